@@ -0,0 +1,306 @@
+#include <sys/resource.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+#include "main.h"
+
+/**
+ * @file bench.cpp
+ * @brief This file contains the host benchmarks for the path, geometry and trajectory kernels.
+ * @details The inputs are the paths skills() and SAWP() record when they're dry run the way the
+ * preview task runs them, so the kernels see the same points they see on the brain. Each kernel
+ * reports ns per point, heap allocations and the peak heap it holds for one pass over its input.
+ * --save writes the results as a baseline and --compare fails when a kernel gets slower than the
+ * tolerance allows or allocates more than the baseline did. Times are compared relative to a fixed
+ * reference loop so the baseline survives a slower or busier machine.
+ */
+
+//
+// Heap accounting
+//
+
+// Every allocation carries its size in front so frees can be subtracted from the live total. Kept
+// out of line, GCC misreads the header arithmetic once they're inlined into a caller
+static const size_t HEADER = alignof(std::max_align_t);
+static size_t heap_allocations = 0;
+static size_t heap_live = 0;
+static size_t heap_peak = 0;
+
+__attribute__((noinline)) void* operator new(size_t size) {
+    char* block = (char*)malloc(size + HEADER);
+    if (!block) throw std::bad_alloc();
+    *(size_t*)block = size;
+    heap_allocations++;
+    heap_live += size;
+    if (heap_live > heap_peak) heap_peak = heap_live;
+    return block + HEADER;
+}
+
+__attribute__((noinline)) void operator delete(void* pointer) noexcept {
+    if (!pointer) return;
+    char* block = (char*)pointer - HEADER;
+    heap_live -= *(size_t*)block;
+    free(block);
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete[](void* pointer) noexcept { operator delete(pointer); }
+void operator delete(void* pointer, size_t) noexcept { operator delete(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { operator delete(pointer); }
+
+//
+// Kernels
+//
+
+class Result {
+    public:
+        std::string kernel;
+        std::string input;
+        size_t points = 0;  // per pass
+        double ns_per_point = 0;
+        size_t allocations = 0;  // per pass
+        size_t peak_bytes = 0;   // per pass, above what was live before it
+};
+
+// A pass returns how many points it handled and something derived from them, so nothing is
+// optimised away
+class Case {
+    public:
+        std::string kernel;
+        std::string input;
+        std::function<double(size_t& points)> pass;
+};
+
+static const int BENCH_ROUNDS = 9;
+static const double BENCH_ROUND_NS = 4e6;
+static const int BENCH_RETRIES = 2;  // reruns of a kernel that looks slower before it counts
+static volatile double sink;
+
+// CPU time of this thread, so time spent preempted doesn't count against a kernel
+static double thread_ns() {
+    timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+static Result measure(const Case& bench) {
+    Result result = {bench.kernel, bench.input};
+    const auto& pass = bench.pass;
+    sink = sink + pass(result.points);  // warm up
+
+    size_t allocations = heap_allocations, live = heap_live;
+    heap_peak = heap_live;
+    sink = sink + pass(result.points);
+    result.allocations = heap_allocations - allocations;
+    result.peak_bytes = heap_peak - live;
+
+    // Each round repeats until it's well above the clock's resolution. The fastest round is the
+    // one least disturbed by the rest of the machine
+    result.ns_per_point = INFINITY;
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        size_t points = 0;
+        double start = thread_ns(), elapsed = 0;
+        while (elapsed < BENCH_ROUND_NS) {
+            size_t handled = 0;
+            sink = sink + pass(handled);
+            points += handled;
+            elapsed = thread_ns() - start;
+        }
+        if (points) result.ns_per_point = fmin(result.ns_per_point, elapsed / points);
+    }
+    if (std::isinf(result.ns_per_point)) result.ns_per_point = 0;
+    return result;
+}
+
+// Fixed arithmetic timed next to every kernel. Comparisons scale the baseline by how much this moved,
+// so a machine that's running slower as a whole doesn't read as every kernel regressing
+static const Case REFERENCE = {"reference", "-", [](size_t& points) {
+    double total = 0;
+    for (int i = 0; i < 64; i++) {
+        double x = i * 0.1;
+        total += sqrt(x * x + 1) + atan2(x, 1) + sin(x);
+    }
+    points = 64;
+    return total;
+}};
+
+// The path an auton records when it's dry run, same as the preview task
+static std::vector<Coordinate> record(void (*auton)()) {
+    currentPoint = {};
+    autonPath.clear();
+    dry_run_begin(false);
+    auton();
+    dry_run_end();
+    return autonPath.to_vector();
+}
+
+// The path has to outlive the cases
+static void add_path(std::vector<Case>& cases, const std::string& input, const std::vector<Coordinate>& path) {
+    cases.push_back({"get_distance", input, [&](size_t& points) {
+        double total = 0;
+        for (size_t i = 1; i < path.size(); i++) total += get_distance(path[i - 1], path[i]);
+        points = path.size() - 1;
+        return total;
+    }});
+    cases.push_back({"get_theta", input, [&](size_t& points) {
+        double total = 0;
+        for (size_t i = 1; i < path.size(); i++) total += get_theta(path[i - 1], path[i], fwd);
+        points = path.size() - 1;
+        return total;
+    }});
+    cases.push_back({"get_point", input, [&](size_t& points) {
+        double total = 0;
+        for (const Coordinate& point : path) total += get_point(point, 1).x;
+        points = path.size();
+        return total;
+    }});
+    cases.push_back({"get_point_arc", input, [&](size_t& points) {
+        double total = 0;
+        for (const Coordinate& point : path) total += get_point(point, 30, 50, 0.05).x;
+        points = path.size();
+        return total;
+    }});
+    // Per injected point, the segments are the ones injectPath hands it
+    cases.push_back({"injectPoint", input, [&](size_t& points) {
+        double total = 0;
+        points = 0;
+        for (size_t i = 1; i < path.size(); i++) {
+            const Coordinate& end = path[i];
+            std::vector<Coordinate> segment = injectPoint(path[i - 1], end, end.behavior, end.left, end.right, end.t, 1);
+            points += segment.size();
+            if (!segment.empty()) total += segment.back().x;
+        }
+        return total;
+    }});
+    cases.push_back({"injectPath", input, [&](size_t& points) {
+        std::vector<Coordinate> injected = injectPath(path, 1);
+        points = injected.size();
+        return injected.back().x;
+    }});
+    // One profile per leg of the path, sampled every 10 ms like the profile task
+    cases.push_back({"SCurveProfile", input, [&](size_t& points) {
+        double total = 0;
+        points = 0;
+        for (size_t i = 1; i < path.size(); i++) {
+            SCurveProfile profile(get_distance(path[i - 1], path[i]), 60, drive_profile_limits.acceleration, drive_profile_limits.jerk);
+            for (double t = 0; t < profile.duration(); t += 0.01, points++) total += profile.at_time(t).velocity;
+        }
+        return total;
+    }});
+}
+
+//
+// Baselines
+//
+
+static std::string key(const Result& result) { return result.kernel + " " + result.input; }
+
+static bool save(const char* path, const std::vector<Result>& results) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+    fprintf(file, "# kernel input points ns_per_point allocations peak_bytes\n");
+    for (const Result& r : results) fprintf(file, "%s %s %zu %.2f %zu %zu\n", r.kernel.c_str(), r.input.c_str(), r.points, r.ns_per_point, r.allocations, r.peak_bytes);
+    return fclose(file) == 0;
+}
+
+static bool load(const char* path, std::map<std::string, Result>& baseline) {
+    FILE* file = fopen(path, "r");
+    if (!file) return false;
+    char line[256], kernel[64], input[64];
+    while (fgets(line, sizeof(line), file)) {
+        Result r;
+        if (line[0] == '#' || sscanf(line, "%63s %63s %zu %lf %zu %zu", kernel, input, &r.points, &r.ns_per_point, &r.allocations, &r.peak_bytes) != 6) continue;
+        r.kernel = kernel;
+        r.input = input;
+        baseline[key(r)] = r;
+    }
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* save_path = nullptr;
+    const char* compare_path = nullptr;
+    double tolerance = 0.25;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--save") == 0 && i + 1 < argc) save_path = argv[++i];
+        else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc) compare_path = argv[++i];
+        else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) tolerance = atof(argv[++i]) / 100;
+        else {
+            fprintf(stderr, "usage: %s [--save FILE] [--compare FILE] [--tolerance PERCENT]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    default_constants();
+    std::vector<Coordinate> skills_path = record(skills), sawp_path = record(SAWP);
+    std::vector<Case> cases;
+    add_path(cases, "skills", skills_path);
+    add_path(cases, "SAWP", sawp_path);
+
+    std::map<std::string, Result> baseline;
+    if (compare_path && !load(compare_path, baseline)) {
+        fprintf(stderr, "can't read baseline %s\n", compare_path);
+        return 2;
+    }
+
+    // Kernels are saved against the reference they were timed next to
+    auto base_reference = baseline.find(REFERENCE.kernel + " " + REFERENCE.input);
+    double reference_ns = base_reference == baseline.end() ? 0 : base_reference->second.ns_per_point;
+
+    int regressions = 0;
+    std::vector<Result> results;
+    double reference_total = 0;
+    printf("%-14s %-7s %7s %11s %7s %11s\n", "kernel", "input", "points", "ns/point", "allocs", "peak bytes");
+    for (const Case& bench : cases) {
+        Result r = measure(bench);
+        double reference = measure(REFERENCE).ns_per_point;
+        auto base = baseline.find(key(r));
+        bool compared = compare_path && base != baseline.end() && reference_ns > 0;
+        auto allowed = [&]() { return base->second.ns_per_point * reference / reference_ns * (1 + tolerance); };
+        for (int retry = 0; compared && retry < BENCH_RETRIES && r.ns_per_point > allowed(); retry++) {
+            r.ns_per_point = fmin(r.ns_per_point, measure(bench).ns_per_point);
+            reference = fmin(reference, measure(REFERENCE).ns_per_point);
+        }
+        results.push_back(r);
+        reference_total += reference;
+
+        printf("%-14s %-7s %7zu %11.2f %7zu %11zu", r.kernel.c_str(), r.input.c_str(), r.points, r.ns_per_point, r.allocations, r.peak_bytes);
+        if (compare_path && !compared) printf("  new");
+        else if (compared) {
+            const Result& b = base->second;
+            bool slower = r.ns_per_point > allowed();
+            bool heavier = r.allocations > b.allocations || r.peak_bytes > b.peak_bytes;
+            double scaled = b.ns_per_point * reference / reference_ns;
+            printf("  %+6.1f%%%s%s", (r.ns_per_point / scaled - 1) * 100, slower ? " SLOWER" : "", heavier ? " MORE HEAP" : "");
+            regressions += slower || heavier;
+        }
+        printf("\n");
+    }
+    Result reference = {REFERENCE.kernel, REFERENCE.input, 64, cases.empty() ? 0 : reference_total / cases.size()};
+    results.push_back(reference);
+    printf("%-14s %-7s %7zu %11.2f", reference.kernel.c_str(), reference.input.c_str(), reference.points, reference.ns_per_point);
+    if (reference_ns > 0) printf("  %+6.1f%% machine speed, kernels scaled by it", (reference.ns_per_point / reference_ns - 1) * 100);
+    printf("\n");
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    printf("peak RSS %ld KB\n", usage.ru_maxrss);
+
+    if (save_path && !save(save_path, results)) {
+        fprintf(stderr, "can't write baseline %s\n", save_path);
+        return 2;
+    }
+    if (regressions) {
+        printf("%d regression%s against %s\n", regressions, regressions == 1 ? "" : "s", compare_path);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,64 @@
+################################################################################
+# Host build: drive, controls, the autons and the rest of the non-UI code, compiled for Linux
+# against the stand-ins in host/include. Run from the project root with `make host`, then
+# host/bin/autons [-v] [-s [--trace FILE]] [auton name...], -s for the drive dynamics simulation.
+# `make host-bench` runs the kernel benchmarks against host/bench/baseline.txt, `make host-test` the
+# tests in host/test
+################################################################################
+
+HOSTDIR:=host
+HOSTBIN:=$(HOSTDIR)/bin
+HOSTCXX?=g++
+
+# Everything in src except the screen, its image cache and bindings, and main.cpp
+HOST_SRC:=autons autotune bindings config controls ctrlscreen drive ekf feedforward gains latency \
+	motionlog odometry preview profile recorder relocalize sdwriter startup telemetry
+HOST_OBJ:=$(addprefix $(HOSTBIN)/obj/src/,$(addsuffix .o,$(HOST_SRC)))
+HOST_MOCK_OBJ:=$(patsubst $(HOSTDIR)/%.cpp,$(HOSTBIN)/obj/%.o,$(wildcard $(HOSTDIR)/mock/*.cpp))
+HOST_TEST_OBJ:=$(patsubst $(HOSTDIR)/%.cpp,$(HOSTBIN)/obj/%.o,$(wildcard $(HOSTDIR)/test/*.cpp))
+
+# The project headers include "api.h" and "pros/..." with quotes, which finds the real ones
+# sitting next to them before any -I path. Compiling against copies keeps the stand-ins in front
+HOST_STAGE:=$(HOSTBIN)/include
+HOST_HEADERS:=$(patsubst include/%,$(HOST_STAGE)/%,$(wildcard include/*.hpp) include/main.h)
+
+HOST_CXXFLAGS:=-std=gnu++20 -O2 -g -Wall -Wno-unused-variable -Wno-unused-but-set-variable -Wno-sign-compare \
+	-Wno-deprecated-enum-enum-conversion -Wno-unknown-pragmas -MMD -MP \
+	-I$(HOSTDIR)/include -I$(HOST_STAGE) -Iinclude
+
+.PHONY: all bench test clean
+all: $(HOSTBIN)/autons $(HOSTBIN)/bench $(HOSTBIN)/tests
+
+$(HOSTBIN)/autons: $(HOST_OBJ) $(HOST_MOCK_OBJ) $(HOSTBIN)/obj/main.o
+	$(HOSTCXX) -o $@ $^
+
+$(HOSTBIN)/bench: $(HOST_OBJ) $(HOST_MOCK_OBJ) $(HOSTBIN)/obj/bench/bench.o
+	$(HOSTCXX) -o $@ $^
+
+$(HOSTBIN)/tests: $(HOST_OBJ) $(HOST_MOCK_OBJ) $(HOST_TEST_OBJ)
+	$(HOSTCXX) -o $@ $^
+
+test: $(HOSTBIN)/tests
+	$<
+
+# Fails when a kernel is slower than the baseline allows or uses more heap. Timings are scaled by
+# a reference loop, but a different CPU can still shift kernels unevenly, rerun with --save then
+bench: $(HOSTBIN)/bench
+	$< --compare $(HOSTDIR)/bench/baseline.txt
+
+$(HOST_STAGE)/%: include/%
+	@mkdir -p $(dir $@)
+	cp $< $@
+
+$(HOSTBIN)/obj/src/%.o: src/%.cpp | $(HOST_HEADERS)
+	@mkdir -p $(dir $@)
+	$(HOSTCXX) $(HOST_CXXFLAGS) -c $< -o $@
+
+$(HOSTBIN)/obj/%.o: $(HOSTDIR)/%.cpp | $(HOST_HEADERS)
+	@mkdir -p $(dir $@)
+	$(HOSTCXX) $(HOST_CXXFLAGS) -c $< -o $@
+
+clean:
+	rm -rf $(HOSTBIN)
+
+-include $(HOST_OBJ:.o=.d) $(HOST_MOCK_OBJ:.o=.d) $(HOST_TEST_OBJ:.o=.d) $(HOSTBIN)/obj/main.d $(HOSTBIN)/obj/bench/bench.d
@@ -0,0 +1,14 @@
+#pragma once
+
+// Host build replacement for EZ-Template's api.hpp. The value types, PID, pistons and tracking
+// wheels are the real headers, the drive is the stand-in next to this file. The selector and SD
+// card helpers aren't used off the brain
+#include "EZ-Template/PID.hpp"
+#include "EZ-Template/drive/drive.hpp"
+#include "EZ-Template/piston.hpp"
+#include "EZ-Template/slew.hpp"
+#include "EZ-Template/tracking_wheel.hpp"
+#include "EZ-Template/util.hpp"
+
+// auton_selector.hpp brings this in on the brain, and the project headers lean on it
+using namespace std;
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "EZ-Template/PID.hpp"
+#include "EZ-Template/tracking_wheel.hpp"
+#include "EZ-Template/util.hpp"
+#include "host/sim.hpp"
+#include "okapi/api/units/QAngle.hpp"
+#include "okapi/api/units/QLength.hpp"
+#include "okapi/api/units/QTime.hpp"
+#include "pros/motors.hpp"
+
+using namespace ez;
+
+// Host stand-in for ez::Drive. It has the same calls the project makes. By default there's no
+// control loop: a motion is recorded when it's set, and the pid_wait calls jump the pose to where
+// the motion ends and move the virtual clock by how long the robot would take at the motion's speed
+// cap. With simulate_set(true) the motions run EZ-Template style PID every 10 ms against
+// host::DriveSim instead, for as long as the clock moves, pros::delay included
+namespace ez {
+
+class Drive {
+    public:
+        Drive(std::vector<int> left_motor_ports, std::vector<int> right_motor_ports, int imu_port, double wheel_diameter, double ticks, double ratio = 1.0);
+
+        // Same members the real drive exposes
+        tracking_wheel* odom_tracker_left = nullptr;
+        tracking_wheel* odom_tracker_right = nullptr;
+        tracking_wheel* odom_tracker_front = nullptr;
+        tracking_wheel* odom_tracker_back = nullptr;
+        PID turnPID;
+        PID leftPID;
+        PID rightPID;
+        PID headingPID;
+        PID swingPID;
+        PID xyPID;
+        PID current_a_odomPID;  // the angular or boomerang PID, copied as an odom motion starts
+        PID odom_angularPID;
+        PID boomerangPID;
+
+        // Motion model, set by the host
+        double track_width = 11;      // in
+        double top_speed;             // in/s at full power, from the wheel size and rpm
+        double settle_time = 0.1;     // s added to a pid_wait, pid_wait_quick adds half
+        double chain_time = 0;        // s added to a pid_wait_quick_chain
+
+        // Dynamics, set up from the constructor's wheel size, rpm and motor count
+        host::DriveSim sim;
+        double motion_timeout = 10;   // s a simulated wait gives a motion that never exits
+        std::vector<std::function<void()>> tasks;  // one tick of each brain task, run ahead of every control tick
+        double left_travel = 0;       // in each side's encoders read, moved by the simulator or the host
+        double right_travel = 0;
+        void simulate_set(bool enabled);
+        bool simulate_get();
+
+        // Modes and limits
+        void drive_mode_set(e_mode p_mode, bool stop_drive = true);
+        e_mode drive_mode_get();
+        void drive_set(int left, int right);
+        void drive_brake_set(pros::motor_brake_mode_e_t brake_type);
+        void pid_speed_max_set(int speed);
+        int pid_speed_max_get();
+        void pid_angle_behavior_set(e_angle_behavior behavior);
+        void pid_targets_reset();
+        bool pid_tuner_enabled();
+
+        // Sensors
+        double drive_imu_get();
+        void drive_imu_reset(double new_heading = 0);
+        double drive_sensor_left();
+        double drive_sensor_right();
+        void drive_sensor_reset();
+
+        // Odometry
+        double odom_x_get();
+        double odom_y_get();
+        double odom_theta_get();
+        pose odom_pose_get();
+        void odom_x_set(double x);
+        void odom_x_set(okapi::QLength p_x);
+        void odom_y_set(double y);
+        void odom_y_set(okapi::QLength p_y);
+        void odom_theta_set(double a);
+        void odom_xyt_set(double x, double y, double t);
+        void odom_xyt_set(okapi::QLength p_x, okapi::QLength p_y, okapi::QAngle p_t);
+        void odom_turn_bias_set(double bias);
+        void odom_look_ahead_set(double distance);
+        void odom_boomerang_distance_set(double distance);
+        void odom_boomerang_dlead_set(double input);
+
+        // Constants
+        void pid_drive_constants_set(double p, double i = 0.0, double d = 0.0, double p_start_i = 0.0);
+        void pid_heading_constants_set(double p, double i = 0.0, double d = 0.0, double p_start_i = 0.0);
+        void pid_turn_constants_set(double p, double i = 0.0, double d = 0.0, double p_start_i = 0.0);
+        void pid_swing_constants_set(double p, double i = 0.0, double d = 0.0, double p_start_i = 0.0);
+        void pid_odom_angular_constants_set(double p, double i = 0.0, double d = 0.0, double p_start_i = 0.0);
+        void pid_odom_boomerang_constants_set(double p, double i = 0.0, double d = 0.0, double p_start_i = 0.0);
+        PID::Constants pid_drive_constants_get();
+        PID::Constants pid_turn_constants_get();
+        PID::Constants pid_swing_constants_get();
+        void pid_turn_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout, bool use_imu = true);
+        void pid_swing_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout, bool use_imu = true);
+        void pid_drive_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout, bool use_imu = true);
+        void pid_odom_turn_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout, bool use_imu = true);
+        void pid_odom_drive_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout, bool use_imu = true);
+        void pid_turn_chain_constant_set(double input);
+        void pid_swing_chain_constant_set(double input);
+        void pid_drive_chain_constant_set(double input);
+        void slew_turn_constants_set(okapi::QAngle distance, int min_speed);
+        void slew_drive_constants_set(okapi::QLength distance, int min_speed);
+        void slew_swing_constants_set(okapi::QLength distance, int min_speed);
+
+        // Motions
+        void pid_drive_set(double target, int speed, bool slew_on = false, bool toggle_heading = true);
+        void pid_drive_set(okapi::QLength p_target, int speed, bool slew_on = false, bool toggle_heading = true);
+        void pid_odom_set(double target, int speed, bool slew_on = false);
+        void pid_odom_set(okapi::QLength p_target, int speed, bool slew_on = false);
+        void pid_odom_set(odom imovement, bool slew_on = false);
+        void pid_odom_set(united_odom p_imovement, bool slew_on = false);
+        void pid_odom_boomerang_set(odom imovement, bool slew_on = false);
+        void pid_odom_boomerang_set(united_odom p_imovement, bool slew_on = false);
+        void pid_turn_set(double target, int speed, e_angle_behavior behavior = shortest, bool slew_on = false);
+        void pid_turn_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior = shortest, bool slew_on = false);
+        void pid_turn_set(double target, int speed, bool slew_on);
+        void pid_turn_set(okapi::QAngle p_target, int speed, bool slew_on);
+        void pid_turn_set(pose itarget, drive_directions dir, int speed, e_angle_behavior behavior = shortest, bool slew_on = false);
+        void pid_turn_set(united_pose p_itarget, drive_directions dir, int speed, e_angle_behavior behavior = shortest, bool slew_on = false);
+        void pid_turn_relative_set(double target, int speed, e_angle_behavior behavior = shortest, bool slew_on = false);
+        void pid_turn_relative_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior = shortest, bool slew_on = false);
+        void pid_swing_set(e_swing type, double target, int speed, int opposite_speed = 0, e_angle_behavior behavior = shortest, bool slew_on = false);
+        void pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed = 0, e_angle_behavior behavior = shortest, bool slew_on = false);
+        void pid_swing_set(e_swing type, double target, int speed, e_angle_behavior behavior, bool slew_on = false);
+        void pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on = false);
+        void pid_swing_relative_set(e_swing type, double target, int speed, e_angle_behavior behavior = shortest);
+        void pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior = shortest);
+
+        // Waits
+        void pid_wait();
+        void pid_wait_quick();
+        void pid_wait_quick_chain();
+        void pid_wait_until(double target);
+        void pid_wait_until(okapi::QLength target);
+        void pid_wait_until(okapi::QAngle target);
+        void pid_wait_until(pose target);
+        void pid_wait_until(united_pose target);
+
+    private:
+        // Where the motion that was last set ends, and how long it takes at its speed cap
+        class Motion {
+            public:
+                pose end = {0, 0, 0};
+                double left = 0;   // in each side travels
+                double right = 0;
+                double seconds = 0;
+                bool pending = false;
+
+                // What the simulated control loop needs
+                bool active = false;
+                const char* action = "";
+                uint64_t start_time = 0;  // us
+                double start_left = 0;
+                double start_right = 0;
+                double start_theta = 0;
+                double heading = 0;       // held through a drive
+                pose target = {0, 0, 0};  // odom motions
+                drive_directions direction = FWD;
+                bool boomerang = false;
+                e_swing swing = LEFT_SWING;
+                int opposite_speed = 0;
+                bool slew = false;        // drives only
+                exit_output exit = RUNNING;
+                exit_output left_exit = RUNNING;
+                exit_output right_exit = RUNNING;
+        };
+
+        void motion_set(e_mode mode, const char* action, std::vector<double> values, pose end, double left, double right, int speed);
+        void motion_finish(double extra);
+        double turn_delta(double target, e_angle_behavior behavior);
+        void turn_to(double target, int speed, e_angle_behavior behavior, const char* action);
+        void swing_to(e_swing type, double target, int speed, int opposite_speed, e_angle_behavior behavior, const char* action);
+        void odom_to(pose target, drive_directions dir, int speed, bool boomerang, const char* action);
+
+        void simulate_to(uint64_t from, uint64_t to);
+        void control();
+        double chain_error();
+        void sim_wait(const char* wait, std::function<bool()> reached);
+        bool passed(double target);
+        bool passed(pose target);
+
+        pose position = {0, 0, 0};
+        e_mode mode = DISABLE;
+        int speed_max = 127;
+        e_angle_behavior default_behavior = raw;
+        Motion motion;
+        bool simulate = false;
+        double turn_chain = 0;  // deg
+        double swing_chain = 0;
+        double drive_chain = 0;  // in
+        double slew_drive_distance = 0;  // in EZ's linear slew ramps over
+        int slew_drive_speed = 0;        // speed it ramps up from
+        double boomerang_dlead = 0.625;
+};
+
+}  // namespace ez
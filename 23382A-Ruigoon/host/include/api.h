@@ -0,0 +1,26 @@
+#pragma once
+
+/**
+ * Host build replacement for the PROS api.h. Pulls in the stand-ins in host/include/pros instead
+ * of the real headers, which would need the PROS kernel to link against.
+ */
+
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+#include "liblvgl/lvgl.h"
+#include "pros/adi.hpp"
+#include "pros/colors.h"
+#include "pros/distance.hpp"
+#include "pros/error.h"
+#include "pros/imu.hpp"
+#include "pros/misc.hpp"
+#include "pros/motors.hpp"
+#include "pros/optical.hpp"
+#include "pros/rotation.hpp"
+#include "pros/rtos.hpp"
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Host stand-ins for the brain. Every command sent to a stand-in device lands in one log stamped
+// with a virtual clock. pros::delay moves the clock instead of sleeping, so an auton that takes
+// fifteen seconds on the field runs in a few microseconds here
+namespace host {
+
+class Command {
+    public:
+        uint64_t time;       // us on the virtual clock
+        std::string device;  // "motor 11", "piston H", "chassis", "controller"...
+        std::string action;  // the call that was made
+        std::vector<double> values;
+        std::string text;    // for calls that take a string, like set_text
+};
+
+uint64_t now();  // us
+void advance(uint64_t us);
+void advance_to(uint64_t us);  // never goes backwards
+// Called with the span every time the clock moves forward, so a simulated drive keeps pace with it
+void clock_hook_set(std::function<void(uint64_t from, uint64_t to)> hook);
+
+void record(const std::string& device, const std::string& action, std::vector<double> values = {}, const std::string& text = "");
+const std::vector<Command>& commands();
+size_t count(const std::string& device, const std::string& action = "");  // matching commands in the log
+void reset();  // clears the log and winds the clock back to zero
+
+std::string format(const Command& command);
+std::string port_name(int port);  // smart ports as numbers, three wire ports as letters
+
+}  // namespace host
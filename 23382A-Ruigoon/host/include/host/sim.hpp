@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "EZ-Template/util.hpp"
+
+// Differential drive dynamics for the host. Each side is a group of V5 motors on the blue
+// cartridge geared down to the wheels, pushing a rigid robot that rolls along its heading and drags
+// its wheels sideways when it turns. A side that pushes harder than its wheels can grip spins them
+// past the ground, and the encoders count the spin. Poses are inches and degrees, clockwise
+// positive, like the rest of the project
+namespace host {
+
+class DriveModel {
+    public:
+        double mass = 6.8;             // kg, about 15 lb
+        double inertia = 0.15;         // kg m^2 about the turning center
+        double track_width = 11;       // in
+        double wheel_diameter = 3.25;  // in
+        double wheel_rpm = 450;        // with the motors free
+        int motors_per_side = 3;
+        double cartridge_rpm = 600;    // blue, free speed at the cartridge output
+        double stall_torque = 0.35;    // Nm per motor at the cartridge output, the current limit caps it there
+        double rolling = 0.03;         // rolling resistance, fraction of the robot's weight
+        double scrub = 0.3;            // sideways wheel friction while turning, fraction of the robot's weight
+        double scrub_arm = 3;          // in, how far the wheels sit from the turning center along the robot
+        double traction = 0.7;         // most a side can push before its wheels slip, fraction of the weight on it
+};
+
+// One sample per control tick
+class TracePoint {
+    public:
+        uint64_t time;  // us on the virtual clock
+        ez::pose pose;
+        double left_velocity;  // in/s
+        double right_velocity;
+        double left_voltage;   // -127 to 127
+        double right_voltage;
+};
+
+class DriveSim {
+    public:
+        DriveModel model;
+        double left_velocity = 0;  // in/s
+        double right_velocity = 0;
+        double left_voltage = 0;   // -127 to 127, the same scale the drive's PID outputs are on
+        double right_voltage = 0;
+        bool brake = true;         // zero output shorts the motors, false lets them coast
+        double slip = 0;           // in the wheels have spun past the ground, both sides summed
+        std::vector<TracePoint> trace;
+
+        // Moves the pose and the distance each side has rolled on by dt seconds
+        void step(double dt, ez::pose& position, double& left_travel, double& right_travel);
+        void sample(uint64_t time, const ez::pose& position);
+        void stop();  // at rest with no output, for placing the robot
+};
+
+}  // namespace host
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+// Host build: the screen isn't built, but the project headers name a few LVGL types
+typedef struct _lv_obj_t lv_obj_t;
+
+typedef union {
+    struct {
+        uint8_t blue;
+        uint8_t green;
+        uint8_t red;
+        uint8_t alpha;
+    } ch;
+    uint32_t full;
+} lv_color32_t;
+
+inline lv_color32_t lv_color_hex(uint32_t c) {
+    lv_color32_t color;
+    color.full = c | 0xff000000;
+    return color;
+}
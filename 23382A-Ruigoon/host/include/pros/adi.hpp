@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include "host/mock.hpp"
+
+// Host stand-in for the three wire ports, enough for EZ-Template's pistons and tracking wheels
+namespace pros {
+
+typedef std::pair<uint8_t, uint8_t> ext_adi_port_pair_t;
+typedef std::tuple<uint8_t, uint8_t, uint8_t> ext_adi_port_tuple_t;
+
+namespace adi {
+
+class DigitalOut {
+    public:
+        DigitalOut(uint8_t adi_port, bool init_state = false) : port(adi_port), state(init_state) {}
+        DigitalOut(ext_adi_port_pair_t port_pair, bool init_state = false) : port(port_pair.second), state(init_state) {}
+
+        int32_t set_value(int32_t value) {
+            host::record("piston " + host::port_name(port), "set_value", {(double)value});
+            state = value;
+            return 1;
+        }
+
+        uint8_t port;
+        bool state;
+};
+
+class Encoder {
+    public:
+        Encoder(uint8_t adi_port_top, uint8_t adi_port_bottom, bool reverse = false) {}
+        Encoder(ext_adi_port_tuple_t port_tuple, bool reverse = false) {}
+
+        int32_t get_value() const { return value; }
+        int32_t reset() {
+            value = 0;
+            return 1;
+        }
+
+        // Set by the host or a simulator
+        int32_t value = 0;  // ticks
+};
+
+}  // namespace adi
+}  // namespace pros
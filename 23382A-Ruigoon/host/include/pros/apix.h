@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+// Host stand-in for the serial controls, stdout is already raw on the host so these do nothing
+#define SERCTL_ACTIVATE 10
+#define SERCTL_DEACTIVATE 11
+#define SERCTL_BLKWRITE 12
+#define SERCTL_NOBLKWRITE 13
+#define SERCTL_ENABLE_COBS 14
+#define SERCTL_DISABLE_COBS 15
+
+namespace pros {
+namespace c {
+inline int32_t serctl(const uint32_t action, void* const extra_arg) { return 1; }
+inline int32_t fdctl(int file, const uint32_t action, void* const extra_arg) { return 1; }
+}  // namespace c
+}  // namespace pros
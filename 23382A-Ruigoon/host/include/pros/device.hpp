@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+// Host stand-in for the smart port base class, only the port is kept
+namespace pros {
+inline namespace v5 {
+
+class Device {
+    public:
+        explicit Device(uint8_t port) : port(port) {}
+        uint8_t get_port() const { return port; }
+        bool is_installed() const { return true; }
+
+    protected:
+        uint8_t port;
+};
+
+}  // namespace v5
+}  // namespace pros
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include "pros/device.hpp"
+#include "pros/error.h"
+
+// Host stand-in for the distance sensor. Readings are members the host (or a simulator) sets, the
+// default is no object in range
+namespace pros {
+inline namespace v5 {
+
+class Distance : public Device {
+    public:
+        explicit Distance(uint8_t port) : Device(port) {}
+
+        int32_t get() const { return distance; }
+        int32_t get_distance() const { return distance; }
+        int32_t get_confidence() const { return confidence; }
+        int32_t get_object_size() const { return object_size; }
+        double get_object_velocity() const { return 0; }
+
+        // Set by the host or a simulator
+        int32_t distance = PROS_ERR;  // mm
+        int32_t confidence = 0;       // 0-63
+        int32_t object_size = 0;
+};
+
+}  // namespace v5
+}  // namespace pros
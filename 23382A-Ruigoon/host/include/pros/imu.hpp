@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include "host/mock.hpp"
+#include "pros/device.hpp"
+
+// Host stand-in for the inertial sensor. Readings are members the host (or a simulator) sets
+namespace pros {
+
+typedef struct imu_raw_s {
+    double x;
+    double y;
+    double z;
+    double w;
+} imu_raw_s;
+typedef struct imu_raw_s imu_gyro_s_t;
+typedef struct imu_raw_s imu_accel_s_t;
+
+inline namespace v5 {
+
+class Imu : public Device {
+    public:
+        explicit Imu(uint8_t port) : Device(port) {}
+
+        int32_t reset(bool blocking = false) {
+            host::record("imu " + host::port_name(port), "reset");
+            rotation = 0;
+            return 1;
+        }
+        bool is_calibrating() const { return false; }
+        double get_rotation() const { return rotation; }
+        double get_heading() const {
+            double heading = std::fmod(rotation, 360.0);
+            return heading < 0 ? heading + 360 : heading;
+        }
+        int32_t set_rotation(double target) {
+            rotation = target;
+            return 1;
+        }
+        imu_gyro_s_t get_gyro_rate() const { return gyro; }
+        imu_accel_s_t get_accel() const { return accel; }
+
+        // Set by the host or a simulator
+        double rotation = 0;  // degrees, clockwise positive
+        imu_gyro_s_t gyro = {0, 0, 0, 0};    // degrees per second
+        imu_accel_s_t accel = {0, 0, 0, 0};  // g
+};
+
+}  // namespace v5
+}  // namespace pros
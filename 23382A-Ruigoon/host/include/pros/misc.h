@@ -0,0 +1,4 @@
+#pragma once
+
+// Host build: the controller, competition and SD stand-ins all live in misc.hpp
+#include "pros/misc.hpp"  // IWYU pragma: export
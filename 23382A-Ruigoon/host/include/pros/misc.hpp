@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "host/mock.hpp"
+
+// Host stand-in for the controller, competition state and SD card. Inputs are plain members the
+// host sets before calling the code under test; text and rumbles are recorded
+namespace pros {
+
+typedef enum { E_CONTROLLER_MASTER = 0, E_CONTROLLER_PARTNER } controller_id_e_t;
+
+typedef enum {
+    E_CONTROLLER_ANALOG_LEFT_X = 0,
+    E_CONTROLLER_ANALOG_LEFT_Y,
+    E_CONTROLLER_ANALOG_RIGHT_X,
+    E_CONTROLLER_ANALOG_RIGHT_Y
+} controller_analog_e_t;
+
+typedef enum {
+    E_CONTROLLER_DIGITAL_L1 = 6,
+    E_CONTROLLER_DIGITAL_L2,
+    E_CONTROLLER_DIGITAL_R1,
+    E_CONTROLLER_DIGITAL_R2,
+    E_CONTROLLER_DIGITAL_UP,
+    E_CONTROLLER_DIGITAL_DOWN,
+    E_CONTROLLER_DIGITAL_LEFT,
+    E_CONTROLLER_DIGITAL_RIGHT,
+    E_CONTROLLER_DIGITAL_X,
+    E_CONTROLLER_DIGITAL_B,
+    E_CONTROLLER_DIGITAL_Y,
+    E_CONTROLLER_DIGITAL_A
+} controller_digital_e_t;
+
+#ifdef PROS_USE_SIMPLE_NAMES
+#define CONTROLLER_MASTER pros::E_CONTROLLER_MASTER
+#define CONTROLLER_PARTNER pros::E_CONTROLLER_PARTNER
+#define ANALOG_LEFT_X pros::E_CONTROLLER_ANALOG_LEFT_X
+#define ANALOG_LEFT_Y pros::E_CONTROLLER_ANALOG_LEFT_Y
+#define ANALOG_RIGHT_X pros::E_CONTROLLER_ANALOG_RIGHT_X
+#define ANALOG_RIGHT_Y pros::E_CONTROLLER_ANALOG_RIGHT_Y
+#define DIGITAL_L1 pros::E_CONTROLLER_DIGITAL_L1
+#define DIGITAL_L2 pros::E_CONTROLLER_DIGITAL_L2
+#define DIGITAL_R1 pros::E_CONTROLLER_DIGITAL_R1
+#define DIGITAL_R2 pros::E_CONTROLLER_DIGITAL_R2
+#define DIGITAL_UP pros::E_CONTROLLER_DIGITAL_UP
+#define DIGITAL_DOWN pros::E_CONTROLLER_DIGITAL_DOWN
+#define DIGITAL_LEFT pros::E_CONTROLLER_DIGITAL_LEFT
+#define DIGITAL_RIGHT pros::E_CONTROLLER_DIGITAL_RIGHT
+#define DIGITAL_X pros::E_CONTROLLER_DIGITAL_X
+#define DIGITAL_B pros::E_CONTROLLER_DIGITAL_B
+#define DIGITAL_Y pros::E_CONTROLLER_DIGITAL_Y
+#define DIGITAL_A pros::E_CONTROLLER_DIGITAL_A
+#endif
+
+inline const int CONTROLLER_BUTTONS = 12;
+
+class Controller {
+    public:
+        explicit Controller(controller_id_e_t id) : id(id) {}
+
+        int32_t is_connected() { return connected; }
+        int32_t get_analog(controller_analog_e_t channel) { return analog[channel]; }
+        int32_t get_digital(controller_digital_e_t button) { return digital[button - E_CONTROLLER_DIGITAL_L1]; }
+        int32_t get_digital_new_press(controller_digital_e_t button) {
+            int index = button - E_CONTROLLER_DIGITAL_L1;
+            bool pressed = digital[index] && !reported[index];
+            reported[index] = digital[index];
+            return pressed;
+        }
+        int32_t get_battery_capacity() { return 100; }
+        int32_t get_battery_level() { return 100; }
+
+        int32_t set_text(uint8_t line, uint8_t col, const char* str) {
+            host::record("controller", "set_text", {(double)line, (double)col}, str);
+            return 1;
+        }
+        int32_t set_text(uint8_t line, uint8_t col, const std::string& str) { return set_text(line, col, str.c_str()); }
+        int32_t clear_line(uint8_t line) {
+            host::record("controller", "clear_line", {(double)line});
+            return 1;
+        }
+        int32_t clear() {
+            host::record("controller", "clear");
+            return 1;
+        }
+        int32_t rumble(const char* rumble_pattern) {
+            host::record("controller", "rumble", {}, rumble_pattern);
+            return 1;
+        }
+
+        // Set by the host
+        controller_id_e_t id;
+        bool connected = true;
+        int32_t analog[4] = {0, 0, 0, 0};
+        bool digital[CONTROLLER_BUTTONS] = {};
+
+    private:
+        bool reported[CONTROLLER_BUTTONS] = {};
+};
+
+namespace competition {
+inline bool connected = false;  // set by the host
+inline uint8_t get_status() { return 0; }
+inline uint8_t is_autonomous() { return 0; }
+inline uint8_t is_connected() { return connected; }
+inline uint8_t is_disabled() { return 0; }
+}  // namespace competition
+
+namespace usd {
+inline bool installed = false;  // set by the host, there's no card so the SD writer is never needed
+inline int32_t is_installed() { return installed; }
+}  // namespace usd
+
+namespace battery {
+inline double get_capacity() { return 100; }
+inline int32_t get_voltage() { return 12800; }
+}  // namespace battery
+
+}  // namespace pros
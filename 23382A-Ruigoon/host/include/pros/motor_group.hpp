@@ -0,0 +1,4 @@
+#pragma once
+
+// Host build: the motor stand-ins all live in motors.hpp
+#include "pros/motors.hpp"  // IWYU pragma: export
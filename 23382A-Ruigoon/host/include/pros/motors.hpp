@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+#include "host/mock.hpp"
+#include "pros/error.h"
+#include "pros/rtos.hpp"
+
+// Host stand-in for smart motors. Commands are recorded and kept as the motor's voltage, readings
+// are plain members the host (or a simulator) sets
+namespace pros {
+
+typedef enum motor_brake_mode_e {
+    E_MOTOR_BRAKE_COAST = 0,
+    E_MOTOR_BRAKE_BRAKE = 1,
+    E_MOTOR_BRAKE_HOLD = 2,
+    E_MOTOR_BRAKE_INVALID = INT32_MAX
+} motor_brake_mode_e_t;
+
+#ifdef PROS_USE_SIMPLE_NAMES
+#define MOTOR_BRAKE_COAST pros::E_MOTOR_BRAKE_COAST
+#define MOTOR_BRAKE_BRAKE pros::E_MOTOR_BRAKE_BRAKE
+#define MOTOR_BRAKE_HOLD pros::E_MOTOR_BRAKE_HOLD
+#endif
+
+inline namespace v5 {
+
+enum class MotorGears {
+    ratio_36_to_1 = 0, red = ratio_36_to_1, rpm_100 = ratio_36_to_1,
+    ratio_18_to_1 = 1, green = ratio_18_to_1, rpm_200 = ratio_18_to_1,
+    ratio_6_to_1 = 2, blue = ratio_6_to_1, rpm_600 = ratio_6_to_1,
+    invalid = INT32_MAX
+};
+
+enum class MotorBrake { coast = 0, brake = 1, hold = 2, invalid = INT32_MAX };
+
+enum class MotorUnits { degrees = 0, deg = 0, rotations = 1, counts = 2, invalid = INT32_MAX };
+
+class Motor {
+    public:
+        Motor(int8_t port, MotorGears gearset = MotorGears::green, MotorUnits encoder_units = MotorUnits::degrees) : port(port), gearset(gearset) {}
+
+        int32_t move(int32_t voltage) { return command("move", voltage, voltage * 12000 / 127); }
+        int32_t move_voltage(int32_t voltage) { return command("move_voltage", voltage, voltage); }
+        int32_t move_velocity(int32_t velocity) {
+            host::record(name(), "move_velocity", {(double)velocity});
+            return 1;
+        }
+        int32_t brake() { return command("brake", 0, 0); }
+        int32_t set_brake_mode(motor_brake_mode_e_t mode) {
+            host::record(name(), "set_brake_mode", {(double)mode});
+            brake_mode = mode;
+            return 1;
+        }
+        int32_t set_brake_mode(MotorBrake mode) { return set_brake_mode((motor_brake_mode_e_t)mode); }
+        int32_t tare_position() {
+            position = 0;
+            return 1;
+        }
+
+        int32_t get_voltage() const { return voltage; }
+        double get_actual_velocity() const { return velocity; }
+        double get_position() const { return position; }
+        int32_t get_raw_position(uint32_t* const timestamp) const {
+            if (timestamp) *timestamp = millis();
+            return (int32_t)position;
+        }
+        double get_current_draw() const { return current; }
+        double get_temperature() const { return temperature; }
+        int32_t is_over_temp() const { return temperature >= 55; }
+        motor_brake_mode_e_t get_brake_mode() const { return brake_mode; }
+        MotorGears get_gearing() const { return gearset; }
+        int8_t get_port() const { return port; }
+
+        // Set by the host or a simulator
+        double velocity = 0;      // rpm
+        double position = 0;      // degrees
+        double current = 0;       // mA
+        double temperature = 30;  // C
+        int32_t voltage = 0;      // mV, the last command
+
+    private:
+        std::string name() const { return "motor " + host::port_name(port < 0 ? -port : port); }
+        int32_t command(const char* action, int32_t value, int32_t millivolts) {
+            host::record(name(), action, {(double)value});
+            voltage = millivolts;
+            return 1;
+        }
+        int8_t port;
+        MotorGears gearset;
+        motor_brake_mode_e_t brake_mode = E_MOTOR_BRAKE_COAST;
+};
+
+class MotorGroup {
+    public:
+        MotorGroup(std::initializer_list<int8_t> ports, MotorGears gearset = MotorGears::green, MotorUnits encoder_units = MotorUnits::degrees) {
+            for (int8_t port : ports) motors.emplace_back(port, gearset, encoder_units);
+        }
+        MotorGroup(const std::vector<int8_t>& ports, MotorGears gearset = MotorGears::green, MotorUnits encoder_units = MotorUnits::degrees) {
+            for (int8_t port : ports) motors.emplace_back(port, gearset, encoder_units);
+        }
+
+        int32_t move(int32_t voltage) { return each([=](Motor& motor) { motor.move(voltage); }); }
+        int32_t move_voltage(int32_t voltage) { return each([=](Motor& motor) { motor.move_voltage(voltage); }); }
+        int32_t move_velocity(int32_t velocity) { return each([=](Motor& motor) { motor.move_velocity(velocity); }); }
+        int32_t brake() { return each([](Motor& motor) { motor.brake(); }); }
+        int32_t set_brake_mode_all(motor_brake_mode_e_t mode) { return each([=](Motor& motor) { motor.set_brake_mode(mode); }); }
+        int32_t set_brake_mode(motor_brake_mode_e_t mode) { return set_brake_mode_all(mode); }
+        int32_t tare_position() { return each([](Motor& motor) { motor.tare_position(); }); }
+
+        // Readings come from the first motor, like PROS
+        int32_t get_voltage() const { return motors.empty() ? PROS_ERR : motors[0].get_voltage(); }
+        double get_actual_velocity() const { return motors.empty() ? PROS_ERR_F : motors[0].get_actual_velocity(); }
+        double get_position() const { return motors.empty() ? PROS_ERR_F : motors[0].get_position(); }
+        int32_t get_raw_position(uint32_t* const timestamp) const { return motors.empty() ? PROS_ERR : motors[0].get_raw_position(timestamp); }
+        std::int8_t size() const { return motors.size(); }
+
+        std::vector<Motor> motors;
+
+    private:
+        template <class F>
+        int32_t each(F function) {
+            for (Motor& motor : motors) function(motor);
+            return 1;
+        }
+};
+
+}  // namespace v5
+}  // namespace pros
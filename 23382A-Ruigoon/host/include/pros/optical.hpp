@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include "host/mock.hpp"
+#include "pros/device.hpp"
+
+// Host stand-in for the optical sensor. Readings are members the host (or a simulator) sets
+namespace pros {
+inline namespace v5 {
+
+class Optical : public Device {
+    public:
+        explicit Optical(uint8_t port) : Device(port) {}
+
+        double get_hue() const { return hue; }
+        double get_saturation() const { return saturation; }
+        double get_brightness() const { return brightness; }
+        int32_t get_proximity() const { return proximity; }
+        int32_t set_led_pwm(uint8_t value) {
+            host::record("optical " + host::port_name(port), "set_led_pwm", {(double)value});
+            return 1;
+        }
+        int32_t set_integration_time(double time) { return 1; }
+
+        // Set by the host or a simulator
+        double hue = 0;
+        double saturation = 0;
+        double brightness = 0;
+        int32_t proximity = 0;  // 0-255
+};
+
+}  // namespace v5
+}  // namespace pros
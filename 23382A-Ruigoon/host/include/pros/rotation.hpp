@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include "pros/device.hpp"
+
+// Host stand-in for the rotation sensor, EZ-Template's tracking wheels hold one
+namespace pros {
+inline namespace v5 {
+
+class Rotation : public Device {
+    public:
+        explicit Rotation(int8_t port, bool reverse = false) : Device(port < 0 ? -port : port) {}
+
+        int32_t reset_position() {
+            position = 0;
+            return 1;
+        }
+        int32_t get_position() const { return position; }
+        int32_t get_angle() const { return position % 36000; }
+        int32_t get_velocity() const { return 0; }
+        int32_t set_reversed(bool value) { return 1; }
+
+        // Set by the host or a simulator
+        int32_t position = 0;  // centidegrees
+};
+
+}  // namespace v5
+}  // namespace pros
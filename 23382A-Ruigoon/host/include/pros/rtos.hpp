@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include "host/mock.hpp"
+
+// Host stand-in for the PROS RTOS. There is one thread and a virtual clock: delays move the clock,
+// tasks are recorded but never started, and mutexes always succeed. Host code calls the task
+// bodies it wants to exercise itself
+namespace pros {
+
+inline const uint32_t TASK_PRIORITY_MAX = 16;
+inline const uint32_t TASK_PRIORITY_MIN = 1;
+inline const uint32_t TASK_PRIORITY_DEFAULT = 8;
+inline const uint16_t TASK_STACK_DEPTH_DEFAULT = 0x2000;
+inline const uint16_t TASK_STACK_DEPTH_MIN = 0x200;
+inline const uint32_t TIMEOUT_MAX = UINT32_MAX;
+
+typedef void (*task_fn_t)(void*);
+typedef void* task_t;
+
+namespace c {
+// There's one thread, so every caller is the same task
+inline task_t task_get_current() {
+    static int main_task;
+    return &main_task;
+}
+}  // namespace c
+
+inline uint32_t millis() { return host::now() / 1000; }
+inline uint64_t micros() { return host::now(); }
+inline void delay(uint32_t milliseconds) { host::advance((uint64_t)milliseconds * 1000); }
+
+class Task {
+    public:
+        Task(task_fn_t function, void* parameters = nullptr, uint32_t prio = TASK_PRIORITY_DEFAULT, uint16_t stack_depth = TASK_STACK_DEPTH_DEFAULT, const char* name = "") {
+            create(prio, name);
+        }
+        Task(task_fn_t function, void* parameters, const char* name) { create(TASK_PRIORITY_DEFAULT, name); }
+        template <class F, class = std::enable_if_t<std::is_invocable_r_v<void, F>>>
+        Task(F&& function, uint32_t prio = TASK_PRIORITY_DEFAULT, uint16_t stack_depth = TASK_STACK_DEPTH_DEFAULT, const char* name = "") {
+            create(prio, name);
+        }
+        template <class F, class = std::enable_if_t<std::is_invocable_r_v<void, F>>>
+        Task(F&& function, const char* name) { create(TASK_PRIORITY_DEFAULT, name); }
+
+        static Task current() { return Task(); }
+        static void delay(uint32_t milliseconds) { pros::delay(milliseconds); }
+        static void delay_until(uint32_t* const prev_time, uint32_t delta) {
+            *prev_time += delta;
+            host::advance_to((uint64_t)*prev_time * 1000);
+        }
+
+        void remove() { host::record("task " + name, "remove"); }
+        void suspend() {}
+        void resume() {}
+        uint32_t get_priority() { return priority; }
+        void set_priority(uint32_t prio) { priority = prio; }
+        const char* get_name() { return name.c_str(); }
+        uint32_t notify() { return 1; }
+        uint32_t notify_take(bool clear_on_exit, uint32_t timeout) { return 0; }
+
+    private:
+        Task() = default;
+        void create(uint32_t prio, const char* task_name) {
+            priority = prio;
+            name = task_name;
+            host::record("task " + name, "create", {(double)prio});
+        }
+        uint32_t priority = TASK_PRIORITY_DEFAULT;
+        std::string name;
+};
+
+class Mutex {
+    public:
+        bool take() { return true; }
+        bool take(uint32_t timeout) { return true; }
+        bool give() { return true; }
+        void lock() {}
+        void unlock() {}
+        bool try_lock() { return true; }
+};
+
+class RecursiveMutex : public Mutex {};
+
+}  // namespace pros
@@ -0,0 +1,132 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "host/mock.hpp"
+#include "main.h"
+
+/**
+ * @file main.cpp
+ * @brief This file contains the host runner that plays the registered autons against the stand-ins.
+ * @details Each auton runs the way autonomous() starts it on the brain, then the runner prints its
+ * virtual run time, end pose and command counts. -v prints every recorded command. Names on the
+ * command line pick which autons run, otherwise all of them do.
+ *
+ * -s runs the drive through the dynamics simulation instead of jumping between end poses. Each
+ * auton then also gets how long every wait took and how it exited, and its total against the 15 s
+ * match auton or the 60 s skills run. --trace FILE writes the simulated pose every 10 ms as CSV.
+ * The brain tasks the motions lean on, the S-curve profile, the gain schedule and the motion log,
+ * get their tick ahead of every control tick the way they run beside EZ's task on the brain.
+ */
+
+static const double AUTON_LIMIT = 15;  // s
+static const double SKILLS_LIMIT = 60;
+
+// Motion waits the simulated drive logs, see Drive::sim_wait
+static bool is_wait(const host::Command& command) {
+    return command.device == "chassis" && command.action.rfind("pid_wait", 0) == 0 && command.values.size() == 6;
+}
+
+static double limit(const std::string& name) {
+    std::string lower = name;
+    for (char& c : lower) c = tolower(c);
+    return lower.find("skills") != std::string::npos ? SKILLS_LIMIT : AUTON_LIMIT;
+}
+
+static bool selected(const std::string& name, int argc, char** argv) {
+    bool named = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--trace") == 0) i++;  // its file isn't an auton name
+        else if (argv[i][0] != '-') {
+            named = true;
+            if (name == argv[i]) return true;
+        }
+    }
+    return !named;
+}
+
+static void run(const AutonObj& auton) {
+    host::reset();
+    chassis.pid_targets_reset();
+    chassis.drive_imu_reset();
+    chassis.drive_sensor_reset();
+    chassis.odom_xyt_set(0_in, 0_in, 0_deg);
+    chassis.drive_brake_set(MOTOR_BRAKE_HOLD);
+    chassis.sim.stop();
+    chassis.sim.trace.clear();
+    auton_sel.selector_name = auton.name;
+    auton_sel.selector_mirrored = auton.mirrored;
+    matchState = AUTO;
+    sideMirrored = auton.mirrored;
+    auton.callback();
+    matchState = DISABLED;
+}
+
+int main(int argc, char** argv) {
+    bool verbose = false, simulate = false;
+    const char* trace_path = nullptr;
+    for (int i = 1; i < argc; i++) {
+        verbose |= strcmp(argv[i], "-v") == 0;
+        simulate |= strcmp(argv[i], "-s") == 0;
+        if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) trace_path = argv[++i];
+    }
+    if (trace_path && !simulate) {
+        fprintf(stderr, "--trace needs -s\n");
+        return 2;
+    }
+    FILE* trace = trace_path ? fopen(trace_path, "w") : nullptr;
+    if (trace_path && !trace) {
+        fprintf(stderr, "can't write %s\n", trace_path);
+        return 2;
+    }
+    if (trace) fprintf(trace, "auton,time,x,y,theta,left_velocity,right_velocity,left_voltage,right_voltage\n");
+
+    default_constants();
+    autons_populate();
+    chassis.track_width = chassis.sim.model.track_width = TRACK_WIDTH;
+    chassis.simulate_set(simulate);
+    chassis.tasks = {profile_iterate, gain_schedule_iterate, motion_log_iterate};
+
+    int ran = 0;
+    for (const AutonObj& auton : auton_sel.autons) {
+        if (!selected(auton.name, argc, argv)) continue;
+        auto start = std::chrono::steady_clock::now();
+        run(auton);
+        double wall = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        ran++;
+
+        printf("%-16s %7.2f s  end (%6.1f, %6.1f, %6.1f)  %zu commands: %zu chassis, %zu controller, %zu screen\n", auton.name.c_str(),
+               host::now() / 1e6, chassis.odom_x_get(), chassis.odom_y_get(), chassis.odom_theta_get(), host::commands().size(),
+               host::count("chassis"), host::count("controller"), host::count("screen"));
+        if (simulate) {
+            for (const host::Command& command : host::commands()) {
+                if (!is_wait(command)) continue;
+                // Running means the wait got what it wanted before the motion exited, or gave up on it
+                exit_output exit = (exit_output)command.values[1];
+                std::string how = exit != RUNNING ? exit_to_string(exit) : command.values[2] ? "reached" : "timed out";
+                const std::vector<double>& v = command.values;
+                printf("    %8.2f s  %-24s %-22s %6.2f s  %-10s at (%6.1f, %6.1f, %6.1f)\n", command.time / 1e6, command.text.c_str(), command.action.c_str(), v[0],
+                       how.c_str(), v[3], v[4], v[5]);
+            }
+            double seconds = host::now() / 1e6, allowed = limit(auton.name);
+            printf("    total %.2f s of %.0f s, %s, %zu motions logged, simulated in %.1f ms\n", seconds, allowed,
+                   seconds > allowed ? "OVER" : "fits", motion_log.size(), wall);
+        }
+        if (verbose) {
+            for (const host::Command& command : host::commands()) printf("    %s\n", host::format(command).c_str());
+        }
+        motion_log_flush(auton.name);  // like autonomous(), so the next auton's log starts empty
+        if (trace) {
+            for (const host::TracePoint& p : chassis.sim.trace) {
+                fprintf(trace, "\"%s\",%.3f,%.3f,%.3f,%.3f,%.2f,%.2f,%.1f,%.1f\n", auton.name.c_str(), p.time / 1e6, p.pose.x, p.pose.y,
+                        p.pose.theta, p.left_velocity, p.right_velocity, p.left_voltage, p.right_voltage);
+            }
+        }
+    }
+    if (trace) fclose(trace);
+    if (ran == 0) {
+        fprintf(stderr, "no auton matched\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,532 @@
+#include "EZ-Template/drive/drive.hpp"
+#include <cmath>
+#include "host/mock.hpp"
+
+/**
+ * @file drive.cpp
+ * @brief This file contains the host stand-in for ez::Drive.
+ * @details Motions finish in one step: pid_wait puts the robot where the motion ends and moves the
+ * virtual clock by the time it would take at the motion's speed cap plus a settle time. Turns and
+ * swings rotate about the wheels the way the real drive does, so a routine's end pose matches the
+ * field path it draws.
+ *
+ * Simulating, a motion is a control law instead: every 10 ms of virtual time it computes side
+ * outputs from the same PIDs and exit conditions EZ-Template uses, and host::DriveSim turns them
+ * into motion in 1 ms steps. The loop runs whenever the clock moves, so a pid_wait steps the clock
+ * until the motion exits, and a pros::delay lets the robot carry on holding its target or coasting
+ * through it. Brain tasks put in tasks get a tick each just ahead of the motion's, the way their
+ * loops interleave with EZ's on the brain. The IMU and odometry read the simulated pose perfectly,
+ * the drive encoders read the wheels, slip included.
+ */
+
+namespace ez {
+
+Drive::Drive(std::vector<int> left_motor_ports, std::vector<int> right_motor_ports, int imu_port, double wheel_diameter, double ticks, double ratio) {
+    top_speed = ticks * ratio * M_PI * wheel_diameter / 60;
+    sim.model.wheel_diameter = wheel_diameter;
+    sim.model.wheel_rpm = ticks * ratio;
+    sim.model.motors_per_side = left_motor_ports.size();
+}
+
+//
+// Modes and limits
+//
+
+void Drive::drive_mode_set(e_mode p_mode, bool stop_drive) {
+    mode = p_mode;
+    if (p_mode == DISABLE) motion.active = false;
+    host::record("chassis", "drive_mode_set", {(double)p_mode});
+    if (stop_drive) drive_set(0, 0);
+}
+
+e_mode Drive::drive_mode_get() { return mode; }
+
+void Drive::drive_set(int left, int right) {
+    host::record("chassis", "drive_set", {(double)left, (double)right});
+    motion.active = false;
+    sim.left_voltage = left;
+    sim.right_voltage = right;
+}
+
+void Drive::drive_brake_set(pros::motor_brake_mode_e_t brake_type) {
+    host::record("chassis", "drive_brake_set", {(double)brake_type});
+    sim.brake = brake_type != pros::E_MOTOR_BRAKE_COAST;
+}
+
+void Drive::pid_speed_max_set(int speed) {
+    speed_max = std::abs(speed);
+    host::record("chassis", "pid_speed_max_set", {(double)speed});
+}
+
+int Drive::pid_speed_max_get() { return speed_max; }
+
+void Drive::pid_angle_behavior_set(e_angle_behavior behavior) { default_behavior = behavior; }
+
+void Drive::pid_targets_reset() {
+    motion = Motion();
+    sim.left_voltage = sim.right_voltage = 0;
+    host::record("chassis", "pid_targets_reset");
+}
+
+bool Drive::pid_tuner_enabled() { return false; }
+
+//
+// Sensors and odometry
+//
+
+double Drive::drive_imu_get() { return position.theta; }
+
+void Drive::drive_imu_reset(double new_heading) { position.theta = new_heading; }
+
+double Drive::drive_sensor_left() { return left_travel; }
+
+double Drive::drive_sensor_right() { return right_travel; }
+
+void Drive::drive_sensor_reset() { left_travel = right_travel = 0; }
+
+double Drive::odom_x_get() { return position.x; }
+
+double Drive::odom_y_get() { return position.y; }
+
+double Drive::odom_theta_get() { return position.theta; }
+
+pose Drive::odom_pose_get() { return position; }
+
+void Drive::odom_x_set(double x) { position.x = x; }
+
+void Drive::odom_x_set(okapi::QLength p_x) { odom_x_set(p_x.convert(okapi::inch)); }
+
+void Drive::odom_y_set(double y) { position.y = y; }
+
+void Drive::odom_y_set(okapi::QLength p_y) { odom_y_set(p_y.convert(okapi::inch)); }
+
+void Drive::odom_theta_set(double a) { position.theta = a; }
+
+void Drive::odom_xyt_set(double x, double y, double t) {
+    position = {x, y, t};
+    host::record("chassis", "odom_xyt_set", {x, y, t});
+}
+
+void Drive::odom_xyt_set(okapi::QLength p_x, okapi::QLength p_y, okapi::QAngle p_t) {
+    odom_xyt_set(p_x.convert(okapi::inch), p_y.convert(okapi::inch), p_t.convert(okapi::degree));
+}
+
+void Drive::odom_turn_bias_set(double bias) {}
+
+void Drive::odom_look_ahead_set(double distance) {}
+
+void Drive::odom_boomerang_distance_set(double distance) {}
+
+void Drive::odom_boomerang_dlead_set(double input) { boomerang_dlead = input; }
+
+//
+// Constants
+//
+
+// Odom motions drive on the drive constants too
+void Drive::pid_drive_constants_set(double p, double i, double d, double p_start_i) {
+    leftPID.constants_set(p, i, d, p_start_i);
+    rightPID.constants_set(p, i, d, p_start_i);
+    xyPID.constants_set(p, i, d, p_start_i);
+}
+
+void Drive::pid_heading_constants_set(double p, double i, double d, double p_start_i) { headingPID.constants_set(p, i, d, p_start_i); }
+
+void Drive::pid_turn_constants_set(double p, double i, double d, double p_start_i) { turnPID.constants_set(p, i, d, p_start_i); }
+
+void Drive::pid_swing_constants_set(double p, double i, double d, double p_start_i) { swingPID.constants_set(p, i, d, p_start_i); }
+
+void Drive::pid_odom_angular_constants_set(double p, double i, double d, double p_start_i) { odom_angularPID.constants_set(p, i, d, p_start_i); }
+
+void Drive::pid_odom_boomerang_constants_set(double p, double i, double d, double p_start_i) { boomerangPID.constants_set(p, i, d, p_start_i); }
+
+PID::Constants Drive::pid_drive_constants_get() { return leftPID.constants_get(); }
+
+PID::Constants Drive::pid_turn_constants_get() { return turnPID.constants_get(); }
+
+PID::Constants Drive::pid_swing_constants_get() { return swingPID.constants_get(); }
+
+void Drive::pid_turn_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout, bool use_imu) {
+    turnPID.exit_condition_set(p_small_exit_time, p_small_error, p_big_exit_time, p_big_error, p_velocity_exit_time, p_mA_timeout);
+}
+
+void Drive::pid_swing_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout, bool use_imu) {
+    swingPID.exit_condition_set(p_small_exit_time, p_small_error, p_big_exit_time, p_big_error, p_velocity_exit_time, p_mA_timeout);
+}
+
+void Drive::pid_drive_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout, bool use_imu) {
+    leftPID.exit_condition_set(p_small_exit_time, p_small_error, p_big_exit_time, p_big_error, p_velocity_exit_time, p_mA_timeout);
+    rightPID.exit_condition_set(p_small_exit_time, p_small_error, p_big_exit_time, p_big_error, p_velocity_exit_time, p_mA_timeout);
+}
+
+void Drive::pid_odom_turn_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout, bool use_imu) {
+    odom_angularPID.exit_condition_set(p_small_exit_time, p_small_error, p_big_exit_time, p_big_error, p_velocity_exit_time, p_mA_timeout);
+}
+
+void Drive::pid_odom_drive_exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout, bool use_imu) {
+    xyPID.exit_condition_set(p_small_exit_time, p_small_error, p_big_exit_time, p_big_error, p_velocity_exit_time, p_mA_timeout);
+}
+
+void Drive::pid_turn_chain_constant_set(double input) { turn_chain = fabs(input); }
+
+void Drive::pid_swing_chain_constant_set(double input) { swing_chain = fabs(input); }
+
+void Drive::pid_drive_chain_constant_set(double input) { drive_chain = fabs(input); }
+
+void Drive::slew_turn_constants_set(okapi::QAngle distance, int min_speed) {}
+
+void Drive::slew_drive_constants_set(okapi::QLength distance, int min_speed) {
+    slew_drive_distance = distance.convert(okapi::inch);
+    slew_drive_speed = min_speed;
+}
+
+void Drive::slew_swing_constants_set(okapi::QLength distance, int min_speed) {}
+
+//
+// Motion model
+//
+
+void Drive::motion_set(e_mode new_mode, const char* action, std::vector<double> values, pose end, double left, double right, int speed) {
+    host::record("chassis", action, values);
+    mode = new_mode;
+    speed_max = std::abs(speed);
+    double rate = top_speed * util::clamp(speed_max, 127, 1) / 127.0;
+    motion = {end, left, right, fmax(fabs(left), fabs(right)) / rate, true};
+
+    motion.active = true;
+    motion.action = action;
+    motion.start_time = host::now();
+    motion.start_left = left_travel;
+    motion.start_right = right_travel;
+    motion.start_theta = motion.heading = position.theta;
+    for (PID* pid : {&leftPID, &rightPID, &headingPID, &turnPID, &swingPID, &xyPID, &odom_angularPID, &boomerangPID}) {
+        pid->variables_reset();
+        pid->timers_reset();
+    }
+}
+
+void Drive::motion_finish(double extra) {
+    if (!motion.pending) return;
+    host::advance((uint64_t)((motion.seconds + extra) * 1e6));
+    position = motion.end;
+    left_travel += motion.left;
+    right_travel += motion.right;
+    motion.pending = false;
+}
+
+double Drive::turn_delta(double target, e_angle_behavior behavior) {
+    double delta = target - position.theta;
+    if (behavior == raw) return delta;
+    double wrapped = fmod(fmod(delta, 360) + 540, 360) - 180;  // -180 to 180
+    if (behavior == cw) return wrapped < 0 ? wrapped + 360 : wrapped;
+    if (behavior == ccw) return wrapped > 0 ? wrapped - 360 : wrapped;
+    if (behavior == longest) return wrapped < 0 ? wrapped + 360 : wrapped - 360;
+    return wrapped;
+}
+
+void Drive::turn_to(double target, int speed, e_angle_behavior behavior, const char* action) {
+    // Like EZ-Template the PID chases the heading the behavior reaches, not the wrapped target
+    double delta = turn_delta(target, behavior);
+    turnPID.target_set(position.theta + delta);
+    double arc = util::to_rad(delta) * track_width / 2;
+    pose end = {position.x, position.y, position.theta + delta};
+    motion_set(TURN, action, {target, (double)speed, (double)behavior}, end, arc, -arc, speed);
+}
+
+void Drive::swing_to(e_swing type, double target, int speed, int opposite_speed, e_angle_behavior behavior, const char* action) {
+    double delta = turn_delta(target, behavior);
+    swingPID.target_set(position.theta + delta);
+    double turn = util::to_rad(delta) * track_width;  // left minus right
+    // Each side covers distance in proportion to its speed, and they differ by the turn
+    double main = speed == opposite_speed ? 0 : turn * speed / (speed - opposite_speed);
+    double other = speed == 0 ? 0 : main * opposite_speed / speed;
+    double left = type == LEFT_SWING ? main : -other;
+    double right = type == LEFT_SWING ? other : -main;
+
+    double travel = (left + right) / 2;
+    double start = util::to_rad(position.theta), finish = util::to_rad(position.theta + delta);
+    pose end = {position.x, position.y, position.theta + delta};
+    if (fabs(finish - start) < 1e-9) {
+        end.x += travel * sin(start);
+        end.y += travel * cos(start);
+    } else {
+        double radius = travel / (finish - start);
+        end.x += radius * (cos(start) - cos(finish));
+        end.y += radius * (sin(finish) - sin(start));
+    }
+    motion_set(SWING, action, {(double)type, target, (double)speed, (double)opposite_speed, (double)behavior}, end, left, right, std::max(speed, std::abs(opposite_speed)));
+    motion.swing = type;
+    motion.opposite_speed = opposite_speed;
+    speed_max = std::abs(speed);
+}
+
+void Drive::odom_to(pose target, drive_directions dir, int speed, bool boomerang, const char* action) {
+    double dx = target.x - position.x, dy = target.y - position.y;
+    double distance = hypot(dx, dy);
+    double facing = util::to_deg(atan2(dx, dy)) + (dir == REV ? 180 : 0);
+    double face = distance > 1e-9 ? turn_delta(facing, shortest) : 0;
+    double settle = boomerang && target.theta != ANGLE_NOT_SET ? turn_delta(target.theta, shortest) - face : 0;
+    double arc = util::to_rad(fabs(face) + fabs(settle)) * track_width / 2;
+    double travel = dir == REV ? -distance : distance;
+    pose end = {target.x, target.y, position.theta + face + settle};
+    motion_set(boomerang ? POINT_TO_POINT : PURE_PURSUIT, action, {target.x, target.y, target.theta, (double)dir, (double)speed}, end, travel + arc, travel - arc, speed);
+    motion.target = target;
+    motion.direction = dir;
+    motion.boomerang = boomerang && target.theta != ANGLE_NOT_SET;
+    current_a_odomPID = motion.boomerang ? boomerangPID : odom_angularPID;
+}
+
+//
+// Motions
+//
+
+void Drive::pid_drive_set(double target, int speed, bool slew_on, bool toggle_heading) {
+    leftPID.target_set(left_travel + target);
+    rightPID.target_set(right_travel + target);
+    double heading = util::to_rad(position.theta);
+    pose end = {position.x + target * sin(heading), position.y + target * cos(heading), position.theta};
+    motion_set(DRIVE, "pid_drive_set", {target, (double)speed}, end, target, target, speed);
+    motion.slew = slew_on;
+}
+
+void Drive::pid_drive_set(okapi::QLength p_target, int speed, bool slew_on, bool toggle_heading) {
+    pid_drive_set(p_target.convert(okapi::inch), speed, slew_on, toggle_heading);
+}
+
+void Drive::pid_odom_set(double target, int speed, bool slew_on) { pid_drive_set(target, speed, slew_on); }
+
+void Drive::pid_odom_set(okapi::QLength p_target, int speed, bool slew_on) { pid_odom_set(p_target.convert(okapi::inch), speed, slew_on); }
+
+void Drive::pid_odom_set(odom imovement, bool slew_on) {
+    odom_to(imovement.target, imovement.drive_direction, imovement.max_xy_speed, false, "pid_odom_set");
+}
+
+void Drive::pid_odom_set(united_odom p_imovement, bool slew_on) { pid_odom_set(util::united_odom_to_odom(p_imovement), slew_on); }
+
+void Drive::pid_odom_boomerang_set(odom imovement, bool slew_on) {
+    odom_to(imovement.target, imovement.drive_direction, imovement.max_xy_speed, true, "pid_odom_boomerang_set");
+}
+
+void Drive::pid_odom_boomerang_set(united_odom p_imovement, bool slew_on) { pid_odom_boomerang_set(util::united_odom_to_odom(p_imovement), slew_on); }
+
+void Drive::pid_turn_set(double target, int speed, e_angle_behavior behavior, bool slew_on) { turn_to(target, speed, behavior, "pid_turn_set"); }
+
+void Drive::pid_turn_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on) {
+    pid_turn_set(p_target.convert(okapi::degree), speed, behavior, slew_on);
+}
+
+void Drive::pid_turn_set(double target, int speed, bool slew_on) { pid_turn_set(target, speed, default_behavior, slew_on); }
+
+void Drive::pid_turn_set(okapi::QAngle p_target, int speed, bool slew_on) { pid_turn_set(p_target.convert(okapi::degree), speed, default_behavior, slew_on); }
+
+void Drive::pid_turn_set(pose itarget, drive_directions dir, int speed, e_angle_behavior behavior, bool slew_on) {
+    double target = util::to_deg(atan2(itarget.x - position.x, itarget.y - position.y)) + (dir == REV ? 180 : 0);
+    turn_to(target, speed, behavior == raw ? shortest : behavior, "pid_turn_set");
+}
+
+void Drive::pid_turn_set(united_pose p_itarget, drive_directions dir, int speed, e_angle_behavior behavior, bool slew_on) {
+    pid_turn_set(util::united_pose_to_pose(p_itarget), dir, speed, behavior, slew_on);
+}
+
+void Drive::pid_turn_relative_set(double target, int speed, e_angle_behavior behavior, bool slew_on) {
+    turn_to(position.theta + target, speed, raw, "pid_turn_relative_set");
+}
+
+void Drive::pid_turn_relative_set(okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on) {
+    pid_turn_relative_set(p_target.convert(okapi::degree), speed, behavior, slew_on);
+}
+
+void Drive::pid_swing_set(e_swing type, double target, int speed, int opposite_speed, e_angle_behavior behavior, bool slew_on) {
+    swing_to(type, target, speed, opposite_speed, behavior, "pid_swing_set");
+}
+
+void Drive::pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, int opposite_speed, e_angle_behavior behavior, bool slew_on) {
+    pid_swing_set(type, p_target.convert(okapi::degree), speed, opposite_speed, behavior, slew_on);
+}
+
+void Drive::pid_swing_set(e_swing type, double target, int speed, e_angle_behavior behavior, bool slew_on) { pid_swing_set(type, target, speed, 0, behavior, slew_on); }
+
+void Drive::pid_swing_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior, bool slew_on) {
+    pid_swing_set(type, p_target.convert(okapi::degree), speed, 0, behavior, slew_on);
+}
+
+void Drive::pid_swing_relative_set(e_swing type, double target, int speed, e_angle_behavior behavior) {
+    swing_to(type, position.theta + target, speed, 0, raw, "pid_swing_relative_set");
+}
+
+void Drive::pid_swing_relative_set(e_swing type, okapi::QAngle p_target, int speed, e_angle_behavior behavior) {
+    pid_swing_relative_set(type, p_target.convert(okapi::degree), speed, behavior);
+}
+
+//
+// Simulation
+//
+
+static const uint64_t SIM_STEP = 1000;  // us between physics steps
+static const uint64_t CONTROL_STEP = util::DELAY_TIME * 1000;
+
+void Drive::simulate_set(bool enabled) {
+    simulate = enabled;
+    if (enabled) host::clock_hook_set([this](uint64_t from, uint64_t to) { simulate_to(from, to); });
+    else host::clock_hook_set(nullptr);
+}
+
+bool Drive::simulate_get() { return simulate; }
+
+// Control ticks land on the same 10 ms grid however the clock gets moved
+void Drive::simulate_to(uint64_t from, uint64_t to) {
+    for (uint64_t time = from; time + SIM_STEP <= to; time += SIM_STEP) {
+        if (time % CONTROL_STEP == 0) {
+            for (const std::function<void()>& task : tasks) task();
+            control();
+            sim.sample(time, position);
+        }
+        sim.step(SIM_STEP / 1e6, position, left_travel, right_travel);
+    }
+}
+
+// One tick of the running motion, outputs are on the -127 to 127 scale
+void Drive::control() {
+    if (!motion.active) return;
+    double speed = speed_max, left = 0, right = 0;
+    exit_output exit = RUNNING;
+
+    switch (mode) {
+        case DRIVE: {
+            // EZ's linear slew raises the cap with the distance covered
+            double covered = fabs(left_travel - motion.start_left + right_travel - motion.start_right) / 2;
+            if (motion.slew && covered < slew_drive_distance) speed = fmin(speed, slew_drive_speed + (speed - slew_drive_speed) * covered / slew_drive_distance);
+            double heading = headingPID.compute_error(motion.heading - position.theta, position.theta);
+            left = util::clamp(leftPID.compute(left_travel), speed) + heading;
+            right = util::clamp(rightPID.compute(right_travel), speed) - heading;
+            // Each side holds on to its exit until the other one gets there, like EZ-Template's wait
+            if (motion.left_exit == RUNNING) motion.left_exit = leftPID.exit_condition();
+            if (motion.right_exit == RUNNING) motion.right_exit = rightPID.exit_condition();
+            if (motion.right_exit != RUNNING) exit = motion.left_exit;
+            break;
+        }
+        case TURN:
+            left = util::clamp(turnPID.compute(position.theta), speed);
+            right = -left;
+            exit = turnPID.exit_condition();
+            break;
+        case SWING: {
+            // The opposite side keeps the ratio the arc was planned with
+            double main = util::clamp(swingPID.compute(position.theta), speed);
+            double other = speed == 0 ? 0 : main * motion.opposite_speed / speed;
+            left = motion.swing == LEFT_SWING ? main : -other;
+            right = motion.swing == LEFT_SWING ? other : -main;
+            exit = swingPID.exit_condition();
+            break;
+        }
+        case PURE_PURSUIT:
+        case POINT_TO_POINT: {
+            // Steer at the target, or at a carrot behind it that leads a boomerang into its heading
+            pose goal = motion.target;
+            double reverse = motion.direction == REV ? 180 : 0;
+            double distance = util::distance_to_point(goal, position);
+            pose aim = goal;
+            if (motion.boomerang) {
+                double lead = util::to_rad(goal.theta + reverse);
+                aim.x -= boomerang_dlead * distance * sin(lead);
+                aim.y -= boomerang_dlead * distance * cos(lead);
+            }
+            double facing = util::wrap_angle(util::absolute_angle_to_point(goal, position) + reverse - position.theta);
+            double steer = util::wrap_angle(util::absolute_angle_to_point(aim, position) + reverse - position.theta);
+
+            // Distance along the robot toward the target, the exit conditions run on it
+            double along = distance * cos(util::to_rad(facing));
+            double drive = util::clamp(xyPID.compute_error(along, 0), speed) * (reverse ? -1 : 1);
+            double turn = distance < drive_chain + 2 ? 0 : current_a_odomPID.compute_error(steer, position.theta);
+            left = drive + turn;
+            right = drive - turn;
+            double scale = fmax(fabs(left), fabs(right)) / fmax(speed, 1);
+            if (scale > 1) {
+                left /= scale;
+                right /= scale;
+            }
+            exit = xyPID.exit_condition();
+            break;
+        }
+        default:
+            break;
+    }
+
+    sim.left_voltage = util::clamp(left, 127);
+    sim.right_voltage = util::clamp(right, 127);
+    if (motion.exit == RUNNING && exit != RUNNING) motion.exit = exit;
+}
+
+// How far the motion is from its target, in the units its chain constant is in
+double Drive::chain_error() {
+    switch (mode) {
+        case DRIVE: return fabs((leftPID.target_get() - left_travel + rightPID.target_get() - right_travel) / 2);
+        case TURN: return fabs(turnPID.target_get() - position.theta);
+        case SWING: return fabs(swingPID.target_get() - position.theta);
+        case PURE_PURSUIT:
+        case POINT_TO_POINT: return util::distance_to_point(motion.target, position);
+        default: return 0;
+    }
+}
+
+// Wheels the clock on a tick at a time until the motion exits or reaches where the wait wants it.
+// The motion keeps running afterwards, holding its target until the next one replaces it
+void Drive::sim_wait(const char* wait, std::function<bool()> reached) {
+    if (!motion.active) return;
+    uint64_t timeout = motion.start_time + (uint64_t)(motion_timeout * 1e6);
+    bool done = false;
+    while (motion.exit == RUNNING && !(done = reached()) && host::now() < timeout) host::advance(CONTROL_STEP);
+    host::record("chassis", wait, {(host::now() - motion.start_time) / 1e6, (double)motion.exit, (double)done, position.x, position.y, position.theta}, motion.action);
+}
+
+// Drives count inches from the start of the motion, turns and swings count degrees and are past
+// their target once they've crossed it
+bool Drive::passed(double target) {
+    if (mode == TURN || mode == SWING) return util::sgn(target - position.theta) != util::sgn(target - motion.start_theta);
+    double travel = (left_travel - motion.start_left + right_travel - motion.start_right) / 2;
+    return fabs(travel) >= fabs(target);
+}
+
+// A point is passed once it's behind the robot's direction of travel
+bool Drive::passed(pose target) {
+    double heading = util::to_rad(position.theta + (motion.direction == REV ? 180 : 0));
+    return (target.x - position.x) * sin(heading) + (target.y - position.y) * cos(heading) <= 0;
+}
+
+//
+// Waits, the motion finishes on any of them
+//
+
+void Drive::pid_wait() {
+    if (simulate) sim_wait("pid_wait", [] { return false; });
+    else motion_finish(settle_time);
+}
+
+void Drive::pid_wait_quick() {
+    if (simulate) sim_wait("pid_wait_quick", [] { return false; });
+    else motion_finish(settle_time / 2);
+}
+
+void Drive::pid_wait_quick_chain() {
+    double chain = mode == TURN ? turn_chain : mode == SWING ? swing_chain : drive_chain;
+    if (simulate) sim_wait("pid_wait_quick_chain", [this, chain] { return chain_error() < chain; });
+    else motion_finish(chain_time);
+}
+
+void Drive::pid_wait_until(double target) {
+    if (simulate) sim_wait("pid_wait_until", [this, target] { return passed(target); });
+    else motion_finish(0);
+}
+
+void Drive::pid_wait_until(okapi::QLength target) { pid_wait_until(target.convert(okapi::inch)); }
+
+void Drive::pid_wait_until(okapi::QAngle target) { pid_wait_until(target.convert(okapi::degree)); }
+
+void Drive::pid_wait_until(pose target) {
+    if (simulate) sim_wait("pid_wait_until", [this, target] { return passed(target); });
+    else motion_finish(0);
+}
+
+void Drive::pid_wait_until(united_pose target) { pid_wait_until(util::united_pose_to_pose(target)); }
+
+}  // namespace ez
@@ -0,0 +1,242 @@
+#include <cmath>
+#include "EZ-Template/PID.hpp"
+#include "EZ-Template/piston.hpp"
+#include "EZ-Template/tracking_wheel.hpp"
+#include "EZ-Template/util.hpp"
+#include "host/mock.hpp"
+
+/**
+ * @file ez.cpp
+ * @brief This file contains the host definitions for the EZ-Template headers the project uses.
+ * @details The headers are the real ones, the library they're compiled into only exists for the
+ * brain. PID is a plain PID with EZ-Template's small, big and velocity exit timers, counted in
+ * control ticks since the host has no motors to time out on current. Everything else is a straight
+ * reimplementation of the helper it replaces.
+ */
+
+pros::Controller master(pros::E_CONTROLLER_MASTER);
+
+namespace ez {
+
+void ez_template_print() {}
+
+void screen_print(std::string text, int line) { host::record("screen", "screen_print", {(double)line}, text); }
+
+std::string exit_to_string(exit_output input) {
+    switch (input) {
+        case RUNNING: return "Running";
+        case SMALL_EXIT: return "Small";
+        case BIG_EXIT: return "Big";
+        case VELOCITY_EXIT: return "Velocity";
+        case mA_EXIT: return "mA";
+        case ERROR_NO_CONSTANTS: return "Error: Exit condition constants not set!";
+    }
+    return "Error: Out of bounds!";
+}
+
+//
+// util
+//
+
+namespace util {
+
+bool AUTON_RAN = true;
+
+int places_after_decimal(double input, int min) {
+    int places = 0;
+    while (places < 10 && fabs(input - round(input)) > 1e-9) {
+        input *= 10;
+        places++;
+    }
+    return places < min ? min : places;
+}
+
+std::string to_string_with_precision(double input, int n) {
+    char out[64];
+    snprintf(out, sizeof(out), "%.*f", n, input);
+    return out;
+}
+
+int sgn(double input) { return input > 0 ? 1 : input < 0 ? -1 : 0; }
+
+bool reversed_active(double input) { return input < 0; }
+
+double clamp(double input, double max, double min) { return input > max ? max : input < min ? min : input; }
+
+double clamp(double input, double max) { return clamp(input, fabs(max), -fabs(max)); }
+
+double to_deg(double input) { return input * (180 / M_PI); }
+
+double to_rad(double input) { return input * (M_PI / 180); }
+
+double absolute_angle_to_point(pose itarget, pose icurrent) {
+    double angle = to_deg(atan2(itarget.x - icurrent.x, itarget.y - icurrent.y));
+    return std::isnan(angle) ? 0 : angle;
+}
+
+double distance_to_point(pose itarget, pose icurrent) { return hypot(itarget.x - icurrent.x, itarget.y - icurrent.y); }
+
+double wrap_angle(double theta) {
+    while (theta > 180) theta -= 360;
+    while (theta < -180) theta += 360;
+    return theta;
+}
+
+pose vector_off_point(double added, pose icurrent) {
+    double angle = to_rad(icurrent.theta);
+    return {icurrent.x + added * sin(angle), icurrent.y + added * cos(angle), icurrent.theta};
+}
+
+double turn_shortest(double target, double current, bool print) { return current + wrap_angle(target - current); }
+
+double turn_longest(double target, double current, bool print) {
+    double delta = wrap_angle(target - current);
+    return current + (delta < 0 ? delta + 360 : delta - 360);
+}
+
+pose united_pose_to_pose(united_pose input) { return {input.x.convert(okapi::inch), input.y.convert(okapi::inch), input.theta.convert(okapi::degree)}; }
+
+odom united_odom_to_odom(united_odom input) { return {united_pose_to_pose(input.target), input.drive_direction, input.max_xy_speed, input.turn_behavior}; }
+
+std::vector<odom> united_odoms_to_odoms(std::vector<united_odom> inputs) {
+    std::vector<odom> out;
+    for (const united_odom& input : inputs) out.push_back(united_odom_to_odom(input));
+    return out;
+}
+
+}  // namespace util
+
+//
+// PID
+//
+
+PID::PID() {}
+
+PID::PID(double p, double i, double d, double start_i, std::string name) : name(name) { constants_set(p, i, d, start_i); }
+
+void PID::constants_set(double p, double i, double d, double p_start_i) { constants = {p, i, d, p_start_i}; }
+
+PID::Constants PID::constants_get() { return constants; }
+
+bool PID::constants_set_check() { return constants.kp != 0 || constants.ki != 0 || constants.kd != 0; }
+
+void PID::exit_condition_set(int p_small_exit_time, double p_small_error, int p_big_exit_time, double p_big_error, int p_velocity_exit_time, int p_mA_timeout) {
+    exit = {p_small_exit_time, p_small_error, p_big_exit_time, p_big_error, p_velocity_exit_time, p_mA_timeout};
+}
+
+void PID::target_set(double input) { target = input; }
+
+double PID::target_get() { return target; }
+
+void PID::variables_reset() {
+    output = cur = error = prev_error = prev_current = integral = derivative = 0;
+    time = prev_time = 0;
+}
+
+void PID::timers_reset() { i = j = k = l = m = 0; }
+
+// Called once per control tick, same as EZ-Template's loop
+exit_output PID::exit_condition(bool print) {
+    if (exit.small_error == 0 && exit.big_error == 0 && exit.velocity_exit_time == 0) return ERROR_NO_CONSTANTS;
+
+    if (exit.small_error != 0) {
+        if (fabs(error) < exit.small_error) {
+            j += util::DELAY_TIME;
+            i = 0;  // the big timer restarts so it can't fire while the small one runs
+            if (j > exit.small_exit_time) {
+                timers_reset();
+                return SMALL_EXIT;
+            }
+        } else {
+            j = 0;
+        }
+    }
+    if (exit.big_error != 0 && exit.big_exit_time != 0) {
+        if (fabs(error) < exit.big_error) {
+            i += util::DELAY_TIME;
+            if (i > exit.big_exit_time) {
+                timers_reset();
+                return BIG_EXIT;
+            }
+        } else {
+            i = 0;
+        }
+    }
+    if (exit.velocity_exit_time != 0) {
+        if (fabs(derivative) <= velocity_zero_main) {
+            k += util::DELAY_TIME;
+            if (k > exit.velocity_exit_time) {
+                timers_reset();
+                return VELOCITY_EXIT;
+            }
+        } else {
+            k = 0;
+        }
+    }
+    return RUNNING;
+}
+
+double PID::compute(double current) { return compute_error(target - current, current); }
+
+double PID::compute_error(double err, double current) {
+    cur = current;
+    error = err;
+    if (constants.ki != 0 && fabs(error) < constants.start_i) integral += error;
+    if (reset_i_sgn && util::sgn(error) != util::sgn(prev_error)) integral = 0;
+    derivative = error - prev_error;
+    output = constants.kp * error + constants.ki * integral + constants.kd * derivative;
+    prev_error = error;
+    prev_current = current;
+    return output;
+}
+
+void PID::name_set(std::string p_name) { name = p_name; }
+
+std::string PID::name_get() { return name; }
+
+void PID::i_reset_toggle(bool toggle) { reset_i_sgn = toggle; }
+
+bool PID::i_reset_get() { return reset_i_sgn; }
+
+//
+// Piston
+//
+
+Piston::Piston(int input_port, bool default_state) : piston(input_port, default_state) {
+    reversed = default_state;
+}
+
+Piston::Piston(int input_port, int expander_smart_port, bool default_state) : piston({(uint8_t)expander_smart_port, (uint8_t)input_port}, default_state) {
+    reversed = default_state;
+}
+
+void Piston::set(bool input) {
+    piston.set_value(reversed ? !input : input);
+    current = input;
+}
+
+bool Piston::get() { return current; }
+
+void Piston::button_toggle(int toggle) {
+    if (toggle && !last_press) set(!current);
+    last_press = toggle;
+}
+
+void Piston::buttons(int active, int deactive) {
+    if (active && !current) set(true);
+    else if (deactive && current) set(false);
+}
+
+//
+// Tracking wheels, the stand-in drive doesn't attach any
+//
+
+double tracking_wheel::get() { return 0; }
+
+void tracking_wheel::reset() {}
+
+double tracking_wheel::distance_to_center_get() { return 0; }
+
+void tracking_wheel::distance_to_center_set(double input) {}
+
+}  // namespace ez
@@ -0,0 +1,66 @@
+#include "host/mock.hpp"
+#include <cstdio>
+
+/**
+ * @file host.cpp
+ * @brief This file contains the command log and virtual clock the host stand-ins share.
+ */
+
+namespace host {
+
+static uint64_t clock_us = 0;
+static std::vector<Command> log;
+static std::function<void(uint64_t, uint64_t)> clock_hook;
+
+uint64_t now() { return clock_us; }
+
+void advance(uint64_t us) { advance_to(clock_us + us); }
+
+void advance_to(uint64_t us) {
+    if (us <= clock_us) return;
+    uint64_t from = clock_us;
+    clock_us = us;
+    if (clock_hook) clock_hook(from, us);
+}
+
+void clock_hook_set(std::function<void(uint64_t from, uint64_t to)> hook) { clock_hook = std::move(hook); }
+
+void record(const std::string& device, const std::string& action, std::vector<double> values, const std::string& text) {
+    log.push_back({clock_us, device, action, std::move(values), text});
+}
+
+const std::vector<Command>& commands() { return log; }
+
+size_t count(const std::string& device, const std::string& action) {
+    size_t found = 0;
+    for (const Command& command : log) {
+        if (command.device == device && (action.empty() || command.action == action)) found++;
+    }
+    return found;
+}
+
+void reset() {
+    clock_us = 0;
+    log.clear();
+}
+
+std::string format(const Command& command) {
+    char stamp[32];
+    snprintf(stamp, sizeof(stamp), "%10.3f ", command.time / 1e6);
+    std::string out = stamp + command.device + " " + command.action + "(";
+    for (size_t i = 0; i < command.values.size(); i++) {
+        char value[32];
+        snprintf(value, sizeof(value), "%s%g", i ? ", " : "", command.values[i]);
+        out += value;
+    }
+    if (!command.text.empty()) out += (command.values.empty() ? "\"" : ", \"") + command.text + "\"";
+    return out + ")";
+}
+
+std::string port_name(int port) {
+    if (port >= 'a' && port <= 'h') port -= 'a' - 'A';
+    if (port >= 'A' && port <= 'H') return std::string(1, (char)port);
+    return std::to_string(port);
+}
+
+}  // namespace host
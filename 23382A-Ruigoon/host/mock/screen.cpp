@@ -0,0 +1,29 @@
+#include "screen.hpp"
+#include "host/mock.hpp"
+
+/**
+ * @file screen.cpp
+ * @brief This file contains the host stand-ins for the parts of screen.cpp other files call.
+ * @details The UI itself isn't built off the brain. The selector keeps its list so the host can
+ * run every registered auton, and console prints go to the command log.
+ */
+
+string controllerInput = "";
+AutonSel auton_sel;
+
+void AutonSel::selector_populate(vector<AutonObj> auton_list) { autons.insert(autons.end(), auton_list.begin(), auton_list.end()); }
+
+void resetViewer(bool full) { host::record("screen", "resetViewer", {(double)full}); }
+
+void refresh_console_label() {}
+
+void print(int line, const std::string& msg) {
+    if (line < 0 || line >= STRUCTURED_LINES) return;
+    structured_log[line] = msg;
+    host::record("screen", "print", {(double)line}, msg);
+}
+
+void print(const std::string& msg) {
+    unstructured_log.push_back(msg);
+    host::record("screen", "print", {}, msg);
+}
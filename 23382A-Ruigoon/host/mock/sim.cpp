@@ -0,0 +1,79 @@
+#include "host/sim.hpp"
+#include <cmath>
+
+/**
+ * @file sim.cpp
+ * @brief This file contains the differential drive dynamics the host drive runs on when it simulates.
+ * @details Each motor follows the DC motor line, torque falling from stall at zero speed to nothing
+ * at free speed in proportion to the voltage, and the current limit caps it at stall torque. The two
+ * sides push the robot forward and twist it about its center, against rolling resistance and the
+ * wheels scrubbing sideways through a turn. Both frictions are smoothed near zero speed so the robot
+ * settles instead of chattering about it.
+ *
+ * A side's push is capped at what its wheels can grip. Past that the wheels spin at the speed
+ * where the motors' torque falls back to the grip, and the encoders count that instead of the
+ * ground they covered.
+ */
+
+namespace host {
+
+static const double GRAVITY = 9.81;     // m/s^2
+static const double METERS = 0.0254;    // per inch
+static const double SETTLE_SPEED = 0.01;  // m/s, friction reaches full strength above this
+static const double SETTLE_TURN = 0.05;   // rad/s
+
+void DriveSim::step(double dt, ez::pose& position, double& left_travel, double& right_travel) {
+    const DriveModel& m = model;
+    double radius = m.wheel_diameter / 2 * METERS;
+    double ratio = m.cartridge_rpm / m.wheel_rpm;  // motor turns per wheel turn
+    double free_speed = m.cartridge_rpm * 2 * M_PI / 60;
+    double half_track = m.track_width / 2 * METERS;
+    double grip = m.traction * m.mass * GRAVITY / 2;
+
+    // Force at the ground from one side. A side that slips gets how fast its wheels spin in in/s
+    auto push = [&](double voltage, double velocity, double& wheel) {
+        wheel = NAN;
+        if (voltage == 0 && !brake) return 0.0;
+        double motor_speed = velocity * METERS / radius * ratio;
+        double drive = ez::util::clamp(voltage, 127) / 127;
+        double torque = ez::util::clamp(m.stall_torque * (drive - motor_speed / free_speed), m.stall_torque);
+        double force = m.motors_per_side * torque * ratio / radius;
+        if (fabs(force) <= grip) return force;
+        force = ez::util::sgn(force) * grip;
+        double slipping_torque = force * radius / ratio / m.motors_per_side;
+        wheel = free_speed * (drive - slipping_torque / m.stall_torque) * radius / ratio / METERS;
+        return force;
+    };
+    double left_wheel, right_wheel;  // NAN while they grip
+    double left_force = push(left_voltage, left_velocity, left_wheel);
+    double right_force = push(right_voltage, right_velocity, right_wheel);
+
+    // Forward speed and turn rate, clockwise positive
+    double speed = (left_velocity + right_velocity) / 2 * METERS;
+    double turn = (left_velocity - right_velocity) * METERS / (2 * half_track);
+    double rolling = m.rolling * m.mass * GRAVITY * tanh(speed / SETTLE_SPEED);
+    double scrub = m.scrub * m.mass * GRAVITY * m.scrub_arm * METERS * tanh(turn / SETTLE_TURN);
+    speed += (left_force + right_force - rolling) / m.mass * dt;
+    turn += ((left_force - right_force) * half_track - scrub) / m.inertia * dt;
+
+    left_velocity = (speed + turn * half_track) / METERS;
+    right_velocity = (speed - turn * half_track) / METERS;
+    position.theta += ez::util::to_deg(turn * dt);
+    double heading = ez::util::to_rad(position.theta);
+    position.x += speed / METERS * sin(heading) * dt;
+    position.y += speed / METERS * cos(heading) * dt;
+    // A gripping wheel rolls with the ground it's on
+    if (std::isnan(left_wheel)) left_wheel = left_velocity;
+    if (std::isnan(right_wheel)) right_wheel = right_velocity;
+    slip += (fabs(left_wheel - left_velocity) + fabs(right_wheel - right_velocity)) * dt;
+    left_travel += left_wheel * dt;
+    right_travel += right_wheel * dt;
+}
+
+void DriveSim::sample(uint64_t time, const ez::pose& position) {
+    trace.push_back({time, position, left_velocity, right_velocity, left_voltage, right_voltage});
+}
+
+void DriveSim::stop() { left_velocity = right_velocity = left_voltage = right_voltage = slip = 0; }
+
+}  // namespace host
@@ -0,0 +1,30 @@
+#include "test.hpp"
+
+/**
+ * @file autotune.cpp
+ * @brief This file contains the host test for the relay autotuner.
+ * @details The relay and validation steps run against the simulated drive, so the test covers the
+ * whole experiment down to where a kept proposal lands.
+ */
+
+TEST("autotuned turn gains land in the config the schedule reads") {
+    test::reset(true);
+    config_reset();
+    config_apply();
+    ez::PID::Constants before = config_pid_get(CFG_TURN_KP);
+    TuneResult result = autotune(TUNE_TURN);
+    printf("    Ku %.2f Tu %.3f s, kP %.2f kI %.3f kD %.1f, overshoot %.2f, settle %.0f ms, %s %s\n", result.ultimate_gain, result.ultimate_period,
+           result.proposed.kp, result.proposed.ki, result.proposed.kd, result.overshoot, result.settle, result.accepted ? "kept" : "rejected",
+           result.reason.c_str());
+    CHECK(result.ultimate_gain > 0);
+    ez::PID::Constants after = config_pid_get(CFG_TURN_KP);
+    if (result.accepted) {
+        CHECK_NEAR(after.kp, result.proposed.kp, 1e-2);
+        CHECK_NEAR(chassis.turnPID.constants.kp, after.kp, 1e-9);
+    } else {
+        CHECK_NEAR(after.kp, before.kp, 1e-9);
+        CHECK_NEAR(chassis.turnPID.constants.kp, before.kp, 1e-9);
+    }
+    config_reset();
+    config_apply();
+}
@@ -0,0 +1,124 @@
+#include <fstream>
+#include <sstream>
+#include "test.hpp"
+
+/**
+ * @file ekf.cpp
+ * @brief This file contains the replay test for the EKF pose estimator.
+ * @details A logged run is played back through the filter tick by tick. The log holds the true pose
+ * and wheel speeds every 10 ms, and the sensors are made from it with the errors the real ones have:
+ * a left wheel that slips and reads long, encoder noise, and IMU noise. Each tick is put on the mock
+ * drive and IMU and the robot's own models sample it from there, so the code under test is the code
+ * the brain runs.
+ */
+
+class LogSample {
+    public:
+        double time, x, y, theta, left_velocity, right_velocity;
+};
+
+static std::vector<LogSample> log_load(const std::string& name) {
+    std::string path = std::string(__FILE__).substr(0, std::string(__FILE__).rfind('/')) + "/data/" + name;
+    std::ifstream file(path);
+    std::vector<LogSample> samples;
+    std::string line;
+    while (std::getline(file, line)) {
+        LogSample s;
+        if (sscanf(line.c_str(), "%lf,%lf,%lf,%lf,%lf,%lf", &s.time, &s.x, &s.y, &s.theta, &s.left_velocity, &s.right_velocity) == 6) samples.push_back(s);
+    }
+    return samples;
+}
+
+// Same noise every run, so a failure can be reproduced
+static double noise(uint32_t& seed, double amplitude) {
+    seed = seed * 1664525 + 1013904223;
+    return ((seed >> 8) / (double)(1 << 24) * 2 - 1) * amplitude;
+}
+
+// Puts one tick of the log on the mock sensors the models read, then lets the tick's time pass
+static void sensors_set(double left, double right, double heading, double rate, double dt) {
+    chassis.left_travel += left * dt;
+    chassis.right_travel += right * dt;
+    chassis.odom_theta_set(heading);
+    ::imu.gyro.z = -util::to_deg(rate);  // the gyro's z axis points up
+    pros::delay(lround(dt * 1000));
+}
+
+static double wrap(double degrees) { return util::wrap_angle(degrees); }
+
+TEST("ekf follows a logged run through wheel slip") {
+    std::vector<LogSample> run = log_load("left7_trace.csv");
+    CHECK(run.size() > 500);
+    if (run.size() < 2) return;
+
+    test::reset(false);
+    ImuYawModel yaw;
+    ImuRateModel rate(::imu);
+    EncoderModel encoders(TRACK_WIDTH);
+    PoseEKF filter;
+    filter.models_add(&yaw);
+    filter.models_add(&rate);
+    filter.models_add(&encoders);
+    filter.reset(run[0].x, run[0].y, run[0].theta);
+
+    // Encoder-only dead reckoning alongside, what the pose would be with nothing to correct the slip
+    double dead_x = run[0].x, dead_y = run[0].y, dead_theta = util::to_rad(run[0].theta);
+
+    const double SLIP = 1.04;  // the left wheel reads 4% long
+    uint32_t seed = 1;
+    double worst = 0, worst_heading = 0, dead_worst = 0;
+    size_t outside = 0;
+    for (size_t i = 1; i < run.size(); i++) {
+        const LogSample& s = run[i];
+        double dt = s.time - run[i - 1].time;
+        double left = s.left_velocity * SLIP + noise(seed, 0.5);
+        double right = s.right_velocity + noise(seed, 0.5);
+        double heading = s.theta + noise(seed, 0.3);
+        sensors_set(left, right, heading, util::to_rad(wrap(s.theta - run[i - 1].theta)) / dt + noise(seed, 0.05), dt);
+        filter.iterate(dt);
+
+        double speed = (left + right) / 2;
+        dead_theta += (left - right) / TRACK_WIDTH * dt;
+        dead_x += speed * sin(dead_theta) * dt;
+        dead_y += speed * cos(dead_theta) * dt;
+
+        double error = hypot(filter.x_get() - s.x, filter.y_get() - s.y);
+        worst = fmax(worst, error);
+        worst_heading = fmax(worst_heading, fabs(wrap(filter.theta_get() - s.theta)));
+        dead_worst = fmax(dead_worst, hypot(dead_x - s.x, dead_y - s.y));
+
+        // The covariance should own up to the error it has
+        double sigma = sqrt(filter.covariance[EKF_X][EKF_X] + filter.covariance[EKF_Y][EKF_Y]);
+        outside += error > 3 * sigma;
+    }
+    printf("    worst %.2f in %.2f deg, encoders alone %.2f in, %zu of %zu outside 3 sigma\n", worst, worst_heading, dead_worst, outside, run.size() - 1);
+
+    CHECK(worst < 2);
+    CHECK(worst_heading < 2);
+    CHECK(worst * 2 < dead_worst);
+    CHECK(outside < run.size() / 20);
+    for (int i = 0; i < EKF_STATES; i++) {
+        CHECK(filter.covariance[i][i] > 0);
+        for (int j = 0; j < EKF_STATES; j++) CHECK(filter.covariance[i][j] == filter.covariance[j][i]);
+    }
+}
+
+TEST("ekf holds still on a still robot") {
+    test::reset(false);
+    ImuYawModel yaw;
+    ImuRateModel rate(::imu);
+    EncoderModel encoders(TRACK_WIDTH);
+    PoseEKF filter;
+    filter.models_add(&yaw);
+    filter.models_add(&rate);
+    filter.models_add(&encoders);
+    filter.reset(10, -20, 359.5);
+    for (int i = 0; i < 500; i++) {
+        sensors_set(0, 0, 359.5, 0, 0.01);
+        filter.iterate(0.01);
+    }
+    CHECK_NEAR(filter.x_get(), 10, 1e-6);
+    CHECK_NEAR(filter.y_get(), -20, 1e-6);
+    CHECK_NEAR(filter.theta_get(), 359.5, 1e-6);
+    CHECK_NEAR(filter.velocity_get(), 0, 1e-6);
+}
@@ -0,0 +1,109 @@
+#include "test.hpp"
+
+/**
+ * @file gains.cpp
+ * @brief This file contains the tests for gain scheduling.
+ * @details The schedule scales whatever the config holds, so an edited or autotuned constant has
+ * to come through it, and it reads the speed the motion was set with rather than the cap a
+ * profile is moving.
+ */
+
+TEST("scheduled gains scale the configured constants") {
+    test::reset(false);
+    config_set(CFG_TURN_KP, 4);
+    config_set(CFG_TURN_KD, 30);
+    chassis.pid_turn_set(90, 60);
+    gain_schedule_start();
+    chassis.pid_speed_max_set(15);  // a profile easing in
+    chassis.turnPID.error = 5;
+    gain_schedule_iterate();
+    CHECK_NEAR(chassis.turnPID.constants.kp, 4 * 1.2, 1e-9);
+    CHECK_NEAR(chassis.turnPID.constants.kd, 30 * 0.9, 1e-9);
+
+    // The editor changing a constant mid motion lands on the next tick
+    config_set(CFG_TURN_KP, 2);
+    gain_schedule_iterate();
+    CHECK_NEAR(chassis.turnPID.constants.kp, 2 * 1.2, 1e-9);
+
+    // Ending the motion puts the configured constants back
+    chassis.drive_mode_set(ez::DISABLE);
+    gain_schedule_iterate();
+    CHECK_NEAR(chassis.turnPID.constants.kp, 2, 1e-9);
+    CHECK_NEAR(chassis.turnPID.constants.kd, 30, 1e-9);
+    config_reset();
+    config_apply();
+}
+
+TEST("odom motions are scheduled") {
+    test::reset(false);
+    chassis.pid_odom_set({{24_in, 24_in}, fwd, 110});
+    gain_schedule_start();
+    CHECK(chassis.drive_mode_get() == ez::PURE_PURSUIT);
+    chassis.xyPID.error = 36;
+    chassis.current_a_odomPID.error = 5;
+    gain_schedule_iterate();
+    CHECK_NEAR(chassis.xyPID.constants.kp, config_get(CFG_DRIVE_KP) * 0.9, 1e-9);
+    CHECK_NEAR(chassis.xyPID.constants.kd, config_get(CFG_DRIVE_KD) * 1.15, 1e-9);
+    CHECK_NEAR(chassis.current_a_odomPID.constants.kp, config_get(CFG_ANGULAR_KP) * 1.13, 1e-9);
+    chassis.drive_mode_set(ez::DISABLE);
+    gain_schedule_iterate();
+    CHECK_NEAR(chassis.xyPID.constants.kp, config_get(CFG_DRIVE_KP), 1e-9);
+    CHECK_NEAR(chassis.current_a_odomPID.constants.kp, config_get(CFG_ANGULAR_KP), 1e-9);
+}
+
+// EZ copies the angular or boomerang PID into current_a_odomPID as the motion starts and only
+// computes the copy, so that's the one the schedule has to read and write
+TEST("odom motions schedule the angular PID EZ computes") {
+    for (bool boomerang : {false, true}) {
+        test::reset(true);
+        matchState = AUTO;
+        if (boomerang) set_boom({20, 24, 90}, DRIVE_SPEED);
+        else set_mtp({20, 24}, DRIVE_SPEED);
+        pros::delay(100);  // still turning towards the target
+        const ez::PID& angular = chassis.current_a_odomPID;
+        ez::PID::Constants base = config_pid_get(boomerang ? CFG_BOOMERANG_KP : CFG_ANGULAR_KP);
+        CHECK(fabs(angular.error) > 1);
+        gain_schedule_iterate();
+        CHECK_NEAR(angular.constants.kp, gain_scale(base, turn_schedule.get(angular.error, DRIVE_SPEED)).kp, 1e-9);
+        CHECK(fabs(angular.constants.kp - base.kp) > 1e-6);
+        chassis.pid_wait();
+        matchState = DISABLED;
+    }
+}
+
+// Steps a key the way the config editor's buttons do, live
+static void edit(ConfigKeys key, double value) {
+    config_set(key, value);
+    config_apply();
+}
+
+TEST("editor changes reach swings and drives mid motion") {
+    test::reset(false);
+    edit(CFG_SWING_KP, 5);
+    chassis.pid_swing_set(ez::LEFT_SWING, 45, 90);
+    gain_schedule_start();
+    chassis.swingPID.error = 20;
+    gain_schedule_iterate();
+    double swing = chassis.swingPID.constants.kp;
+    edit(CFG_SWING_KP, 7.5);
+    gain_schedule_iterate();
+    CHECK_NEAR(chassis.swingPID.constants.kp, swing * 1.5, 1e-9);
+
+    // Drives schedule the side PIDs. config_apply writes them unscaled, the next tick scales them again
+    edit(CFG_DRIVE_KP, 20);
+    chassis.pid_drive_set(24, 110);
+    gain_schedule_start();
+    chassis.leftPID.error = chassis.rightPID.error = 12;
+    gain_schedule_iterate();
+    double drive = chassis.leftPID.constants.kp;
+    edit(CFG_DRIVE_KP, 10);
+    gain_schedule_iterate();
+    CHECK_NEAR(chassis.leftPID.constants.kp, drive / 2, 1e-9);
+    CHECK_NEAR(chassis.rightPID.constants.kp, drive / 2, 1e-9);
+
+    chassis.drive_mode_set(ez::DISABLE);
+    gain_schedule_iterate();
+    CHECK_NEAR(chassis.leftPID.constants.kp, 10, 1e-9);
+    config_reset();
+    config_apply();
+}
@@ -0,0 +1,80 @@
+#include <cstring>
+#include "host/mock.hpp"
+#include "test.hpp"
+
+/**
+ * @file main.cpp
+ * @brief This file contains the host test runner.
+ * @details Every TEST in host/test registers itself, the runner runs them all or the ones named on
+ * the command line, prints each failure and exits non-zero if any failed.
+ */
+
+namespace test {
+
+static int failures = 0;
+
+std::vector<Case>& cases() {
+    static std::vector<Case> registered;
+    return registered;
+}
+
+void fail(const char* file, int line, const std::string& message) {
+    printf("    %s:%d: %s\n", file, line, message.c_str());
+    failures++;
+}
+
+void reset(bool simulate) {
+    host::reset();
+    chassis.simulate_set(simulate);
+    chassis.pid_targets_reset();
+    chassis.drive_imu_reset();
+    chassis.drive_sensor_reset();
+    chassis.odom_xyt_set(0_in, 0_in, 0_deg);
+    chassis.drive_brake_set(MOTOR_BRAKE_HOLD);
+    chassis.sim.stop();
+    chassis.sim.trace.clear();
+    chassis.tasks = {profile_iterate, gain_schedule_iterate, motion_log_iterate};
+    allianceColor = Alliances::RED;
+    currentPoint = {};
+}
+
+void run(std::function<void()> auton, bool mirrored) {
+    auton_sel.selector_mirrored = mirrored;
+    matchState = AUTO;
+    sideMirrored = mirrored;
+    auton();
+    matchState = DISABLED;
+    sideMirrored = false;
+}
+
+std::vector<Coordinate> dry_run(std::function<void()> auton, bool mirrored) {
+    currentPoint = {};
+    autonPath.clear();
+    dry_run_begin(mirrored);
+    auton();
+    dry_run_end();
+    return autonPath.to_vector();
+}
+
+}  // namespace test
+
+int main(int argc, char** argv) {
+    default_constants();
+    autons_populate();
+    chassis.track_width = chassis.sim.model.track_width = TRACK_WIDTH;
+
+    int ran = 0, failed = 0;
+    for (const test::Case& c : test::cases()) {
+        bool named = argc < 2;
+        for (int i = 1; i < argc; i++) named |= strcmp(argv[i], c.name) == 0;
+        if (!named) continue;
+
+        int before = test::failures;
+        printf("%s\n", c.name);
+        c.body();
+        ran++;
+        failed += test::failures > before;
+    }
+    printf("%d test%s, %d failed\n", ran, ran == 1 ? "" : "s", failed);
+    return failed || ran == 0;
+}
@@ -0,0 +1,123 @@
+#include "test.hpp"
+
+/**
+ * @file mirror.cpp
+ * @brief This file contains the tests for the alliance and side transform.
+ * @details A mirrored auton has to be the exact reflection of the one it was authored as, so the
+ * simulated drive is run through the same motions both ways and every sample of one trace is
+ * checked against the reflection of the other.
+ */
+
+// Reflection across the x axis
+static bool mirror_of(const ez::pose& a, const ez::pose& b, double tolerance) {
+    double heading = fmod(a.theta + b.theta - 180, 360);
+    if (heading > 180) heading -= 360;
+    if (heading < -180) heading += 360;
+    return fabs(a.x - b.x) <= tolerance && fabs(a.y + b.y) <= tolerance && fabs(heading) <= tolerance;
+}
+
+// Every wrapper that takes a target, headings on both sides of 90 and 270 so a reflection that
+// only works in one quadrant shows up
+static void every_motion() {
+    set_position(-47, 16, 90);
+    set_drive(6.0);
+    wait();
+    set_turn(135, TURN_SPEED, cw);
+    wait();
+    set_turn(30);
+    wait();
+    set_swing(LEFT_SWING, 300, SWING_SPEED, 0);
+    wait();
+    set_swing(RIGHT_SWING, 20, SWING_SPEED, 20);
+    wait();
+    set_turn_relative(-45, TURN_SPEED);
+    wait();
+    set_turn({-20, 40}, rev, TURN_SPEED);
+    wait();
+    set_mtp({-24, 30}, DRIVE_SPEED);
+    wait();
+    set_boom({-40, 10, 200}, DRIVE_SPEED, fwd);
+    wait_until({-36, 20});
+    wait();
+    set_drive(-8.0, DRIVE_SPEED, false, false);
+    wait();
+}
+
+TEST("transforms are their own inverse") {
+    for (bool mirrored : {false, true}) {
+        for (Alliances alliance : {Alliances::RED, Alliances::BLUE}) {
+            sideMirrored = mirrored;
+            allianceColor = alliance;
+            for (double theta = -90; theta < 450; theta += 15) {
+                Coordinate point = transform_point(transform_point({12.5, -30.25, theta}));
+                CHECK_NEAR(point.x, 12.5, 1e-9);
+                CHECK_NEAR(point.y, -30.25, 1e-9);
+                CHECK_NEAR(point.t, fmod(theta + 360, 360), 1e-9);
+            }
+            for (e_angle_behavior behavior : {cw, ccw, shortest, longest})
+                CHECK(transform_behavior(transform_behavior(behavior)) == behavior);
+            CHECK(transform_swing(transform_swing(LEFT_SWING)) == LEFT_SWING);
+        }
+    }
+    sideMirrored = false;
+    allianceColor = Alliances::RED;
+}
+
+TEST("mirroring reflects targets and swaps turn directions") {
+    sideMirrored = true;
+    allianceColor = Alliances::RED;
+    Coordinate point = transform_point({-47, 16, 90});
+    CHECK_NEAR(point.x, -47, 1e-9);
+    CHECK_NEAR(point.y, -16, 1e-9);
+    CHECK_NEAR(point.t, 90, 1e-9);
+    CHECK_NEAR(transform_theta(30), 150, 1e-9);
+    CHECK_NEAR(transform_theta(300), 240, 1e-9);
+    CHECK(transform_behavior(cw) == ccw);
+    CHECK(transform_behavior(ccw) == cw);
+    CHECK(transform_behavior(shortest) == shortest);
+    CHECK(transform_swing(LEFT_SWING) == RIGHT_SWING);
+    CHECK(transform_swing(RIGHT_SWING) == LEFT_SWING);
+    sideMirrored = false;
+}
+
+TEST("mirrored motions are exact inverses") {
+    test::reset(true);
+    test::run(every_motion, false);
+    std::vector<host::TracePoint> authored = chassis.sim.trace;
+    test::reset(true);
+    test::run(every_motion, true);
+    const std::vector<host::TracePoint>& mirrored = chassis.sim.trace;
+
+    CHECK(authored.size() > 100);
+    CHECK(authored.size() == mirrored.size());
+    size_t bad = 0;
+    for (size_t i = 0; i < authored.size() && i < mirrored.size(); i++) {
+        if (mirror_of(authored[i].pose, mirrored[i].pose, 1e-6)) continue;
+        if (bad++ == 0) {
+            char message[160];
+            snprintf(message, sizeof(message), "at %.2f s (%.3f, %.3f, %.3f) against (%.3f, %.3f, %.3f)", authored[i].time / 1e6, authored[i].pose.x,
+                     authored[i].pose.y, authored[i].pose.theta, mirrored[i].pose.x, mirrored[i].pose.y, mirrored[i].pose.theta);
+            test::fail(__FILE__, __LINE__, message);
+        }
+    }
+    CHECK(bad == 0);
+}
+
+TEST("mirrored autons pair with the routine they reflect") {
+    for (const AutonObj& auton : auton_sel.autons) {
+        if (!auton.mirrored) continue;
+        bool paired = false;
+        auto routine = *auton.callback.target<void (*)()>();
+        for (const AutonObj& other : auton_sel.autons) {
+            auto other_routine = other.callback.target<void (*)()>();
+            paired |= !other.mirrored && other_routine && *other_routine == routine;
+        }
+        CHECK(paired);
+
+        std::vector<Coordinate> authored = test::dry_run(auton.callback, false);
+        std::vector<Coordinate> mirrored = test::dry_run(auton.callback, true);
+        CHECK(!authored.empty() && !mirrored.empty());
+        if (authored.empty() || mirrored.empty()) continue;
+        CHECK(mirror_of({authored[0].x, authored[0].y, authored[0].t}, {mirrored[0].x, mirrored[0].y, mirrored[0].t}, 1e-9));
+    }
+}
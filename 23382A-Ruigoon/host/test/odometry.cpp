@@ -0,0 +1,77 @@
+#include "test.hpp"
+
+/**
+ * @file odometry.cpp
+ * @brief This file contains the tests for the pose history the odometry task publishes into.
+ * @details Each test fills its own history the way the task does, one sample per ODOM_PERIOD, and
+ * reads it back the way other tasks look up where the robot was.
+ */
+
+static const uint64_t PERIOD_US = ODOM_PERIOD * 1000;
+
+TEST("pose history interpolates between the samples that bracket a time") {
+    static PoseHistory history;
+    PoseSample out;
+    CHECK(!history.latest(out));
+    CHECK(!history.at(0, out));
+
+    for (int i = 0; i < 10; i++) history.push({1000 + i * PERIOD_US, i * 2.0, -i * 1.0, 90.0 + i});
+    CHECK(history.latest(out));
+    CHECK(out.time == 1000 + 9 * PERIOD_US);
+
+    // A quarter of the way from sample 3 to sample 4
+    CHECK(history.at(1000 + 3 * PERIOD_US + PERIOD_US / 4, out));
+    CHECK_NEAR(out.x, 6.5, 1e-9);
+    CHECK_NEAR(out.y, -3.25, 1e-9);
+    CHECK_NEAR(out.t, 93.25, 1e-9);
+
+    // On a sample, at either end
+    CHECK(history.at(1000, out));
+    CHECK_NEAR(out.x, 0, 1e-9);
+    CHECK(history.at(1000 + 9 * PERIOD_US, out));
+    CHECK_NEAR(out.x, 18, 1e-9);
+
+    // Past the newest sample it holds the newest pose, but says it didn't have the time
+    CHECK(!history.at(1000 + 10 * PERIOD_US, out));
+    CHECK_NEAR(out.x, 18, 1e-9);
+    CHECK(!history.at(999, out));
+}
+
+TEST("pose history turns the short way across 0 and 360") {
+    static PoseHistory history;
+    history.push({0, 0, 0, 350});
+    history.push({PERIOD_US, 0, 0, 10});
+    history.push({2 * PERIOD_US, 0, 0, 340});
+    PoseSample out;
+    CHECK(history.at(PERIOD_US / 4, out));
+    CHECK_NEAR(out.t, 355, 1e-9);
+    CHECK(history.at(PERIOD_US * 3 / 4, out));
+    CHECK_NEAR(out.t, 5, 1e-9);
+    CHECK(history.at(PERIOD_US / 2, out));
+    CHECK(out.t >= 0 && out.t < 360);
+    CHECK(fabs(util::wrap_angle(out.t)) < 1e-9);
+    // Back across 0 the other way
+    CHECK(history.at(PERIOD_US + PERIOD_US / 2, out));
+    CHECK_NEAR(out.t, 355, 1e-9);
+}
+
+TEST("pose history refuses times older than it keeps") {
+    static PoseHistory history;
+    // Round the ring a few times so the slots have been reused
+    const uint32_t pushed = ODOM_HISTORY * 3 + 17;
+    for (uint32_t i = 0; i < pushed; i++) history.push({i * PERIOD_US, (double)i, 0, 0});
+
+    PoseSample out;
+    CHECK(history.latest(out));
+    CHECK_NEAR(out.x, pushed - 1, 1e-9);
+
+    // The oldest slot is left for the writer to reuse, so one less than the ring holds can be read
+    uint32_t oldest = pushed - (ODOM_HISTORY - 1);
+    CHECK(history.at(oldest * PERIOD_US, out));
+    CHECK_NEAR(out.x, oldest, 1e-9);
+    CHECK(history.at(oldest * PERIOD_US + PERIOD_US / 2, out));
+    CHECK_NEAR(out.x, oldest + 0.5, 1e-9);
+    CHECK(!history.at((oldest - 1) * PERIOD_US, out));
+    CHECK(!history.at((oldest - 1) * PERIOD_US + PERIOD_US / 2, out));
+    CHECK(!history.at(0, out));
+}
@@ -0,0 +1,104 @@
+#include "host/mock.hpp"
+#include "test.hpp"
+
+/**
+ * @file preview.cpp
+ * @brief This file contains the host tests for the preview task's dry runs.
+ * @details The preview task dry runs autons while opcontrol is driving, so a dry run has to keep
+ * its hands off the mechanisms and the match state everything else reads.
+ */
+
+// Outputs recorded from command first on, test::reset sets the brake itself
+static size_t outputs(size_t first) {
+    size_t found = 0;
+    const std::vector<host::Command>& commands = host::commands();
+    for (size_t i = first; i < commands.size(); i++) {
+        const host::Command& command = commands[i];
+        found += command.device.rfind("motor", 0) == 0 || command.device.rfind("piston", 0) == 0 || command.action == "drive_set" ||
+                 command.action == "drive_brake_set";
+    }
+    return found;
+}
+
+TEST("a dry run leaves the robot and the match state alone") {
+    for (const AutonObj& auton : auton_sel.autons) {
+        test::reset(false);
+        matchState = DRIVER;
+        sideMirrored = !auton.mirrored;
+        size_t first = host::commands().size();
+        std::vector<Coordinate> path = test::dry_run(auton.callback, auton.mirrored);
+        if (outputs(first) != 0) printf("    %s moved a mechanism\n", auton.name.c_str());
+        CHECK(outputs(first) == 0);
+        CHECK(matchState == DRIVER);
+        CHECK(sideMirrored == !auton.mirrored);
+        CHECK(!dry_running());
+    }
+    matchState = DISABLED;
+    sideMirrored = false;
+}
+
+TEST("a dry run sees its own mirroring whatever is selected") {
+    test::reset(false);
+    sideMirrored = true;
+    std::vector<Coordinate> left = test::dry_run(sixThree, false);
+    sideMirrored = false;
+    std::vector<Coordinate> right = test::dry_run(sixThree, true);
+    // The two sides end differently, they start reflected
+    CHECK(!left.empty() && !right.empty());
+    if (left.empty() || right.empty()) return;
+    CHECK_NEAR(right.front().y, -left.front().y, 1e-9);
+    CHECK_NEAR(right.front().x, left.front().x, 1e-9);
+}
+
+TEST("only a dry run records the path") {
+    test::reset(false);
+    autonPath.clear();
+    matchState = DISABLED;
+    set_position(0, 0, 0);
+    set_drive(24);
+    set_piston(piston_wing, true);
+    CHECK(autonPath.empty());
+    dry_run_begin(false);
+    set_position(0, 0, 0);
+    set_drive(24);
+    dry_run_end();
+    CHECK(autonPath.size() == 2);
+}
+
+TEST("driver control doesn't record pistons into the path") {
+    test::reset(false);
+    autonPath.clear();
+    matchState = DRIVER;
+    for (int tick = 0; tick < 10; tick++) {
+        driver_input.buttons_set(tick % 2 ? 1 << (BUTTON_WING - pros::E_CONTROLLER_DIGITAL_L1) : 0);
+        control_piston_hold(piston_wing, BUTTON_WING);
+    }
+    CHECK(autonPath.empty());
+    CHECK(piston_wing.get());  // the output itself still goes out
+    matchState = DISABLED;
+    driver_input = DriverInput();
+}
+
+// A characterised drive has its own kS and kV per side, so a point turn's sides no longer cancel exactly
+TEST("point turns inject with a characterised drive") {
+    Feedforward left_fit = ff_left, right_fit = ff_right;
+    ff_left.ks = 9;
+    ff_left.kv = 1.6;
+    ff_right.ks = 11;
+    ff_right.kv = 1.5;
+
+    std::vector<Coordinate> turn = injectPoint({0, 0, 0}, {0, 0, 90}, cw, TURN_SPEED, -TURN_SPEED, 90, 1);
+    printf("    %zu points\n", turn.size());
+    CHECK(turn.size() > 5 && turn.size() < 100);
+    if (!turn.empty()) CHECK_NEAR(turn.back().t, 90, 15);
+    // The slower side drifts it a little off the spot
+    for (const Coordinate& point : turn) CHECK(hypot(point.x, point.y) < 2);
+
+    // Both sides below kS, the robot stays put
+    std::vector<Coordinate> stalled = injectPoint({0, 0, 0}, {0, 0, 90}, cw, 5, -5, 90, 1);
+    CHECK(stalled.size() == 1);
+    if (!stalled.empty()) CHECK_NEAR(stalled[0].t, 90, 1e-9);
+
+    ff_left = left_fit;
+    ff_right = right_fit;
+}
@@ -0,0 +1,89 @@
+#include "host/mock.hpp"
+#include "test.hpp"
+
+/**
+ * @file profile.cpp
+ * @brief This file contains the host tests for the S-curve profiles the motion wrappers follow.
+ * @details The profile task gets a tick ahead of every control tick the way it runs on the brain,
+ * along with the gain schedule and motion log, and the drive is the simulated one, whose wheels
+ * slip once a side pushes harder than they grip.
+ */
+
+class StepResult {
+    public:
+        double seconds;  // to exit
+        double slip;     // in
+        double error;    // in short of the target at exit
+        double peak;     // in/s^2, hardest the robot sped up or slowed down
+};
+
+// A 48 in drive from rest, set by start, through to its exit on tiles that grip as well as traction
+static StepResult drive_step(double traction, std::function<void()> start) {
+    test::reset(true);
+    chassis.sim.model.traction = traction;
+    matchState = AUTO;
+    uint64_t begin = host::now();
+    start();
+    chassis.pid_wait();
+    matchState = DISABLED;
+    chassis.sim.model.traction = host::DriveModel().traction;
+
+    double peak = 0;
+    const std::vector<host::TracePoint>& trace = chassis.sim.trace;
+    for (size_t i = 1; i < trace.size(); i++) {
+        double speed = (trace[i].left_velocity + trace[i].right_velocity) / 2, last = (trace[i - 1].left_velocity + trace[i - 1].right_velocity) / 2;
+        peak = fmax(peak, fabs(speed - last) / ((trace[i].time - trace[i - 1].time) / 1e6));
+    }
+    return {(host::now() - begin) / 1e6, chassis.sim.slip, 48 - chassis.odom_y_get(), peak};
+}
+
+// EZ's linear slew as its examples set it up, the wrappers use the S-curve instead
+static void linear_slew(double distance) {
+    chassis.slew_drive_constants_set(3_in, 70);
+    chassis.pid_drive_set(distance, DRIVE_SPEED, true);
+}
+
+// Worn wheels or dusty tiles grip less than the model's default
+TEST("the S-curve holds traction a linear slew loses") {
+    for (double traction : {host::DriveModel().traction, 0.45}) {
+        StepResult none = drive_step(traction, [] { chassis.pid_drive_set(48, DRIVE_SPEED, false); });
+        StepResult linear = drive_step(traction, [] { linear_slew(48); });
+        StepResult scurve = drive_step(traction, [] { set_drive(48, DRIVE_SPEED, true, false); });
+        printf("    traction %.2f\n", traction);
+        for (auto [name, r] : {std::pair{"no slew", none}, {"linear slew", linear}, {"S-curve", scurve}}) {
+            printf("      %-12s %.2f s to exit, %.2f in of slip, %.2f in short, peak %.0f in/s^2\n", name, r.seconds, r.slip, r.error, r.peak);
+        }
+        CHECK(none.slip > 0);
+        CHECK(scurve.slip <= linear.slip);
+        CHECK(fabs(scurve.error) <= fabs(linear.error));
+        // Easing in and out costs time over the linear ramp, this is how much it's allowed
+        CHECK(scurve.seconds < linear.seconds * 1.5);
+    }
+    // What slip the S-curve has left on slick tiles is the PID braking at the end, not the launch
+    StepResult linear = drive_step(0.45, [] { linear_slew(48); });
+    StepResult scurve = drive_step(0.45, [] { set_drive(48, DRIVE_SPEED, true, false); });
+    CHECK(scurve.slip < linear.slip / 2);
+}
+
+TEST("a new motion stops the last one's profile") {
+    test::reset(true);
+    matchState = AUTO;
+    set_drive(48, DRIVE_SPEED, true, false);
+    chassis.pid_wait_until(12);  // the profile is still cruising
+    set_turn(90, TURN_SPEED);
+    pros::delay(50);
+    CHECK(chassis.pid_speed_max_get() == TURN_SPEED);
+    matchState = DISABLED;
+}
+
+TEST("the config editor sets the S-curve limits") {
+    config_set(CFG_PROFILE_DRIVE_ACCEL, 90);
+    config_set(CFG_PROFILE_TURN_JERK, 9000);
+    config_apply();
+    CHECK_NEAR(drive_profile_limits.acceleration, 90, 1e-9);
+    CHECK_NEAR(turn_profile_limits.jerk, 9000, 1e-9);
+    config_reset();
+    config_apply();
+    CHECK_NEAR(drive_profile_limits.acceleration, 120, 1e-9);
+    CHECK_NEAR(turn_profile_limits.jerk, 15000, 1e-9);
+}
@@ -0,0 +1,38 @@
+#include "test.hpp"
+
+/**
+ * @file relocalize.cpp
+ * @brief This file contains the tests for the field model the wall sensors are checked against.
+ */
+
+static double beam(double x, double y, double heading, WallAxis* axis = nullptr) { return field_wall_distance(x, y, util::to_rad(heading), axis); }
+
+TEST("beams stop at the first structure in their way") {
+    WallAxis axis;
+    // Toward a long goal face, and past its end to the wall
+    CHECK_NEAR(beam(0, 0, 0, &axis), 45.75, 1e-9);
+    CHECK(axis == WALL_Y);
+    CHECK_NEAR(beam(-30, 0, 0), 72, 1e-9);
+    // Into the end of a long goal
+    CHECK_NEAR(beam(-40, 48, 90, &axis), 15, 1e-9);
+    CHECK(axis == WALL_X);
+    // Onto a match loader's front rather than the wall behind it
+    CHECK_NEAR(beam(-40, 48, 270), 27.5, 1e-9);
+    CHECK_NEAR(beam(-40, 40, 270), 32, 1e-9);
+    // Onto the park zone barrier, and along its open side into the wall
+    CHECK_NEAR(beam(-40, 0, 270), 15.5, 1e-9);
+    CHECK_NEAR(beam(-64, 0, 0, &axis), 9, 1e-9);
+    CHECK(axis == WALL_Y);
+}
+
+TEST("the field model is symmetric about both axes") {
+    for (double heading = 0; heading < 360; heading += 7.5) {
+        for (double x : {-50.0, -20.0, 10.0}) {
+            for (double y : {-30.0, 5.0, 60.0}) {
+                double d = beam(x, y, heading);
+                CHECK_NEAR(beam(x, -y, 180 - heading), d, 1e-6);
+                CHECK_NEAR(beam(-x, y, -heading), d, 1e-6);
+            }
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+#include "main.h"
+
+// A small registry of host tests. TEST defines one and registers it before main runs, CHECK and
+// CHECK_NEAR report a failure with where it happened and carry on, so one run shows every failure
+namespace test {
+
+class Case {
+    public:
+        const char* name;
+        std::function<void()> body;
+};
+
+std::vector<Case>& cases();
+void fail(const char* file, int line, const std::string& message);
+
+class Register {
+    public:
+        Register(const char* name, std::function<void()> body) { cases().push_back({name, body}); }
+};
+
+// Puts the chassis, clock and selector back the way the runner starts an auton, with the
+// simulation on or off. Simulating, the profile, gain schedule and motion log tasks run too
+void reset(bool simulate);
+// Runs an auton the way autonomous() starts it
+void run(std::function<void()> auton, bool mirrored);
+// The path an auton records when the preview task dry runs it
+std::vector<Coordinate> dry_run(std::function<void()> auton, bool mirrored);
+
+}  // namespace test
+
+#define TEST_JOIN(a, b) a##b
+#define TEST_CAT(a, b) TEST_JOIN(a, b)
+#define TEST(name)                                                                      \
+    static void TEST_CAT(test_, __LINE__)();                                            \
+    static test::Register TEST_CAT(register_, __LINE__)(name, TEST_CAT(test_, __LINE__)); \
+    static void TEST_CAT(test_, __LINE__)()
+
+#define CHECK(condition) \
+    do { if (!(condition)) test::fail(__FILE__, __LINE__, #condition); } while (0)
+
+#define CHECK_NEAR(actual, expected, tolerance)                                                    \
+    do {                                                                                           \
+        double a_ = (actual), e_ = (expected);                                                     \
+        if (!(fabs(a_ - e_) <= (tolerance))) {                                                     \
+            char message_[256];                                                                    \
+            snprintf(message_, sizeof(message_), "%s = %g, expected %s = %g", #actual, a_, #expected, e_); \
+            test::fail(__FILE__, __LINE__, message_);                                              \
+        }                                                                                          \
+    } while (0)
@@ -4,8 +4,7 @@ void default_constants();
 
 void doNothing();
 void SAWP();
-void sixThreeLeft();
-void sixThreeRight();
+void sixThree();  // registered mirrored as well
 void fourFiveLeft();
 void fourFiveRight();
 void left7();
@@ -13,3 +12,4 @@ void right7();
 void skills();
 void fourFive();
 void measure_offsets();
+void autons_populate();  // fills the selector with the routines above
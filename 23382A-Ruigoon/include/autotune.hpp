@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+enum TuneAxes {TUNE_TURN = 0, TUNE_SWING = 1, TUNE_DRIVE = 2};
+
+// Relay experiment settings per axis. The relay swings the output between +amplitude and -amplitude
+// (in drive_set units) whenever the error crosses +-hysteresis
+inline const int TUNE_AMPLITUDE[3] = {45, 60, 40};
+inline const double TUNE_HYSTERESIS[3] = {0.5, 0.5, 0.2};   // degrees, degrees, inches
+inline const double TUNE_RUNAWAY[3] = {45, 45, 10};          // aborts if the error gets this big
+inline const int TUNE_CYCLES = 6;                             // oscillations averaged, after 2 to settle
+inline const int TUNE_TIMEOUT = 10000;                        // ms
+
+// A proposal is kept if every validation step settles with less overshoot than this
+inline const double TUNE_OVERSHOOT_MAX[3] = {3, 4, 1};       // degrees, degrees, inches
+inline const char* TUNE_LOG_FILE = "/usd/autotune.csv";
+
+class TuneResult {
+    public:
+        TuneAxes axis;
+        double ultimate_gain = 0;    // Ku, drive_set units per degree / inch
+        double ultimate_period = 0;  // Tu, seconds
+        ez::PID::Constants proposed = {0, 0, 0, 0};
+        double overshoot = 0;        // worst validation step
+        double settle = 0;           // mean validation settle time, ms
+        bool accepted = false;
+        std::string reason;
+};
+
+TuneResult autotune(TuneAxes axis);
+void autotune_turn();
+void autotune_swing();
+void autotune_drive();
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+// Something a widget shows, polled by bindings_task
+class BindingBase {
+    public:
+        virtual ~BindingBase() = default;
+        virtual bool poll() = 0;
+        void invalidate() { dirty = true; }  // apply on the next poll even if nothing changed
+        bool enabled = true;
+
+    protected:
+        bool dirty = true;
+};
+
+// Pushes a value into a widget only when it really changes, by more than epsilon for numbers and at
+// all for anything else, and at most once every period ms. A change inside the period is applied
+// when it ends. value() is already the new value when apply runs
+template <typename T>
+class Binding : public BindingBase {
+    public:
+        Binding(std::function<T()> read, std::function<void(const T&)> apply, T epsilon = T(), uint32_t period = 0)
+            : read(read), apply(apply), epsilon(epsilon), period(period) {}
+
+        bool poll() override {
+            if (!enabled) return false;
+            uint32_t now = pros::millis();
+            if (!dirty && now - last < period) return false;
+            T next = read();
+            if (!dirty && !changed(next)) return false;
+            current = next;
+            last = now;
+            dirty = false;
+            apply(current);
+            return true;
+        }
+        const T& value() const { return current; }
+
+    private:
+        std::function<T()> read;
+        std::function<void(const T&)> apply;
+        T epsilon;
+        uint32_t period;
+        T current = T();
+        uint32_t last = 0;
+
+        bool changed(const T& next) const {
+            if constexpr (std::is_arithmetic_v<T>) return std::fabs((double)next - (double)current) > (double)epsilon;
+            else return !(next == current);
+        }
+};
+
+void bindings_add(BindingBase* binding);
+void bindings_poll();
+void bindings_task();
+
+inline const int BINDINGS_PERIOD = 10;
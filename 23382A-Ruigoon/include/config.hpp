@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+// Robot settings that can be retuned on the brain without a rebuild. The values compiled in below
+// are the defaults, /usd/config.bin overrides them at startup. Keys are stored in the file, so
+// only ever add new ones at the end and never renumber
+enum ConfigKeys {
+    CFG_DRIVE_SPEED = 0, CFG_TURN_SPEED, CFG_SWING_SPEED, CFG_DRIVE_CURVE, CFG_TRACK_WIDTH,
+    CFG_DRIVE_KP, CFG_DRIVE_KI, CFG_DRIVE_KD, CFG_DRIVE_START_I,
+    CFG_HEADING_KP, CFG_HEADING_KI, CFG_HEADING_KD, CFG_HEADING_START_I,
+    CFG_TURN_KP, CFG_TURN_KI, CFG_TURN_KD, CFG_TURN_START_I,
+    CFG_SWING_KP, CFG_SWING_KI, CFG_SWING_KD, CFG_SWING_START_I,
+    CFG_ANGULAR_KP, CFG_ANGULAR_KI, CFG_ANGULAR_KD, CFG_ANGULAR_START_I,
+    CFG_BOOMERANG_KP, CFG_BOOMERANG_KI, CFG_BOOMERANG_KD, CFG_BOOMERANG_START_I,
+    CFG_TURN_SMALL_TIME, CFG_TURN_SMALL_ERROR, CFG_TURN_BIG_TIME, CFG_TURN_BIG_ERROR, CFG_TURN_VELOCITY_TIME, CFG_TURN_MA_TIME,
+    CFG_SWING_SMALL_TIME, CFG_SWING_SMALL_ERROR, CFG_SWING_BIG_TIME, CFG_SWING_BIG_ERROR, CFG_SWING_VELOCITY_TIME, CFG_SWING_MA_TIME,
+    CFG_DRIVE_SMALL_TIME, CFG_DRIVE_SMALL_ERROR, CFG_DRIVE_BIG_TIME, CFG_DRIVE_BIG_ERROR, CFG_DRIVE_VELOCITY_TIME, CFG_DRIVE_MA_TIME,
+    CFG_ODOM_TURN_SMALL_TIME, CFG_ODOM_TURN_SMALL_ERROR, CFG_ODOM_TURN_BIG_TIME, CFG_ODOM_TURN_BIG_ERROR, CFG_ODOM_TURN_VELOCITY_TIME, CFG_ODOM_TURN_MA_TIME,
+    CFG_ODOM_DRIVE_SMALL_TIME, CFG_ODOM_DRIVE_SMALL_ERROR, CFG_ODOM_DRIVE_BIG_TIME, CFG_ODOM_DRIVE_BIG_ERROR, CFG_ODOM_DRIVE_VELOCITY_TIME, CFG_ODOM_DRIVE_MA_TIME,
+    CFG_TURN_CHAIN, CFG_SWING_CHAIN, CFG_DRIVE_CHAIN,
+    // Held EZ's slew constants until the S-curve profiles took over from its slew. Kept so the keys after them don't move
+    CFG_RETIRED_0, CFG_RETIRED_1, CFG_RETIRED_2, CFG_RETIRED_3, CFG_RETIRED_4, CFG_RETIRED_5,
+    CFG_ODOM_TURN_BIAS, CFG_LOOK_AHEAD, CFG_BOOMERANG_DISTANCE, CFG_BOOMERANG_DLEAD,
+    CFG_TELEMETRY,
+    CFG_PROFILE_DRIVE_ACCEL, CFG_PROFILE_DRIVE_JERK, CFG_PROFILE_TURN_ACCEL, CFG_PROFILE_TURN_JERK,
+    CFG_COUNT
+};
+
+// One setting and how the editor page steps it. Retired keys have no name, the editor and the
+// file leave them out
+class ConfigField {
+    public:
+        const char* name;
+        double value;
+        double step;
+        double min;
+        double max;
+};
+
+inline const char* CONFIG_FILE = "/usd/config.bin";
+inline const uint8_t CONFIG_VERSION = 1;
+
+// In ConfigKeys order
+inline ConfigField config_fields[CFG_COUNT] = {
+    {"drive speed", 110, 1, 0, 127}, {"turn speed", 90, 1, 0, 127}, {"swing speed", 110, 1, 0, 127},
+    {"drive curve", 4.0, 0.1, 0, 10}, {"track width", 11, 0.05, 5, 20},
+    {"drive kP", 20.0, 0.5, 0, 100}, {"drive kI", 0.0, 0.01, 0, 10}, {"drive kD", 100.0, 1, 0, 500}, {"drive start I", 0.0, 0.5, 0, 50},
+    {"heading kP", 11.0, 0.5, 0, 100}, {"heading kI", 0.0, 0.01, 0, 10}, {"heading kD", 20.0, 1, 0, 500}, {"heading start I", 0.0, 0.5, 0, 50},
+    {"turn kP", 3.0, 0.1, 0, 50}, {"turn kI", 0.05, 0.01, 0, 10}, {"turn kD", 20.0, 1, 0, 500}, {"turn start I", 15.0, 0.5, 0, 90},
+    {"swing kP", 6.0, 0.1, 0, 50}, {"swing kI", 0.0, 0.01, 0, 10}, {"swing kD", 65.0, 1, 0, 500}, {"swing start I", 0.0, 0.5, 0, 90},
+    {"odom angular kP", 6.5, 0.1, 0, 50}, {"odom angular kI", 0.0, 0.01, 0, 10}, {"odom angular kD", 52.5, 1, 0, 500}, {"odom angular start I", 0.0, 0.5, 0, 90},
+    {"boomerang kP", 5.8, 0.1, 0, 50}, {"boomerang kI", 0.0, 0.01, 0, 10}, {"boomerang kD", 32.5, 1, 0, 500}, {"boomerang start I", 0.0, 0.5, 0, 90},
+    {"turn small ms", 90, 10, 0, 2000}, {"turn small deg", 3, 0.25, 0, 45}, {"turn big ms", 250, 10, 0, 2000},
+    {"turn big deg", 7, 0.25, 0, 45}, {"turn velocity ms", 500, 10, 0, 5000}, {"turn mA ms", 500, 10, 0, 5000},
+    {"swing small ms", 90, 10, 0, 2000}, {"swing small deg", 3, 0.25, 0, 45}, {"swing big ms", 250, 10, 0, 2000},
+    {"swing big deg", 7, 0.25, 0, 45}, {"swing velocity ms", 500, 10, 0, 5000}, {"swing mA ms", 500, 10, 0, 5000},
+    {"drive small ms", 90, 10, 0, 2000}, {"drive small in", 1, 0.25, 0, 24}, {"drive big ms", 250, 10, 0, 2000},
+    {"drive big in", 3, 0.25, 0, 24}, {"drive velocity ms", 500, 10, 0, 5000}, {"drive mA ms", 500, 10, 0, 5000},
+    {"odom turn small ms", 90, 10, 0, 2000}, {"odom turn small deg", 3, 0.25, 0, 45}, {"odom turn big ms", 250, 10, 0, 2000},
+    {"odom turn big deg", 7, 0.25, 0, 45}, {"odom turn velocity ms", 500, 10, 0, 5000}, {"odom turn mA ms", 750, 10, 0, 5000},
+    {"odom drive small ms", 90, 10, 0, 2000}, {"odom drive small in", 1, 0.25, 0, 24}, {"odom drive big ms", 250, 10, 0, 2000},
+    {"odom drive big in", 3, 0.25, 0, 24}, {"odom drive velocity ms", 500, 10, 0, 5000}, {"odom drive mA ms", 750, 10, 0, 5000},
+    {"turn chain deg", 3, 0.25, 0, 45}, {"swing chain deg", 5, 0.25, 0, 45}, {"drive chain in", 3, 0.25, 0, 24},
+    {}, {}, {}, {}, {}, {},
+    {"odom turn bias", 0.9, 0.05, 0, 1}, {"look ahead in", 7, 0.5, 1, 36}, {"boomerang distance in", 16, 0.5, 0, 72}, {"boomerang dlead", 0.625, 0.025, 0, 1},
+    {"telemetry on", 0, 1, 0, 1},
+    {"profile drive in/s2", 120, 10, 10, 1000}, {"profile drive in/s3", 1200, 100, 100, 10000},
+    {"profile turn deg/s2", 1500, 50, 100, 10000}, {"profile turn deg/s3", 15000, 500, 1000, 100000},
+};
+
+inline double config_get(ConfigKeys key) { return config_fields[key].value; }
+// The four constants starting at a kP key, kP, kI, kD and start I
+inline ez::PID::Constants config_pid_get(ConfigKeys kp) {
+    return {config_get(kp), config_get((ConfigKeys)(kp + 1)), config_get((ConfigKeys)(kp + 2)), config_get((ConfigKeys)(kp + 3))};
+}
+void config_set(ConfigKeys key, double value);  // clamped to the field's range
+void config_reset();  // back to the compiled defaults
+bool config_load();  // false keeps the defaults: no card, no file, wrong version or a bad checksum
+bool config_save();  // queued on the SD writer
+void config_apply();  // pushes the PID, exit, profile and odom settings into the chassis
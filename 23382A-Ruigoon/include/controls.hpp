@@ -10,6 +10,25 @@ inline MatchStates matchState = DISABLED;
 enum Alliances {BLUE = 0, NONE = 1, RED = 2};
 inline Alliances allianceColor = Alliances::NONE; // for now
 enum RollerStates {INTAKE = 0, OUTTAKE = 1, SCORE = 2, SCORE_MID = 3, STOP = 4};
+inline RollerStates rollerState = STOP; // last state passed to set_rollers(RollerStates)
+
+// Driver input for one control tick, read from the controller or fed back from a recording
+class DriverInput {
+    public:
+        int8_t analog[4] = {0, 0, 0, 0}; // indexed by pros::controller_analog_e_t
+        uint16_t buttons = 0;            // one bit per digital button, L1 is bit 0
+        uint16_t pressed = 0;            // buttons that went down this tick
+
+        int get_analog(pros::controller_analog_e_t channel) const { return analog[channel]; }
+        bool get_digital(pros::controller_digital_e_t button) const { return buttons & (1 << (button - pros::E_CONTROLLER_DIGITAL_L1)); }
+        bool get_digital_new_press(pros::controller_digital_e_t button) const { return pressed & (1 << (button - pros::E_CONTROLLER_DIGITAL_L1)); }
+        void buttons_set(uint16_t state) { pressed = state & ~buttons; buttons = state; }
+};
+
+inline DriverInput driver_input;
+
+void driver_input_read();
+void driver_control();
 
 
 void intake_t();
@@ -25,4 +44,7 @@ void control_rollers();
 
 void set_piston(ez::Piston& piston, bool state);
 void control_piston_toggle(ez::Piston& piston, pros::controller_digital_e_t button);
-void control_piston_hold(ez::Piston& piston, pros::controller_digital_e_t button);
\ No newline at end of file
+void control_piston_hold(ez::Piston& piston, pros::controller_digital_e_t button);
+
+uint8_t piston_states_get();
+void piston_states_set(uint8_t states);
\ No newline at end of file
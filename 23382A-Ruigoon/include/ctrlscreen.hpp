@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+// Everything shown on or rumbled by the controller goes through one task. The controller drops
+// anything sent less than 50 ms after the last write, so callers only post what they want shown
+// and never wait. Each line shows its highest priority message, only lines that changed are sent,
+// and when several are waiting the highest priority one goes first
+enum ControllerPriorities {
+    CTRL_LOW = 0,     // background status
+    CTRL_NORMAL = 1,  // debug pages, recorder state
+    CTRL_HIGH = 2     // what the driver has to see, heading, jams, a failed IMU
+};
+inline const int CTRL_PRIORITIES = 3;
+inline const int CONTROLLER_LINES = 3;
+inline const int CONTROLLER_COLUMNS = 15;
+inline const int CONTROLLER_PERIOD = 50;  // ms between writes the controller will take
+
+// hold is how long the message stays in ms, 0 keeps it until it's replaced or cleared
+void controller_print(int line, const std::string& text, ControllerPriorities priority = CTRL_NORMAL, uint32_t hold = 0);
+void controller_clear(int line, ControllerPriorities priority = CTRL_NORMAL);
+// Rumbles waiting to be sent are replaced by a newer one of at least their priority
+void controller_rumble(const char* pattern, ControllerPriorities priority = CTRL_NORMAL);
+void controller_screen_task();
@@ -8,6 +8,9 @@
 
 const int KEY = 267267;
 
+// What a path point marks on the preview trail
+enum PathEvents {EVENT_NONE = 0, EVENT_WAIT = 1, EVENT_ROLLERS = 2, EVENT_PISTON = 3};
+
 class Coordinate {
     public: 
         double x = 0;
@@ -16,10 +19,36 @@ class Coordinate {
         double right = 127;
         double left = 0;
         ez::e_angle_behavior behavior = ez::cw;
+        PathEvents event = EVENT_NONE;
+};
+
+// Path recorded by the wrappers for the selector preview. Storage is fixed at compile time and
+// points are only kept on the task running a dry run (see dry_running), so a real run never
+// grows it and opcontrol can't race the preview task over it. Points past the capacity are
+// dropped and counted
+inline const size_t PATH_CAPACITY = 1024;
+
+class PathArena {
+    public:
+        void push_back(const Coordinate& point);
+        void clear() { count = 0; overflow = 0; }
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+        size_t dropped() const { return overflow; }
+        const Coordinate& front() const { return points[0]; }
+        const Coordinate& back() const { return points[count - 1]; }
+        const Coordinate* begin() const { return points; }
+        const Coordinate* end() const { return points + count; }
+        std::vector<Coordinate> to_vector() const { return std::vector<Coordinate>(begin(), end()); }
+
+    private:
+        Coordinate points[PATH_CAPACITY];
+        size_t count = 0;
+        size_t overflow = 0;
 };
 
 extern Coordinate currentPoint;
-extern vector<Coordinate> autonPath;
+extern PathArena autonPath;
 
 // Internal math
 double get_distance(Coordinate point1, Coordinate point2);
@@ -31,6 +60,17 @@ Coordinate get_point(Coordinate startPoint, double v_left, double v_right, doubl
 std::vector<Coordinate> injectPoint(Coordinate startPoint, Coordinate endPoint, e_angle_behavior behavior, double left, double right, double theta, double lookAhead);
 std::vector<Coordinate> injectPath(std::vector<Coordinate> coordList, double lookAhead);
 
+// Alliance / side transform
+// Autons are authored once for the red alliance on the side they were written for.
+// Every wrapper passes its targets through this layer, so blue rotates the whole path 180 degrees
+// about the field center and sideMirrored reflects it across the x axis to run on the other side.
+inline bool sideMirrored = false;
+
+Coordinate transform_point(Coordinate point);
+double transform_theta(double theta);
+ez::e_angle_behavior transform_behavior(ez::e_angle_behavior behavior);
+ez::e_swing transform_swing(ez::e_swing side);
+
 // Set position wrappers
 void set_position(double x, double y);
 void set_position(double x, double y, double t = 0);
@@ -47,6 +87,11 @@ void wait(int millis, bool ignore = false);
 void wait_until(double target);
 void wait_until(Coordinate coordinate);
 
+// Marks a mechanism action at the current point of the path, for the preview trail
+void path_event(PathEvents event);
+
+// Motion wrappers with slew on follow a jerk limited S-curve (profile.hpp) instead of EZ's linear slew
+
 // Move to point wrappers
 void set_mtp(Coordinate newpoint, int speed, ez::drive_directions direction = fwd, bool slew = false);
 void set_boom(Coordinate newpoint, int speed, ez::drive_directions direction = fwd, bool slew = false);
@@ -67,6 +112,6 @@ void set_swing(ez::e_swing side, double theta, double main, ez::e_angle_behavior
 void set_swing(ez::e_swing side, double theta, double main, double opp);
 void set_swing(ez::e_swing side, double theta, double main);
 
-// Print path
+// Send path over telemetry
 void get_path();
 void get_path_injected();
\ No newline at end of file
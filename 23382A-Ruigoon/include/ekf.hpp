@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+// State is x and y in inches, theta in radians (clockwise from +y, like odom), forward velocity in in/s
+// and yaw rate in rad/s
+enum EkfStates {EKF_X = 0, EKF_Y = 1, EKF_THETA = 2, EKF_V = 3, EKF_OMEGA = 4};
+inline const int EKF_STATES = 5;
+
+// Process noise, as the variance of the acceleration the model can't predict per second
+inline const double EKF_ACCEL_NOISE = 400;       // (in/s^2)^2
+inline const double EKF_ANGULAR_NOISE = 100;     // (rad/s^2)^2
+
+// A measurement source. Each model reads its sensor once per tick and describes how that
+// reading follows from the state, so the filter can fuse any mix of them
+class EkfModel {
+    public:
+        virtual ~EkfModel() = default;
+
+        // Fills z and its variance for each new reading and returns how many there are, 0 if nothing new
+        virtual int sample(double z[], double variance[]) = 0;
+
+        // Returns the reading the state predicts for row and fills that row of the Jacobian
+        virtual double predict(const double state[EKF_STATES], int row, double jacobian[EKF_STATES]) = 0;
+
+        // True if the row is an angle, so its innovation wraps
+        virtual bool angular(int row) { return false; }
+
+        // Lets a model reject a reading that disagrees too much with the prediction
+        virtual bool accept(int row, double innovation) { return true; }
+};
+
+class PoseEKF {
+    public:
+        double state[EKF_STATES] = {0, 0, 0, 0, 0};
+        double covariance[EKF_STATES][EKF_STATES] = {};
+
+        void reset(double x, double y, double theta);
+        void predict(double dt);
+        void update(EkfModel& model);
+        void iterate(double dt);
+
+        void models_add(EkfModel* model) { models.push_back(model); }
+
+        double x_get() { return state[EKF_X]; }
+        double y_get() { return state[EKF_Y]; }
+        double theta_get();  // degrees, 0 to 360 like odom_theta_get()
+        double velocity_get() { return state[EKF_V]; }
+
+    private:
+        std::vector<EkfModel*> models;
+        void update_row(double innovation, double variance, const double jacobian[EKF_STATES]);
+};
+
+// Heading from the IMU, through EZ's odom heading so it shares the same zero
+class ImuYawModel : public EkfModel {
+    public:
+        double variance = 0.0004;  // rad^2
+        int sample(double z[], double variance[]) override;
+        double predict(const double state[EKF_STATES], int row, double jacobian[EKF_STATES]) override;
+        bool angular(int row) override { return true; }
+};
+
+// Yaw rate from the IMU gyro
+class ImuRateModel : public EkfModel {
+    public:
+        ImuRateModel(pros::Imu& sensor) : imu(sensor) {}
+        double variance = 0.01;  // (rad/s)^2
+        int sample(double z[], double variance[]) override;
+        double predict(const double state[EKF_STATES], int row, double jacobian[EKF_STATES]) override;
+
+    private:
+        pros::Imu& imu;
+};
+
+// Left and right drive encoder deltas, as wheel speeds over the last tick
+class EncoderModel : public EkfModel {
+    public:
+        EncoderModel(double track_width) : half_width(track_width / 2) {}
+        double variance = 4;  // (in/s)^2, covers a fair amount of wheel slip
+        int sample(double z[], double variance[]) override;
+        double predict(const double state[EKF_STATES], int row, double jacobian[EKF_STATES]) override;
+
+    private:
+        double half_width;
+        double last_left = 0, last_right = 0;
+        uint32_t last_time = 0;
+};
+
+// A distance sensor mounted on the robot, measuring to the nearest field wall along its beam
+class RangeModel : public EkfModel {
+    public:
+        // offset_x / offset_y in inches in the robot frame (+y forward, +x right), angle in degrees clockwise from forward
+        RangeModel(pros::Distance& sensor, double offset_x, double offset_y, double angle) : distance(sensor), x(offset_x), y(offset_y), a(angle) {}
+        double variance = 0.25;      // in^2
+        double max_range = 48;       // readings farther than this are too noisy to trust
+        double gate = 4;             // innovations over this many inches are an object, not the wall
+        int sample(double z[], double variance[]) override;
+        double predict(const double state[EKF_STATES], int row, double jacobian[EKF_STATES]) override;
+        bool accept(int row, double innovation) override { return fabs(innovation) < gate; }
+
+    private:
+        pros::Distance& distance;
+        double x, y, a;
+        double last_reading = 0;
+};
+
+// A consistent copy of the filter's output, for readers outside the EKF task
+class EkfEstimate {
+    public:
+        ez::pose pose;  // degrees, 0 to 360 like odom_theta_get()
+        double velocity = 0;
+        double variance[3] = {};  // x and y in in^2, theta in rad^2
+};
+
+inline PoseEKF pose_ekf;
+inline uint32_t ekf_iterate_us = 0;      // time the last filter tick took
+inline uint32_t ekf_iterate_max_us = 0;  // longest tick since startup, against the 10 ms tracking budget
+
+void ekf_initialize();
+void ekf_reset(double x, double y, double theta);
+ez::pose ekf_pose_get();
+EkfEstimate ekf_estimate_get();
+void ekf_task();
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+#include "subsystems.hpp"
+
+// Drive side model, u = kS sign(v) + kV v + kA a. Voltages are in the -127 to 127 units drive_set takes,
+// v in in/s and a in in/s^2
+class Feedforward {
+    public:
+        double ks = 0;
+        double kv = 127 / (M_PI * DRIVE_DIAMETER * DRIVE_RPM / 60);  // the old linear model until characterised
+        double ka = 0;
+
+        double voltage(double velocity, double acceleration = 0) const;
+        double velocity(double voltage) const;  // steady state speed at a constant voltage
+};
+
+inline Feedforward ff_left;
+inline Feedforward ff_right;
+
+// Characterisation settings
+inline const double FF_RAMP_RATE = 1.0;        // volts per second for the quasistatic test
+inline const double FF_RAMP_MAX = 7.0;         // volts
+inline const double FF_STEP_VOLTAGE = 6.0;     // volts for the dynamic test
+inline const int FF_STEP_TIME = 1200;          // ms
+inline const double FF_MAX_TRAVEL = 36;        // inches, any test stops here
+inline const double FF_MIN_VELOCITY = 0.5;     // in/s, slower samples are still in static friction
+inline const char* FF_FILE = "/usd/feedforward.txt";
+
+bool feedforward_load();
+void characterize_drive();
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+// A table of PID constant multipliers indexed by |error| and commanded speed, read with bilinear
+// interpolation and clamped at the edges. gains[s][e] are the multipliers at speeds[s] and errors[e],
+// both ascending. They scale the configured constants (config.hpp), so retuning those moves the
+// whole schedule with them
+class GainSchedule {
+    public:
+        GainSchedule() = default;
+        GainSchedule(std::vector<double> errors, std::vector<double> speeds, std::vector<std::vector<ez::PID::Constants>> gains)
+            : errors(errors), speeds(speeds), gains(gains) {}
+
+        ez::PID::Constants get(double error, double speed) const;
+        bool empty() const { return gains.empty(); }
+
+    private:
+        std::vector<double> errors;
+        std::vector<double> speeds;
+        std::vector<std::vector<ez::PID::Constants>> gains;
+};
+
+// Schedules per motion type, errors in degrees for turns and swings and inches for drives. Odom
+// motions use the drive schedule for xyPID and the turn schedule for their angular PID
+inline GainSchedule turn_schedule;
+inline GainSchedule swing_schedule;
+inline GainSchedule drive_schedule;
+
+// Multiplies each constant by the matching multiplier
+ez::PID::Constants gain_scale(const ez::PID::Constants& base, const ez::PID::Constants& factor);
+
+void gain_scheduling_set(bool enabled);
+bool gain_scheduling_get();
+// Called as a motion is set, before a profile starts moving the speed cap. boomerang says which
+// constants an odom motion's angular PID started from
+void gain_schedule_start(bool boomerang = false);
+void gain_schedule_iterate();  // one tick of gain_schedule_task
+void gain_schedule_task();
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+// Images in src/pics are packed by tools/img_pack.py (palette or RGBA, run length encoded) and
+// only unpacked when LVGL draws them. Unpacked pixels stay in an LRU cache so switching between
+// pages doesn't decode the field again, and the ones not on screen get dropped when it fills
+inline const size_t IMG_CACHE_SIZE = 384 * 1024;  // bytes of unpacked pixels, one field, the robot frames and the small images
+inline const size_t IMG_CACHE_AVERAGE = 16 * 1024;
+
+void img_cache_init();  // registers the decoder, before any packed image is shown
+void img_cache_clear();  // drops every image that isn't open
+size_t img_cache_used();
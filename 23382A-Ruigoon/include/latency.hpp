@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+// Stages of the control path, timed by a probe task watching each one change
+enum LatencyStages {
+    LAT_SAMPLE_TO_TRACK = 0,  // encoder reading to the odom pose moving
+    LAT_TRACK_TO_PID = 1,     // odom pose to the PID output moving
+    LAT_PID_TO_MOTOR = 2,     // PID output to the motors reporting a new voltage
+    LAT_TOTAL = 3,            // encoder reading to the motors reporting a new voltage
+    LAT_IMU_AGE = 4,          // how old the IMU reading was when the PID ran
+    LAT_PID_PERIOD = 5        // time between PID updates, 10 ms when nothing is starving the task
+};
+inline const int LAT_STAGES = 6;
+inline const char* LATENCY_NAMES[LAT_STAGES] = {"smp>trk", "trk>pid", "pid>mtr", "total", "imu age", "pid per"};
+
+// 1 ms bins, the last one holds everything past it
+inline const int LAT_BINS = 40;
+
+class LatencyHistogram {
+    public:
+        uint16_t bins[LAT_BINS] = {};
+        uint32_t count = 0;
+        uint32_t max = 0;
+
+        void add(uint32_t ms);
+        uint32_t percentile(double p) const;
+        void clear() { *this = LatencyHistogram(); }
+        void merge(const LatencyHistogram& other);
+};
+
+inline LatencyHistogram latency_motion[LAT_STAGES];  // the motion in progress
+inline LatencyHistogram latency_run[LAT_STAGES];     // everything since the last auton started
+inline bool latency_page = false;                    // latency on controller lines 1 and 2, toggled with DOWN
+
+void latency_motion_begin();
+void latency_run_begin();
+LatencyHistogram latency_get(LatencyStages stage, bool run = false);  // run adds everything before this motion
+std::string latency_summary(LatencyStages stage, bool run = false);  // "name p50/p95/max"
+void latency_report();
+void latency_controller_iterate();
+void latency_task();
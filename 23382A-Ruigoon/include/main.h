@@ -49,6 +49,24 @@
 #include "controls.hpp"
 #include "drive.hpp"
 #include "screen.hpp"
+#include "recorder.hpp"
+#include "ekf.hpp"
+#include "relocalize.hpp"
+#include "odometry.hpp"
+#include "gains.hpp"
+#include "autotune.hpp"
+#include "motionlog.hpp"
+#include "feedforward.hpp"
+#include "profile.hpp"
+#include "latency.hpp"
+#include "imgcache.hpp"
+#include "bindings.hpp"
+#include "sdwriter.hpp"
+#include "config.hpp"
+#include "startup.hpp"
+#include "preview.hpp"
+#include "ctrlscreen.hpp"
+#include "telemetry.hpp"
 
 /**
  * If you find doing pros::Motor() to be tedious and you'd prefer just to do
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+#include "drive.hpp"
+
+// Why a motion finished. EZ doesn't keep its exit output, so the reason is worked out from the
+// sampled error against the motion's exit conditions
+enum MotionExits {EXIT_SMALL = 0, EXIT_BIG = 1, EXIT_VELOCITY = 2, EXIT_MA = 3, EXIT_CHAIN = 4};
+
+class MotionRecord {
+    public:
+        uint16_t index = 0;                // order within the run
+        ez::e_mode mode = ez::DISABLE;
+        MotionExits reason = EXIT_SMALL;
+        uint32_t duration = 0;             // ms from set to the end of the wait
+        int32_t time_to_small = -1;        // ms until the error first got inside small_error, -1 if never
+        double start_error = 0;            // degrees for turns and swings, inches otherwise
+        double final_error = 0;
+        double overshoot = 0;              // furthest the error went past zero
+        ez::PID::exit_condition_ exit;     // the exit conditions the motion ran with
+        uint16_t latency_p50 = 0;          // ms from encoder reading to motor voltage, see latency.hpp
+        uint16_t latency_p95 = 0;
+        uint16_t period_p95 = 0;           // ms between PID updates
+};
+
+inline const char* MOTION_LOG_FILE = "/usd/motions.csv";
+inline std::vector<MotionRecord> motion_log;
+
+// Called by the motion wrappers. A motion started before the last one was waited on closes that one as chained
+void motion_log_start();
+void motion_log_end(Wait type);
+void motion_log_iterate();  // one tick of motion_log_task
+void motion_log_task();
+void motion_log_flush(const std::string& run);
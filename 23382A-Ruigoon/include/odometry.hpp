@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+// The integrator runs faster than EZ's tracking task, and keeps ODOM_HISTORY samples (~2.5 s)
+inline const int ODOM_PERIOD = 5;          // ms
+inline const int ODOM_HISTORY = 512;       // must be a power of two
+
+// A pose at a point in time, in the same frame as odom_*_get()
+class PoseSample {
+    public:
+        uint64_t time = 0;  // pros::micros()
+        double x = 0;
+        double y = 0;
+        double t = 0;       // degrees, 0 to 360
+};
+
+// Single writer, many readers. Each slot carries a sequence number that is odd while it's being
+// written, so a reader copies the slot and retries if the number moved underneath it
+class PoseHistory {
+    public:
+        void push(const PoseSample& sample);
+        bool latest(PoseSample& out) const;
+        bool at(uint64_t time, PoseSample& out) const;  // interpolated, false if time is outside the history
+
+    private:
+        class Slot {
+            public:
+                std::atomic<uint32_t> sequence{0};
+                PoseSample sample;
+        };
+        Slot slots[ODOM_HISTORY];
+        std::atomic<uint32_t> head{0};  // samples ever written
+        bool read(uint32_t index, PoseSample& out) const;
+};
+
+inline PoseHistory pose_history;
+
+void odometry_reset(double x, double y, double t);
+void odometry_shift(double dx, double dy);  // moves the pose without losing what the integrator has since
+PoseSample pose_latest();
+bool pose_at(uint64_t time, PoseSample& out);
+void odometry_task();
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+#include "controls.hpp"
+#include "drive.hpp"
+
+// Preview paths for the auton selector, dry run by a low priority task instead of in the click
+// handler. Selecting an auton only swaps in a path that's already built
+class AutonPreview {
+    public:
+        std::vector<Coordinate> path;  // injected, what the viewer plays
+        Coordinate start;              // first pose, the alignment check's target
+};
+
+inline const int PREVIEW_ALLIANCES = 3;  // indexed by Alliances
+inline const int PREVIEW_IDLE = 50;      // ms between checks when every preview is built
+
+// Held for each dry run. autonomous() takes it to set preview_paused, so a dry run never shares
+// currentPoint with a real one. The flag rather than the mutex is held for the run because the
+// competition kills the auton task without giving anything back, disabled() clears it instead
+inline pros::Mutex preview_mutex;
+inline std::atomic<bool> preview_paused{false};
+
+// A dry run shares the robot with whatever else is running, so it leaves matchState and
+// sideMirrored alone. Code an auton runs reads them through match_state() and side_mirrored(),
+// which on the dry run's task say DISABLED and the mirroring being previewed, and the real values
+// everywhere else. Mechanism outputs are skipped on it
+void dry_run_begin(bool mirrored);
+void dry_run_end();
+bool dry_running();  // on the task running a dry run
+MatchStates match_state();
+bool side_mirrored();
+
+std::shared_ptr<const AutonPreview> preview_get(size_t auton, Alliances alliance);  // nullptr until built
+void preview_request(size_t auton);  // builds this one next, for the alliance on screen
+void preview_invalidate();  // rebuilds everything, for when speeds or the track width change
+void preview_task();
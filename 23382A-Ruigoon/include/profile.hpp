@@ -0,0 +1,56 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+// Where a profile is along its motion. Units follow the profile, inches or degrees
+class ProfileState {
+    public:
+        double time = 0;  // s
+        double position = 0;
+        double velocity = 0;
+        double acceleration = 0;
+};
+
+// Rest to rest jerk limited (S-curve) profile. Seven segments of constant jerk: ramp the
+// acceleration up, hold it, ramp it down, cruise, and the same mirrored to stop. Short motions
+// that can't reach max velocity or acceleration get a lower peak instead
+class SCurveProfile {
+    public:
+        SCurveProfile() = default;
+        SCurveProfile(double distance, double max_velocity, double max_acceleration, double max_jerk);
+
+        ProfileState at_time(double time) const;
+        ProfileState at_distance(double distance) const;
+        double duration() const { return total; }
+        double distance() const { return length; }
+
+    private:
+        double length = 0, jerk = 0, total = 0;
+        double durations[7] = {};
+        ProfileState starts[8];  // state at the start of each segment, and the end
+        static double accel_distance(double velocity, double max_acceleration, double max_jerk, double times[2]);
+};
+
+// Limits the profiles are built with. Drives are in inches, turns in degrees of robot heading.
+// config_apply() sets them from the config store
+class ProfileLimits {
+    public:
+        double acceleration;
+        double jerk;
+};
+
+inline ProfileLimits drive_profile_limits = {120, 1200};   // in/s^2, in/s^3
+inline ProfileLimits turn_profile_limits = {1500, 15000};  // deg/s^2, deg/s^3
+
+enum ProfileSampling {BY_DISTANCE = 0, BY_TIME = 1};
+
+// Caps an EZ motion's speed to follow a profile. The motion wrappers use this instead of EZ's linear slew
+// when slew is on. The minimum speed keeps the PID able to finish once the profile reaches zero
+void profile_drive_start(double distance, int speed, ProfileSampling sampling = BY_DISTANCE);
+void profile_turn_start(double degrees, int speed, ProfileSampling sampling = BY_DISTANCE);
+void profile_stop();
+void profile_iterate();  // one tick of profile_task
+void profile_task();
+
+inline const int PROFILE_MIN_SPEED = 30;
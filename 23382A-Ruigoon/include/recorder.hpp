@@ -0,0 +1,35 @@
+#pragma once
+
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+#include "controls.hpp"
+
+// Recordings live in numbered slots on the SD card
+inline const int REPLAY_SLOTS = 8;
+inline const char* REPLAY_FILE_FORMAT = "/usd/replay_%d.bin";
+
+// Frames are stored at the opcontrol rate, with a pose keyframe every REPLAY_KEYFRAME_TICKS
+inline const int REPLAY_KEYFRAME_TICKS = 25;
+
+// Drift compensation gains, in stick units per inch / degree of error against the recorded pose,
+// which is interpolated between keyframes so the correction is fresh every frame
+inline const double REPLAY_KP_DRIVE = 4.0;
+inline const double REPLAY_KP_TURN = 0.5;
+inline const int REPLAY_CORRECTION_MAX = 30;
+
+// Frame header bits. Each frame starts with one of these bytes followed by only the fields that changed
+enum ReplayFields {
+    FRAME_ANALOG = 0x0f,     // one bit per stick axis, an int8_t follows for each set bit
+    FRAME_BUTTONS = 0x10,    // uint16_t button state
+    FRAME_MECHANISM = 0x20,  // RollerStates in the low 3 bits, pistons in the high 5 bits
+    FRAME_POSE = 0x40        // int16_t x and y in 1/100 in, uint16_t theta in 1/100 deg
+};
+
+bool recording_active();
+void recording_start();
+void recording_stop();
+void recording_iterate();
+
+bool replay_active();
+void replay_run(int slot);
+void replay_register_all();
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+#include "subsystems.hpp"
+
+// A distance sensor and where it sits on the robot
+class WallSensor {
+    public:
+        pros::Distance* sensor;
+        double x;      // inches right of the center of rotation
+        double y;      // inches forward of the center of rotation
+        double angle;  // degrees clockwise from forward
+        const char* name;
+};
+
+// Which wall a beam hit, so a reading only corrects the axis it can see
+enum WallAxis {WALL_NONE = 0, WALL_X = 1, WALL_Y = 2};
+
+// An axis-aligned stretch of wall on the field, in inches
+class WallSegment {
+    public:
+        WallAxis axis;  // WALL_X walls sit at a constant x, WALL_Y walls at a constant y
+        double at;      // the constant coordinate
+        double from;    // start and end along the other axis
+        double to;
+};
+
+// One correction applied to odom, kept so we can see where drift comes from
+class WallCorrection {
+    public:
+        uint32_t time;
+        const char* sensor;  // one row per sensor that contributed
+        bool snap;        // true for an on-demand snap, false for continuous fusion
+        double x, y;      // odom before the correction
+        double dx, dy;    // how far odom was moved
+};
+
+inline const double RELOCALIZE_SQUARE_TOLERANCE = 4;   // degrees off a wall for a snap
+inline const double RELOCALIZE_SNAP_MAX = 8;           // inches, bigger errors are an obstacle
+inline const double RELOCALIZE_FUSE_GAIN = 0.05;       // fraction of the error fused each reading
+inline const double RELOCALIZE_FUSE_GATE = 3;          // inches, continuous fusion ignores anything bigger
+inline const double RELOCALIZE_MAX_RANGE = 60;         // inches
+inline const int RELOCALIZE_PERIOD = 40;               // ms between continuous fusion readings
+inline const char* RELOCALIZE_LOG_FILE = "/usd/relocalize_log.csv";
+
+inline std::vector<WallSensor> wall_sensors = {
+    {&dist_front, DIST_FRONT_X, DIST_FRONT_Y, 0, "front"},
+    {&dist_left, DIST_LEFT_X, DIST_LEFT_Y, 270, "left"},
+    {&dist_right, DIST_RIGHT_X, DIST_RIGHT_Y, 90, "right"},
+};
+
+inline std::vector<WallCorrection> relocalize_log;  // appended under a lock, read it through relocalize_log_flush()
+
+// Field model, the perimeter and the structures a beam can hit. Match and skills fields share it
+const std::vector<WallSegment>& field_walls();
+double field_wall_distance(double x, double y, double theta, WallAxis* axis = nullptr);
+
+bool relocalize_snap();
+void relocalize_continuous_set(bool enabled);
+bool relocalize_continuous_get();
+void relocalize_task();
+void relocalize_log_flush();
@@ -24,17 +24,18 @@ enum Fields {MATCH = 1, SKILLS = 2};
 inline int currentField = Fields::MATCH;
 
 // Auton selector
-void angleCheckTask();
 void pathViewerTask();
+void resetViewer(bool full);  // full swaps in the selected auton's preview once it's built
 
 class AutonObj {
     public:
     AutonObj() = default;
-    AutonObj(function<void()> cb, const string& nm, lv_color32_t c) : callback(cb), name(nm), color(c) {}
+    AutonObj(function<void()> cb, const string& nm, lv_color32_t c, bool mirror = false) : callback(cb), name(nm), color(c), mirrored(mirror) {}
 
     function<void()> callback = doNothing;
     string name = "no name";
     lv_color32_t color = pink;
+    bool mirrored = false; // runs the routine reflected onto the other side of the field
 };
 
 class AutonSel {
@@ -42,6 +43,7 @@ class AutonSel {
         vector<AutonObj> autons = {};
         function<void()> selector_callback = doNothing; // make this doNothing
         string selector_name = "no name";
+        bool selector_mirrored = false;
         void selector_populate(vector<AutonObj> auton_list);
 };
 
@@ -53,6 +55,7 @@ extern lv_obj_t* colorInd;
 extern lv_obj_t* autoSelector;
 extern lv_obj_t* autonTable;
 extern lv_obj_t* autonField;
+extern lv_obj_t* autonTrail;
 extern lv_obj_t* autonRobot;
 extern lv_obj_t* autonUp;
 extern lv_obj_t* autonDown;
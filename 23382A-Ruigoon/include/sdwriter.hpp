@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+// All SD card writes go through one low priority task so a slow card never stalls the UI or a
+// control task. Requests for the same file coalesce while they wait: a replace keeps only the
+// newest contents, appends are joined in order
+enum SdWriteModes {SD_REPLACE = 0, SD_APPEND = 1};
+
+inline const int SD_QUEUE_CAPACITY = 16;            // files waiting at once
+inline const size_t SD_QUEUE_BYTES = 256 * 1024;    // bytes waiting at once, a long replay is ~60 KB
+inline const int SD_WRITER_PERIOD = 20;             // ms between checks when idle
+inline const char* SD_TEMP_SUFFIX = ".tmp";
+
+// Replaces the whole file. It's written to path.tmp and renamed over the old one, so a power cut
+// leaves either the old file or the new one. False when the queue is full
+bool sd_write(const std::string& path, const std::string& data);
+// Adds to the end of a log, header first if the file doesn't exist yet. Appends are written in
+// place, a power cut loses at most the tail. False when the queue is full
+bool sd_append(const std::string& path, const std::string& data, const std::string& header = "");
+
+// Opens a file sd_write manages for reading, falling back to the temp file if a power cut landed
+// between removing the old one and renaming the new one
+FILE* sd_open(const char* path, const char* mode = "r");
+
+std::string sd_format(const char* format, ...) __attribute__((format(printf, 1, 2)));
+size_t sd_pending();  // bytes still waiting to be written
+void sd_writer_task();
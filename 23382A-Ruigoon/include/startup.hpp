@@ -0,0 +1,37 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+
+// initialize() split into stages that start as soon as the stages they need are done, each in its
+// own task, so the screen and the SD card don't wait on IMU calibration
+enum StartupStages {
+    STARTUP_CONFIG = 0,  // config.bin, curve, constants, feedforward
+    STARTUP_AUTONS = 1,  // selector list and saved recordings
+    STARTUP_IMU = 2,     // IMU calibration, sensor reset, pose estimators
+    STARTUP_UI = 3,      // every LVGL object, saved auton selection
+    STARTUP_PATHS = 4,   // preview task, selected auton first
+    STARTUP_TASKS = 5    // control and logging tasks
+};
+inline const int STARTUP_STAGES = 6;
+
+class StartupStage {
+    public:
+        const char* name = nullptr;
+        std::function<void()> run;
+        uint32_t after = 0;  // bit per stage that has to finish first
+        uint32_t start = 0;  // ms since startup_run began
+        uint32_t end = 0;
+        bool started = false;
+        std::atomic<bool> finished{false};
+};
+
+inline StartupStage startup_stages[STARTUP_STAGES];
+
+void startup_add(StartupStages stage, const char* name, std::function<void()> run, std::initializer_list<StartupStages> after = {});
+void startup_run();  // blocks until every stage added is done
+void startup_report();  // one console line per stage, then the total
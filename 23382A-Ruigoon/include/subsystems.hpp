@@ -10,7 +10,10 @@
 #include <cstdint>  // IWYU pragma: keep
 #include <type_traits>
 #include "EZ-Template/piston.hpp"
+#include "config.hpp"
+#include "gains.hpp"
 #include "pros/adi.hpp" // IWYU pragma: keep
+#include "pros/distance.hpp"
 #include "pros/motors.hpp"
 #include "pros/optical.hpp"
 #include "api.h"    // IWYU pragma: keep
@@ -34,6 +37,9 @@
 #define PORT_IMU            14
 #define PORT_OPTICAL        22
 #define PORT_OPTICAL_2      23
+#define PORT_DIST_FRONT     3
+#define PORT_DIST_LEFT      4
+#define PORT_DIST_RIGHT     5
 
 // Defining three wire ports
 #define PORT_LOADER         'H'
@@ -44,13 +50,22 @@
 
 // Defining robot constants
 #define DRIVE_DIAMETER      3.25
-#define TRACK_WIDTH         11
 #define DRIVE_RPM           450
 
-#define DRIVE_SPEED         110
-#define TURN_SPEED          90
-#define SWING_SPEED         110
-#define DRIVE_CURVE         4.0
+// Retunable on the brain, defaults in config.hpp
+#define TRACK_WIDTH         config_get(CFG_TRACK_WIDTH)
+#define DRIVE_SPEED         ((int)config_get(CFG_DRIVE_SPEED))
+#define TURN_SPEED          ((int)config_get(CFG_TURN_SPEED))
+#define SWING_SPEED         ((int)config_get(CFG_SWING_SPEED))
+#define DRIVE_CURVE         config_get(CFG_DRIVE_CURVE)
+
+// Distance sensor mounts, inches from the center of rotation (+x right, +y forward)
+#define DIST_FRONT_X        0.0
+#define DIST_FRONT_Y        6.0
+#define DIST_LEFT_X         -6.0
+#define DIST_LEFT_Y         0.0
+#define DIST_RIGHT_X        6.0
+#define DIST_RIGHT_Y        0.0
 
 // Defining controller buttons
 #define BUTTON_INTAKE       pros::E_CONTROLLER_DIGITAL_R1
@@ -93,6 +108,9 @@ inline pros::Motor motor_intake3  (PORT_INTAKE3, pros::v5::MotorGears::blue);
 inline pros::Imu      imu               (PORT_IMU);
 inline pros::Optical  optical           (PORT_OPTICAL);
 inline pros::Optical  optical_2         (PORT_OPTICAL_2);
+inline pros::Distance dist_front        (PORT_DIST_FRONT);
+inline pros::Distance dist_left         (PORT_DIST_LEFT);
+inline pros::Distance dist_right        (PORT_DIST_RIGHT);
 
 //three wire port constructors
 
@@ -117,36 +135,24 @@ inline ez::Drive chassis(
 #pragma endregion
 
 inline void default_constants() {
-  // P, I, D, and Start I
-  chassis.pid_drive_constants_set(20.0, 0.0, 100.0);         // Fwd/rev constants, used for odom and non odom motions
-  chassis.pid_heading_constants_set(11.0, 0.0, 20.0);        // Holds the robot straight while going forward without odom
-  chassis.pid_turn_constants_set(3.0, 0.05, 20.0, 15.0);     // Turn in place constants
-  chassis.pid_swing_constants_set(6.0, 0.0, 65.0);           // Swing constants
-  chassis.pid_odom_angular_constants_set(6.5, 0.0, 52.5);    // Angular control for odom motions
-  chassis.pid_odom_boomerang_constants_set(5.8, 0.0, 32.5);  // Angular control for boomerang motions
-
-  // Exit conditions
-  chassis.pid_turn_exit_condition_set(90_ms, 3_deg, 250_ms, 7_deg, 500_ms, 500_ms);
-  chassis.pid_swing_exit_condition_set(90_ms, 3_deg, 250_ms, 7_deg, 500_ms, 500_ms);
-  chassis.pid_drive_exit_condition_set(90_ms, 1_in, 250_ms, 3_in, 500_ms, 500_ms);
-  chassis.pid_odom_turn_exit_condition_set(90_ms, 3_deg, 250_ms, 7_deg, 500_ms, 750_ms);
-  chassis.pid_odom_drive_exit_condition_set(90_ms, 1_in, 250_ms, 3_in, 500_ms, 750_ms);
-  chassis.pid_turn_chain_constant_set(3_deg);
-  chassis.pid_swing_chain_constant_set(5_deg);
-  chassis.pid_drive_chain_constant_set(3_in);
-
-  // Slew constants
-  chassis.slew_turn_constants_set(3_deg, 70);
-  chassis.slew_drive_constants_set(3_in, 70);
-  chassis.slew_swing_constants_set(3_in, 80);
-
-  // The amount that turns are prioritized over driving in odom motions
-  // - if you have tracking wheels, you can run this higher.  1.0 is the max
-  chassis.odom_turn_bias_set(0.9);
-
-  chassis.odom_look_ahead_set(7_in);           // This is how far ahead in the path the robot looks at
-  chassis.odom_boomerang_distance_set(16_in);  // This sets the maximum distance away from target that the carrot point can be
-  chassis.odom_boomerang_dlead_set(0.625);     // This handles how aggressive the end of boomerang motions are
+  // PID, exit, profile and odom settings come from the config store (config.hpp), so they can be
+  // retuned on the brain. Load it first with config_load()
+  config_apply();
+
+  // Gain schedules, by |error| (columns) and speed cap (rows), as multipliers on the configured constants.
+  // The middle of each table is 1; small errors get more P to finish the last few degrees, big ones more D to stop overshoot
+  turn_schedule = GainSchedule(
+      {5, 30, 90, 180}, {60, 110},
+      {{{1.20, 1, 0.90, 1}, {1.07, 1, 1.00, 1}, {1.00, 1, 1.00, 1}, {0.93, 1, 1.10, 1}},
+       {{1.13, 1, 1.00, 1}, {1.00, 1, 1.00, 1}, {0.93, 1, 1.20, 1}, {0.87, 1, 1.40, 1}}});
+  swing_schedule = GainSchedule(
+      {5, 45, 90}, {60, 110},
+      {{{1.17, 1, 0.92, 1}, {1.00, 1, 1.00, 1}, {0.92, 1, 1.08, 1}},
+       {{1.08, 1, 1.00, 1}, {1.00, 1, 1.00, 1}, {0.83, 1, 1.15, 1}}});
+  drive_schedule = GainSchedule(
+      {2, 12, 36}, {60, 110},
+      {{{1.10, 1, 0.95, 1}, {1.00, 1, 1.00, 1}, {0.95, 1, 1.05, 1}},
+       {{1.05, 1, 1.00, 1}, {1.00, 1, 1.00, 1}, {0.90, 1, 1.15, 1}}});
 
   chassis.pid_angle_behavior_set(ez::shortest);  // Changes the default behavior for turning, this defaults it to the shortest path there
-}
\ No newline at end of file
+}
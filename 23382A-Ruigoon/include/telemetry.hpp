@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "EZ-Template/api.hpp"  // IWYU pragma: keep
+#include "api.h"    // IWYU pragma: keep
+#include "drive.hpp"
+
+// Binary telemetry on the USB serial link, decoded by tools/telemetry.py. Every frame is
+//   u8 channel  u16 sequence  u32 time ms  body  u16 CRC-16/CCITT of everything before it
+// COBS encoded and ended with a 0 byte, so the host can find the next frame after a dropped byte.
+// Off unless "telemetry on" is set in the config editor, and never on a competition switch
+enum TelemetryChannels {
+    TEL_POSE = 1,    // f32 x, y, theta
+    TEL_MOTORS = 2,  // f32 left mV, right mV, left rpm, right rpm
+    TEL_PID = 3,     // u8 ez::e_mode, f32 error, output
+    TEL_EVENT = 4,   // text
+    TEL_PATH = 5,    // u16 index, u16 count, f32 x, y, theta
+    TEL_EKF = 6      // f32 x, y, theta, velocity, x, y and theta variance, u16 tick us
+};
+
+inline const int TELEMETRY_PERIOD = 20;       // ms, pose, motors and PID go out every period
+inline const int TELEMETRY_EVENTS = 16;       // events waiting at once, newer ones are dropped
+inline const int TELEMETRY_PATH_POINTS = 16;  // path points per period
+
+void telemetry_event(const std::string& text);
+void telemetry_path(const std::vector<Coordinate>& path);  // replaces a path still being sent
+void telemetry_task();
@@ -29,7 +29,10 @@ void testing() {
   wait();
 }
 
+// Drives EZ directly, so it does nothing while the path viewer previews it
 void measure_offsets() {
+  if (match_state() != MatchStates::AUTO) return;
+
   // Number of times to test
   int iterations = 10;
 
@@ -172,7 +175,9 @@ void doNothing() {
 
 }
 
-void sixThreeLeft() {
+// Authored for the left side. "6 + 3 Right" runs it mirrored, the openings are the same shape but
+// the left finishes on the middle goal from behind and the right on the low goal from the front
+void sixThree() {
   set_position(-47, 16, 90);
 
   set_drive(4.0, 125);
@@ -216,120 +221,62 @@ void sixThreeLeft() {
   set_piston(piston_loader, true);
   wait(CHAIN);
   
-  // **THE REST NEEDS TUNING**
-  set_drive(-6.0); // backs up from loader, might need to tune this
-  wait(CHAIN);
-  set_piston(piston_loader, false);
-
-  //set_turn({0,-8}, rev, TURN_SPEED); // this needs tuning
-  // I think replacing above with...
-  set_turn(315, TURN_SPEED);
-  //... would be much better, and then just tune the angle value from 315 degrees
-  wait(QUICK);
-  set_drive(-50.0, 127); // backing up into the goal, might be too big or too small
-  wait(QUICK);
-  set_piston(piston_scorer, true);
-  set_rollers(12000, -12000, -12000);
-  wait(150);
-  set_rollers(SCORE_MID);
-  wait(1750);
-  set_drive(22.0); // if u change the -50.0 degrees, change this in the opposite direction accordingly
-  wait(CHAIN);
-  set_turn(270); //turns so snacky is in goal
-  // *You MIGHT have to put the snacky down again, uncomment this line*
-  set_piston(piston_wing, false);
-  wait(CHAIN);
-  set_drive(-16.0);
-  wait();
-
-  set_piston(piston_wing, false);
-  set_piston(piston_scorer, false);
-}
-
-// this is literally the same as the top but mirrored, except for the end.
-void sixThreeRight() {
-  set_position(-47, -16, 90);
-
-  set_drive(4.0, 125);
-  wait(CHAIN);
-
-  set_mtp({-13, -23.5}, 75, fwd, true);
-  set_rollers(INTAKE);
-  wait(650);
-  set_piston(piston_loader, true);
-  wait();
-
-  set_mtp({-6, -43}, DRIVE_SPEED);
-  wait(125);
-  set_piston(piston_loader, false);
-  wait();
-
-
-  set_drive(-15.0, DRIVE_SPEED);
-  wait(QUICK);
-  //set_piston(piston_loader, false);
-
-  set_mtp({-44, -47.25}, DRIVE_SPEED, fwd, true);
-  set_piston(piston_loader, true);
-  wait(CHAIN);
-  
-  set_turn({-25, -48}, rev, TURN_SPEED);
-  wait(CHAIN);
-
-  set_boom({-25, -48, 90}, DRIVE_SPEED, rev);
-  wait();
-  set_rollers(OUTTAKE);
-  wait(150);
-  set_rollers(SCORE);
-  wait(1700);
-  set_rollers(INTAKE);
-
-  set_boom({-60, -48, 270}, 125);
-  set_rollers(INTAKE);
-  set_piston(piston_loader, true);
-  wait(CHAIN);
-  // set_drive(-0.25);
-  // wait(CHAIN);
-  set_drive(-4.0); //may need to tune this valud
-  wait(CHAIN);
-  set_piston(piston_loader, false);
-
-  // This turns to the goal, should change it to an angle instead
-  //set_turn({0,14}, fwd, TURN_SPEED);
-  //I think replace it with this line and tune the angle
-  set_turn(42.5, TURN_SPEED);
-  wait();
-  set_drive(48.0, 127); //might be going too far or not far enough who knows, can tune
-  wait(QUICK);
-  set_rollers(-12000);
-  wait(100);
-  set_rollers(INTAKE);
-  wait(100);
-  set_rollers(-9750);
-  wait(1750);
-  set_drive(1.0);
-  wait();
- 
-  set_piston(piston_wing, false);
-  set_drive(-22.0);
-  wait(CHAIN);
-  set_turn(90);
-  wait(CHAIN);
-  set_drive(17.0); //this last value might be too big or too small.
-  wait();
-  set_turn(45);
-  wait();
-
+  if (!side_mirrored()) {
+    // **THE REST NEEDS TUNING**
+    set_drive(-6.0); // backs up from loader, might need to tune this
+    wait(CHAIN);
+    set_piston(piston_loader, false);
+
+    //set_turn({0,-8}, rev, TURN_SPEED); // this needs tuning
+    // I think replacing above with...
+    set_turn(315, TURN_SPEED);
+    //... would be much better, and then just tune the angle value from 315 degrees
+    wait(QUICK);
+    set_drive(-50.0, 127); // backing up into the goal, might be too big or too small
+    wait(QUICK);
+    set_piston(piston_scorer, true);
+    set_rollers(12000, -12000, -12000);
+    wait(150);
+    set_rollers(SCORE_MID);
+    wait(1750);
+    set_drive(22.0); // if u change the -50.0 degrees, change this in the opposite direction accordingly
+    wait(CHAIN);
+    set_turn(270); //turns so snacky is in goal
+    // *You MIGHT have to put the snacky down again, uncomment this line*
+    set_piston(piston_wing, false);
+    wait(CHAIN);
+    set_drive(-16.0);
+    wait();
+  } else {
+    // Headings and turns are in the left side's frame, the transform flips them back
+    set_drive(-4.0); //may need to tune this valud
+    wait(CHAIN);
+    set_piston(piston_loader, false);
+
+    set_turn(137.5, TURN_SPEED);
+    wait();
+    set_drive(48.0, 127); //might be going too far or not far enough who knows, can tune
+    wait(QUICK);
+    set_rollers(-12000);
+    wait(100);
+    set_rollers(INTAKE);
+    wait(100);
+    set_rollers(-9750);
+    wait(1750);
+    set_drive(1.0);
+    wait();
+
+    set_piston(piston_wing, false);
+    set_drive(-22.0);
+    wait(CHAIN);
+    set_turn(90);
+    wait(CHAIN);
+    set_drive(17.0); //this last value might be too big or too small.
+    wait();
+    set_turn(135);
+    wait();
+  }
 
-  //if you want to try going down the alley you can replace the last chuck with this and tune the drive values
-  /*
-  set_drive(-40.0);
-  wait(CHAIN);
-  set_turn(270);
-  wait(CHAIN);
-  set_drive(-30.0); //this last value might be too big or too small.
-  wait();
-  */
   set_piston(piston_wing, false);
   set_piston(piston_scorer, false);
 }
@@ -576,7 +523,7 @@ void left7() {
   set_drive(-20.0);
   wait();
   
-  if (matchState != AUTO) set_piston(piston_loader, false);
+  if (match_state() != AUTO) set_piston(piston_loader, false);
 }
 
 void right7() {
@@ -640,7 +587,7 @@ void right7() {
   wait();
   set_drive(-18.0, 127);
   wait();
-  chassis.drive_brake_set(pros::E_MOTOR_BRAKE_HOLD);
+  if (!dry_running()) chassis.drive_brake_set(pros::E_MOTOR_BRAKE_HOLD);  // the preview runs this while driving
   set_piston(piston_wing, false);
   set_piston(piston_scorer, false);
   set_piston(piston_loader, false);
@@ -653,6 +600,8 @@ void skills() {
   int unjamTime = 125;
 
   set_position(-48, -12.5, 180);
+  // A minute of driving drifts, fuse the walls whenever the robot is square to one
+  relocalize_continuous_set(true);
 
   set_drive(80.0, DRIVE_SPEED, true);
   set_piston(piston_wing, true);
@@ -662,6 +611,7 @@ void skills() {
   set_rollers(OUTTAKE);
   wait(unjamTime);
   set_rollers(SCORE);
+  relocalize_snap(); // sitting still and square while it scores
   wait(2750);
   set_drive(80.0, DRIVE_SPEED, true);
   wait();
@@ -816,4 +766,22 @@ void skillsEnd() {
   set_rollers(OUTTAKE);
   set_drive(28.0, 127);
   wait();
-}
\ No newline at end of file
+}
+// The selector's list, in the order it shows on the brain
+void autons_populate() {
+  auton_sel.selector_populate(std::vector<AutonObj>{
+      {doNothing, "23382A", pink},
+      {SAWP, "13 SAWP", green},
+      {sixThree, "6 + 3 Left", blue},
+      {sixThree, "6 + 3 Right", blue, true},
+      {fourFive, "4 + 5 middle", red},
+      {left7, "Left 7", orange},
+      {right7, "Right 7", orange},
+      {skills, "Skills", gray},
+      {measure_offsets, "measure offsets", purple},
+      {autotune_turn, "tune turn", purple},
+      {autotune_swing, "tune swing", purple},
+      {autotune_drive, "tune drive", purple},
+      {characterize_drive, "characterize", purple},
+  });
+}
@@ -0,0 +1,230 @@
+#include "autotune.hpp"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "EZ-Template/util.hpp"
+#include "config.hpp"
+#include "controls.hpp"
+#include "gains.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "screen.hpp"
+#include "sdwriter.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file autotune.cpp
+ * @brief This file contains the relay feedback PID autotuner.
+ * @details A relay around the current position makes the robot oscillate at the loop's ultimate
+ * period. Its amplitude gives the ultimate gain (Astrom-Hagglund), Ziegler-Nichols turns those into
+ * constants, and a set of step moves decides whether they are kept.
+ */
+
+static const char* AXIS_NAMES[3] = {"turn", "swing", "drive"};
+
+// Validation steps, relative degrees for turns and swings and inches for drives
+static const std::vector<double> TUNE_STEPS[3] = {
+    {15, -45, 90, -180},
+    {20, -45, 90},
+    {6, -12, 24, -18},
+};
+
+static double process_value(TuneAxes axis) {
+    if (axis == TUNE_DRIVE) return (chassis.drive_sensor_left() + chassis.drive_sensor_right()) / 2;
+    return chassis.drive_imu_get();
+}
+
+static void relay_output(TuneAxes axis, int output) {
+    switch (axis) {
+        case TUNE_TURN:
+            chassis.drive_set(output, -output);
+            break;
+        case TUNE_SWING:
+            chassis.drive_set(output, 0);
+            break;
+        case TUNE_DRIVE:
+            chassis.drive_set(output, output);
+            break;
+    }
+}
+
+// The chassis holds scheduled constants mid-motion, the config holds what they're scaled from
+static const ConfigKeys KP_KEYS[3] = {CFG_TURN_KP, CFG_SWING_KP, CFG_DRIVE_KP};
+
+static void constants_set(TuneAxes axis, ez::PID::Constants c) {
+    if (axis == TUNE_TURN) chassis.pid_turn_constants_set(c.kp, c.ki, c.kd, c.start_i);
+    else if (axis == TUNE_SWING) chassis.pid_swing_constants_set(c.kp, c.ki, c.kd, c.start_i);
+    else chassis.pid_drive_constants_set(c.kp, c.ki, c.kd, c.start_i);
+}
+
+//
+// Relay experiment
+//
+
+static bool relay_run(TuneAxes axis, TuneResult& result) {
+    const int h = TUNE_AMPLITUDE[axis];
+    const double eps = TUNE_HYSTERESIS[axis];
+    double setpoint = process_value(axis);
+    int output = h;
+    double high = -INFINITY, low = INFINITY;
+    uint32_t start = pros::millis(), last_rise = 0;
+    std::vector<double> periods, amplitudes;
+
+    chassis.drive_mode_set(ez::DISABLE);
+    uint32_t now = start;
+    while ((int)periods.size() < TUNE_CYCLES + 2) {
+        double value = process_value(axis);
+        double error = setpoint - value;
+        if (fabs(error) > TUNE_RUNAWAY[axis]) {
+            result.reason = "ran away";
+            break;
+        }
+        if (pros::millis() - start > TUNE_TIMEOUT) {
+            result.reason = "no oscillation";
+            break;
+        }
+        high = fmax(high, value);
+        low = fmin(low, value);
+
+        // Every switch from pushing back to pushing forward ends one cycle
+        if (error > eps && output < 0) {
+            output = h;
+            uint32_t time = pros::millis();
+            if (last_rise != 0) {
+                periods.push_back((time - last_rise) / 1000.0);
+                amplitudes.push_back((high - low) / 2);
+            }
+            last_rise = time;
+            high = -INFINITY;
+            low = INFINITY;
+        } else if (error < -eps && output > 0) {
+            output = -h;
+        }
+        relay_output(axis, output);
+        pros::Task::delay_until(&now, ez::util::DELAY_TIME);
+    }
+    chassis.drive_set(0, 0);
+    if ((int)periods.size() < TUNE_CYCLES + 2) return false;
+
+    // The first cycles are still settling into the limit cycle
+    double period = 0, amplitude = 0;
+    for (int i = 2; i < (int)periods.size(); i++) {
+        period += periods[i];
+        amplitude += amplitudes[i];
+    }
+    period /= TUNE_CYCLES;
+    amplitude /= TUNE_CYCLES;
+    if (amplitude <= eps) {
+        result.reason = "amplitude inside hysteresis";
+        return false;
+    }
+
+    // Describing function of a relay with hysteresis
+    result.ultimate_gain = 4 * h / (M_PI * sqrt(amplitude * amplitude - eps * eps));
+    result.ultimate_period = period;
+    return true;
+}
+
+// Ziegler-Nichols "no overshoot", converted to EZ's per tick integral and derivative
+static ez::PID::Constants propose(double ku, double tu, double start_i) {
+    double dt = ez::util::DELAY_TIME / 1000.0;
+    double kp = 0.2 * ku;
+    double ti = tu / 2;
+    double td = tu / 3;
+    return {kp, kp * dt / ti, kp * td / dt, start_i};
+}
+
+//
+// Validation
+//
+
+// The exit checks pid_wait runs, polled here so the step can be sampled in the same loop
+static bool step_running(TuneAxes axis, ez::exit_output& left, ez::exit_output& right) {
+    if (axis == TUNE_TURN) left = right = chassis.turnPID.exit_condition();
+    else if (axis == TUNE_SWING) left = right = chassis.swingPID.exit_condition();
+    else {
+        if (left == ez::RUNNING) left = chassis.leftPID.exit_condition();
+        if (right == ez::RUNNING) right = chassis.rightPID.exit_condition();
+    }
+    return left == ez::RUNNING || right == ez::RUNNING;
+}
+
+static double step_run(TuneAxes axis, double delta, double& settle) {
+    double target = process_value(axis) + delta;
+    double direction = delta > 0 ? 1 : -1;
+    double peak = 0;
+
+    if (axis == TUNE_TURN) chassis.pid_turn_relative_set(delta, TURN_SPEED, ez::raw);
+    else if (axis == TUNE_SWING) chassis.pid_swing_relative_set(ez::LEFT_SWING, delta, SWING_SPEED, ez::raw);
+    else chassis.pid_drive_set(delta, DRIVE_SPEED);
+
+    uint32_t start = pros::millis(), now = start;
+    ez::exit_output left = ez::RUNNING, right = ez::RUNNING;
+    while (step_running(axis, left, right)) {
+        peak = fmax(peak, (process_value(axis) - target) * direction);
+        pros::Task::delay_until(&now, ez::util::DELAY_TIME);
+    }
+    settle = pros::millis() - start;
+    return peak;
+}
+
+static void result_log(const TuneResult& result) {
+    print(std::string(AXIS_NAMES[result.axis]) + (result.accepted ? " kept " : " rejected ") + util::to_string_with_precision(result.proposed.kp, 2) + ", " +
+          util::to_string_with_precision(result.proposed.ki, 3) + ", " + util::to_string_with_precision(result.proposed.kd, 1));
+    sd_append(TUNE_LOG_FILE, sd_format("%s,%.3f,%.3f,%.3f,%.4f,%.2f,%.1f,%.2f,%.0f,%d,%s\n", AXIS_NAMES[result.axis], result.ultimate_gain, result.ultimate_period,
+                                       result.proposed.kp, result.proposed.ki, result.proposed.kd, result.proposed.start_i, result.overshoot, result.settle,
+                                       result.accepted, result.reason.c_str()));
+}
+
+TuneResult autotune(TuneAxes axis) {
+    TuneResult result;
+    result.axis = axis;
+    ez::PID::Constants previous = config_pid_get(KP_KEYS[axis]);
+    bool scheduling = gain_scheduling_get();
+    gain_scheduling_set(false);
+    chassis.drive_brake_set(pros::E_MOTOR_BRAKE_HOLD);
+
+    if (relay_run(axis, result)) {
+        result.proposed = propose(result.ultimate_gain, result.ultimate_period, previous.start_i);
+        constants_set(axis, result.proposed);
+        pros::delay(500);
+
+        result.accepted = true;
+        for (double delta : TUNE_STEPS[axis]) {
+            double settle;
+            double overshoot = step_run(axis, delta, settle);
+            result.overshoot = fmax(result.overshoot, overshoot);
+            result.settle += settle / TUNE_STEPS[axis].size();
+            pros::delay(250);
+        }
+        if (result.overshoot > TUNE_OVERSHOOT_MAX[axis]) {
+            result.accepted = false;
+            result.reason = "overshoot";
+        }
+    }
+
+    if (!result.accepted) constants_set(axis, previous);
+    else {
+        // Kept gains go into the config store, which the schedule scales from and which survives a restart
+        const double gains[4] = {result.proposed.kp, result.proposed.ki, result.proposed.kd, result.proposed.start_i};
+        for (int i = 0; i < 4; i++) config_set((ConfigKeys)(KP_KEYS[axis] + i), gains[i]);
+        config_apply();
+        config_save();
+    }
+    gain_scheduling_set(scheduling);
+    result_log(result);
+    return result;
+}
+
+// Selector entries. These move the robot, so they do nothing while the path viewer previews them
+void autotune_turn() {
+    if (match_state() == MatchStates::AUTO) autotune(TUNE_TURN);
+}
+
+void autotune_swing() {
+    if (match_state() == MatchStates::AUTO) autotune(TUNE_SWING);
+}
+
+void autotune_drive() {
+    if (match_state() == MatchStates::AUTO) autotune(TUNE_DRIVE);
+}
@@ -0,0 +1,35 @@
+#include "bindings.hpp"
+#include <vector>
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+
+/**
+ * @file bindings.cpp
+ * @brief This file contains the task that keeps the screen's bound widgets up to date.
+ * @details Widgets used to be rewritten from their tasks every tick whether anything changed or
+ * not, and every rewrite invalidates the widget for LVGL to redraw. Bindings only touch a widget
+ * when its value moves.
+ */
+
+static pros::Mutex bindings_mutex;
+static std::vector<BindingBase*> bindings;
+
+void bindings_add(BindingBase* binding) {
+    bindings_mutex.take();
+    bindings.push_back(binding);
+    bindings_mutex.give();
+}
+
+void bindings_poll() {
+    bindings_mutex.take();
+    for (BindingBase* binding : bindings) binding->poll();
+    bindings_mutex.give();
+}
+
+void bindings_task() {
+    uint32_t now = pros::millis();
+    while (true) {
+        bindings_poll();
+        pros::Task::delay_until(&now, BINDINGS_PERIOD);
+    }
+}
@@ -0,0 +1,135 @@
+#include "config.hpp"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "EZ-Template/util.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "sdwriter.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file config.cpp
+ * @brief This file contains the robot configuration store.
+ * @details The file is a 12 byte header ("RCFG", version, reserved, key count, CRC-32 of the
+ * entries) followed by one 10 byte entry per key, a uint16_t key and a double. Keys the firmware
+ * doesn't know are skipped and keys missing from the file keep their defaults, so adding settings
+ * doesn't throw away a saved config.
+ */
+
+static const size_t HEADER_SIZE = 12;
+static const size_t ENTRY_SIZE = 10;
+static const size_t MAX_FILE_SIZE = 4096;
+
+// The table starts out holding the compiled values, keep a copy for config_reset
+static double defaults[CFG_COUNT];
+[[maybe_unused]] static const bool defaults_saved = [] {
+    for (int i = 0; i < CFG_COUNT; i++) defaults[i] = config_fields[i].value;
+    return true;
+}();
+
+static uint32_t crc32(const uint8_t* data, size_t length) {
+    uint32_t crc = 0xffffffff;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+void config_set(ConfigKeys key, double value) {
+    if (key < 0 || key >= CFG_COUNT) return;
+    config_fields[key].value = util::clamp(value, config_fields[key].max, config_fields[key].min);
+}
+
+void config_reset() {
+    for (int i = 0; i < CFG_COUNT; i++) config_fields[i].value = defaults[i];
+}
+
+bool config_load() {
+    FILE* file = pros::usd::is_installed() ? sd_open(CONFIG_FILE, "rb") : nullptr;
+    if (!file) return false;
+    static uint8_t buffer[MAX_FILE_SIZE];
+    size_t size = fread(buffer, 1, sizeof(buffer), file);
+    fclose(file);
+
+    if (size < HEADER_SIZE || memcmp(buffer, "RCFG", 4) != 0 || buffer[4] != CONFIG_VERSION) return false;
+    uint16_t count;
+    uint32_t crc;
+    memcpy(&count, buffer + 6, sizeof(count));
+    memcpy(&crc, buffer + 8, sizeof(crc));
+    if (HEADER_SIZE + count * ENTRY_SIZE != size || crc32(buffer + HEADER_SIZE, count * ENTRY_SIZE) != crc) return false;
+
+    for (int i = 0; i < count; i++) {
+        const uint8_t* entry = buffer + HEADER_SIZE + i * ENTRY_SIZE;
+        uint16_t key;
+        double value;
+        memcpy(&key, entry, sizeof(key));
+        memcpy(&value, entry + 2, sizeof(value));
+        if (key < CFG_COUNT && config_fields[key].name) config_set((ConfigKeys)key, value);
+    }
+    return true;
+}
+
+bool config_save() {
+    uint16_t count = 0;
+    for (int key = 0; key < CFG_COUNT; key++) count += config_fields[key].name != nullptr;
+    std::string data(HEADER_SIZE + count * ENTRY_SIZE, '\0');
+    uint8_t* out = (uint8_t*)data.data();
+    uint8_t* entry = out + HEADER_SIZE;
+    for (uint16_t key = 0; key < CFG_COUNT; key++) {
+        if (!config_fields[key].name) continue;
+        memcpy(entry, &key, sizeof(key));
+        memcpy(entry + 2, &config_fields[key].value, sizeof(double));
+        entry += ENTRY_SIZE;
+    }
+    uint32_t crc = crc32(out + HEADER_SIZE, count * ENTRY_SIZE);
+    memcpy(out, "RCFG", 4);
+    out[4] = CONFIG_VERSION;
+    memcpy(out + 6, &count, sizeof(count));
+    memcpy(out + 8, &crc, sizeof(crc));
+    return sd_write(CONFIG_FILE, data);
+}
+
+//
+// Apply
+//
+
+static void pid_set(void (ez::Drive::*setter)(double, double, double, double), ConfigKeys kp) {
+    ez::PID::Constants constants = config_pid_get(kp);
+    (chassis.*setter)(constants.kp, constants.ki, constants.kd, constants.start_i);
+}
+
+static void exit_set(void (ez::Drive::*setter)(int, double, int, double, int, int, bool), ConfigKeys small_time) {
+    auto get = [small_time](int offset) { return config_get((ConfigKeys)(small_time + offset)); };
+    (chassis.*setter)(get(0), get(1), get(2), get(3), get(4), get(5), true);
+}
+
+void config_apply() {
+    // P, I, D, and Start I
+    pid_set(&ez::Drive::pid_drive_constants_set, CFG_DRIVE_KP);
+    pid_set(&ez::Drive::pid_heading_constants_set, CFG_HEADING_KP);
+    pid_set(&ez::Drive::pid_turn_constants_set, CFG_TURN_KP);
+    pid_set(&ez::Drive::pid_swing_constants_set, CFG_SWING_KP);
+    pid_set(&ez::Drive::pid_odom_angular_constants_set, CFG_ANGULAR_KP);
+    pid_set(&ez::Drive::pid_odom_boomerang_constants_set, CFG_BOOMERANG_KP);
+
+    // Exit conditions
+    exit_set(&ez::Drive::pid_turn_exit_condition_set, CFG_TURN_SMALL_TIME);
+    exit_set(&ez::Drive::pid_swing_exit_condition_set, CFG_SWING_SMALL_TIME);
+    exit_set(&ez::Drive::pid_drive_exit_condition_set, CFG_DRIVE_SMALL_TIME);
+    exit_set(&ez::Drive::pid_odom_turn_exit_condition_set, CFG_ODOM_TURN_SMALL_TIME);
+    exit_set(&ez::Drive::pid_odom_drive_exit_condition_set, CFG_ODOM_DRIVE_SMALL_TIME);
+    chassis.pid_turn_chain_constant_set(config_get(CFG_TURN_CHAIN));
+    chassis.pid_swing_chain_constant_set(config_get(CFG_SWING_CHAIN));
+    chassis.pid_drive_chain_constant_set(config_get(CFG_DRIVE_CHAIN));
+
+    // S-curve limits, the motion wrappers' slew
+    drive_profile_limits = {config_get(CFG_PROFILE_DRIVE_ACCEL), config_get(CFG_PROFILE_DRIVE_JERK)};
+    turn_profile_limits = {config_get(CFG_PROFILE_TURN_ACCEL), config_get(CFG_PROFILE_TURN_JERK)};
+
+    // Odom motions
+    chassis.odom_turn_bias_set(config_get(CFG_ODOM_TURN_BIAS));
+    chassis.odom_look_ahead_set(config_get(CFG_LOOK_AHEAD));
+    chassis.odom_boomerang_distance_set(config_get(CFG_BOOMERANG_DISTANCE));
+    chassis.odom_boomerang_dlead_set(config_get(CFG_BOOMERANG_DLEAD));
+}
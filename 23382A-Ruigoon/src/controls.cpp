@@ -24,24 +24,29 @@ bool jammed = false;
 #pragma region motors
 
 void set_rollers(int vltg1, int vltg2, int vltg3) {
+    if (dry_running()) return;
     motor_intake1.move(vltg1);
     motor_intake2.move(vltg2);
     motor_intake3.move(vltg3);
 }
 
 void set_rollers(int vltg1, int vltg2) {
+    if (dry_running()) return;
     motor_intake1.move(vltg1);
     motor_intake2.move(vltg1);
     motor_intake3.move(vltg2);
 } 
 
 void set_rollers(int vltg) {
+    if (dry_running()) return;
     motor_intake1.move(vltg);
     motor_intake2.move(vltg);
     motor_intake3.move(vltg);
 }
 
 void set_rollers(RollerStates state) {
+    path_event(EVENT_ROLLERS);
+    if (!dry_running()) rollerState = state;
     switch (state) {
         case INTAKE:
             set_rollers(127, 100, -25);
@@ -67,13 +72,13 @@ void set_rollers(RollerStates state) {
 }
 
 void control_rollers() {
-    if (master.get_digital(BUTTON_INTAKE)) {
+    if (driver_input.get_digital(BUTTON_INTAKE)) {
         set_rollers(INTAKE);
-    } else if (master.get_digital(BUTTON_OUTTAKE)) {
+    } else if (driver_input.get_digital(BUTTON_OUTTAKE)) {
         set_rollers(OUTTAKE);
-    } else if (master.get_digital(BUTTON_SCORE)) {
+    } else if (driver_input.get_digital(BUTTON_SCORE)) {
         set_rollers(SCORE);
-    } else if (master.get_digital(BUTTON_SCORE_MID)) {
+    } else if (driver_input.get_digital(BUTTON_SCORE_MID)) {
         set_rollers(SCORE_MID);
     } else {
         set_rollers(STOP);
@@ -82,24 +87,75 @@ void control_rollers() {
 
 #pragma endregion
 
+#pragma region driver
+
+void driver_input_read() {
+    for (int i = 0; i < 4; i++) {
+        driver_input.analog[i] = controlla.get_analog((pros::controller_analog_e_t)i);
+    }
+    uint16_t state = 0;
+    for (int i = pros::E_CONTROLLER_DIGITAL_L1; i <= pros::E_CONTROLLER_DIGITAL_A; i++) {
+        if (controlla.get_digital((pros::controller_digital_e_t)i)) state |= 1 << (i - pros::E_CONTROLLER_DIGITAL_L1);
+    }
+    driver_input.buttons_set(state);
+}
+
+// One tick of driver control. Replays call this too, so it must only read driver_input
+void driver_control() {
+    int forward = driver_input.get_analog(pros::E_CONTROLLER_ANALOG_LEFT_Y);
+    int turn    = driver_input.get_analog(pros::E_CONTROLLER_ANALOG_RIGHT_X);
+
+    // deadband (important)
+    if (abs(forward) < 10) forward = 0;
+    if (abs(turn) < 10) turn = 0;
+
+    // scale turning
+    turn = turn * 0.65;
+
+    chassis.drive_set(forward + turn, forward - turn);
+
+    control_rollers();
+    control_piston_toggle(piston_loader, BUTTON_LOADER);
+    control_piston_hold(piston_wing, BUTTON_WING);
+    control_piston_toggle(piston_park, BUTTON_PARK);
+    control_piston_toggle(piston_scorer, BUTTON_SCORER);
+    control_piston_toggle(piston_descore, BUTTON_DESCORE);
+}
+
+#pragma endregion
+
 #pragma region pistons 
 
 void set_piston(ez::Piston& piston, bool state) {
-    piston.set(state);
+    path_event(EVENT_PISTON);
+    if (!dry_running()) piston.set(state);
 }
 
 void control_piston_toggle(ez::Piston& piston, pros::controller_digital_e_t button) {
-    if (controlla.get_digital_new_press(button)) {
+    if (driver_input.get_digital_new_press(button)) {
         set_piston(piston, !piston.get());
     }
 }
 
 void control_piston_hold(ez::Piston& piston, pros::controller_digital_e_t button) {
-    if (controlla.get_digital(button)) {
+    if (driver_input.get_digital(button)) {
         set_piston(piston, true);
     } else {
         set_piston(piston, false);
     }
 }
 
+// Packs every piston into one byte, in the order they are declared in subsystems.hpp
+uint8_t piston_states_get() {
+    return piston_scorer.get() | piston_loader.get() << 1 | piston_wing.get() << 2 | piston_park.get() << 3 | piston_descore.get() << 4;
+}
+
+void piston_states_set(uint8_t states) {
+    if (piston_scorer.get() != (bool)(states & 1)) set_piston(piston_scorer, states & 1);
+    if (piston_loader.get() != (bool)(states & 2)) set_piston(piston_loader, states & 2);
+    if (piston_wing.get() != (bool)(states & 4)) set_piston(piston_wing, states & 4);
+    if (piston_park.get() != (bool)(states & 8)) set_piston(piston_park, states & 8);
+    if (piston_descore.get() != (bool)(states & 16)) set_piston(piston_descore, states & 16);
+}
+
 #pragma endregion
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "ctrlscreen.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file ctrlscreen.cpp
+ * @brief This file contains the controller screen service.
+ * @details Each line keeps one message per priority. What the line should show is its highest
+ * priority message that hasn't expired, and the line is dirty while that differs from what was
+ * last sent. Every CONTROLLER_PERIOD the task sends one dirty line or the waiting rumble, highest
+ * priority first, rotating through ties so a busy line can't starve the others.
+ */
+
+class ControllerMessage {
+    public:
+        std::string text;
+        uint32_t expires = 0;  // 0 never
+        bool set = false;
+};
+
+class ControllerLine {
+    public:
+        ControllerMessage messages[CTRL_PRIORITIES];
+        std::string shown;
+        bool sent = false;  // shown is what the controller has
+};
+
+static pros::Mutex controller_mutex;
+static ControllerLine controller_lines[CONTROLLER_LINES];
+static std::string rumble_pattern;
+static int rumble_priority = -1;  // -1 nothing waiting
+
+void controller_print(int line, const std::string& text, ControllerPriorities priority, uint32_t hold) {
+    if (line < 0 || line >= CONTROLLER_LINES) return;
+    controller_mutex.take();
+    ControllerMessage& message = controller_lines[line].messages[priority];
+    message.text = text.substr(0, CONTROLLER_COLUMNS);
+    message.text.erase(message.text.find_last_not_of(' ') + 1);
+    message.expires = hold ? pros::millis() + hold : 0;
+    message.set = true;
+    controller_mutex.give();
+}
+
+void controller_clear(int line, ControllerPriorities priority) {
+    if (line < 0 || line >= CONTROLLER_LINES) return;
+    controller_mutex.take();
+    controller_lines[line].messages[priority] = ControllerMessage();
+    controller_mutex.give();
+}
+
+void controller_rumble(const char* pattern, ControllerPriorities priority) {
+    controller_mutex.take();
+    if ((int)priority >= rumble_priority) {
+        rumble_pattern = pattern;
+        rumble_priority = priority;
+    }
+    controller_mutex.give();
+}
+
+// Highest priority live message, drops the expired ones. -1 when the line should be blank
+static int line_priority(ControllerLine& line, uint32_t now) {
+    for (int priority = CTRL_PRIORITIES - 1; priority >= 0; priority--) {
+        ControllerMessage& message = line.messages[priority];
+        if (message.set && message.expires && (int32_t)(now - message.expires) >= 0) message = ControllerMessage();
+        if (message.set) return priority;
+    }
+    return -1;
+}
+
+void controller_screen_task() {
+    uint32_t now = pros::millis();
+    int next = 0;  // where ties start, one past the last thing sent
+    bool tuning = false;
+    while (true) {
+        // EZ's PID tuner writes to the controller itself, so stay off it and redraw after
+        if (chassis.pid_tuner_enabled()) {
+            tuning = true;
+            pros::Task::delay_until(&now, CONTROLLER_PERIOD);
+            continue;
+        }
+
+        controller_mutex.take();
+        if (tuning) {
+            for (ControllerLine& line : controller_lines) line.sent = false;
+            tuning = false;
+        }
+
+        // Lines are 0 to CONTROLLER_LINES - 1, the rumble is CONTROLLER_LINES
+        int best = -1, best_priority = -1;
+        std::string text;
+        for (int i = 0; i <= CONTROLLER_LINES; i++) {
+            int index = (next + i) % (CONTROLLER_LINES + 1);
+            int priority;
+            std::string wanted;
+            if (index == CONTROLLER_LINES) {
+                priority = rumble_priority;
+                wanted = rumble_pattern;
+            } else {
+                ControllerLine& line = controller_lines[index];
+                int live = line_priority(line, now);
+                wanted = live >= 0 ? line.messages[live].text : "";
+                if (line.sent && wanted == line.shown) continue;
+                // A line going blank still has to be written over
+                priority = live >= 0 ? live : CTRL_LOW;
+            }
+            if (priority > best_priority) {
+                best = index;
+                best_priority = priority;
+                text = wanted;
+            }
+        }
+        if (best == CONTROLLER_LINES) {
+            rumble_priority = -1;
+            rumble_pattern.clear();
+        }
+        controller_mutex.give();
+
+        if (best == CONTROLLER_LINES) {
+            controlla.rumble(text.c_str());
+        } else if (best >= 0) {
+            // Padded so a shorter message covers the end of the longer one before it
+            text.resize(CONTROLLER_COLUMNS, ' ');
+            bool written = controlla.set_text(best, 0, text) == 1;
+            controller_mutex.take();
+            controller_lines[best].shown = text.substr(0, text.find_last_not_of(' ') + 1);
+            controller_lines[best].sent = written;
+            controller_mutex.give();
+        }
+        if (best >= 0) next = best + 1;
+        pros::Task::delay_until(&now, CONTROLLER_PERIOD);
+    }
+}
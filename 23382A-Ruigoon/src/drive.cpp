@@ -7,6 +7,7 @@
 #include "main.h"  // IWYU pragma: keep
 #include "okapi/api/units/QAngle.hpp"
 #include "subsystems.hpp"
+#include "telemetry.hpp"
 
 /**
  * @file drive.cpp
@@ -16,7 +17,17 @@
  */
 
 Coordinate currentPoint = {0, 0, 0};
-vector<Coordinate> autonPath = {};
+PathArena autonPath;
+
+// Only the task running a dry run writes, anything else reaching a wrapper leaves the path alone
+void PathArena::push_back(const Coordinate& point) {
+	if(!dry_running()) return;
+	if(count == PATH_CAPACITY) {
+		overflow++;
+		return;
+	}
+	points[count++] = point;
+}
 
 //
 // Internal math
@@ -38,7 +49,8 @@ double get_theta(Coordinate point1, Coordinate point2, drive_directions directio
 	return theta;
 }
 
-double get_velocity(double voltage) { return (2 * M_PI * (voltage / 127 * chassis.drive_rpm_get()) * DRIVE_DIAMETER) / 120; }
+// Steady state speed in in/s from the characterised feedforward, averaged across both sides
+double get_velocity(double voltage) { return (ff_left.velocity(voltage) + ff_right.velocity(voltage)) / 2; }
 
 double get_time_point(double distance, double velocity) { return distance / velocity; }
 
@@ -82,10 +94,10 @@ std::vector<Coordinate> injectPoint(Coordinate startPoint, Coordinate endPoint,
 	if(startPoint.t < 0) startPoint.t += 360;
 
 	// Get wheel velocities and proper time
-	double v_left = get_velocity(left);
-	double v_right = get_velocity(right);
-	double v_all = (v_left + v_right) / 2;
-	if(v_all == 0) v_all = v_left;
+	double v_left = ff_left.velocity(left);
+	double v_right = ff_right.velocity(right);
+	// A point turn's sides cancel out, only roughly once each side has its own fit, so it goes at their mean speed
+	double v_all = left == -right ? (fabs(v_left) + fabs(v_right)) / 2 : (v_left + v_right) / 2;
 
 	double time = abs(get_time_point(lookAhead, v_all));
 
@@ -96,7 +108,8 @@ std::vector<Coordinate> injectPoint(Coordinate startPoint, Coordinate endPoint,
 	theta = fmod(theta, 360);
 	if(theta < 0) theta += 360;
 
-	if(left != KEY) {
+	// Sides below kS don't move the robot, and a curve between them would never reach theta
+	if(left != KEY && (v_left != 0 || v_right != 0)) {
 		if(left != right) {
 			// Make sure the robot travels in the correct direction
 			if(left == -right)
@@ -145,16 +158,68 @@ std::vector<Coordinate> injectPath(std::vector<Coordinate> coordList, double loo
 	return coordList;
 }
 
+//
+// Alliance / side transform
+//
+
+double transform_theta(double theta) {
+	// Mirroring across the x axis reflects the heading about 90
+	if(side_mirrored()) theta = 180 - theta;
+	// The blue alliance is the red path rotated 180 degrees about the field center
+	if(allianceColor == Alliances::BLUE) theta += 180;
+	theta = fmod(theta, 360);
+	if(theta < 0) theta += 360;
+	return theta;
+}
+
+Coordinate transform_point(Coordinate point) {
+	if(side_mirrored()) point.y = -point.y;
+	if(allianceColor == Alliances::BLUE) {
+		point.x = -point.x;
+		point.y = -point.y;
+	}
+	point.t = transform_theta(point.t);
+	return point;
+}
+
+e_angle_behavior transform_behavior(e_angle_behavior behavior) {
+	// A rotation keeps the turn direction, a reflection swaps it
+	if(!side_mirrored()) return behavior;
+	if(behavior == cw) return ccw;
+	if(behavior == ccw) return cw;
+	return behavior;
+}
+
+e_swing transform_swing(e_swing side) {
+	if(!side_mirrored()) return side;
+	return side == LEFT_SWING ? RIGHT_SWING : LEFT_SWING;
+}
+
+// Every motion wrapper calls this right after it sets the motion. A profile left running by the
+// last motion, say one that chained out early, is stopped, and the speed it may have capped in
+// the meantime is put back
+static void motion_start(int speed, bool boomerang = false) {
+	profile_stop();
+	chassis.pid_speed_max_set(abs(speed));
+	motion_log_start();
+	gain_schedule_start(boomerang);
+}
+
 //
 // Set position wrappers
 //
 
 void set_position(double x, double y, double t) {
-	currentPoint.x = x;
-	currentPoint.y = y;
-	currentPoint.t = t;
+	Coordinate start = transform_point({x, y, t});
+	currentPoint.x = start.x;
+	currentPoint.y = start.y;
+	currentPoint.t = start.t;
 	
-	if(matchState != MatchStates::DISABLED) chassis.odom_xyt_set(currentPoint.x, currentPoint.y, t);
+	if(match_state() != MatchStates::DISABLED) {
+		chassis.odom_xyt_set(currentPoint.x, currentPoint.y, currentPoint.t);
+		ekf_reset(currentPoint.x, currentPoint.y, currentPoint.t);
+		odometry_reset(currentPoint.x, currentPoint.y, currentPoint.t);
+	}
 	autonPath.push_back(currentPoint);
 }
 
@@ -163,7 +228,7 @@ void set_position(double x, double y, double t) {
 //
 
 void wait(Wait type) {
-	switch (matchState) {
+	switch(match_state()) {
 		case AUTO:
 			switch (type) {
 				case WAIT:
@@ -176,13 +241,14 @@ void wait(Wait type) {
 					chassis.pid_wait_quick_chain();
 					break;
 			}
+			motion_log_end(type);
 		default:
 			break;
 	}
 }
 
 void wait(int millis, bool ignore) {
-	switch(matchState) {
+	switch(match_state()) {
 		case MatchStates::AUTO:
 			pros::delay(millis);
 			break;
@@ -192,12 +258,26 @@ void wait(int millis, bool ignore) {
 	if(!ignore) {
 	currentPoint.left = KEY;
 	currentPoint.right = millis;
-	autonPath.push_back(currentPoint);
+	Coordinate marker = currentPoint;
+	marker.event = EVENT_WAIT;
+	autonPath.push_back(marker);
 	}
 }
 
+void path_event(PathEvents event) {
+	// Driver control sets the mechanisms every tick, only dry runs are paths
+	if(!dry_running()) return;
+	// set_rollers moves pistons too, one marker per spot is enough
+	if(!autonPath.empty() && autonPath.back().event == event && autonPath.back().x == currentPoint.x && autonPath.back().y == currentPoint.y) return;
+	Coordinate marker = currentPoint;
+	marker.left = KEY;
+	marker.right = 0;
+	marker.event = event;
+	autonPath.push_back(marker);
+}
+
 void wait_until(double target) {
-	switch(matchState) {
+	switch(match_state()) {
 		case MatchStates::AUTO:
 			chassis.pid_wait_until(target);
 			break;
@@ -207,7 +287,8 @@ void wait_until(double target) {
 }
 
 void wait_until(Coordinate coordinate) {
-	switch(matchState) {
+	coordinate = transform_point(coordinate);
+	switch(match_state()) {
 		case MatchStates::AUTO:
 			chassis.pid_wait_until({coordinate.x * okapi::inch, coordinate.y * okapi::inch});
 			break;
@@ -221,39 +302,46 @@ void wait_until(Coordinate coordinate) {
 //
 
 void set_mtp(Coordinate newpoint, int speed, drive_directions direction, bool slew) {
-	switch(matchState) {
+	Coordinate target = transform_point(newpoint);
+	switch(match_state()) {
 		case AUTO:
-			chassis.pid_odom_set({{newpoint.x * okapi::inch, newpoint.y * okapi::inch}, direction, speed}, slew);
-			currentPoint.t = get_theta({currentPoint.x, currentPoint.y}, newpoint, direction);
-			currentPoint.x = newpoint.x;
-			currentPoint.y = newpoint.y;
+			chassis.pid_odom_set({{target.x * okapi::inch, target.y * okapi::inch}, direction, speed}, false);
+			motion_start(speed);
+			if(slew) profile_drive_start(get_distance({chassis.odom_x_get(), chassis.odom_y_get()}, target), speed);
+			currentPoint.t = get_theta({currentPoint.x, currentPoint.y}, target, direction);
+			currentPoint.x = target.x;
+			currentPoint.y = target.y;
 			currentPoint.left = speed * (direction == fwd ? 1 : -1);
 			currentPoint.right = speed * (direction == fwd ? 1 : -1);
 			autonPath.push_back(currentPoint);
 			break;
 		default:
-			set_turn(get_theta(currentPoint, newpoint, direction));
+			// The nested wrappers transform again, so plan the motion in the authored frame
+			set_turn(get_theta(transform_point(currentPoint), newpoint, direction));
 			wait();
-			set_drive(get_distance(currentPoint, newpoint), speed, slew);
+			set_drive(get_distance(currentPoint, target), speed, slew);
 			break;
 	}
 }
 
 void set_boom(Coordinate newpoint, int speed, drive_directions direction, bool slew) {
-	switch(matchState) {
+	Coordinate target = transform_point(newpoint);
+	switch(match_state()) {
 		case AUTO:
-			chassis.pid_odom_boomerang_set({{newpoint.x * okapi::inch, newpoint.y * okapi::inch, newpoint.t * okapi::degree}, direction, speed}, slew);
-				currentPoint.t = get_theta({currentPoint.x, currentPoint.y}, newpoint, direction);
-				currentPoint.x = newpoint.x;
-				currentPoint.y = newpoint.y;
+			chassis.pid_odom_boomerang_set({{target.x * okapi::inch, target.y * okapi::inch, target.t * okapi::degree}, direction, speed}, false);
+			motion_start(speed, true);
+			if(slew) profile_drive_start(get_distance({chassis.odom_x_get(), chassis.odom_y_get()}, target), speed);
+				currentPoint.t = get_theta({currentPoint.x, currentPoint.y}, target, direction);
+				currentPoint.x = target.x;
+				currentPoint.y = target.y;
 				currentPoint.left = speed * (direction == fwd ? 1 : -1);
 				currentPoint.right = speed * (direction == fwd ? 1 : -1);
 				autonPath.push_back(currentPoint);
 			break;
 		default:
-			set_turn(get_theta(currentPoint, newpoint, direction));
+			set_turn(get_theta(transform_point(currentPoint), newpoint, direction));
 			wait();
-			set_drive(get_distance(currentPoint, newpoint), speed, slew);
+			set_drive(get_distance(currentPoint, target), speed, slew);
 			wait();
 			set_turn(newpoint.t, speed);
 			break;
@@ -265,7 +353,7 @@ void set_boom(Coordinate newpoint, int speed, drive_directions direction, bool s
 //
 void set_drive(int speed) {
 	drive_directions direction = speed < 0 ? rev : fwd;
-	chassis.drive_set(speed, speed);
+	if(!dry_running()) chassis.drive_set(speed, speed);
 	currentPoint.left = speed * (direction == fwd ? 1 : -1);
 	currentPoint.right = speed * (direction == fwd ? 1 : -1);
 	currentPoint.t = currentPoint.t;
@@ -274,14 +362,16 @@ void set_drive(int speed) {
 
 void set_drive(double distance, int speed, bool slew, bool correction) {
 	drive_directions direction = distance > 0 ? fwd : rev;
-	switch(matchState) {
+	switch(match_state()) {
 		case MatchStates::AUTO:
 			if (correction == false) {
-				chassis.pid_drive_set(distance * okapi::inch, speed, slew, correction);
+				chassis.pid_drive_set(distance * okapi::inch, speed, false, correction);
+				motion_start(speed);
 			} else {
-				chassis.pid_odom_set(distance * okapi::inch, speed, slew);
-
+				chassis.pid_odom_set(distance * okapi::inch, speed, false);
+				motion_start(speed);
 			}
+			if(slew) profile_drive_start(distance, speed);
 			currentPoint.x = chassis.odom_x_get();
 			currentPoint.y = chassis.odom_y_get();
 			break;
@@ -299,9 +389,13 @@ void set_drive(double distance, int speed, bool slew, bool correction) {
 //
 
 void set_turn(double theta, int speed, e_angle_behavior behavior, bool slew) {
-	switch(matchState) {
+	theta = transform_theta(theta);
+	behavior = transform_behavior(behavior);
+	switch(match_state()) {
 		case MatchStates::AUTO:
-			chassis.pid_turn_set(theta * okapi::degree, speed, behavior, slew);
+			chassis.pid_turn_set(theta * okapi::degree, speed, behavior, false);
+			motion_start(speed);
+			if(slew) profile_turn_start(chassis.turnPID.target_get() - chassis.drive_imu_get(), speed);
 			break;
 		default:
 			break;
@@ -319,28 +413,39 @@ void set_turn(double theta, int speed, e_angle_behavior behavior, bool slew) {
 }
 
 void set_turn(Coordinate newpoint, drive_directions direction, int speed, e_angle_behavior behavior, bool slew) {
-	switch(matchState) {
+	newpoint = transform_point(newpoint);
+	behavior = transform_behavior(behavior);
+	switch(match_state()) {
 		case MatchStates::AUTO:
-			chassis.pid_turn_set({newpoint.x * okapi::inch, newpoint.y * okapi::inch, newpoint.t * okapi::degree}, direction, speed, behavior, slew);
+			chassis.pid_turn_set({newpoint.x * okapi::inch, newpoint.y * okapi::inch, newpoint.t * okapi::degree}, direction, speed, behavior, false);
+			motion_start(speed);
+			if(slew) profile_turn_start(chassis.turnPID.target_get() - chassis.drive_imu_get(), speed);
 			break;
 		default:
 			break;
-			currentPoint.t = get_theta({currentPoint.x, currentPoint.y}, newpoint, direction);
-			currentPoint.x = newpoint.x;
-			currentPoint.y = newpoint.y;
-			currentPoint.left = speed * (direction == fwd ? 1 : -1);
-			currentPoint.right = speed * (direction == fwd ? 1 : -1);
-			autonPath.push_back(currentPoint);
 	}
+
+	// Turns in place to face the point, recorded the same way as a turn to a heading
+	double theta = get_theta(currentPoint, newpoint, direction);
+	if(behavior == shortest) behavior = (util::turn_shortest(theta, currentPoint.t) < currentPoint.t) ? ccw : cw;
+
+	if(behavior == ccw) speed *= -1;
+
+	currentPoint.t = theta;
+	currentPoint.left = speed;
+	currentPoint.right = -speed;
+	currentPoint.behavior = behavior;
+	autonPath.push_back(currentPoint);
 }
 
 void set_turn_relative(double theta, int speed, e_angle_behavior behavior) {
-	switch(matchState) {
+	// set_turn transforms the target, so add the offset to the authored heading
+	switch(match_state()) {
 		case MatchStates::AUTO:
-			theta += chassis.odom_theta_get();
+			theta += transform_theta(chassis.odom_theta_get());
 			break;
 		default:
-			theta += currentPoint.t;
+			theta += transform_theta(currentPoint.t);
 			break;
 	}
 	fmod(theta, 360);
@@ -349,16 +454,16 @@ void set_turn_relative(double theta, int speed, e_angle_behavior behavior) {
 }
 
 void set_turn_relative(double theta, int speed) {
-	e_angle_behavior behavior = (util::turn_shortest(theta, currentPoint.t) < 0) ? ccw : cw;
-	switch(matchState) {
+	double current = transform_theta(currentPoint.t);
+	switch(match_state()) {
 		case MatchStates::AUTO:
-			behavior = (util::turn_shortest(theta, chassis.odom_theta_get()) < 0) ? ccw : cw;
-			theta += chassis.odom_theta_get();
+			current = transform_theta(chassis.odom_theta_get());
 			break;
 		default:
-			theta += currentPoint.t;
 			break;
 	}
+	e_angle_behavior behavior = (util::turn_shortest(theta, current) < 0) ? ccw : cw;
+	theta += current;
 	fmod(theta, 360);
 	if(theta < 0) theta += 360;
 	set_turn(theta, speed, behavior);
@@ -369,9 +474,13 @@ void set_turn_relative(double theta, int speed) {
 //
 
 void set_swing(e_swing side, double theta, double main, double opp, e_angle_behavior behavior) {
-	switch(matchState) {
+	theta = transform_theta(theta);
+	side = transform_swing(side);
+	behavior = transform_behavior(behavior);
+	switch(match_state()) {
 		case MatchStates::AUTO:
 			chassis.pid_swing_set(side, theta * okapi::degree, main, opp, behavior);
+			motion_start(main);
 			break;
 		default:
 			break;
@@ -382,8 +491,8 @@ void set_swing(e_swing side, double theta, double main, double opp, e_angle_beha
 	double left = side == LEFT_SWING ? main : opp;
 
 	// Convert voltage to velocity
-	double v_left = get_velocity(left);
-	double v_right = get_velocity(right);
+	double v_left = ff_left.velocity(left);
+	double v_right = ff_right.velocity(right);
 	double v_all = (v_left + v_right) / 2;
 
 	// Get radius and arc length
@@ -404,10 +513,11 @@ void set_swing(e_swing side, double theta, double main, double opp, e_angle_beha
 void set_swing(ez::e_swing side, double theta, double main, ez::e_angle_behavior behavior) { set_swing(side, theta, main, 0, behavior); }
 
 void set_swing(ez::e_swing side, double theta, double main, double opp) {
-	e_angle_behavior behavior = (util::turn_shortest(theta, currentPoint.t) < 0) ? ccw : cw;
-	switch(matchState) {
+	// Pick the direction in the authored frame, set_swing transforms it with the target
+	e_angle_behavior behavior = (util::turn_shortest(theta, transform_theta(currentPoint.t)) < 0) ? ccw : cw;
+	switch(match_state()) {
 		case MatchStates::AUTO:
-			behavior = (util::turn_shortest(theta, chassis.odom_theta_get()) < 0) ? ccw : cw;
+			behavior = (util::turn_shortest(theta, transform_theta(chassis.odom_theta_get())) < 0) ? ccw : cw;
 			break;
 		default:
 			break;
@@ -416,10 +526,11 @@ void set_swing(ez::e_swing side, double theta, double main, double opp) {
 }
 
 void swingSet(ez::e_swing side, double theta, double main) {
-	e_angle_behavior behavior = (util::turn_shortest(theta, currentPoint.t) < 0) ? ccw : cw;
-	switch(matchState) {
+	// Pick the direction in the authored frame, set_swing transforms it with the target
+	e_angle_behavior behavior = (util::turn_shortest(theta, transform_theta(currentPoint.t)) < 0) ? ccw : cw;
+	switch(match_state()) {
 		case MatchStates::AUTO:
-			behavior = (util::turn_shortest(theta, chassis.odom_theta_get()) < 0) ? ccw : cw;
+			behavior = (util::turn_shortest(theta, transform_theta(chassis.odom_theta_get())) < 0) ? ccw : cw;
 			break;
 		default:
 			break;
@@ -431,19 +542,7 @@ void swingSet(ez::e_swing side, double theta, double main) {
 // Print path
 //
 
-void getPath() {
-	cout << "===========================================" << endl;
-	for(auto point : autonPath) {
-		cout << "(" << point.x << ", " << point.y << ")" << endl;
-	}
-	cout << "===========================================" << endl;
-}
+// Sent on the telemetry path channel a few points per period, tools/telemetry.py collects them
+void get_path() { telemetry_path(autonPath.to_vector()); }
 
-void getPathInjected() {
-	auto injected = injectPath(autonPath, 2);
-	cout << "===========================================" << endl;
-	for(auto point : injected) {
-		cout << "(" << point.x << ", " << point.y << ")" << endl;
-	}
-	cout << "===========================================" << endl;
-}
\ No newline at end of file
+void get_path_injected() { telemetry_path(injectPath(autonPath.to_vector(), 2)); }
\ No newline at end of file
@@ -0,0 +1,266 @@
+#include "ekf.hpp"
+#include <cmath>
+#include "EZ-Template/util.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "relocalize.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file ekf.cpp
+ * @brief This file contains the extended Kalman filter pose estimator.
+ * @details The filter tracks x, y, heading, forward velocity and yaw rate, and fuses any set of
+ * EkfModel measurements one row at a time, so no matrix inverse is needed.
+ */
+
+static pros::Mutex ekf_mutex;
+
+static double wrap_radians(double theta) {
+	theta = fmod(theta + M_PI, 2 * M_PI);
+	if(theta < 0) theta += 2 * M_PI;
+	return theta - M_PI;
+}
+
+//
+// Filter
+//
+
+void PoseEKF::reset(double x, double y, double theta) {
+	state[EKF_X] = x;
+	state[EKF_Y] = y;
+	state[EKF_THETA] = util::to_rad(theta);
+	state[EKF_V] = 0;
+	state[EKF_OMEGA] = 0;
+
+	for(int i = 0; i < EKF_STATES; i++)
+		for(int j = 0; j < EKF_STATES; j++) covariance[i][j] = 0;
+	covariance[EKF_X][EKF_X] = 1;
+	covariance[EKF_Y][EKF_Y] = 1;
+	covariance[EKF_THETA][EKF_THETA] = 0.01;
+	covariance[EKF_V][EKF_V] = 1;
+	covariance[EKF_OMEGA][EKF_OMEGA] = 0.1;
+}
+
+void PoseEKF::predict(double dt) {
+	double theta = state[EKF_THETA];
+	double v = state[EKF_V];
+
+	// Constant velocity and yaw rate model
+	state[EKF_X] += v * sin(theta) * dt;
+	state[EKF_Y] += v * cos(theta) * dt;
+	state[EKF_THETA] = wrap_radians(theta + state[EKF_OMEGA] * dt);
+
+	// Jacobian of the motion model
+	double F[EKF_STATES][EKF_STATES] = {};
+	for(int i = 0; i < EKF_STATES; i++) F[i][i] = 1;
+	F[EKF_X][EKF_THETA] = v * cos(theta) * dt;
+	F[EKF_X][EKF_V] = sin(theta) * dt;
+	F[EKF_Y][EKF_THETA] = -v * sin(theta) * dt;
+	F[EKF_Y][EKF_V] = cos(theta) * dt;
+	F[EKF_THETA][EKF_OMEGA] = dt;
+
+	// P = F P F^T + Q
+	double FP[EKF_STATES][EKF_STATES] = {};
+	for(int i = 0; i < EKF_STATES; i++)
+		for(int k = 0; k < EKF_STATES; k++)
+			if(F[i][k] != 0)
+				for(int j = 0; j < EKF_STATES; j++) FP[i][j] += F[i][k] * covariance[k][j];
+	for(int i = 0; i < EKF_STATES; i++) {
+		for(int j = 0; j < EKF_STATES; j++) {
+			double sum = 0;
+			for(int k = 0; k < EKF_STATES; k++) sum += FP[i][k] * F[j][k];
+			covariance[i][j] = sum;
+		}
+	}
+	covariance[EKF_V][EKF_V] += EKF_ACCEL_NOISE * dt;
+	covariance[EKF_OMEGA][EKF_OMEGA] += EKF_ANGULAR_NOISE * dt;
+}
+
+void PoseEKF::update_row(double innovation, double variance, const double jacobian[EKF_STATES]) {
+	// PH^T, and the innovation variance S = H P H^T + R
+	double PH[EKF_STATES] = {};
+	for(int i = 0; i < EKF_STATES; i++)
+		for(int j = 0; j < EKF_STATES; j++) PH[i] += covariance[i][j] * jacobian[j];
+	double S = variance;
+	for(int i = 0; i < EKF_STATES; i++) S += jacobian[i] * PH[i];
+	if(S <= 0) return;
+
+	// K = P H^T / S, x += K y, P -= K (H P)
+	double K[EKF_STATES];
+	for(int i = 0; i < EKF_STATES; i++) {
+		K[i] = PH[i] / S;
+		state[i] += K[i] * innovation;
+	}
+	state[EKF_THETA] = wrap_radians(state[EKF_THETA]);
+	for(int i = 0; i < EKF_STATES; i++)
+		for(int j = 0; j < EKF_STATES; j++) covariance[i][j] -= K[i] * PH[j];
+
+	// Keep P symmetric against rounding
+	for(int i = 0; i < EKF_STATES; i++) {
+		for(int j = i + 1; j < EKF_STATES; j++) {
+			double average = (covariance[i][j] + covariance[j][i]) / 2;
+			covariance[i][j] = average;
+			covariance[j][i] = average;
+		}
+	}
+}
+
+void PoseEKF::update(EkfModel& model) {
+	double z[4], variance[4], jacobian[EKF_STATES];
+	int rows = model.sample(z, variance);
+	for(int row = 0; row < rows; row++) {
+		for(int i = 0; i < EKF_STATES; i++) jacobian[i] = 0;
+		double innovation = z[row] - model.predict(state, row, jacobian);
+		if(model.angular(row)) innovation = wrap_radians(innovation);
+		if(model.accept(row, innovation)) update_row(innovation, variance[row], jacobian);
+	}
+}
+
+void PoseEKF::iterate(double dt) {
+	predict(dt);
+	for(auto model : models) update(*model);
+}
+
+double PoseEKF::theta_get() {
+	double theta = fmod(util::to_deg(state[EKF_THETA]), 360);
+	if(theta < 0) theta += 360;
+	return theta;
+}
+
+//
+// Measurement models
+//
+
+int ImuYawModel::sample(double z[], double variance[]) {
+	z[0] = util::to_rad(chassis.odom_theta_get());
+	variance[0] = this->variance;
+	return 1;
+}
+
+double ImuYawModel::predict(const double state[EKF_STATES], int row, double jacobian[EKF_STATES]) {
+	jacobian[EKF_THETA] = 1;
+	return state[EKF_THETA];
+}
+
+int ImuRateModel::sample(double z[], double variance[]) {
+	// The gyro's z axis points up, so a clockwise (positive heading) turn reads negative
+	double rate = imu.get_gyro_rate().z;
+	if(!std::isfinite(rate)) return 0;
+	z[0] = -util::to_rad(rate);
+	variance[0] = this->variance;
+	return 1;
+}
+
+double ImuRateModel::predict(const double state[EKF_STATES], int row, double jacobian[EKF_STATES]) {
+	jacobian[EKF_OMEGA] = 1;
+	return state[EKF_OMEGA];
+}
+
+int EncoderModel::sample(double z[], double variance[]) {
+	double left = chassis.drive_sensor_left();
+	double right = chassis.drive_sensor_right();
+	uint32_t now = pros::millis();
+	double dt = (now - last_time) / 1000.0;
+	double delta_left = left - last_left;
+	double delta_right = right - last_right;
+	bool first = last_time == 0;
+	last_left = left;
+	last_right = right;
+	last_time = now;
+
+	// Skip the first tick and any jump from drive_sensor_reset()
+	if(first || dt <= 0 || fabs(delta_left) > 10 || fabs(delta_right) > 10) return 0;
+	z[0] = delta_left / dt;
+	z[1] = delta_right / dt;
+	variance[0] = this->variance;
+	variance[1] = this->variance;
+	return 2;
+}
+
+double EncoderModel::predict(const double state[EKF_STATES], int row, double jacobian[EKF_STATES]) {
+	// A clockwise turn speeds up the left side
+	double side = row == 0 ? 1 : -1;
+	jacobian[EKF_V] = 1;
+	jacobian[EKF_OMEGA] = side * half_width;
+	return state[EKF_V] + side * half_width * state[EKF_OMEGA];
+}
+
+int RangeModel::sample(double z[], double variance[]) {
+	int32_t reading = distance.get();
+	if(reading == PROS_ERR || reading <= 0 || reading == last_reading) return 0;
+	last_reading = reading;
+
+	double inches = reading / 25.4;
+	if(inches > max_range) return 0;
+	z[0] = inches;
+	variance[0] = this->variance;
+	return 1;
+}
+
+double RangeModel::predict(const double state[EKF_STATES], int row, double jacobian[EKF_STATES]) {
+	auto measure = [this](double rx, double ry, double rt) {
+		double sx = rx + x * cos(rt) + y * sin(rt);
+		double sy = ry - x * sin(rt) + y * cos(rt);
+		return field_wall_distance(sx, sy, rt + util::to_rad(a));
+	};
+	double expected = measure(state[EKF_X], state[EKF_Y], state[EKF_THETA]);
+
+	// The wall model is piecewise, so differentiate it numerically
+	const double step = 1e-3;
+	jacobian[EKF_X] = (measure(state[EKF_X] + step, state[EKF_Y], state[EKF_THETA]) - expected) / step;
+	jacobian[EKF_Y] = (measure(state[EKF_X], state[EKF_Y] + step, state[EKF_THETA]) - expected) / step;
+	jacobian[EKF_THETA] = (measure(state[EKF_X], state[EKF_Y], state[EKF_THETA] + step) - expected) / step;
+	return expected;
+}
+
+//
+// Task
+//
+
+void ekf_initialize() {
+	static ImuYawModel yaw;
+	static ImuRateModel rate(imu);
+	static EncoderModel encoders(TRACK_WIDTH);
+	pose_ekf.models_add(&yaw);
+	pose_ekf.models_add(&rate);
+	pose_ekf.models_add(&encoders);
+	// Reserved up front so the pointers handed to the filter stay valid
+	static std::vector<RangeModel> ranges;
+	ranges.reserve(wall_sensors.size());
+	for(const WallSensor& mount : wall_sensors) {
+		ranges.emplace_back(*mount.sensor, mount.x, mount.y, mount.angle);
+		pose_ekf.models_add(&ranges.back());
+	}
+	ekf_reset(chassis.odom_x_get(), chassis.odom_y_get(), chassis.odom_theta_get());
+}
+
+void ekf_reset(double x, double y, double theta) {
+	ekf_mutex.take();
+	pose_ekf.reset(x, y, theta);
+	ekf_mutex.give();
+}
+
+ez::pose ekf_pose_get() { return ekf_estimate_get().pose; }
+
+EkfEstimate ekf_estimate_get() {
+	EkfEstimate estimate;
+	ekf_mutex.take();
+	estimate.pose = {pose_ekf.x_get(), pose_ekf.y_get(), pose_ekf.theta_get()};
+	estimate.velocity = pose_ekf.velocity_get();
+	for(int i = 0; i < 3; i++) estimate.variance[i] = pose_ekf.covariance[i][i];
+	ekf_mutex.give();
+	return estimate;
+}
+
+void ekf_task() {
+	uint32_t now = pros::millis();
+	while(true) {
+		uint32_t start = pros::micros();
+		ekf_mutex.take();
+		pose_ekf.iterate(ez::util::DELAY_TIME / 1000.0);
+		ekf_mutex.give();
+		ekf_iterate_us = pros::micros() - start;
+		if(ekf_iterate_us > ekf_iterate_max_us) ekf_iterate_max_us = ekf_iterate_us;
+		pros::Task::delay_until(&now, ez::util::DELAY_TIME);
+	}
+}
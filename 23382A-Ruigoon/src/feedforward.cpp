@@ -0,0 +1,154 @@
+#include "feedforward.hpp"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "EZ-Template/util.hpp"
+#include "controls.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "screen.hpp"
+#include "sdwriter.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file feedforward.cpp
+ * @brief This file contains the drivetrain feedforward model and its characterisation routine.
+ * @details The routine runs a slow voltage ramp (quasistatic, where acceleration is ~0 so the
+ * data pins down kS and kV) and a voltage step (dynamic, which exposes kA) in both directions,
+ * then fits each side with least squares.
+ */
+
+//
+// Model
+//
+
+double Feedforward::voltage(double velocity, double acceleration) const {
+    double sign = velocity > 0 ? 1 : velocity < 0 ? -1 : 0;
+    return ks * sign + kv * velocity + ka * acceleration;
+}
+
+double Feedforward::velocity(double voltage) const {
+    if (kv <= 0 || fabs(voltage) <= ks) return 0;
+    return (voltage - (voltage > 0 ? ks : -ks)) / kv;
+}
+
+bool feedforward_load() {
+    FILE* file = pros::usd::is_installed() ? sd_open(FF_FILE) : nullptr;
+    if (!file) return false;
+    Feedforward left, right;
+    bool valid = fscanf(file, "L %lf %lf %lf\nR %lf %lf %lf", &left.ks, &left.kv, &left.ka, &right.ks, &right.kv, &right.ka) == 6 && left.kv > 0 && right.kv > 0;
+    fclose(file);
+    if (valid) {
+        ff_left = left;
+        ff_right = right;
+    }
+    return valid;
+}
+
+static void feedforward_save() {
+    sd_write(FF_FILE, sd_format("L %.4f %.5f %.5f\nR %.4f %.5f %.5f\n", ff_left.ks, ff_left.kv, ff_left.ka, ff_right.ks, ff_right.kv, ff_right.ka));
+}
+
+//
+// Characterisation
+//
+
+class FfSample {
+    public:
+        double u, v, a;
+};
+
+// Runs the drive open loop with voltage(t) in volts until it returns false or travel runs out, sampling both sides
+static void ff_run(std::function<double(double)> voltage, int timeout, std::vector<FfSample>& left, std::vector<FfSample>& right) {
+    chassis.drive_sensor_reset();
+    double last_left = 0, last_right = 0, last_v_left = 0, last_v_right = 0;
+    const double dt = ez::util::DELAY_TIME / 1000.0;
+    uint32_t start = pros::millis(), now = start;
+
+    while ((int)(pros::millis() - start) < timeout) {
+        double volts = voltage((pros::millis() - start) / 1000.0);
+        motorgroup_L.move_voltage(volts * 1000);
+        motorgroup_R.move_voltage(volts * 1000);
+        pros::Task::delay_until(&now, ez::util::DELAY_TIME);
+
+        double pos_left = chassis.drive_sensor_left();
+        double pos_right = chassis.drive_sensor_right();
+        double v_left = (pos_left - last_left) / dt;
+        double v_right = (pos_right - last_right) / dt;
+        double u = volts / 12 * 127;
+        if (pros::millis() - start > 2 * ez::util::DELAY_TIME) {
+            left.push_back({u, v_left, (v_left - last_v_left) / dt});
+            right.push_back({u, v_right, (v_right - last_v_right) / dt});
+        }
+        last_left = pos_left;
+        last_right = pos_right;
+        last_v_left = v_left;
+        last_v_right = v_right;
+        if (fabs(pos_left) > FF_MAX_TRAVEL || fabs(pos_right) > FF_MAX_TRAVEL) break;
+    }
+    motorgroup_L.move_voltage(0);
+    motorgroup_R.move_voltage(0);
+    pros::delay(1000);
+}
+
+// Least squares on u = kS sign(v) + kV v + kA a, through the 3x3 normal equations
+static bool ff_fit(const std::vector<FfSample>& samples, Feedforward& out) {
+    double A[3][4] = {};
+    for (const FfSample& s : samples) {
+        if (fabs(s.v) < FF_MIN_VELOCITY) continue;
+        double row[3] = {s.v > 0 ? 1.0 : -1.0, s.v, s.a};
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) A[i][j] += row[i] * row[j];
+            A[i][3] += row[i] * s.u;
+        }
+    }
+
+    // Gaussian elimination with partial pivoting
+    for (int col = 0; col < 3; col++) {
+        int pivot = col;
+        for (int row = col + 1; row < 3; row++)
+            if (fabs(A[row][col]) > fabs(A[pivot][col])) pivot = row;
+        if (fabs(A[pivot][col]) < 1e-9) return false;
+        for (int k = 0; k < 4; k++) std::swap(A[col][k], A[pivot][k]);
+        for (int row = 0; row < 3; row++) {
+            if (row == col) continue;
+            double f = A[row][col] / A[col][col];
+            for (int k = col; k < 4; k++) A[row][k] -= f * A[col][k];
+        }
+    }
+    out.ks = A[0][3] / A[0][0];
+    out.kv = A[1][3] / A[1][1];
+    out.ka = A[2][3] / A[2][2];
+    return out.kv > 0 && out.ks >= 0 && out.ka >= 0;
+}
+
+// Selector entry. Moves the robot, so it does nothing while the path viewer previews it
+void characterize_drive() {
+    if (match_state() != MatchStates::AUTO) return;
+    std::vector<FfSample> left, right;
+    chassis.drive_mode_set(ez::DISABLE);
+    chassis.drive_brake_set(pros::E_MOTOR_BRAKE_COAST);
+
+    // Quasistatic, forward then back to where it started
+    for (double direction : {1.0, -1.0}) {
+        ff_run([direction](double t) { return direction * fmin(FF_RAMP_RATE * t, FF_RAMP_MAX); }, FF_RAMP_MAX / FF_RAMP_RATE * 1000, left, right);
+    }
+    // Dynamic
+    for (double direction : {1.0, -1.0}) {
+        ff_run([direction](double t) { return direction * FF_STEP_VOLTAGE; }, FF_STEP_TIME, left, right);
+    }
+    chassis.drive_brake_set(pros::E_MOTOR_BRAKE_HOLD);
+
+    Feedforward fit_left, fit_right;
+    if (!ff_fit(left, fit_left) || !ff_fit(right, fit_right)) {
+        print("Characterisation failed, keeping the old model");
+        return;
+    }
+    ff_left = fit_left;
+    ff_right = fit_right;
+    feedforward_save();
+    print("L kS " + util::to_string_with_precision(ff_left.ks, 2) + " kV " + util::to_string_with_precision(ff_left.kv, 3) + " kA " +
+          util::to_string_with_precision(ff_left.ka, 3));
+    print("R kS " + util::to_string_with_precision(ff_right.ks, 2) + " kV " + util::to_string_with_precision(ff_right.kv, 3) + " kA " +
+          util::to_string_with_precision(ff_right.ka, 3));
+}
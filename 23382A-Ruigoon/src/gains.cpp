@@ -0,0 +1,134 @@
+#include "gains.hpp"
+#include <cmath>
+#include "EZ-Template/util.hpp"
+#include "config.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file gains.cpp
+ * @brief This file contains gain scheduling for the chassis PIDs.
+ * @details EZ's PIDs read their constants every tick, so a task running alongside the motion
+ * looks up the active schedule at the current error and the motion's commanded speed, and writes
+ * the configured constants scaled by it. The configured constants are read every tick, so the
+ * config editor and autotune take effect on the next motion.
+ */
+
+static bool scheduling = true;
+static double motion_speed = 0;  // the speed cap the motion was set with
+static ez::e_mode last_mode = ez::DISABLE;
+static ConfigKeys angular_key = CFG_ANGULAR_KP;  // what EZ copied into current_a_odomPID
+
+// Index of the cell below value and how far value sits towards the next one
+static int locate(const std::vector<double>& axis, double value, double& fraction) {
+    if (axis.size() < 2 || value <= axis.front()) {
+        fraction = 0;
+        return 0;
+    }
+    for (size_t i = 0; i + 1 < axis.size(); i++) {
+        if (value < axis[i + 1]) {
+            fraction = (value - axis[i]) / (axis[i + 1] - axis[i]);
+            return i;
+        }
+    }
+    fraction = 1;
+    return axis.size() - 2;
+}
+
+static ez::PID::Constants blend(const ez::PID::Constants& a, const ez::PID::Constants& b, double f) {
+    return {a.kp + (b.kp - a.kp) * f, a.ki + (b.ki - a.ki) * f, a.kd + (b.kd - a.kd) * f, a.start_i + (b.start_i - a.start_i) * f};
+}
+
+ez::PID::Constants GainSchedule::get(double error, double speed) const {
+    double fe, fs;
+    int e = locate(errors, fabs(error), fe);
+    int s = locate(speeds, fabs(speed), fs);
+    int e1 = errors.size() > 1 ? e + 1 : e;
+    int s1 = speeds.size() > 1 ? s + 1 : s;
+    return blend(blend(gains[s][e], gains[s][e1], fe), blend(gains[s1][e], gains[s1][e1], fe), fs);
+}
+
+ez::PID::Constants gain_scale(const ez::PID::Constants& base, const ez::PID::Constants& factor) {
+    return {base.kp * factor.kp, base.ki * factor.ki, base.kd * factor.kd, base.start_i * factor.start_i};
+}
+
+void gain_scheduling_set(bool enabled) { scheduling = enabled; }
+bool gain_scheduling_get() { return scheduling; }
+
+// The profile task lowers the cap while it runs, the schedule wants what was asked for
+void gain_schedule_start(bool boomerang) {
+    motion_speed = chassis.pid_speed_max_get();
+    angular_key = boomerang ? CFG_BOOMERANG_KP : CFG_ANGULAR_KP;
+}
+
+//
+// Task
+//
+
+static void schedule(ez::PID& pid, const GainSchedule& table, ConfigKeys kp) {
+    ez::PID::Constants base = config_pid_get(kp);
+    pid.constants = table.empty() ? base : gain_scale(base, table.get(pid.error, motion_speed));
+}
+
+// Puts the configured constants back on every PID a mode schedules
+static void unschedule(ez::e_mode mode) {
+    switch (mode) {
+        case ez::TURN:
+        case ez::TURN_TO_POINT:
+            chassis.turnPID.constants = config_pid_get(CFG_TURN_KP);
+            break;
+        case ez::SWING:
+            chassis.swingPID.constants = config_pid_get(CFG_SWING_KP);
+            break;
+        case ez::DRIVE:
+            chassis.leftPID.constants = chassis.rightPID.constants = config_pid_get(CFG_DRIVE_KP);
+            break;
+        case ez::POINT_TO_POINT:
+        case ez::PURE_PURSUIT:
+            chassis.xyPID.constants = config_pid_get(CFG_DRIVE_KP);
+            chassis.current_a_odomPID.constants = config_pid_get(angular_key);
+            break;
+        default:
+            break;
+    }
+}
+
+void gain_schedule_iterate() {
+    ez::e_mode mode = scheduling ? chassis.drive_mode_get() : ez::DISABLE;
+    if (mode != last_mode) {
+        unschedule(last_mode);
+        last_mode = mode;
+    }
+
+    switch (mode) {
+        case ez::TURN:
+        case ez::TURN_TO_POINT:
+            schedule(chassis.turnPID, turn_schedule, CFG_TURN_KP);
+            break;
+        case ez::SWING:
+            schedule(chassis.swingPID, swing_schedule, CFG_SWING_KP);
+            break;
+        case ez::DRIVE:
+            // Drive motions copy their constants into the side PIDs when they start, so schedule those
+            schedule(chassis.leftPID, drive_schedule, CFG_DRIVE_KP);
+            schedule(chassis.rightPID, drive_schedule, CFG_DRIVE_KP);
+            break;
+        case ez::POINT_TO_POINT:
+        case ez::PURE_PURSUIT:
+            // Likewise odom motions copy the angular or boomerang PID into current_a_odomPID
+            schedule(chassis.xyPID, drive_schedule, CFG_DRIVE_KP);
+            schedule(chassis.current_a_odomPID, turn_schedule, angular_key);
+            break;
+        default:
+            break;
+    }
+}
+
+void gain_schedule_task() {
+    uint32_t now = pros::millis();
+    while (true) {
+        gain_schedule_iterate();
+        pros::Task::delay_until(&now, ez::util::DELAY_TIME);
+    }
+}
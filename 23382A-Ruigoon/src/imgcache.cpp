@@ -0,0 +1,162 @@
+#include "imgcache.hpp"
+#include <cstdlib>
+#include <cstring>
+#include "liblvgl/draw/lv_img_decoder.h"
+#include "liblvgl/misc/lv_lru.h"
+#include "main.h"  // IWYU pragma: keep
+
+/**
+ * @file imgcache.cpp
+ * @brief This file contains the decoder for the packed images in src/pics and their LRU cache.
+ * @details The decoder claims any in-memory image whose data starts with the packed magic and
+ * unpacks it to true colour alpha pixels. LVGL's own image cache only holds one image, so every
+ * page change reopens them, and this cache is what makes that cheap. Pixels are malloc'd, the
+ * LVGL heap is far too small for a field.
+ */
+
+static const uint8_t MAGIC[4] = {'R', 'I', 'M', 'G'};
+static const uint8_t VERSION = 1;
+static const uint8_t FLAG_PALETTE = 1;
+static const size_t HEADER_SIZE = 12;
+
+// Unpacked pixels. Evicting one that LVGL still has open only marks it, close frees it
+class CachedImage {
+    public:
+        uint8_t* pixels = nullptr;
+        int open = 0;
+        bool evicted = false;
+};
+
+static lv_lru_t* cache = nullptr;
+
+static void image_free(CachedImage* image) {
+    free(image->pixels);
+    delete image;
+}
+
+static void evict(void* value) {
+    CachedImage* image = (CachedImage*)value;
+    if (image->open > 0) image->evicted = true;
+    else image_free(image);
+}
+
+static uint16_t read16(const uint8_t* data) { return data[0] | data[1] << 8; }
+
+static bool is_packed(const lv_img_dsc_t* img) {
+    return img->header.cf == LV_IMG_CF_RAW_ALPHA && img->data_size >= HEADER_SIZE && memcmp(img->data, MAGIC, 4) == 0 && img->data[4] == VERSION;
+}
+
+// Writes one pixel from RGBA in whatever layout LV_COLOR_DEPTH gives true colour alpha
+static void put_pixel(uint8_t* out, const uint8_t* rgba) {
+    lv_color_t color = lv_color_make(rgba[0], rgba[1], rgba[2]);
+    memcpy(out, &color, sizeof(color));
+    out[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = rgba[3];
+}
+
+static uint8_t* unpack(const lv_img_dsc_t* img) {
+    const uint8_t* data = img->data;
+    const uint8_t* end = data + img->data_size;
+    bool paletted = data[5] & FLAG_PALETTE;
+    uint16_t colours = read16(data + 6);
+    size_t total = (size_t)read16(data + 8) * read16(data + 10);
+    const uint8_t* palette = data + HEADER_SIZE;
+    const uint8_t* in = palette + colours * 4;
+    size_t unit = paletted ? 1 : 4;
+    if (in > end) return nullptr;
+
+    uint8_t* pixels = (uint8_t*)malloc(total * LV_IMG_PX_SIZE_ALPHA_BYTE);
+    if (!pixels) return nullptr;
+
+    // Palette entries converted once, then every index is a copy
+    uint8_t converted[256][LV_IMG_PX_SIZE_ALPHA_BYTE];
+    for (int i = 0; i < colours && i < 256; i++) put_pixel(converted[i], palette + i * 4);
+
+    size_t count = 0;
+    uint8_t* out = pixels;
+    while (in < end && count < total) {
+        uint8_t control = *in++;
+        bool run = control >= 128;
+        size_t length = run ? control - 125 : control + 1;
+        if (count + length > total || in + (run ? unit : length * unit) > end) break;
+        for (size_t i = 0; i < length; i++) {
+            const uint8_t* source = run ? in : in + i * unit;
+            if (!paletted) put_pixel(out, source);
+            else if (*source < colours) memcpy(out, converted[*source], LV_IMG_PX_SIZE_ALPHA_BYTE);
+            else break;
+            out += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+        in += run ? unit : length * unit;
+        count += length;
+    }
+    if (count != total || out != pixels + total * LV_IMG_PX_SIZE_ALPHA_BYTE) {
+        free(pixels);
+        return nullptr;
+    }
+    return pixels;
+}
+
+//
+// Decoder
+//
+
+static lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header) {
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return LV_RES_INV;
+    const lv_img_dsc_t* img = (const lv_img_dsc_t*)src;
+    if (!is_packed(img)) return LV_RES_INV;
+    header->cf = LV_IMG_CF_RAW_ALPHA;
+    header->always_zero = 0;
+    header->w = img->header.w;
+    header->h = img->header.h;
+    return LV_RES_OK;
+}
+
+static lv_res_t decoder_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    if (dsc->src_type != LV_IMG_SRC_VARIABLE) return LV_RES_INV;
+    const lv_img_dsc_t* img = (const lv_img_dsc_t*)dsc->src;
+    if (!is_packed(img)) return LV_RES_INV;
+
+    void* found = nullptr;
+    lv_lru_get(cache, &dsc->src, sizeof(dsc->src), &found);
+    CachedImage* image = (CachedImage*)found;
+    if (!image) {
+        uint8_t* pixels = unpack(img);
+        if (!pixels) {
+            dsc->error_msg = "bad packed image";
+            return LV_RES_INV;
+        }
+        image = new CachedImage;
+        image->pixels = pixels;
+        size_t size = (size_t)img->header.w * img->header.h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        // Too big to cache still gets drawn, it's just freed once it closes
+        if (lv_lru_set(cache, &dsc->src, sizeof(dsc->src), image, size) != LV_LRU_OK) image->evicted = true;
+    }
+    image->open++;
+    dsc->img_data = image->pixels;
+    dsc->user_data = image;
+    return LV_RES_OK;
+}
+
+static void decoder_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    CachedImage* image = (CachedImage*)dsc->user_data;
+    if (!image) return;
+    dsc->user_data = nullptr;
+    dsc->img_data = nullptr;
+    if (--image->open == 0 && image->evicted) image_free(image);
+}
+
+void img_cache_init() {
+    if (cache) return;
+    cache = lv_lru_create(IMG_CACHE_SIZE, IMG_CACHE_AVERAGE, evict, lv_mem_free);
+    lv_img_decoder_t* decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, decoder_info);
+    lv_img_decoder_set_open_cb(decoder, decoder_open);
+    lv_img_decoder_set_close_cb(decoder, decoder_close);
+}
+
+void img_cache_clear() {
+    if (!cache) return;
+    lv_lru_del(cache);
+    cache = lv_lru_create(IMG_CACHE_SIZE, IMG_CACHE_AVERAGE, evict, lv_mem_free);
+}
+
+size_t img_cache_used() { return cache ? cache->total_memory - cache->free_memory : 0; }
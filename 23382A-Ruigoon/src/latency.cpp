@@ -0,0 +1,163 @@
+#include "latency.hpp"
+#include <cmath>
+#include "EZ-Template/util.hpp"
+#include "ctrlscreen.hpp"
+#include "ekf.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "screen.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file latency.cpp
+ * @brief This file contains the sensor to actuation latency probes.
+ * @details EZ's tasks can't be instrumented directly, so a 1 ms probe task watches for each stage
+ * of the control path to change: the encoder timestamp, the odom pose, the active PID output and
+ * the motors' reported voltage. The gaps between them go into per motion histograms.
+ */
+
+static pros::Mutex latency_mutex;
+
+void LatencyHistogram::add(uint32_t ms) {
+    bins[ms < LAT_BINS ? ms : LAT_BINS - 1]++;
+    count++;
+    if (ms > max) max = ms;
+}
+
+uint32_t LatencyHistogram::percentile(double p) const {
+    if (count == 0) return 0;
+    uint32_t rank = ceil(count * p / 100), seen = 0;
+    for (int i = 0; i < LAT_BINS; i++) {
+        seen += bins[i];
+        if (seen >= rank) return i;
+    }
+    return LAT_BINS - 1;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (int i = 0; i < LAT_BINS; i++) bins[i] += other.bins[i];
+    count += other.count;
+    if (other.max > max) max = other.max;
+}
+
+void latency_motion_begin() {
+    latency_mutex.take();
+    for (int i = 0; i < LAT_STAGES; i++) {
+        latency_run[i].merge(latency_motion[i]);
+        latency_motion[i].clear();
+    }
+    latency_mutex.give();
+}
+
+void latency_run_begin() {
+    latency_mutex.take();
+    for (int i = 0; i < LAT_STAGES; i++) {
+        latency_run[i].clear();
+        latency_motion[i].clear();
+    }
+    latency_mutex.give();
+}
+
+LatencyHistogram latency_get(LatencyStages stage, bool run) {
+    latency_mutex.take();
+    LatencyHistogram h = latency_motion[stage];
+    if (run) h.merge(latency_run[stage]);
+    latency_mutex.give();
+    return h;
+}
+
+std::string latency_summary(LatencyStages stage, bool run) {
+    LatencyHistogram h = latency_get(stage, run);
+    return std::string(LATENCY_NAMES[stage]) + " " + std::to_string(h.percentile(50)) + "/" + std::to_string(h.percentile(95)) + "/" +
+           std::to_string(h.max) + "ms";
+}
+
+// Whole run p50/p95/max on the brain console, under the opcontrol pose lines
+void latency_report() {
+    print(4, latency_summary(LAT_TOTAL, true) + "  " + latency_summary(LAT_PID_PERIOD, true));
+    print(5, latency_summary(LAT_SAMPLE_TO_TRACK, true) + "  " + latency_summary(LAT_TRACK_TO_PID, true));
+    // The filter's last and longest tick, it has to fit the tracking task's 10 ms
+    print(6, latency_summary(LAT_PID_TO_MOTOR, true) + "  " + latency_summary(LAT_IMU_AGE, true) + "  ekf " + std::to_string(ekf_iterate_us) + "/" +
+                 std::to_string(ekf_iterate_max_us) + "us");
+}
+
+// Lines 1 and 2, the heading keeps line 0. The controller service only sends what changed
+void latency_controller_iterate() {
+    static uint32_t last = 0;
+    if (pros::millis() - last < CONTROLLER_PERIOD) return;
+    last = pros::millis();
+    controller_print(1, latency_summary(LAT_TOTAL, true));
+    controller_print(2, latency_summary(LAT_PID_PERIOD, true));
+}
+
+//
+// Probe
+//
+
+static double pid_output(ez::e_mode mode) {
+    switch (mode) {
+        case ez::SWING:
+            return chassis.swingPID.output;
+        case ez::TURN:
+        case ez::TURN_TO_POINT:
+            return chassis.turnPID.output;
+        case ez::POINT_TO_POINT:
+        case ez::PURE_PURSUIT:
+            return chassis.xyPID.output;
+        default:
+            return chassis.leftPID.output;
+    }
+}
+
+void latency_task() {
+    uint32_t sample_time = 0, track_time = 0, pid_time = 0, imu_time = 0;
+    uint32_t pid_sample_time = 0;  // encoder reading the last PID update was working from
+    double last_x = 0, last_y = 0, last_t = 0, last_output = 0, last_imu = 0;
+    int32_t last_voltage = 0;
+
+    while (true) {
+        ez::e_mode mode = chassis.drive_mode_get();
+        if (mode == ez::DISABLE) {
+            pid_time = pid_sample_time = 0;
+            pros::delay(ez::util::DELAY_TIME);
+            continue;
+        }
+        uint32_t now = pros::millis();
+
+        // Motors stamp each reading with when the brain received it
+        uint32_t stamp;
+        if (motorgroup_L.get_raw_position(&stamp) != PROS_ERR) sample_time = stamp;
+
+        double imu = chassis.drive_imu_get();
+        if (imu != last_imu) imu_time = now;
+
+        latency_mutex.take();
+        double x = chassis.odom_x_get(), y = chassis.odom_y_get(), t = chassis.odom_theta_get();
+        if (x != last_x || y != last_y || t != last_t) {
+            track_time = now;
+            if (sample_time) latency_motion[LAT_SAMPLE_TO_TRACK].add(now - sample_time);
+        }
+
+        double output = pid_output(mode);
+        if (output != last_output) {
+            if (pid_time) latency_motion[LAT_PID_PERIOD].add(now - pid_time);
+            if (track_time) latency_motion[LAT_TRACK_TO_PID].add(now - track_time);
+            if (imu_time) latency_motion[LAT_IMU_AGE].add(now - imu_time);
+            pid_time = now;
+            pid_sample_time = sample_time;
+        }
+
+        int32_t voltage = motorgroup_L.get_voltage();
+        if (voltage != PROS_ERR && voltage != last_voltage && pid_time) {
+            latency_motion[LAT_PID_TO_MOTOR].add(now - pid_time);
+            if (pid_sample_time) latency_motion[LAT_TOTAL].add(now - pid_sample_time);
+        }
+        latency_mutex.give();
+
+        last_x = x, last_y = y, last_t = t;
+        last_output = output;
+        last_imu = imu;
+        last_voltage = voltage;
+        pros::delay(1);
+    }
+}
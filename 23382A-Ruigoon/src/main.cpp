@@ -20,46 +20,73 @@ void initialize() {
 
   pros::delay(500);  // Stop the user from doing anything while legacy ports configure
 
-  // Configure your chassis controls
-  chassis.opcontrol_curve_buttons_toggle(false);   // Enables modifying the controller curve with buttons on the joysticks
-  chassis.opcontrol_drive_activebrake_set(0.0);   // Sets the active brake kP. We recommend ~2.  0 will disable.
-  chassis.opcontrol_curve_default_set(DRIVE_CURVE, 0.0);  // Defaults for curve. If using tank, only the first parameter is used. (Comment this line out if you have an SD card!)
-
-  default_constants();
-  
-  //ez::as::auton_selector.autons_add({});
-
-  auton_sel.selector_populate(std::vector<AutonObj>{
-      {doNothing, "23382A", pink},
-      {SAWP, "13 SAWP", green},
-      {sixThreeLeft, "6 + 3 Left", blue},
-      {sixThreeRight, "6 + 3 Right", blue},  
-      {fourFive, "4 + 5 middle", red},
-      {left7, "Left 7", orange},
-      {right7, "Right 7", orange},
-      {skills, "Skills", gray},
-      {measure_offsets, "measure offsets", purple},
-  }
-    );
+  // Writes can be queued from any stage
+  pros::Task sdWriterTask(sd_writer_task, TASK_PRIORITY_DEFAULT - 2);  // below everything that queues to it
+  pros::Task controllerScreenTask(controller_screen_task);
 
-  // Initialize chassis and auton selector
-  chassis.opcontrol_curve_sd_initialize();
-  chassis.drive_imu_calibrate(true);
-  chassis.drive_sensor_reset();
-  //ez::as::initialize();
-  uiInit();
-  auton_sel.selector_callback = fourFive; // *TEMP*
-  //ez::as::auton_selector_initialize();
+  startup_add(STARTUP_CONFIG, "config", [] {
+    config_load();  // Retuned settings from the SD card, before anything reads them
 
-  pros::Task pathViewer(pathViewerTask);
-  pros::Task angleChecker(angleCheckTask);
+    // Configure your chassis controls
+    chassis.opcontrol_curve_buttons_toggle(false);   // Enables modifying the controller curve with buttons on the joysticks
+    chassis.opcontrol_drive_activebrake_set(0.0);   // Sets the active brake kP. We recommend ~2.  0 will disable.
+    chassis.opcontrol_curve_default_set(DRIVE_CURVE, 0.0);  // Defaults for curve. If using tank, only the first parameter is used. (Comment this line out if you have an SD card!)
+    chassis.opcontrol_curve_sd_initialize();
 
-  motor_intake1.set_brake_mode(pros::E_MOTOR_BRAKE_COAST);
-  motor_intake2.set_brake_mode(pros::E_MOTOR_BRAKE_COAST);
-  motor_intake3.set_brake_mode(pros::E_MOTOR_BRAKE_COAST);
+    default_constants();
+    feedforward_load();
+  });
 
+  startup_add(STARTUP_AUTONS, "autons", [] {
+    //ez::as::auton_selector.autons_add({});
+    autons_populate();
+    replay_register_all();  // Saved driver recordings show up as extra autons
+  });
 
-  master.rumble(chassis.drive_imu_calibrated() ? "." : "---");
+  // Initialize chassis and auton selector
+  startup_add(STARTUP_IMU, "imu", [] {
+    chassis.drive_imu_calibrate(false);  // No loading animation, the selector is already on screen
+    chassis.drive_sensor_reset();
+    ekf_initialize();
+    odometry_reset(chassis.odom_x_get(), chassis.odom_y_get(), chassis.odom_theta_get());
+  });
+
+  startup_add(STARTUP_UI, "ui", [] {
+    //ez::as::initialize();
+    uiInit();
+    auton_sel.selector_callback = fourFive; // *TEMP*
+    //ez::as::auton_selector_initialize();
+    pros::Task pathViewer(pathViewerTask);
+    pros::Task bindingsTask(bindings_task);
+  }, {STARTUP_AUTONS});
+
+  // Dry runs read speeds and track width, and the list has to be complete
+  startup_add(STARTUP_PATHS, "paths", [] {
+    pros::Task previewTask(preview_task, TASK_PRIORITY_DEFAULT - 3);  // only uses time nothing else wants
+    resetViewer(true);
+  }, {STARTUP_CONFIG, STARTUP_UI});
+
+  startup_add(STARTUP_TASKS, "tasks", [] {
+    pros::Task ekfTask(ekf_task);
+    pros::Task odometryTask(odometry_task);
+    pros::Task gainScheduleTask(gain_schedule_task);
+    pros::Task motionLogTask(motion_log_task);
+    pros::Task profileTask(profile_task);
+    pros::Task latencyTask(latency_task);  // not above the tasks it times, it would hold them off every 1 ms
+    pros::Task relocalizeTask(relocalize_task);
+    pros::Task telemetryTask(telemetry_task);
+
+    motor_intake1.set_brake_mode(pros::E_MOTOR_BRAKE_COAST);
+    motor_intake2.set_brake_mode(pros::E_MOTOR_BRAKE_COAST);
+    motor_intake3.set_brake_mode(pros::E_MOTOR_BRAKE_COAST);
+  }, {STARTUP_CONFIG, STARTUP_IMU});
+
+  startup_run();
+  startup_report();
+
+  controller_rumble(chassis.drive_imu_calibrated() ? "." : "---", CTRL_HIGH);
+  // Line 0 is opcontrol's heading at the same priority, and line 2 has the recorder's warnings
+  if (!chassis.drive_imu_calibrated()) controller_print(1, "IMU FAILED", CTRL_HIGH);
 }
 
 /**
@@ -68,7 +95,12 @@ void initialize() {
  * the robot is enabled, this task will exit.
  */
 void disabled() {
-  // . . .
+  matchState = DISABLED;
+  preview_paused = false;  // autonomous() doesn't get to clear it when it's cut off
+  profile_stop();  // nor finish a profile that's still capping the drive
+  relocalize_continuous_set(false);
+  relocalize_log_flush();
+  motion_log_flush(auton_sel.selector_name);
 }
 
 /**
@@ -114,8 +146,19 @@ void autonomous() {
   You can do cool curved motions, but you have to give your robot the best chance
   to be consistent
   */
+  preview_mutex.take();  // waits out a preview dry run
+  preview_paused = true;
+  controller_print(1, auton_sel.selector_name, CTRL_LOW);
   matchState = AUTO;
+  sideMirrored = auton_sel.selector_mirrored;
+  preview_mutex.give();
+  latency_run_begin();
+  telemetry_event("auton start " + auton_sel.selector_name);
   auton_sel.selector_callback();
+  telemetry_event("auton end " + auton_sel.selector_name);
+  motion_log_flush(auton_sel.selector_name);
+  latency_report();
+  preview_paused = false;
   //ez::as::auton_selector.selected_auton_call();  
 }
 
@@ -192,16 +235,37 @@ void ez_template_extras() {
       chassis.pid_tuner_toggle();
 
     // Trigger the selected autonomous routine
+    // autonomous() leaves matchState at AUTO, driver control picks up again afterwards
     if (master.get_digital(DIGITAL_B)) {
       pros::motor_brake_mode_e_t preference = chassis.drive_brake_get();
       autonomous();
+      matchState = DRIVER;
       chassis.drive_brake_set(preference);
     }
 
     if (controlla.get_digital_new_press(pros::E_CONTROLLER_DIGITAL_UP)) {
       autonomous();
+      matchState = DRIVER;
+    }
+
+    // Start / stop recording a driver run, saved runs can be selected as autons after a restart
+    if (master.get_digital_new_press(DIGITAL_LEFT)) {
+      if (recording_active())
+        recording_stop();
+      else
+        recording_start();
     }
 
+    // Show control path latency on the controller instead of the usual screen. DOWN is the one
+    // button nothing else uses, apart from the PID tuner's arrows while it's open
+    if (master.get_digital_new_press(DIGITAL_DOWN) && !chassis.pid_tuner_enabled()) {
+      latency_page = !latency_page;
+      controller_clear(1);
+      controller_clear(2);
+    }
+    if (latency_page)
+      latency_controller_iterate();
+
     // Allow PID Tuner to iterate
     chassis.pid_tuner_iterate();
   }
@@ -227,6 +291,8 @@ void ez_template_extras() {
  * task, not resume it from where it left off.
  */
 void opcontrol() {
+  matchState = DRIVER;
+
   // This is preference to what you like to drive on
   chassis.drive_brake_set(MOTOR_BRAKE_COAST);
 
@@ -234,30 +300,15 @@ void opcontrol() {
     // Gives you some extras to make EZ-Template ezier
     ez_template_extras();
     //chassis.drive_set(controlla.get_analog(ANALOG_LEFT_Y), controlla.get_analog(ANALOG_RIGHT_X)*0.75);
-    int forward = master.get_analog(pros::E_CONTROLLER_ANALOG_LEFT_Y);
-    int turn    = master.get_analog(pros::E_CONTROLLER_ANALOG_RIGHT_X);
-
-    // deadband (important)
-    if (abs(forward) < 10) forward = 0;
-    if (abs(turn) < 10) turn = 0;
-
-    // scale turning
-    turn = turn * 0.65;
-
-    chassis.drive_set(forward + turn, forward - turn);
     //chassis.drive_set(controlla.get_analog(ANALOG_LEFT_Y) * 0.12, controlla.get_analog(ANALOG_RIGHT_Y) * 0.12);
     //print(2, "Left: " + std::to_string(controlla.get_analog(ANALOG_LEFT_Y)));
     //print(3, "Right: " + std::to_string(controlla.get_analog(ANALOG_RIGHT_Y)));
 
-    control_rollers();
-    control_piston_toggle(piston_loader, BUTTON_LOADER);
-    control_piston_hold(piston_wing, BUTTON_WING);
-    control_piston_toggle(piston_park, BUTTON_PARK);
-    control_piston_toggle(piston_scorer, BUTTON_SCORER);
-    control_piston_toggle(piston_descore, BUTTON_DESCORE);
-    print(1, "X: " + std::to_string(chassis.odom_x_get()));
-    print(2, "Y: " + std::to_string(chassis.odom_y_get()));
-    print(3, "A: " + std::to_string(chassis.odom_theta_get()));
+    // Drive and mechanisms read driver_input, so a recording can be replayed through the same code
+    driver_input_read();
+    driver_control();
+    recording_iterate();
+    controller_print(0, "H " + util::to_string_with_precision(chassis.odom_theta_get(), 1), CTRL_HIGH);
 
     pros::delay(ez::util::DELAY_TIME);  // This is used for timer calculations!  Keep this ez::util::DELAY_TIME
   }
@@ -0,0 +1,162 @@
+#include "motionlog.hpp"
+#include <cmath>
+#include <cstdio>
+#include "EZ-Template/util.hpp"
+#include "latency.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "screen.hpp"
+#include "sdwriter.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file motionlog.cpp
+ * @brief This file contains per motion exit telemetry.
+ * @details Each motion's error is sampled every tick from set to wait, and the record of how it
+ * finished is appended to the SD card after every run for tools/exit_tuner.py to read.
+ */
+
+static const char* MODE_NAMES[] = {"disable", "swing", "turn", "turn_to_point", "drive", "point_to_point", "pure_pursuit"};
+static const char* EXIT_NAMES[] = {"small", "big", "velocity", "mA", "chain"};
+
+// Error changes smaller than this over a tick count as stopped for the velocity exit
+static const double STILL_ERROR = 0.01;
+
+static pros::Mutex log_mutex;
+static bool motion_open = false;
+static bool sampled = false;
+static MotionRecord current;
+static uint16_t motion_count = 0;
+static uint32_t start_time = 0, small_since = 0, big_since = 0, still_since = 0;
+static double last_error = 0;
+
+static ez::PID& active_pid(ez::e_mode mode) {
+    switch (mode) {
+        case ez::SWING:
+            return chassis.swingPID;
+        case ez::TURN:
+        case ez::TURN_TO_POINT:
+            return chassis.turnPID;
+        case ez::POINT_TO_POINT:
+        case ez::PURE_PURSUIT:
+            return chassis.xyPID;
+        default:
+            return chassis.leftPID;
+    }
+}
+
+static double active_error(ez::e_mode mode) {
+    if (mode == ez::DRIVE) return (chassis.leftPID.error + chassis.rightPID.error) / 2;
+    return active_pid(mode).error;
+}
+
+// Call with log_mutex held
+static void sample() {
+    uint32_t now = pros::millis();
+    double error = active_error(current.mode);
+    if (!sampled) {
+        current.start_error = error;
+        last_error = error;
+        sampled = true;
+    }
+
+    if (fabs(error) < current.exit.small_error) {
+        if (current.time_to_small < 0) current.time_to_small = now - start_time;
+        if (small_since == 0) small_since = now;
+    } else {
+        small_since = 0;
+    }
+    if (fabs(error) < current.exit.big_error) {
+        if (big_since == 0) big_since = now;
+    } else {
+        big_since = 0;
+    }
+    if (fabs(error - last_error) < STILL_ERROR) {
+        if (still_since == 0) still_since = now;
+    } else {
+        still_since = 0;
+    }
+    if (error * current.start_error < 0) current.overshoot = fmax(current.overshoot, fabs(error));
+
+    current.final_error = error;
+    last_error = error;
+}
+
+// Call with log_mutex held
+static void motion_close(MotionExits reason) {
+    current.duration = pros::millis() - start_time;
+    current.reason = reason;
+    LatencyHistogram total = latency_get(LAT_TOTAL), period = latency_get(LAT_PID_PERIOD);
+    current.latency_p50 = total.percentile(50);
+    current.latency_p95 = total.percentile(95);
+    current.period_p95 = period.percentile(95);
+    motion_log.push_back(current);
+    motion_open = false;
+}
+
+void motion_log_start() {
+    log_mutex.take();
+    if (motion_open) motion_close(EXIT_CHAIN);
+    current = MotionRecord();
+    current.index = motion_count++;
+    current.mode = chassis.drive_mode_get();
+    current.exit = active_pid(current.mode).exit;
+    latency_motion_begin();
+    start_time = pros::millis();
+    small_since = big_since = still_since = 0;
+    sampled = false;
+    motion_open = true;
+    log_mutex.give();
+}
+
+void motion_log_end(Wait type) {
+    log_mutex.take();
+    if (motion_open) {
+        sample();
+        uint32_t now = pros::millis();
+        const int tick = ez::util::DELAY_TIME;
+        const ez::PID::exit_condition_& exit = current.exit;
+        MotionExits reason = EXIT_MA;
+        if (type == CHAIN) reason = EXIT_CHAIN;
+        else if (small_since && (int)(now - small_since) >= exit.small_exit_time - tick) reason = EXIT_SMALL;
+        else if (big_since && exit.big_exit_time > 0 && (int)(now - big_since) >= exit.big_exit_time - tick) reason = EXIT_BIG;
+        else if (still_since && exit.velocity_exit_time > 0 && (int)(now - still_since) >= exit.velocity_exit_time - tick) reason = EXIT_VELOCITY;
+        motion_close(reason);
+    }
+    log_mutex.give();
+}
+
+void motion_log_iterate() {
+    log_mutex.take();
+    if (motion_open) sample();
+    log_mutex.give();
+}
+
+void motion_log_task() {
+    uint32_t now = pros::millis();
+    while (true) {
+        motion_log_iterate();
+        pros::Task::delay_until(&now, ez::util::DELAY_TIME);
+    }
+}
+
+void motion_log_flush(const std::string& run) {
+    log_mutex.take();
+    if (motion_open) motion_close(EXIT_CHAIN);
+    std::vector<MotionRecord> records;
+    records.swap(motion_log);
+    motion_count = 0;
+    log_mutex.give();
+    if (records.empty()) return;
+
+    std::string rows;
+    for (const MotionRecord& r : records) {
+        rows += sd_format("%s,%u,%s,%s,%lu,%ld,%.3f,%.3f,%.3f,%d,%.3f,%d,%.3f,%d,%d,%u,%u,%u\n", run.c_str(), r.index, MODE_NAMES[r.mode], EXIT_NAMES[r.reason],
+                          (unsigned long)r.duration, (long)r.time_to_small, r.start_error, r.final_error, r.overshoot, r.exit.small_exit_time, r.exit.small_error,
+                          r.exit.big_exit_time, r.exit.big_error, r.exit.velocity_exit_time, r.exit.mA_timeout, r.latency_p50, r.latency_p95,
+                          r.period_p95);
+    }
+    const char* header = "run,index,mode,reason,duration,time_to_small,start_error,final_error,overshoot,"
+                         "small_exit_time,small_error,big_exit_time,big_error,velocity_exit_time,mA_timeout,latency_p50,latency_p95,period_p95\n";
+    if (sd_append(MOTION_LOG_FILE, rows, header)) print("Logged " + std::to_string(records.size()) + " motions");
+}
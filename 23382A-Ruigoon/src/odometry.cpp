@@ -0,0 +1,154 @@
+#include "odometry.hpp"
+#include <cmath>
+#include "EZ-Template/util.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file odometry.cpp
+ * @brief This file contains the high rate odometry integrator and its pose history.
+ * @details Each tick treats the motion since the last one as a constant curvature arc (the SE(2)
+ * exponential map), which is exact for a differential drive between samples, and publishes the
+ * result with a timestamp so other tasks can look up where the robot was at any recent time.
+ */
+
+static double wrap_degrees(double theta) {
+    theta = fmod(theta, 360);
+    return theta < 0 ? theta + 360 : theta;
+}
+
+//
+// History
+//
+
+void PoseHistory::push(const PoseSample& sample) {
+    uint32_t index = head.load(std::memory_order_relaxed);
+    Slot& slot = slots[index & (ODOM_HISTORY - 1)];
+    uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.sample = sample;
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+    head.store(index + 1, std::memory_order_release);
+}
+
+bool PoseHistory::read(uint32_t index, PoseSample& out) const {
+    const Slot& slot = slots[index & (ODOM_HISTORY - 1)];
+    for (int attempt = 0; attempt < 4; attempt++) {
+        uint32_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before & 1) continue;
+        out = slot.sample;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == before) return true;
+    }
+    return false;
+}
+
+bool PoseHistory::latest(PoseSample& out) const {
+    uint32_t count = head.load(std::memory_order_acquire);
+    return count > 0 && read(count - 1, out);
+}
+
+bool PoseHistory::at(uint64_t time, PoseSample& out) const {
+    uint32_t count = head.load(std::memory_order_acquire);
+    if (count == 0) return false;
+
+    // Walk back from the newest sample to the pair that brackets time. The oldest slot is skipped since
+    // the writer may be about to reuse it
+    uint32_t oldest = count > ODOM_HISTORY - 1 ? count - (ODOM_HISTORY - 1) : 0;
+    PoseSample newer, older;
+    if (!read(count - 1, newer)) return false;
+    if (time >= newer.time) {
+        out = newer;
+        return time == newer.time;
+    }
+    for (uint32_t index = count - 1; index-- > oldest;) {
+        if (!read(index, older)) return false;
+        if (time >= older.time) {
+            double span = newer.time - older.time;
+            double f = span > 0 ? (time - older.time) / span : 0;
+            out.time = time;
+            out.x = older.x + (newer.x - older.x) * f;
+            out.y = older.y + (newer.y - older.y) * f;
+            out.t = wrap_degrees(older.t + util::wrap_angle(newer.t - older.t) * f);
+            return true;
+        }
+        newer = older;
+    }
+    return false;
+}
+
+//
+// Integrator
+//
+
+static pros::Mutex reset_mutex;
+static bool reset_pending = true;
+static PoseSample reset_pose;
+static double shift_x = 0, shift_y = 0;
+
+void odometry_reset(double x, double y, double t) {
+    reset_mutex.take();
+    reset_pose = {pros::micros(), x, y, wrap_degrees(t)};
+    reset_pending = true;
+    shift_x = shift_y = 0;
+    reset_mutex.give();
+}
+
+void odometry_shift(double dx, double dy) {
+    reset_mutex.take();
+    shift_x += dx;
+    shift_y += dy;
+    reset_mutex.give();
+}
+
+PoseSample pose_latest() {
+    PoseSample sample;
+    pose_history.latest(sample);
+    return sample;
+}
+
+bool pose_at(uint64_t time, PoseSample& out) { return pose_history.at(time, out); }
+
+void odometry_task() {
+    PoseSample pose;
+    double last_left = 0, last_right = 0, last_heading = 0;
+    uint32_t now = pros::millis();
+    while (true) {
+        double left = chassis.drive_sensor_left();
+        double right = chassis.drive_sensor_right();
+        double heading = chassis.drive_imu_get();
+
+        reset_mutex.take();
+        bool reset = reset_pending;
+        if (reset) {
+            pose = reset_pose;
+            reset_pending = false;
+        }
+        pose.x += shift_x;
+        pose.y += shift_y;
+        shift_x = shift_y = 0;
+        reset_mutex.give();
+
+        // Skip the tick where drive_sensor_reset() or drive_imu_reset() zeroed a sensor under us
+        double distance = ((left - last_left) + (right - last_right)) / 2;
+        double turn = util::to_rad(heading - last_heading);
+        if (!reset && fabs(left - last_left) < 5 && fabs(right - last_right) < 5 && fabs(turn) < 1) {
+            double theta = util::to_rad(pose.t);
+
+            // Follow the arc: the chord is 2 sin(turn / 2) / turn of the arc length, along the mean heading
+            double chord = fabs(turn) < 1e-9 ? distance : distance * 2 * sin(turn / 2) / turn;
+            pose.x += chord * sin(theta + turn / 2);
+            pose.y += chord * cos(theta + turn / 2);
+            pose.t = wrap_degrees(pose.t + util::to_deg(turn));
+        }
+        last_left = left;
+        last_right = right;
+        last_heading = heading;
+
+        pose.time = pros::micros();
+        pose_history.push(pose);
+        pros::Task::delay_until(&now, ODOM_PERIOD);
+    }
+}
@@ -21,250 +21,263 @@
 #define LV_ATTRIBUTE_IMG_LOGO
 #endif
 
+/* Packed by tools/img_pack.py: 56x56, 1042 colours, RGBA, 12544 bytes unpacked.
+ * Decoded on demand by imgcache.cpp */
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_LOGO uint8_t logo_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x11, 0x25, 0x25, 0x49, 0x3b, 0x49, 0x4a, 0x6d, 0x50, 0x49, 0x49, 0x25, 0x31, 0x24, 0x19, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x13, 0x25, 0x2e, 0x6d, 0x56, 0x92, 0x7f, 0xb6, 0x97, 0xb7, 0xa1, 0xb6, 0x94, 0x6e, 0x61, 0x25, 0x31, 0x00, 0x12, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x11, 0x25, 0x2e, 0x6e, 0x61, 0xb6, 0xa0, 0xff, 0xd7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xed, 0xb6, 0x95, 0x49, 0x4a, 0x24, 0x1a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x24, 0x0d, 0x25, 0x27, 0x6d, 0x5b, 0xb7, 0xaa, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xb8, 0x6d, 0x59, 0x25, 0x1f, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x24, 0x1d, 0x49, 0x4b, 0xb6, 0x98, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xbe, 0x6d, 0x58, 0x24, 0x1e, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x24, 0x14, 0x49, 0x38, 0x92, 0x7f, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xab, 0x49, 0x4b, 0x24, 0x18, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x24, 0x0d, 0x25, 0x29, 0x6e, 0x63, 0xdb, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x8b, 0x49, 0x38, 0x24, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x24, 0x1d, 0x49, 0x4c, 0xb6, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x6e, 0x69, 0x25, 0x26, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x04, 0x00, 0x03, 0x00, 0x05, 0x24, 0x14, 0x49, 0x38, 0x92, 0x7f, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xa7, 0x49, 0x4a, 0x24, 0x18, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x07, 0x00, 0x09, 0x24, 0x0e, 0x24, 0x15, 0x24, 0x1d, 0x24, 0x1d, 0x24, 0x1d, 0x24, 0x1d, 0x24, 0x15, 0x24, 0x10, 0x24, 0x14, 0x25, 0x2c, 0x6e, 0x63, 0xdb, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x92, 0x7d, 0x49, 0x33, 0x24, 0x0f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x0b, 0x24, 0x15, 0x25, 0x1f, 0x25, 0x23, 0x25, 0x2d, 0x49, 0x3d, 0x49, 0x4e, 0x6d, 0x50, 0x6d, 0x50, 0x49, 0x4e, 0x49, 0x3d, 0x49, 0x30, 0x49, 0x34, 0x6d, 0x56, 0xb6, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xca, 0x6e, 0x63, 0x25, 0x26, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x08, 0x00, 0x13, 0x25, 0x25, 0x49, 0x3d, 0x6d, 0x52, 0x6d, 0x59, 0x6e, 0x69, 0x92, 0x83, 0xb6, 0x9e, 0xb7, 0xa1, 0xb7, 0xa1, 0xb6, 0x9e, 0x92, 0x83, 0x6e, 0x6e, 0x6e, 0x6f, 0xb6, 0x94, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xc5, 0x6e, 0x64, 0x25, 0x28, 0x24, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x24, 0x0d, 0x24, 0x1d, 0x49, 0x36, 0x6d, 0x56, 0x92, 0x83, 0xb7, 0xa3, 0xb7, 0xab, 0xdb, 0xbe, 0xff, 0xdc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xdc, 0xdb, 0xc3, 0xdb, 0xc1, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x92, 0x7e, 0x49, 0x38, 0x00, 0x12, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x11, 0x25, 0x27, 0x49, 0x49, 0x92, 0x74, 0xb6, 0xa0, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xa3, 0x49, 0x4c, 0x24, 0x1a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x13, 0x25, 0x2e, 0x6d, 0x59, 0x92, 0x90, 0xdb, 0xc7, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xdb, 0xb9, 0x6d, 0x57, 0x25, 0x1f, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x11, 0x25, 0x2e, 0x6e, 0x61, 0xb7, 0xa3, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xb0, 0x6d, 0x52, 0x24, 0x1c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x24, 0x0d, 0x25, 0x27, 0x6d, 0x5b, 0xb7, 0xaa, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x92, 0x8b, 0x49, 0x3d, 0x24, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x24, 0x1d, 0x49, 0x4b, 0xb6, 0x98, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xb9, 0x6d, 0x5d, 0x25, 0x26, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0b, 0x24, 0x18, 0x49, 0x3b, 0x92, 0x7f, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x92, 0x83, 0x49, 0x39, 0x00, 0x13, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x09, 0x00, 0x12, 0x24, 0x1d, 0x25, 0x1f, 0x25, 0x25, 0x49, 0x3b, 0x6e, 0x6c, 0xdb, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x6e, 0x6b, 0x25, 0x28, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x24, 0x19, 0x49, 0x32, 0x6d, 0x50, 0x6d, 0x52, 0x6d, 0x5c, 0x92, 0x77, 0xb7, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x6e, 0x6a, 0x25, 0x25, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x49, 0x30, 0x6e, 0x61, 0xb6, 0x9a, 0xb6, 0x9d, 0xb7, 0xa9, 0xdb, 0xc7, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x92, 0x76, 0x25, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 0x1a, 0x49, 0x47, 0x92, 0x8f, 0xff, 0xe2, 0xff, 0xed, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x86, 0x49, 0x33, 0x24, 0x0d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x24, 0x1d, 0x6d, 0x50, 0xb7, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x9a, 0x49, 0x3f, 0x00, 0x12, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 0x1a, 0x49, 0x47, 0x92, 0x8f, 0xff, 0xe8, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xb8, 0x6d, 0x51, 0x24, 0x1b, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x49, 0x30, 0x6e, 0x61, 0xb6, 0x9f, 0xb7, 0xaf, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x6e, 0x6c, 0x25, 0x27, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x24, 0x19, 0x49, 0x34, 0x6d, 0x5a, 0x92, 0x73, 0xb7, 0xaa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x8e, 0x49, 0x3a, 0x00, 0x11, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x0b, 0x24, 0x18, 0x49, 0x34, 0x6d, 0x5c, 0xb7, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xba, 0x6d, 0x56, 0x24, 0x1e, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x24, 0x17, 0x49, 0x3a, 0x92, 0x74, 0xdb, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x92, 0x7d, 0x49, 0x33, 0x24, 0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x11, 0x25, 0x2e, 0x6e, 0x65, 0xb7, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xb0, 0x6d, 0x52, 0x24, 0x1d, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0b, 0x25, 0x25, 0x6d, 0x59, 0xb7, 0xab, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x92, 0x79, 0x49, 0x30, 0x24, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24, 0x14, 0x49, 0x3d, 0x92, 0x89, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xa5, 0x49, 0x48, 0x24, 0x17, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 0x1c, 0x6d, 0x51, 0xb7, 0xae, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xcb, 0x6d, 0x5e, 0x25, 0x20, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x1f, 0x6d, 0x57, 0xdb, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x6e, 0x6b, 0x25, 0x25, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 0x1a, 0x49, 0x4a, 0xb6, 0x97, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xb7, 0xac, 0xdb, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x6e, 0x6a, 0x25, 0x25, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x25, 0x31, 0x6e, 0x64, 0xb7, 0xa5, 0xdb, 0xc3, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xb9, 0x92, 0x78, 0x92, 0x7e, 0xdb, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xbf, 0x6d, 0x59, 0x25, 0x1f, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x24, 0x19, 0x49, 0x35, 0x6d, 0x5e, 0x92, 0x86, 0xff, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xb6, 0x6e, 0x64, 0x6d, 0x54, 0x92, 0x83, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x92, 0x8e, 0x49, 0x3f, 0x24, 0x15, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x09, 0x24, 0x17, 0x49, 0x35, 0x6e, 0x69, 0xdb, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x92, 0x75, 0x49, 0x48, 0x6d, 0x57, 0xb6, 0x9a, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xb7, 0xaa, 0x6d, 0x59, 0x25, 0x25, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x0b, 0x25, 0x28, 0x6e, 0x68, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xa3, 0x6d, 0x57, 0x49, 0x41, 0x6e, 0x60, 0xb7, 0xa1, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xb6, 0xa0, 0x6e, 0x61, 0x25, 0x2e, 0x00, 0x11, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x25, 0x2a, 0x92, 0x75, 0xff, 0xf0, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x92, 0x7c, 0x49, 0x42, 0x49, 0x3b, 0x6d, 0x59, 0x92, 0x83, 0xb7, 0xa1, 0xb7, 0xa1, 0xb7, 0xa1, 0xb7, 0xa1, 0xb7, 0xa1, 0x92, 0x83, 0x6d, 0x56, 0x25, 0x2e, 0x00, 0x13, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x0d, 0x49, 0x33, 0x92, 0x86, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xaf, 0x6d, 0x57, 0x25, 0x2e, 0x25, 0x2c, 0x49, 0x3e, 0x6d, 0x50, 0x6d, 0x50, 0x6d, 0x50, 0x6d, 0x50, 0x6d, 0x50, 0x49, 0x3d, 0x25, 0x25, 0x00, 0x11, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x12, 0x49, 0x3f, 0xb6, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x92, 0x7a, 0x49, 0x35, 0x24, 0x19, 0x24, 0x17, 0x24, 0x1d, 0x24, 0x1d, 0x24, 0x1d, 0x24, 0x1d, 0x24, 0x1d, 0x24, 0x15, 0x00, 0x0b, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x24, 0x1b, 0x6d, 0x51, 0xdb, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xa5, 0x49, 0x49, 0x24, 0x19, 0x00, 0x09, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x25, 0x27, 0x6e, 0x6c, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xce, 0x6e, 0x60, 0x24, 0x21, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x24, 0x10, 0x49, 0x38, 0x92, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xec, 0x92, 0x72, 0x25, 0x28, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24, 0x18, 0x49, 0x4d, 0xb7, 0xae, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x92, 0x7d, 0x25, 0x2d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x20, 0x6d, 0x5f, 0xdb, 0xca, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x81, 0x49, 0x2f, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x25, 0x25, 0x6e, 0x68, 0xff, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xb7, 0xad, 0x92, 0x7f, 0x92, 0x7f, 0xb7, 0xad, 0xff, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x82, 0x49, 0x2f, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x25, 0x24, 0x6e, 0x61, 0xdb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xb7, 0xaa, 0x6e, 0x65, 0x49, 0x40, 0x49, 0x40, 0x6e, 0x65, 0xb7, 0xab, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x82, 0x49, 0x2f, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x24, 0x1c, 0x49, 0x4c, 0xb6, 0x91, 0xff, 0xde, 0xff, 0xe8, 0xdb, 0xc8, 0xb6, 0x9a, 0x6e, 0x61, 0x25, 0x31, 0x24, 0x19, 0x24, 0x19, 0x25, 0x31, 0x6e, 0x63, 0xb7, 0xaa, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x82, 0x49, 0x2f, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x49, 0x30, 0x6d, 0x5a, 0x92, 0x81, 0x92, 0x87, 0x92, 0x74, 0x6d, 0x52, 0x25, 0x2e, 0x00, 0x13, 0x00, 0x07, 0x00, 0x07, 0x00, 0x13, 0x25, 0x31, 0x6e, 0x61, 0xb7, 0xa3, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x80, 0x25, 0x2e, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x24, 0x18, 0x25, 0x2c, 0x49, 0x3d, 0x49, 0x40, 0x49, 0x35, 0x25, 0x23, 0x00, 0x11, 0x00, 0x06, 0x00, 0x02, 0x00, 0x02, 0x00, 0x06, 0x00, 0x13, 0x25, 0x2e, 0x6d, 0x59, 0x92, 0x8e, 0xdb, 0xc0, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x92, 0x79, 0x25, 0x2c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x09, 0x24, 0x10, 0x24, 0x15, 0x24, 0x16, 0x00, 0x11, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x11, 0x25, 0x27, 0x49, 0x46, 0x6e, 0x6c, 0x92, 0x8e, 0xdb, 0xc0, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x6e, 0x69, 0x25, 0x26, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x05, 0x00, 0x05, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x24, 0x0d, 0x24, 0x1b, 0x49, 0x2f, 0x49, 0x46, 0x6e, 0x6c, 0x92, 0x8e, 0xdb, 0xbe, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xa1, 0x6d, 0x50, 0x24, 0x1d, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x07, 0x24, 0x0f, 0x24, 0x1b, 0x49, 0x2f, 0x49, 0x46, 0x6e, 0x69, 0x92, 0x83, 0xb7, 0xa1, 0xb7, 0xa1, 0xb7, 0xa1, 0xb7, 0xa1, 0xb7, 0xa1, 0x6e, 0x65, 0x49, 0x32, 0x00, 0x12, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x07, 0x24, 0x0f, 0x24, 0x1b, 0x25, 0x2d, 0x49, 0x3d, 0x6d, 0x50, 0x6d, 0x50, 0x6d, 0x50, 0x6d, 0x50, 0x6d, 0x50, 0x49, 0x32, 0x24, 0x19, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x82, 0x10, 0x11, 0x24, 0x21, 0x25, 0xe8, 0x41, 0x3b, 0x49, 0x4a, 0x4a, 0x8a, 0x52, 0x50, 0x49, 0x4a, 0x49, 0x86, 0x31, 0x31, 0xa3, 0x18, 0x19, 0x00, 0x00, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x62, 0x10, 0x13, 0x66, 0x31, 0x2e, 0xcb, 0x5a, 0x56, 0x10, 0x84, 0x7f, 0xd3, 0x9c, 0x97, 0x34, 0xa5, 0xa1, 0xb3, 0x9c, 0x94, 0x0c, 0x63, 0x61, 0x86, 0x31, 0x31, 0x82, 0x10, 0x12, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x82, 0x10, 0x11, 0x66, 0x31, 0x2e, 0x0c, 0x63, 0x61, 0x14, 0xa5, 0xa0, 0xdb, 0xde, 0xd7, 0x9e, 0xf7, 0xf7, 0x9f, 0xff, 0xff, 0x3d, 0xef, 0xed, 0xb3, 0x9c, 0x95, 0x49, 0x4a, 0x4a, 0xe4, 0x20, 0x1a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xa3, 0x18, 0x0d, 0x45, 0x29, 0x27, 0xeb, 0x5a, 0x5b, 0x75, 0xad, 0xaa, 0xdf, 0xff, 0xf6, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x3e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xd7, 0xbd, 0xb8, 0xcb, 0x5a, 0x59, 0x04, 0x21, 0x1f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe3, 0x18, 0x1d, 0x69, 0x4a, 0x4b, 0xd3, 0x9c, 0x98, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x3e, 0xf7, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xbe, 0xcb, 0x5a, 0x58, 0xe3, 0x18, 0x1e, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0xe3, 0x18, 0x14, 0xc7, 0x39, 0x38, 0x10, 0x84, 0x7f, 0x1c, 0xe7, 0xde, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x1e, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xad, 0xab, 0x69, 0x4a, 0x4b, 0xa3, 0x18, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xa3, 0x18, 0x0d, 0x66, 0x31, 0x29, 0x2c, 0x63, 0x63, 0x18, 0xc6, 0xc0, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xfd, 0xee, 0xff, 0x9d, 0xee, 0xff, 0x1f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x8c, 0x8b, 0xc7, 0x39, 0x38, 0x82, 0x10, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe3, 0x18, 0x1d, 0x6a, 0x52, 0x4c, 0x14, 0xa5, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xf7, 0xff, 0x5d, 0xee, 0xff, 0x5e, 0xf6, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xd8, 0x4d, 0x6b, 0x69, 0x45, 0x29, 0x26, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05, 0xe3, 0x18, 0x14, 0xc7, 0x39, 0x38, 0x10, 0x84, 0x7f, 0x1c, 0xe7, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xbe, 0xf6, 0xff, 0x3e, 0xf6, 0xff, 0x9f, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0xa7, 0x49, 0x4a, 0x4a, 0xa3, 0x18, 0x18, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x09, 0xa2, 0x10, 0x0e, 0xc3, 0x18, 0x15, 0xe3, 0x18, 0x1d, 0xe3, 0x18, 0x1d, 0xe3, 0x18, 0x1d, 0xe3, 0x18, 0x1d, 0xc3, 0x18, 0x15, 0x82, 0x10, 0x10, 0xe3, 0x18, 0x14, 0x86, 0x31, 0x2c, 0x2c, 0x63, 0x63, 0x18, 0xc6, 0xc0, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7d, 0xee, 0xff, 0xdd, 0xe5, 0xff, 0xde, 0xf5, 0xff, 0xdf, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xf1, 0xf0, 0x83, 0x7d, 0xa6, 0x31, 0x33, 0x82, 0x10, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0b, 0xc3, 0x18, 0x15, 0x04, 0x21, 0x1f, 0x25, 0x29, 0x23, 0x66, 0x31, 0x2d, 0x08, 0x42, 0x3d, 0x8a, 0x52, 0x4e, 0x8a, 0x52, 0x50, 0x8a, 0x52, 0x50, 0x8a, 0x52, 0x4e, 0x08, 0x42, 0x3d, 0x86, 0x31, 0x30, 0xc7, 0x39, 0x34, 0xcb, 0x5a, 0x56, 0x14, 0xa5, 0x9d, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x1e, 0xf7, 0xff, 0x1d, 0xee, 0xff, 0xdd, 0xed, 0xff, 0x3f, 0xf6, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0xca, 0x2c, 0x63, 0x63, 0x45, 0x29, 0x26, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x62, 0x10, 0x13, 0x24, 0x21, 0x25, 0x08, 0x42, 0x3d, 0x8a, 0x52, 0x52, 0xcb, 0x5a, 0x59, 0x4d, 0x6b, 0x69, 0x30, 0x84, 0x83, 0x14, 0xa5, 0x9e, 0x34, 0xa5, 0xa1, 0x34, 0xa5, 0xa1, 0x14, 0xa5, 0x9e, 0x30, 0x84, 0x83, 0x6e, 0x73, 0x6e, 0x8e, 0x73, 0x6f, 0xb3, 0x9c, 0x94, 0x1c, 0xe7, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x9e, 0xee, 0xff, 0x3f, 0xf6, 0xff, 0x3f, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xce, 0xc5, 0x2c, 0x63, 0x64, 0x45, 0x29, 0x28, 0xa3, 0x18, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0xa3, 0x18, 0x0d, 0xe3, 0x18, 0x1d, 0xa7, 0x39, 0x36, 0xcb, 0x5a, 0x56, 0x30, 0x84, 0x83, 0x34, 0xa5, 0xa3, 0x75, 0xad, 0xab, 0x18, 0xc6, 0xbe, 0xfc, 0xe6, 0xdc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xe6, 0xdc, 0x38, 0xc6, 0xc3, 0x18, 0xc6, 0xc1, 0x1c, 0xe7, 0xe0, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x9d, 0xee, 0xff, 0xdd, 0xed, 0xff, 0x9e, 0xf5, 0xff, 0xfe, 0xf5, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0xe5, 0xf0, 0x83, 0x7e, 0xc7, 0x39, 0x38, 0x82, 0x10, 0x12, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x82, 0x10, 0x11, 0x45, 0x29, 0x27, 0x49, 0x4a, 0x49, 0xaf, 0x7b, 0x74, 0x14, 0xa5, 0xa0, 0xfc, 0xe6, 0xdc, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x3e, 0xf7, 0xff, 0x1e, 0xf7, 0xff, 0xfe, 0xf6, 0xff, 0xde, 0xf6, 0xff, 0xde, 0xf6, 0xff, 0xfe, 0xf6, 0xff, 0x3e, 0xf7, 0xff, 0x7f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9d, 0xee, 0xff, 0xbc, 0xe5, 0xff, 0x7d, 0xed, 0xff, 0x7e, 0xf5, 0xff, 0x5f, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x34, 0xa5, 0xa3, 0x6a, 0x52, 0x4c, 0xe4, 0x20, 0x1a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x62, 0x10, 0x13, 0x66, 0x31, 0x2e, 0xcb, 0x5a, 0x59, 0x92, 0x94, 0x90, 0x59, 0xce, 0xc7, 0xdf, 0xff, 0xf6, 0xbf, 0xff, 0xff, 0x1e, 0xf7, 0xff, 0x7e, 0xf6, 0xff, 0xfd, 0xed, 0xff, 0xdd, 0xed, 0xff, 0xbd, 0xed, 0xff, 0xbd, 0xed, 0xff, 0xbd, 0xed, 0xff, 0xfd, 0xed, 0xff, 0x7d, 0xf6, 0xff, 0xbe, 0xf6, 0xff, 0x3f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x1e, 0xf7, 0xff, 0x3d, 0xee, 0xff, 0xdd, 0xed, 0xff, 0xff, 0xf5, 0xff, 0x5f, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x9f, 0xfe, 0xff, 0x3e, 0xee, 0xff, 0x7e, 0xf6, 0xff, 0x7f, 0xff, 0xff, 0xd7, 0xbd, 0xb9, 0xcb, 0x5a, 0x57, 0x04, 0x21, 0x1f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x82, 0x10, 0x11, 0x66, 0x31, 0x2e, 0x0c, 0x63, 0x61, 0x34, 0xa5, 0xa3, 0x5d, 0xef, 0xe7, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x9e, 0xee, 0xff, 0xdd, 0xed, 0xff, 0x7d, 0xed, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x7e, 0xf5, 0xff, 0x9e, 0xf5, 0xff, 0x1f, 0xfe, 0xff, 0x5f, 0xfe, 0xff, 0x3f, 0xfe, 0xff, 0x1e, 0xf6, 0xff, 0x3e, 0xf6, 0xff, 0x7e, 0xf6, 0xff, 0x9e, 0xf6, 0xff, 0x5e, 0xf6, 0xff, 0x1f, 0xfe, 0xff, 0x3f, 0xfe, 0xff, 0x5f, 0xfe, 0xff, 0x1e, 0xf6, 0xff, 0xbd, 0xed, 0xff, 0xfd, 0xed, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0x96, 0xb5, 0xb0, 0x8a, 0x52, 0x52, 0xe3, 0x18, 0x1c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xa3, 0x18, 0x0d, 0x45, 0x29, 0x27, 0xeb, 0x5a, 0x5b, 0x75, 0xad, 0xaa, 0xdf, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x5d, 0xee, 0xff, 0xbd, 0xed, 0xff, 0x9e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0x1f, 0xfe, 0xff, 0x5f, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0x9e, 0xf5, 0xff, 0x9d, 0xed, 0xff, 0xbd, 0xed, 0xff, 0x9c, 0xed, 0xff, 0xbd, 0xed, 0xff, 0xde, 0xf5, 0xff, 0xbf, 0xfd, 0xff, 0x9e, 0xf5, 0xff, 0x7e, 0xf5, 0xff, 0x9e, 0xed, 0xff, 0xde, 0xf5, 0xff, 0xdf, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x71, 0x8c, 0x8b, 0x08, 0x42, 0x3d, 0xe3, 0x18, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0xe3, 0x18, 0x1d, 0x69, 0x4a, 0x4b, 0xd3, 0x9c, 0x98, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x5e, 0xee, 0xff, 0x9d, 0xed, 0xff, 0x7e, 0xf5, 0xff, 0x9f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0x7f, 0xfe, 0xff, 0x9f, 0xfe, 0xff, 0xdd, 0xed, 0xff, 0x9d, 0xed, 0xff, 0xff, 0xfd, 0xff, 0x7f, 0xfe, 0xff, 0x7f, 0xfe, 0xff, 0x5e, 0xfe, 0xff, 0x1e, 0xf6, 0xff, 0xfe, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0xbf, 0xf5, 0xff, 0xdf, 0xfd, 0xff, 0x5f, 0xfe, 0xff, 0x1f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0xb9, 0xec, 0x62, 0x5d, 0x45, 0x29, 0x26, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0b, 0xa3, 0x18, 0x18, 0xe8, 0x41, 0x3b, 0x10, 0x84, 0x7f, 0x1c, 0xe7, 0xde, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x5e, 0xee, 0xff, 0x9d, 0xed, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x5e, 0xf5, 0xff, 0x5e, 0xf5, 0xff, 0xbf, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0x3d, 0xf6, 0xff, 0xdd, 0xed, 0xff, 0x7f, 0xfe, 0xff, 0xdf, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x7f, 0xfe, 0xff, 0x7f, 0xfe, 0xff, 0x9f, 0xfe, 0xff, 0x9f, 0xfe, 0xff, 0x9f, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0xdf, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xec, 0x30, 0x84, 0x83, 0xe7, 0x39, 0x39, 0x62, 0x10, 0x13, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09, 0x82, 0x10, 0x12, 0xe3, 0x18, 0x1d, 0x04, 0x21, 0x1f, 0x24, 0x21, 0x25, 0xe8, 0x41, 0x3b, 0x6e, 0x73, 0x6c, 0x18, 0xc6, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0x3e, 0xf6, 0xff, 0x3f, 0xfe, 0xff, 0x5f, 0xfe, 0xff, 0x5f, 0xfe, 0xff, 0x1f, 0xfe, 0xff, 0x3f, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x5f, 0xff, 0xff, 0xfe, 0xf6, 0xff, 0x3d, 0xee, 0xff, 0x9f, 0xfe, 0xff, 0xdf, 0xfe, 0xff, 0x5e, 0xf6, 0xff, 0xde, 0xf5, 0xff, 0x9f, 0xf5, 0xff, 0x9f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0x1e, 0xf6, 0xff, 0x3e, 0xf6, 0xff, 0x3d, 0xf6, 0xff, 0x1e, 0xf6, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xda, 0x6d, 0x6b, 0x6b, 0x45, 0x29, 0x28, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0xa3, 0x18, 0x19, 0xa6, 0x31, 0x32, 0x8a, 0x52, 0x50, 0x8a, 0x52, 0x52, 0xeb, 0x5a, 0x5c, 0xcf, 0x7b, 0x77, 0x96, 0xb5, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0xdf, 0xfe, 0xff, 0x3f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xde, 0xf6, 0xff, 0xbe, 0xf6, 0xff, 0x9f, 0xfe, 0xff, 0xfd, 0xed, 0xff, 0x9d, 0xed, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0x7e, 0xf5, 0xff, 0x7e, 0xf5, 0xff, 0x7d, 0xed, 0xff, 0x7c, 0xed, 0xff, 0x9d, 0xed, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xdf, 0x6d, 0x6b, 0x6a, 0x24, 0x21, 0x25, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x82, 0x10, 0x11, 0x86, 0x31, 0x30, 0x0c, 0x63, 0x61, 0xf3, 0x9c, 0x9a, 0x14, 0xa5, 0x9d, 0x55, 0xad, 0xa9, 0x59, 0xce, 0xc7, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x3e, 0xf7, 0xff, 0xbe, 0xf6, 0xff, 0x7e, 0xf6, 0xff, 0x3e, 0xf6, 0xff, 0xfe, 0xed, 0xff, 0x1e, 0xf6, 0xff, 0xbf, 0xfe, 0xff, 0x3f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0xdd, 0xed, 0xff, 0x7d, 0xed, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xbe, 0xf7, 0xf2, 0xcf, 0x7b, 0x76, 0x65, 0x29, 0x2a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe4, 0x20, 0x1a, 0x49, 0x4a, 0x47, 0x92, 0x94, 0x8f, 0x3c, 0xe7, 0xe2, 0x7e, 0xf7, 0xed, 0x9f, 0xff, 0xf9, 0x9f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7e, 0xf6, 0xff, 0xfd, 0xed, 0xff, 0x9d, 0xed, 0xff, 0x9d, 0xed, 0xff, 0x7d, 0xed, 0xff, 0x7d, 0xed, 0xff, 0x3e, 0xf6, 0xff, 0xff, 0xfe, 0xff, 0x7e, 0xf6, 0xff, 0x1d, 0xee, 0xff, 0x1f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x5d, 0xee, 0xff, 0x7d, 0xed, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x8c, 0x86, 0xa6, 0x31, 0x33, 0xa3, 0x18, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe3, 0x18, 0x1d, 0x8a, 0x52, 0x50, 0x34, 0xa5, 0xa2, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x1d, 0xef, 0xff, 0x9d, 0xe6, 0xff, 0x1d, 0xe6, 0xff, 0xbd, 0xed, 0xff, 0x7e, 0xed, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x5e, 0xf5, 0xff, 0x5e, 0xf5, 0xff, 0xbf, 0xf5, 0xff, 0xbf, 0xfe, 0xff, 0xbe, 0xf6, 0xff, 0xbd, 0xed, 0xff, 0x9e, 0xf5, 0xff, 0xdf, 0xfe, 0xff, 0x5f, 0xff, 0xff, 0x1d, 0xee, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x9c, 0x9a, 0x08, 0x42, 0x3f, 0x82, 0x10, 0x12, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe4, 0x20, 0x1a, 0x49, 0x4a, 0x47, 0x92, 0x94, 0x8f, 0x5d, 0xef, 0xe8, 0x7e, 0xf7, 0xf5, 0x5e, 0xf7, 0xff, 0xfd, 0xee, 0xff, 0xde, 0xee, 0xff, 0x7e, 0xf6, 0xff, 0xfe, 0xf5, 0xff, 0xbf, 0xf5, 0xff, 0xbf, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0xdd, 0xed, 0xff, 0x7d, 0xed, 0xff, 0x9e, 0xf5, 0xff, 0x7f, 0xf6, 0xff, 0x3f, 0xff, 0xff, 0x3e, 0xf6, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0xb8, 0xaa, 0x52, 0x51, 0xe4, 0x20, 0x1b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x82, 0x10, 0x11, 0x86, 0x31, 0x30, 0x0c, 0x63, 0x61, 0x14, 0xa5, 0x9f, 0x96, 0xb5, 0xaf, 0xdb, 0xde, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0x5f, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x1f, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x7e, 0xf5, 0xff, 0xfe, 0xf5, 0xff, 0xff, 0xfe, 0xff, 0x9f, 0xfe, 0xff, 0x9e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0xde, 0x6e, 0x73, 0x6c, 0x45, 0x29, 0x27, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0xa3, 0x18, 0x19, 0xc7, 0x39, 0x34, 0xeb, 0x5a, 0x5a, 0xae, 0x73, 0x73, 0x75, 0xad, 0xaa, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x9e, 0xf5, 0xff, 0x5f, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0x1e, 0xf6, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0x8e, 0xc7, 0x39, 0x3a, 0x82, 0x10, 0x11, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0xa3, 0x18, 0x18, 0xc7, 0x39, 0x34, 0xeb, 0x5a, 0x5c, 0x34, 0xa5, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xbd, 0xee, 0xff, 0xfe, 0xed, 0xff, 0x9e, 0xf5, 0xff, 0x9e, 0xf5, 0xff, 0xbf, 0xfe, 0xff, 0xbe, 0xf6, 0xff, 0xbd, 0xed, 0xff, 0x7f, 0xf5, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xbf, 0xfe, 0xff, 0xdf, 0xfe, 0xff, 0xbe, 0xed, 0xff, 0x5f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbd, 0xba, 0xcb, 0x5a, 0x56, 0xe3, 0x18, 0x1e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0xc3, 0x18, 0x17, 0xc7, 0x39, 0x3a, 0xaf, 0x7b, 0x74, 0x59, 0xce, 0xc9, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7d, 0xee, 0xff, 0xbc, 0xe5, 0xff, 0x9d, 0xed, 0xff, 0x7e, 0xf5, 0xff, 0x1f, 0xfe, 0xff, 0x1f, 0xff, 0xff, 0x9e, 0xf6, 0xff, 0x9d, 0xe5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x1f, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xfe, 0xff, 0x9e, 0xf5, 0xff, 0x5e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0xbf, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xf7, 0xef, 0xf0, 0x83, 0x7d, 0xa6, 0x31, 0x33, 0x82, 0x10, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x82, 0x10, 0x11, 0x66, 0x31, 0x2e, 0x2d, 0x6b, 0x65, 0x96, 0xb5, 0xb0, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9d, 0xf6, 0xff, 0xbd, 0xed, 0xff, 0x9e, 0xf5, 0xff, 0x7e, 0xf5, 0xff, 0xbf, 0xf5, 0xff, 0xbf, 0xfe, 0xff, 0x3f, 0xff, 0xff, 0x5d, 0xee, 0xff, 0x9c, 0xed, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x9e, 0xf5, 0xff, 0x5f, 0xfe, 0xff, 0xdf, 0xfe, 0xff, 0x5f, 0xfe, 0xff, 0xbe, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0xb0, 0x8a, 0x52, 0x52, 0xe3, 0x18, 0x1d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0b, 0x24, 0x21, 0x25, 0xcb, 0x5a, 0x59, 0x75, 0xad, 0xab, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x1e, 0xf7, 0xff, 0xfd, 0xed, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0x5f, 0xfe, 0xff, 0x5f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1d, 0xee, 0xff, 0x9d, 0xed, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0x9e, 0xf5, 0xff, 0x5f, 0xfe, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xbf, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0x7d, 0xef, 0xeb, 0xcf, 0x7b, 0x79, 0x86, 0x31, 0x30, 0xa2, 0x10, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe3, 0x18, 0x14, 0x08, 0x42, 0x3d, 0x71, 0x8c, 0x89, 0xbf, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x3d, 0xee, 0xff, 0x9d, 0xed, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x1f, 0xfe, 0xff, 0xdf, 0xfe, 0xff, 0x1f, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0xfd, 0xed, 0xff, 0x7d, 0xed, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0xdf, 0xf5, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x9f, 0xfe, 0xff, 0xbe, 0xf5, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xf5, 0xff, 0xff, 0xf5, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xad, 0xa5, 0x49, 0x4a, 0x48, 0xc3, 0x18, 0x17, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe3, 0x18, 0x1c, 0xaa, 0x52, 0x51, 0x96, 0xb5, 0xae, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x3d, 0xee, 0xff, 0x7d, 0xed, 0xff, 0x7e, 0xf5, 0xff, 0xdf, 0xfd, 0xff, 0x7f, 0xfe, 0xff, 0x9f, 0xfe, 0xff, 0x5e, 0xf6, 0xff, 0x5e, 0xf6, 0xff, 0x9f, 0xfe, 0xff, 0xfe, 0xf5, 0xff, 0x7d, 0xed, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0x1f, 0xfe, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0xde, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0xcb, 0x0c, 0x63, 0x5e, 0x04, 0x21, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x21, 0x1f, 0xcb, 0x5a, 0x57, 0xb7, 0xbd, 0xb4, 0xdf, 0xff, 0xff, 0xfe, 0xf6, 0xff, 0x5e, 0xee, 0xff, 0x9f, 0xfe, 0xff, 0xdf, 0xfe, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x1d, 0xee, 0xff, 0x9d, 0xed, 0xff, 0x3e, 0xf6, 0xff, 0xdf, 0xfe, 0xff, 0x1e, 0xf6, 0xff, 0x7d, 0xed, 0xff, 0x7e, 0xf5, 0xff, 0x5e, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xf6, 0xff, 0xbe, 0xed, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x3f, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0x1c, 0xe7, 0xe1, 0x6d, 0x6b, 0x6b, 0x24, 0x21, 0x25, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe4, 0x20, 0x1a, 0x49, 0x4a, 0x4a, 0xd3, 0x9c, 0x97, 0x7e, 0xf7, 0xf7, 0x7f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7e, 0xee, 0xff, 0x9d, 0xe5, 0xff, 0x9e, 0xed, 0xff, 0x9f, 0xfe, 0xff, 0x5f, 0xff, 0xff, 0x7e, 0xf6, 0xff, 0x9d, 0xed, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe6, 0xdd, 0x76, 0xb5, 0xac, 0x18, 0xc6, 0xc0, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7e, 0xf6, 0xff, 0x9e, 0xed, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x3f, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xfc, 0xe6, 0xdd, 0x6d, 0x6b, 0x6a, 0x24, 0x21, 0x25, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x82, 0x10, 0x12, 0x86, 0x31, 0x31, 0x2c, 0x63, 0x64, 0x35, 0xad, 0xa5, 0x38, 0xc6, 0xc3, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xf7, 0xff, 0xdd, 0xed, 0xff, 0x7e, 0xed, 0xff, 0x9f, 0xf5, 0xff, 0x9f, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0xde, 0xf6, 0xff, 0xdd, 0xed, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0xb9, 0xcf, 0x7b, 0x78, 0xf0, 0x83, 0x7e, 0x18, 0xc6, 0xc1, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xfe, 0xed, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xdf, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0x18, 0xc6, 0xbf, 0xcb, 0x5a, 0x59, 0x04, 0x21, 0x1f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0xa3, 0x18, 0x19, 0xa7, 0x39, 0x35, 0x0c, 0x63, 0x5e, 0x31, 0x8c, 0x86, 0xba, 0xd6, 0xd2, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf6, 0xff, 0xbd, 0xed, 0xff, 0x7f, 0xf5, 0xff, 0x9f, 0xf5, 0xff, 0xbf, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfe, 0xf5, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0xb6, 0x2c, 0x63, 0x64, 0xab, 0x5a, 0x54, 0x30, 0x84, 0x83, 0x1c, 0xe7, 0xde, 0xdf, 0xff, 0xff, 0xbe, 0xf6, 0xff, 0xbd, 0xed, 0xff, 0x7e, 0xf5, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x92, 0x94, 0x8e, 0x08, 0x42, 0x3f, 0xc3, 0x18, 0x15, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09, 0xc3, 0x18, 0x17, 0xa7, 0x39, 0x35, 0x4d, 0x6b, 0x69, 0x59, 0xce, 0xc9, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xfd, 0xed, 0xff, 0x9e, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0xbf, 0xf5, 0xff, 0xbf, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0xd6, 0xcf, 0x7b, 0x75, 0x49, 0x4a, 0x48, 0xcb, 0x5a, 0x57, 0xf3, 0x9c, 0x9a, 0xdf, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xbf, 0xf6, 0xff, 0x1f, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0x7f, 0xfe, 0xff, 0x1f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xf6, 0x75, 0xad, 0xaa, 0xcb, 0x5a, 0x59, 0x24, 0x21, 0x25, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0b, 0x45, 0x29, 0x28, 0x4d, 0x6b, 0x68, 0xdb, 0xde, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xbd, 0xed, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0xbf, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xa5, 0xa3, 0xcb, 0x5a, 0x57, 0x28, 0x42, 0x41, 0x0c, 0x63, 0x60, 0x34, 0xa5, 0xa1, 0xfc, 0xe6, 0xdc, 0xbf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe6, 0xdc, 0x14, 0xa5, 0xa0, 0x0c, 0x63, 0x61, 0x66, 0x31, 0x2e, 0x82, 0x10, 0x11, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x65, 0x29, 0x2a, 0xcf, 0x7b, 0x75, 0x9e, 0xf7, 0xf0, 0xbf, 0xff, 0xff, 0x9e, 0xf6, 0xff, 0x7e, 0xed, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0x5f, 0xff, 0xff, 0xfe, 0xf6, 0xff, 0xbe, 0xf6, 0xff, 0x3f, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0x7e, 0xf5, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0xff, 0xf5, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0xe2, 0xef, 0x7b, 0x7c, 0x28, 0x42, 0x42, 0xe8, 0x41, 0x3b, 0xcb, 0x5a, 0x59, 0x30, 0x84, 0x83, 0x34, 0xa5, 0xa1, 0x34, 0xa5, 0xa1, 0x34, 0xa5, 0xa1, 0x34, 0xa5, 0xa1, 0x34, 0xa5, 0xa1, 0x30, 0x84, 0x83, 0xcb, 0x5a, 0x56, 0x66, 0x31, 0x2e, 0x62, 0x10, 0x13, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa3, 0x18, 0x0d, 0xa6, 0x31, 0x33, 0x31, 0x8c, 0x86, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x3e, 0xf6, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf6, 0xff, 0x1e, 0xf6, 0xff, 0x1f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x1f, 0xfe, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x9f, 0xf5, 0xff, 0x5f, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0xaf, 0xcb, 0x5a, 0x57, 0x66, 0x31, 0x2e, 0x86, 0x31, 0x2c, 0x08, 0x42, 0x3e, 0x8a, 0x52, 0x50, 0x8a, 0x52, 0x50, 0x8a, 0x52, 0x50, 0x8a, 0x52, 0x50, 0x8a, 0x52, 0x50, 0x08, 0x42, 0x3d, 0x24, 0x21, 0x25, 0x82, 0x10, 0x11, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x82, 0x10, 0x12, 0x08, 0x42, 0x3f, 0xf3, 0x9c, 0x9a, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x1e, 0xf6, 0xff, 0x7f, 0xf5, 0xff, 0x5f, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0x1f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x3e, 0xf6, 0xff, 0x9e, 0xf5, 0xff, 0x5f, 0xfe, 0xff, 0x3f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0xfe, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0xeb, 0xcf, 0x7b, 0x7a, 0xa7, 0x39, 0x35, 0xa3, 0x18, 0x19, 0xc3, 0x18, 0x17, 0xe3, 0x18, 0x1d, 0xe3, 0x18, 0x1d, 0xe3, 0x18, 0x1d, 0xe3, 0x18, 0x1d, 0xe3, 0x18, 0x1d, 0xc3, 0x18, 0x15, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe4, 0x20, 0x1b, 0xaa, 0x52, 0x51, 0xd7, 0xbd, 0xb8, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfe, 0xed, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x1e, 0xf6, 0xff, 0x7e, 0xf5, 0xff, 0xbe, 0xf5, 0xff, 0x7e, 0xf6, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0x9f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x3f, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xad, 0xa5, 0x49, 0x4a, 0x49, 0xa3, 0x18, 0x19, 0x00, 0x00, 0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x45, 0x29, 0x27, 0x6e, 0x73, 0x6c, 0x1c, 0xe7, 0xde, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xff, 0xbd, 0xed, 0xff, 0x5e, 0xf5, 0xff, 0xbf, 0xfd, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x3e, 0xee, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0xbe, 0xf5, 0xff, 0x3e, 0xf6, 0xff, 0xff, 0xfe, 0xff, 0x3f, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xbf, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0xbe, 0xf5, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xd6, 0xce, 0x0c, 0x63, 0x60, 0x04, 0x21, 0x21, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x82, 0x10, 0x10, 0xc7, 0x39, 0x38, 0x72, 0x94, 0x8c, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf6, 0xff, 0x9d, 0xed, 0xff, 0x9f, 0xf5, 0xff, 0x9f, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7e, 0xf6, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0x9e, 0xed, 0xff, 0xfe, 0xed, 0xff, 0xdf, 0xfe, 0xff, 0x5f, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0xde, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0x3f, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0x7e, 0xf7, 0xec, 0xae, 0x73, 0x72, 0x45, 0x29, 0x28, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa3, 0x18, 0x18, 0x6a, 0x52, 0x4d, 0x96, 0xb5, 0xae, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x1d, 0xee, 0xff, 0x9d, 0xed, 0xff, 0x7f, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xbf, 0xf5, 0xff, 0x5f, 0xf5, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7e, 0xf5, 0xff, 0xfe, 0xed, 0xff, 0xff, 0xfe, 0xff, 0x5f, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0xbe, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf0, 0x83, 0x7d, 0x66, 0x31, 0x2d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x21, 0x20, 0x0c, 0x63, 0x5f, 0x79, 0xce, 0xca, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xff, 0xfd, 0xed, 0xff, 0x9f, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9a, 0xd6, 0xd1, 0x9a, 0xd6, 0xd1, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0x5f, 0xf6, 0xff, 0x7e, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0x7e, 0xed, 0xff, 0xfe, 0xed, 0xff, 0xff, 0xfe, 0xff, 0x5f, 0xff, 0xff, 0x9f, 0xfe, 0xff, 0xbf, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x81, 0x86, 0x31, 0x2f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x24, 0x21, 0x25, 0x4d, 0x6b, 0x68, 0xba, 0xd6, 0xd2, 0xdf, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x76, 0xb5, 0xad, 0x10, 0x84, 0x7f, 0x10, 0x84, 0x7f, 0x76, 0xb5, 0xad, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0x3f, 0xfe, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x7e, 0xf5, 0xff, 0xfe, 0xed, 0xff, 0x1f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0x9e, 0xf5, 0xff, 0xbf, 0xfd, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x82, 0x86, 0x31, 0x2f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x24, 0x21, 0x24, 0x0c, 0x63, 0x61, 0x18, 0xc6, 0xbf, 0xdf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x9e, 0xf7, 0xef, 0x75, 0xad, 0xaa, 0x2d, 0x6b, 0x65, 0x08, 0x42, 0x40, 0x08, 0x42, 0x40, 0x2d, 0x6b, 0x65, 0x75, 0xad, 0xab, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0xbf, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0x5f, 0xf5, 0xff, 0x7f, 0xfd, 0xff, 0x7e, 0xed, 0xff, 0x1e, 0xf6, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x1f, 0xf6, 0xff, 0xbf, 0xfd, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x82, 0x86, 0x31, 0x2f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe3, 0x18, 0x1c, 0x6a, 0x52, 0x4c, 0x92, 0x94, 0x91, 0xfc, 0xe6, 0xde, 0x3d, 0xef, 0xe8, 0x59, 0xce, 0xc8, 0xf3, 0x9c, 0x9a, 0x0c, 0x63, 0x61, 0x86, 0x31, 0x31, 0xa3, 0x18, 0x19, 0xa3, 0x18, 0x19, 0x86, 0x31, 0x31, 0x2c, 0x63, 0x63, 0x75, 0xad, 0xaa, 0xdf, 0xff, 0xf7, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x3f, 0xfe, 0xff, 0x9f, 0xfd, 0xff, 0x7f, 0xf5, 0xff, 0x7f, 0xf5, 0xff, 0x9e, 0xf5, 0xff, 0x7e, 0xf6, 0xff, 0x5f, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0x1f, 0xfe, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x82, 0x86, 0x31, 0x2f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x82, 0x10, 0x12, 0x86, 0x31, 0x30, 0xeb, 0x5a, 0x5a, 0x10, 0x84, 0x81, 0x51, 0x8c, 0x87, 0xaf, 0x7b, 0x74, 0x8a, 0x52, 0x52, 0x66, 0x31, 0x2e, 0x62, 0x10, 0x13, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x62, 0x10, 0x13, 0x86, 0x31, 0x31, 0x0c, 0x63, 0x61, 0x34, 0xa5, 0xa3, 0x3d, 0xef, 0xe5, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0x1f, 0xfe, 0xff, 0x9f, 0xfd, 0xff, 0x7e, 0xf5, 0xff, 0xdd, 0xed, 0xff, 0xdf, 0xfe, 0xff, 0x3f, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x80, 0x66, 0x31, 0x2e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0xa3, 0x18, 0x18, 0x86, 0x31, 0x2c, 0x08, 0x42, 0x3d, 0x08, 0x42, 0x40, 0xa7, 0x39, 0x35, 0x25, 0x29, 0x23, 0x82, 0x10, 0x11, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06, 0x62, 0x10, 0x13, 0x66, 0x31, 0x2e, 0xcb, 0x5a, 0x59, 0x92, 0x94, 0x8e, 0x18, 0xc6, 0xc0, 0x3d, 0xef, 0xe5, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0x9d, 0xed, 0xff, 0x3e, 0xf6, 0xff, 0x1f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xf4, 0xcf, 0x7b, 0x79, 0x86, 0x31, 0x2c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09, 0x82, 0x10, 0x10, 0xc3, 0x18, 0x15, 0xc3, 0x18, 0x16, 0x82, 0x10, 0x11, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x82, 0x10, 0x11, 0x45, 0x29, 0x27, 0x29, 0x4a, 0x46, 0x6e, 0x73, 0x6c, 0x92, 0x94, 0x8e, 0x18, 0xc6, 0xc0, 0x3d, 0xef, 0xe5, 0xdf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0x3d, 0xee, 0xff, 0xbe, 0xf6, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xde, 0xd4, 0x4d, 0x6b, 0x69, 0x45, 0x29, 0x26, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0xa3, 0x18, 0x0d, 0xe4, 0x20, 0x1b, 0x86, 0x31, 0x2f, 0x29, 0x4a, 0x46, 0x6e, 0x73, 0x6c, 0x92, 0x94, 0x8e, 0x18, 0xc6, 0xbe, 0xfc, 0xe6, 0xdc, 0xdf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xa5, 0xa1, 0x8a, 0x52, 0x50, 0xe3, 0x18, 0x1d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x82, 0x10, 0x0f, 0xe4, 0x20, 0x1b, 0x86, 0x31, 0x2f, 0x29, 0x4a, 0x46, 0x4d, 0x6b, 0x69, 0x30, 0x84, 0x83, 0x34, 0xa5, 0xa1, 0x34, 0xa5, 0xa1, 0x34, 0xa5, 0xa1, 0x34, 0xa5, 0xa1, 0x34, 0xa5, 0xa1, 0x2d, 0x6b, 0x65, 0xa6, 0x31, 0x32, 0x82, 0x10, 0x12, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x82, 0x10, 0x0f, 0xe4, 0x20, 0x1b, 0x66, 0x31, 0x2d, 0x08, 0x42, 0x3d, 0x8a, 0x52, 0x50, 0x8a, 0x52, 0x50, 0x8a, 0x52, 0x50, 0x8a, 0x52, 0x50, 0x8a, 0x52, 0x50, 0xa6, 0x31, 0x32, 0xa3, 0x18, 0x19, 0x00, 0x00, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x10, 0x82, 0x11, 0x21, 0x24, 0x25, 0x41, 0xe8, 0x3b, 0x4a, 0x49, 0x4a, 0x52, 0x8a, 0x50, 0x4a, 0x49, 0x49, 0x31, 0x86, 0x31, 0x18, 0xa3, 0x19, 0x00, 0x00, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x10, 0x62, 0x13, 0x31, 0x66, 0x2e, 0x5a, 0xcb, 0x56, 0x84, 0x10, 0x7f, 0x9c, 0xd3, 0x97, 0xa5, 0x34, 0xa1, 0x9c, 0xb3, 0x94, 0x63, 0x0c, 0x61, 0x31, 0x86, 0x31, 0x10, 0x82, 0x12, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x10, 0x82, 0x11, 0x31, 0x66, 0x2e, 0x63, 0x0c, 0x61, 0xa5, 0x14, 0xa0, 0xde, 0xdb, 0xd7, 0xf7, 0x9e, 0xf7, 0xff, 0x9f, 0xff, 0xef, 0x3d, 0xed, 0x9c, 0xb3, 0x95, 0x4a, 0x49, 0x4a, 0x20, 0xe4, 0x1a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0xa3, 0x0d, 0x29, 0x45, 0x27, 0x5a, 0xeb, 0x5b, 0xad, 0x75, 0xaa, 0xff, 0xdf, 0xf6, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x3e, 0xff, 0xff, 0xbf, 0xff, 0xbd, 0xd7, 0xb8, 0x5a, 0xcb, 0x59, 0x21, 0x04, 0x1f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x18, 0xe3, 0x1d, 0x4a, 0x69, 0x4b, 0x9c, 0xd3, 0x98, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x3e, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x18, 0xbe, 0x5a, 0xcb, 0x58, 0x18, 0xe3, 0x1e, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x18, 0xe3, 0x14, 0x39, 0xc7, 0x38, 0x84, 0x10, 0x7f, 0xe7, 0x1c, 0xde, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x1e, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xad, 0x75, 0xab, 0x4a, 0x69, 0x4b, 0x18, 0xa3, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0xa3, 0x0d, 0x31, 0x66, 0x29, 0x63, 0x2c, 0x63, 0xc6, 0x18, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xee, 0xfd, 0xff, 0xee, 0x9d, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x71, 0x8b, 0x39, 0xc7, 0x38, 0x10, 0x82, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x18, 0xe3, 0x1d, 0x52, 0x6a, 0x4c, 0xa5, 0x14, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3e, 0xff, 0xee, 0x5d, 0xff, 0xf6, 0x5e, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xd8, 0x6b, 0x4d, 0x69, 0x29, 0x45, 0x26, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05, 0x18, 0xe3, 0x14, 0x39, 0xc7, 0x38, 0x84, 0x10, 0x7f, 0xe7, 0x1c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xf6, 0xbe, 0xff, 0xf6, 0x3e, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xad, 0x55, 0xa7, 0x4a, 0x49, 0x4a, 0x18, 0xa3, 0x18, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x09, 0x10, 0xa2, 0x0e, 0x18, 0xc3, 0x15, 0x18, 0xe3, 0x1d, 0x18, 0xe3, 0x1d, 0x18, 0xe3, 0x1d, 0x18, 0xe3, 0x1d, 0x18, 0xc3, 0x15, 0x10, 0x82, 0x10, 0x18, 0xe3, 0x14, 0x31, 0x86, 0x2c, 0x63, 0x2c, 0x63, 0xc6, 0x18, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xee, 0x7d, 0xff, 0xe5, 0xdd, 0xff, 0xf5, 0xde, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xf1, 0x83, 0xf0, 0x7d, 0x31, 0xa6, 0x33, 0x10, 0x82, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0b, 0x18, 0xc3, 0x15, 0x21, 0x04, 0x1f, 0x29, 0x25, 0x23, 0x31, 0x66, 0x2d, 0x42, 0x08, 0x3d, 0x52, 0x8a, 0x4e, 0x52, 0x8a, 0x50, 0x52, 0x8a, 0x50, 0x52, 0x8a, 0x4e, 0x42, 0x08, 0x3d, 0x31, 0x86, 0x30, 0x39, 0xc7, 0x34, 0x5a, 0xcb, 0x56, 0xa5, 0x14, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x1e, 0xff, 0xee, 0x1d, 0xff, 0xed, 0xdd, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xce, 0x79, 0xca, 0x63, 0x2c, 0x63, 0x29, 0x45, 0x26, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x08, 0x10, 0x62, 0x13, 0x21, 0x24, 0x25, 0x42, 0x08, 0x3d, 0x52, 0x8a, 0x52, 0x5a, 0xcb, 0x59, 0x6b, 0x4d, 0x69, 0x84, 0x30, 0x83, 0xa5, 0x14, 0x9e, 0xa5, 0x34, 0xa1, 0xa5, 0x34, 0xa1, 0xa5, 0x14, 0x9e, 0x84, 0x30, 0x83, 0x73, 0x6e, 0x6e, 0x73, 0x8e, 0x6f, 0x9c, 0xb3, 0x94, 0xe7, 0x1c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xee, 0x9e, 0xff, 0xf6, 0x3f, 0xff, 0xfe, 0x3f, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xce, 0x39, 0xc5, 0x63, 0x2c, 0x64, 0x29, 0x45, 0x28, 0x18, 0xa3, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x18, 0xa3, 0x0d, 0x18, 0xe3, 0x1d, 0x39, 0xa7, 0x36, 0x5a, 0xcb, 0x56, 0x84, 0x30, 0x83, 0xa5, 0x34, 0xa3, 0xad, 0x75, 0xab, 0xc6, 0x18, 0xbe, 0xe6, 0xfc, 0xdc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe6, 0xfc, 0xdc, 0xc6, 0x38, 0xc3, 0xc6, 0x18, 0xc1, 0xe7, 0x1c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xee, 0x9d, 0xff, 0xed, 0xdd, 0xff, 0xf5, 0x9e, 0xff, 0xf5, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3d, 0xe5, 0x83, 0xf0, 0x7e, 0x39, 0xc7, 0x38, 0x10, 0x82, 0x12, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x10, 0x82, 0x11, 0x29, 0x45, 0x27, 0x4a, 0x49, 0x49, 0x7b, 0xaf, 0x74, 0xa5, 0x14, 0xa0, 0xe6, 0xfc, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x3e, 0xff, 0xf7, 0x1e, 0xff, 0xf6, 0xfe, 0xff, 0xf6, 0xde, 0xff, 0xf6, 0xde, 0xff, 0xf6, 0xfe, 0xff, 0xf7, 0x3e, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xee, 0x9d, 0xff, 0xe5, 0xbc, 0xff, 0xed, 0x7d, 0xff, 0xf5, 0x7e, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xbf, 0xff, 0xa5, 0x34, 0xa3, 0x52, 0x6a, 0x4c, 0x20, 0xe4, 0x1a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x10, 0x62, 0x13, 0x31, 0x66, 0x2e, 0x5a, 0xcb, 0x59, 0x94, 0x92, 0x90, 0xce, 0x59, 0xc7, 0xff, 0xdf, 0xf6, 0xff, 0xbf, 0xff, 0xf7, 0x1e, 0xff, 0xf6, 0x7e, 0xff, 0xed, 0xfd, 0xff, 0xed, 0xdd, 0xff, 0xed, 0xbd, 0xff, 0xed, 0xbd, 0xff, 0xed, 0xbd, 0xff, 0xed, 0xfd, 0xff, 0xf6, 0x7d, 0xff, 0xf6, 0xbe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x1e, 0xff, 0xee, 0x3d, 0xff, 0xed, 0xdd, 0xff, 0xf5, 0xff, 0xff, 0xfe, 0x5f, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0x9f, 0xff, 0xee, 0x3e, 0xff, 0xf6, 0x7e, 0xff, 0xff, 0x7f, 0xff, 0xbd, 0xd7, 0xb9, 0x5a, 0xcb, 0x57, 0x21, 0x04, 0x1f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x10, 0x82, 0x11, 0x31, 0x66, 0x2e, 0x63, 0x0c, 0x61, 0xa5, 0x34, 0xa3, 0xef, 0x5d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xee, 0x9e, 0xff, 0xed, 0xdd, 0xff, 0xed, 0x7d, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x7e, 0xff, 0xf5, 0x9e, 0xff, 0xfe, 0x1f, 0xff, 0xfe, 0x5f, 0xff, 0xfe, 0x3f, 0xff, 0xf6, 0x1e, 0xff, 0xf6, 0x3e, 0xff, 0xf6, 0x7e, 0xff, 0xf6, 0x9e, 0xff, 0xf6, 0x5e, 0xff, 0xfe, 0x1f, 0xff, 0xfe, 0x3f, 0xff, 0xfe, 0x5f, 0xff, 0xf6, 0x1e, 0xff, 0xed, 0xbd, 0xff, 0xed, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb5, 0x96, 0xb0, 0x52, 0x8a, 0x52, 0x18, 0xe3, 0x1c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0xa3, 0x0d, 0x29, 0x45, 0x27, 0x5a, 0xeb, 0x5b, 0xad, 0x75, 0xaa, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xee, 0x5d, 0xff, 0xed, 0xbd, 0xff, 0xf5, 0x9e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x9f, 0xff, 0xfe, 0x1f, 0xff, 0xfe, 0x5f, 0xff, 0xfd, 0xff, 0xff, 0xf5, 0x9e, 0xff, 0xed, 0x9d, 0xff, 0xed, 0xbd, 0xff, 0xed, 0x9c, 0xff, 0xed, 0xbd, 0xff, 0xf5, 0xde, 0xff, 0xfd, 0xbf, 0xff, 0xf5, 0x9e, 0xff, 0xf5, 0x7e, 0xff, 0xed, 0x9e, 0xff, 0xf5, 0xde, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xfa, 0x8c, 0x71, 0x8b, 0x42, 0x08, 0x3d, 0x18, 0xe3, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x18, 0xe3, 0x1d, 0x4a, 0x69, 0x4b, 0x9c, 0xd3, 0x98, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xee, 0x5e, 0xff, 0xed, 0x9d, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x9f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0xbf, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x9f, 0xff, 0xed, 0xdd, 0xff, 0xed, 0x9d, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x5e, 0xff, 0xf6, 0x1e, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xdf, 0xff, 0xf5, 0xbf, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xd7, 0xb9, 0x62, 0xec, 0x5d, 0x29, 0x45, 0x26, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0b, 0x18, 0xa3, 0x18, 0x41, 0xe8, 0x3b, 0x84, 0x10, 0x7f, 0xe7, 0x1c, 0xde, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xee, 0x5e, 0xff, 0xed, 0x9d, 0xff, 0xf5, 0x7e, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x5e, 0xff, 0xf5, 0x5e, 0xff, 0xfd, 0xbf, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0xff, 0xff, 0xf6, 0x3d, 0xff, 0xed, 0xdd, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0xdf, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xec, 0x84, 0x30, 0x83, 0x39, 0xe7, 0x39, 0x10, 0x62, 0x13, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09, 0x10, 0x82, 0x12, 0x18, 0xe3, 0x1d, 0x21, 0x04, 0x1f, 0x21, 0x24, 0x25, 0x41, 0xe8, 0x3b, 0x73, 0x6e, 0x6c, 0xc6, 0x18, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xf6, 0x3e, 0xff, 0xfe, 0x3f, 0xff, 0xfe, 0x5f, 0xff, 0xfe, 0x5f, 0xff, 0xfe, 0x1f, 0xff, 0xfe, 0x3f, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x5f, 0xff, 0xf6, 0xfe, 0xff, 0xee, 0x3d, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0xdf, 0xff, 0xf6, 0x5e, 0xff, 0xf5, 0xde, 0xff, 0xf5, 0x9f, 0xff, 0xfd, 0x9f, 0xff, 0xfd, 0xbf, 0xff, 0xfd, 0xff, 0xff, 0xf6, 0x1e, 0xff, 0xf6, 0x3e, 0xff, 0xf6, 0x3d, 0xff, 0xf6, 0x1e, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfb, 0xda, 0x6b, 0x6d, 0x6b, 0x29, 0x45, 0x28, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0x18, 0xa3, 0x19, 0x31, 0xa6, 0x32, 0x52, 0x8a, 0x50, 0x52, 0x8a, 0x52, 0x5a, 0xeb, 0x5c, 0x7b, 0xcf, 0x77, 0xb5, 0x96, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7f, 0xff, 0xf6, 0xde, 0xff, 0xf6, 0xbe, 0xff, 0xfe, 0x9f, 0xff, 0xed, 0xfd, 0xff, 0xed, 0x9d, 0xff, 0xf5, 0x7e, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x7e, 0xff, 0xf5, 0x7e, 0xff, 0xed, 0x7d, 0xff, 0xed, 0x7c, 0xff, 0xed, 0x9d, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0xdf, 0x6b, 0x6d, 0x6a, 0x21, 0x24, 0x25, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x82, 0x11, 0x31, 0x86, 0x30, 0x63, 0x0c, 0x61, 0x9c, 0xf3, 0x9a, 0xa5, 0x14, 0x9d, 0xad, 0x55, 0xa9, 0xce, 0x59, 0xc7, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x3e, 0xff, 0xf6, 0xbe, 0xff, 0xf6, 0x7e, 0xff, 0xf6, 0x3e, 0xff, 0xed, 0xfe, 0xff, 0xf6, 0x1e, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0xbf, 0xff, 0xed, 0xdd, 0xff, 0xed, 0x7d, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0xbe, 0xf2, 0x7b, 0xcf, 0x76, 0x29, 0x65, 0x2a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x20, 0xe4, 0x1a, 0x4a, 0x49, 0x47, 0x94, 0x92, 0x8f, 0xe7, 0x3c, 0xe2, 0xf7, 0x7e, 0xed, 0xff, 0x9f, 0xf9, 0xff, 0x9f, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0xff, 0xff, 0xf6, 0x7e, 0xff, 0xed, 0xfd, 0xff, 0xed, 0x9d, 0xff, 0xed, 0x9d, 0xff, 0xed, 0x7d, 0xff, 0xed, 0x7d, 0xff, 0xf6, 0x3e, 0xff, 0xfe, 0xff, 0xff, 0xf6, 0x7e, 0xff, 0xee, 0x1d, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x7f, 0xff, 0xee, 0x5d, 0xff, 0xed, 0x7d, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x31, 0x86, 0x31, 0xa6, 0x33, 0x18, 0xa3, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18, 0xe3, 0x1d, 0x52, 0x8a, 0x50, 0xa5, 0x34, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xef, 0x1d, 0xff, 0xe6, 0x9d, 0xff, 0xe6, 0x1d, 0xff, 0xed, 0xbd, 0xff, 0xed, 0x7e, 0xff, 0xf5, 0x7e, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x5e, 0xff, 0xf5, 0x5e, 0xff, 0xf5, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xf6, 0xbe, 0xff, 0xed, 0xbd, 0xff, 0xf5, 0x9e, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0x5f, 0xff, 0xee, 0x1d, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf3, 0x9a, 0x42, 0x08, 0x3f, 0x10, 0x82, 0x12, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x20, 0xe4, 0x1a, 0x4a, 0x49, 0x47, 0x94, 0x92, 0x8f, 0xef, 0x5d, 0xe8, 0xf7, 0x7e, 0xf5, 0xf7, 0x5e, 0xff, 0xee, 0xfd, 0xff, 0xee, 0xde, 0xff, 0xf6, 0x7e, 0xff, 0xf5, 0xfe, 0xff, 0xf5, 0xbf, 0xff, 0xfd, 0xbf, 0xff, 0xfd, 0xbf, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0xbf, 0xff, 0xed, 0xdd, 0xff, 0xed, 0x7d, 0xff, 0xf5, 0x9e, 0xff, 0xf6, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xf6, 0x3e, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xd7, 0xb8, 0x52, 0xaa, 0x51, 0x20, 0xe4, 0x1b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x82, 0x11, 0x31, 0x86, 0x30, 0x63, 0x0c, 0x61, 0xa5, 0x14, 0x9f, 0xb5, 0x96, 0xaf, 0xde, 0xdb, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x1f, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0x5f, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x1f, 0xff, 0xfe, 0x5f, 0xff, 0xf5, 0x7e, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x7e, 0xff, 0xf5, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xf5, 0x9e, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0xde, 0x73, 0x6e, 0x6c, 0x29, 0x45, 0x27, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0x18, 0xa3, 0x19, 0x39, 0xc7, 0x34, 0x5a, 0xeb, 0x5a, 0x73, 0xae, 0x73, 0xad, 0x75, 0xaa, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0xff, 0xff, 0xf5, 0xfe, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xf5, 0x9e, 0xff, 0xfe, 0x5f, 0xff, 0xfe, 0xff, 0xff, 0xf6, 0x1e, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x94, 0x92, 0x8e, 0x39, 0xc7, 0x3a, 0x10, 0x82, 0x11, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0b, 0x18, 0xa3, 0x18, 0x39, 0xc7, 0x34, 0x5a, 0xeb, 0x5c, 0xa5, 0x34, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xee, 0xbd, 0xff, 0xed, 0xfe, 0xff, 0xf5, 0x9e, 0xff, 0xf5, 0x9e, 0xff, 0xfe, 0xbf, 0xff, 0xf6, 0xbe, 0xff, 0xed, 0xbd, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0xdf, 0xff, 0xed, 0xbe, 0xff, 0xf5, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xf7, 0xba, 0x5a, 0xcb, 0x56, 0x18, 0xe3, 0x1e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x18, 0xc3, 0x17, 0x39, 0xc7, 0x3a, 0x7b, 0xaf, 0x74, 0xce, 0x59, 0xc9, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xee, 0x7d, 0xff, 0xe5, 0xbc, 0xff, 0xed, 0x9d, 0xff, 0xf5, 0x7e, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0x1f, 0xff, 0xf6, 0x9e, 0xff, 0xe5, 0x9d, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x1f, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xf5, 0x9e, 0xff, 0xf5, 0x5e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x9f, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9e, 0xef, 0x83, 0xf0, 0x7d, 0x31, 0xa6, 0x33, 0x10, 0x82, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x10, 0x82, 0x11, 0x31, 0x66, 0x2e, 0x6b, 0x2d, 0x65, 0xb5, 0x96, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf6, 0x9d, 0xff, 0xed, 0xbd, 0xff, 0xf5, 0x9e, 0xff, 0xf5, 0x7e, 0xff, 0xf5, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xee, 0x5d, 0xff, 0xed, 0x9c, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xf5, 0x9e, 0xff, 0xfe, 0x5f, 0xff, 0xfe, 0xdf, 0xff, 0xfe, 0x5f, 0xff, 0xf5, 0xbe, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x9f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0xb0, 0x52, 0x8a, 0x52, 0x18, 0xe3, 0x1d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0b, 0x21, 0x24, 0x25, 0x5a, 0xcb, 0x59, 0xad, 0x75, 0xab, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf7, 0x1e, 0xff, 0xed, 0xfd, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x9f, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x1f, 0xff, 0xee, 0x1d, 0xff, 0xed, 0x9d, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x9e, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0xff, 0xfe, 0x7f, 0xff, 0xf5, 0xbf, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x7d, 0xeb, 0x7b, 0xcf, 0x79, 0x31, 0x86, 0x30, 0x10, 0xa2, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x18, 0xe3, 0x14, 0x42, 0x08, 0x3d, 0x8c, 0x71, 0x89, 0xff, 0xbf, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xee, 0x3d, 0xff, 0xed, 0x9d, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x1f, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0x1f, 0xff, 0xfe, 0xdf, 0xff, 0xed, 0xfd, 0xff, 0xed, 0x7d, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0xdf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfe, 0x9f, 0xff, 0xf5, 0xbe, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0x5f, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xad, 0x35, 0xa5, 0x4a, 0x49, 0x48, 0x18, 0xc3, 0x17, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0xe3, 0x1c, 0x52, 0xaa, 0x51, 0xb5, 0x96, 0xae, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xee, 0x3d, 0xff, 0xed, 0x7d, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x9f, 0xff, 0xf6, 0x5e, 0xff, 0xf6, 0x5e, 0xff, 0xfe, 0x9f, 0xff, 0xf5, 0xfe, 0xff, 0xed, 0x7d, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xf5, 0xde, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xf5, 0x7f, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xce, 0x79, 0xcb, 0x63, 0x0c, 0x5e, 0x21, 0x04, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x21, 0x04, 0x1f, 0x5a, 0xcb, 0x57, 0xbd, 0xb7, 0xb4, 0xff, 0xdf, 0xff, 0xf6, 0xfe, 0xff, 0xee, 0x5e, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0xff, 0xff, 0xee, 0x1d, 0xff, 0xed, 0x9d, 0xff, 0xf6, 0x3e, 0xff, 0xfe, 0xdf, 0xff, 0xf6, 0x1e, 0xff, 0xed, 0x7d, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x5e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf6, 0xbf, 0xff, 0xed, 0xbe, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x9f, 0xff, 0xe7, 0x1c, 0xe1, 0x6b, 0x6d, 0x6b, 0x21, 0x24, 0x25, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x20, 0xe4, 0x1a, 0x4a, 0x49, 0x4a, 0x9c, 0xd3, 0x97, 0xf7, 0x7e, 0xf7, 0xff, 0x7f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xee, 0x7e, 0xff, 0xe5, 0x9d, 0xff, 0xed, 0x9e, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0x5f, 0xff, 0xf6, 0x7e, 0xff, 0xed, 0x9d, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0xbf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xfc, 0xdd, 0xb5, 0x76, 0xac, 0xc6, 0x18, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xf6, 0x7e, 0xff, 0xed, 0x9e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x7f, 0xff, 0xe6, 0xfc, 0xdd, 0x6b, 0x6d, 0x6a, 0x21, 0x24, 0x25, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x82, 0x12, 0x31, 0x86, 0x31, 0x63, 0x2c, 0x64, 0xad, 0x35, 0xa5, 0xc6, 0x38, 0xc3, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1e, 0xff, 0xed, 0xdd, 0xff, 0xed, 0x7e, 0xff, 0xf5, 0x9f, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0x9f, 0xff, 0xf6, 0xde, 0xff, 0xed, 0xdd, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xd7, 0xb9, 0x7b, 0xcf, 0x78, 0x83, 0xf0, 0x7e, 0xc6, 0x18, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xed, 0xfe, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0xbf, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xc6, 0x18, 0xbf, 0x5a, 0xcb, 0x59, 0x21, 0x04, 0x1f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0x18, 0xa3, 0x19, 0x39, 0xa7, 0x35, 0x63, 0x0c, 0x5e, 0x8c, 0x31, 0x86, 0xd6, 0xba, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf6, 0x9e, 0xff, 0xed, 0xbd, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x9f, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xf5, 0xfe, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xd7, 0xb6, 0x63, 0x2c, 0x64, 0x5a, 0xab, 0x54, 0x84, 0x30, 0x83, 0xe7, 0x1c, 0xde, 0xff, 0xdf, 0xff, 0xf6, 0xbe, 0xff, 0xed, 0xbd, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xfb, 0x94, 0x92, 0x8e, 0x42, 0x08, 0x3f, 0x18, 0xc3, 0x15, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09, 0x18, 0xc3, 0x17, 0x39, 0xa7, 0x35, 0x6b, 0x4d, 0x69, 0xce, 0x59, 0xc9, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xed, 0xfd, 0xff, 0xf5, 0x9e, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7f, 0xff, 0xfe, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0x9f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0xd6, 0x7b, 0xcf, 0x75, 0x4a, 0x49, 0x48, 0x5a, 0xcb, 0x57, 0x9c, 0xf3, 0x9a, 0xff, 0xdf, 0xf6, 0xff, 0x9f, 0xff, 0xf6, 0xbf, 0xff, 0xfe, 0x1f, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xf6, 0xad, 0x75, 0xaa, 0x5a, 0xcb, 0x59, 0x21, 0x24, 0x25, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0b, 0x29, 0x45, 0x28, 0x6b, 0x4d, 0x68, 0xde, 0xdb, 0xd8, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xed, 0xbd, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0xbf, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0xdf, 0xff, 0xfd, 0xbf, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x34, 0xa3, 0x5a, 0xcb, 0x57, 0x42, 0x28, 0x41, 0x63, 0x0c, 0x60, 0xa5, 0x34, 0xa1, 0xe6, 0xfc, 0xdc, 0xff, 0xbf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xfc, 0xdc, 0xa5, 0x14, 0xa0, 0x63, 0x0c, 0x61, 0x31, 0x66, 0x2e, 0x10, 0x82, 0x11, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x29, 0x65, 0x2a, 0x7b, 0xcf, 0x75, 0xf7, 0x9e, 0xf0, 0xff, 0xbf, 0xff, 0xf6, 0x9e, 0xff, 0xed, 0x7e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xf6, 0xfe, 0xff, 0xf6, 0xbe, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3c, 0xe2, 0x7b, 0xef, 0x7c, 0x42, 0x28, 0x42, 0x41, 0xe8, 0x3b, 0x5a, 0xcb, 0x59, 0x84, 0x30, 0x83, 0xa5, 0x34, 0xa1, 0xa5, 0x34, 0xa1, 0xa5, 0x34, 0xa1, 0xa5, 0x34, 0xa1, 0xa5, 0x34, 0xa1, 0x84, 0x30, 0x83, 0x5a, 0xcb, 0x56, 0x31, 0x66, 0x2e, 0x10, 0x62, 0x13, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0xa3, 0x0d, 0x31, 0xa6, 0x33, 0x8c, 0x31, 0x86, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xf6, 0x3e, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xbf, 0xff, 0xf6, 0x9e, 0xff, 0xf6, 0x1e, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x1f, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0x9f, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0xaf, 0x5a, 0xcb, 0x57, 0x31, 0x66, 0x2e, 0x31, 0x86, 0x2c, 0x42, 0x08, 0x3e, 0x52, 0x8a, 0x50, 0x52, 0x8a, 0x50, 0x52, 0x8a, 0x50, 0x52, 0x8a, 0x50, 0x52, 0x8a, 0x50, 0x42, 0x08, 0x3d, 0x21, 0x24, 0x25, 0x10, 0x82, 0x11, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x82, 0x12, 0x42, 0x08, 0x3f, 0x9c, 0xf3, 0x9a, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xf6, 0x1e, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x9f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x9f, 0xff, 0xf6, 0x3e, 0xff, 0xf5, 0x9e, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x1f, 0xff, 0xfe, 0x1f, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x9f, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0xeb, 0x7b, 0xcf, 0x7a, 0x39, 0xa7, 0x35, 0x18, 0xa3, 0x19, 0x18, 0xc3, 0x17, 0x18, 0xe3, 0x1d, 0x18, 0xe3, 0x1d, 0x18, 0xe3, 0x1d, 0x18, 0xe3, 0x1d, 0x18, 0xe3, 0x1d, 0x18, 0xc3, 0x15, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0xe4, 0x1b, 0x52, 0xaa, 0x51, 0xbd, 0xd7, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xed, 0xfe, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7f, 0xff, 0xf6, 0x1e, 0xff, 0xf5, 0x7e, 0xff, 0xf5, 0xbe, 0xff, 0xf6, 0x7e, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0xff, 0xfe, 0x5f, 0xff, 0xfd, 0x9f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xad, 0x35, 0xa5, 0x4a, 0x49, 0x49, 0x18, 0xa3, 0x19, 0x00, 0x00, 0x09, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x29, 0x45, 0x27, 0x73, 0x6e, 0x6c, 0xe7, 0x1c, 0xde, 0xff, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0xed, 0xbd, 0xff, 0xf5, 0x5e, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xee, 0x3e, 0xff, 0xf5, 0x7e, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0xbe, 0xff, 0xf6, 0x3e, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xf5, 0xbf, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xf5, 0xbe, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x7a, 0xce, 0x63, 0x0c, 0x60, 0x21, 0x04, 0x21, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x82, 0x10, 0x39, 0xc7, 0x38, 0x94, 0x72, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf6, 0x9e, 0xff, 0xed, 0x9d, 0xff, 0xf5, 0x9f, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf6, 0x7e, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xed, 0x9e, 0xff, 0xed, 0xfe, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0xbf, 0xff, 0xf5, 0xde, 0xff, 0xf5, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x9f, 0xff, 0xf7, 0x7e, 0xec, 0x73, 0xae, 0x72, 0x29, 0x45, 0x28, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x18, 0xa3, 0x18, 0x52, 0x6a, 0x4d, 0xb5, 0x96, 0xae, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xee, 0x1d, 0xff, 0xed, 0x9d, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf5, 0xbf, 0xff, 0xf5, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0x7e, 0xff, 0xed, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0xbf, 0xff, 0xf5, 0xbe, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfd, 0x83, 0xf0, 0x7d, 0x31, 0x66, 0x2d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x21, 0x04, 0x20, 0x63, 0x0c, 0x5f, 0xce, 0x79, 0xca, 0xff, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0xed, 0xfd, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0xd6, 0x9a, 0xd1, 0xd6, 0x9a, 0xd1, 0xff, 0xff, 0xfe, 0xff, 0x9f, 0xff, 0xf6, 0x5f, 0xff, 0xf5, 0x7e, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x9f, 0xff, 0xed, 0x7e, 0xff, 0xed, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0x9f, 0xff, 0xf5, 0xbf, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x84, 0x10, 0x81, 0x31, 0x86, 0x2f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x24, 0x25, 0x6b, 0x4d, 0x68, 0xd6, 0xba, 0xd2, 0xff, 0xdf, 0xff, 0xfe, 0xdf, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xfb, 0xb5, 0x76, 0xad, 0x84, 0x10, 0x7f, 0x84, 0x10, 0x7f, 0xb5, 0x76, 0xad, 0xff, 0xff, 0xfc, 0xff, 0x7f, 0xff, 0xfe, 0x3f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x7e, 0xff, 0xed, 0xfe, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0x7f, 0xff, 0xf5, 0x9e, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x84, 0x10, 0x82, 0x31, 0x86, 0x2f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x24, 0x24, 0x63, 0x0c, 0x61, 0xc6, 0x18, 0xbf, 0xff, 0xdf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x9e, 0xef, 0xad, 0x75, 0xaa, 0x6b, 0x2d, 0x65, 0x42, 0x08, 0x40, 0x42, 0x08, 0x40, 0x6b, 0x2d, 0x65, 0xad, 0x75, 0xab, 0xff, 0xff, 0xfb, 0xff, 0x7f, 0xff, 0xfe, 0x5f, 0xff, 0xfd, 0xbf, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xed, 0x7e, 0xff, 0xf6, 0x1e, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x3f, 0xff, 0xf6, 0x1f, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x84, 0x10, 0x82, 0x31, 0x86, 0x2f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18, 0xe3, 0x1c, 0x52, 0x6a, 0x4c, 0x94, 0x92, 0x91, 0xe6, 0xfc, 0xde, 0xef, 0x3d, 0xe8, 0xce, 0x59, 0xc8, 0x9c, 0xf3, 0x9a, 0x63, 0x0c, 0x61, 0x31, 0x86, 0x31, 0x18, 0xa3, 0x19, 0x18, 0xa3, 0x19, 0x31, 0x86, 0x31, 0x63, 0x2c, 0x63, 0xad, 0x75, 0xaa, 0xff, 0xdf, 0xf7, 0xff, 0x9f, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xfd, 0x9f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x7f, 0xff, 0xf5, 0x9e, 0xff, 0xf6, 0x7e, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x84, 0x10, 0x82, 0x31, 0x86, 0x2f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x82, 0x12, 0x31, 0x86, 0x30, 0x5a, 0xeb, 0x5a, 0x84, 0x10, 0x81, 0x8c, 0x51, 0x87, 0x7b, 0xaf, 0x74, 0x52, 0x8a, 0x52, 0x31, 0x66, 0x2e, 0x10, 0x62, 0x13, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x10, 0x62, 0x13, 0x31, 0x86, 0x31, 0x63, 0x0c, 0x61, 0xa5, 0x34, 0xa3, 0xef, 0x3d, 0xe5, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfe, 0xdf, 0xff, 0xfe, 0x1f, 0xff, 0xfd, 0x9f, 0xff, 0xf5, 0x7e, 0xff, 0xed, 0xdd, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x84, 0x10, 0x80, 0x31, 0x66, 0x2e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x09, 0x18, 0xa3, 0x18, 0x31, 0x86, 0x2c, 0x42, 0x08, 0x3d, 0x42, 0x08, 0x40, 0x39, 0xa7, 0x35, 0x29, 0x25, 0x23, 0x10, 0x82, 0x11, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x06, 0x10, 0x62, 0x13, 0x31, 0x66, 0x2e, 0x5a, 0xcb, 0x59, 0x94, 0x92, 0x8e, 0xc6, 0x18, 0xc0, 0xef, 0x3d, 0xe5, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xfe, 0xbf, 0xff, 0xfd, 0xff, 0xff, 0xed, 0x9d, 0xff, 0xf6, 0x3e, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xf4, 0x7b, 0xcf, 0x79, 0x31, 0x86, 0x2c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x09, 0x10, 0x82, 0x10, 0x18, 0xc3, 0x15, 0x18, 0xc3, 0x16, 0x10, 0x82, 0x11, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x10, 0x82, 0x11, 0x29, 0x45, 0x27, 0x4a, 0x29, 0x46, 0x73, 0x6e, 0x6c, 0x94, 0x92, 0x8e, 0xc6, 0x18, 0xc0, 0xef, 0x3d, 0xe5, 0xff, 0xdf, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0xbf, 0xff, 0xee, 0x3d, 0xff, 0xf6, 0xbe, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xde, 0xbb, 0xd4, 0x6b, 0x4d, 0x69, 0x29, 0x45, 0x26, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x18, 0xa3, 0x0d, 0x20, 0xe4, 0x1b, 0x31, 0x86, 0x2f, 0x4a, 0x29, 0x46, 0x73, 0x6e, 0x6c, 0x94, 0x92, 0x8e, 0xc6, 0x18, 0xbe, 0xe6, 0xfc, 0xdc, 0xff, 0xdf, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x34, 0xa1, 0x52, 0x8a, 0x50, 0x18, 0xe3, 0x1d, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x10, 0x82, 0x0f, 0x20, 0xe4, 0x1b, 0x31, 0x86, 0x2f, 0x4a, 0x29, 0x46, 0x6b, 0x4d, 0x69, 0x84, 0x30, 0x83, 0xa5, 0x34, 0xa1, 0xa5, 0x34, 0xa1, 0xa5, 0x34, 0xa1, 0xa5, 0x34, 0xa1, 0xa5, 0x34, 0xa1, 0x6b, 0x2d, 0x65, 0x31, 0xa6, 0x32, 0x10, 0x82, 0x12, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x10, 0x82, 0x0f, 0x20, 0xe4, 0x1b, 0x31, 0x66, 0x2d, 0x42, 0x08, 0x3d, 0x52, 0x8a, 0x50, 0x52, 0x8a, 0x50, 0x52, 0x8a, 0x50, 0x52, 0x8a, 0x50, 0x52, 0x8a, 0x50, 0x31, 0xa6, 0x32, 0x18, 0xa3, 0x19, 0x00, 0x00, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x0f, 0x11, 0x22, 0x22, 0x22, 0x25, 0x3d, 0x3d, 0x3d, 0x3b, 0x48, 0x48, 0x48, 0x4a, 0x50, 0x50, 0x50, 0x50, 0x49, 0x49, 0x49, 0x49, 0x2f, 0x2f, 0x2f, 0x31, 0x14, 0x14, 0x14, 0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x13, 0x2c, 0x2c, 0x2c, 0x2e, 0x56, 0x56, 0x56, 0x56, 0x7e, 0x7e, 0x7e, 0x7f, 0x96, 0x96, 0x96, 0x97, 0xa2, 0xa2, 0xa2, 0xa1, 0x94, 0x94, 0x94, 0x94, 0x61, 0x61, 0x61, 0x61, 0x2f, 0x2f, 0x2f, 0x31, 0x0e, 0x0e, 0x0e, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x0f, 0x0f, 0x11, 0x2c, 0x2c, 0x2c, 0x2e, 0x61, 0x61, 0x61, 0x61, 0x9f, 0x9f, 0x9f, 0xa0, 0xd7, 0xd7, 0xd7, 0xd7, 0xf0, 0xee, 0xf0, 0xf7, 0xf6, 0xef, 0xf7, 0xff, 0xe9, 0xe5, 0xe9, 0xed, 0x95, 0x95, 0x95, 0x95, 0x48, 0x48, 0x48, 0x4a, 0x1d, 0x1d, 0x1d, 0x1a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x14, 0x14, 0x0d, 0x27, 0x27, 0x27, 0x27, 0x5a, 0x5a, 0x5a, 0x5b, 0xaa, 0xaa, 0xaa, 0xaa, 0xf6, 0xf6, 0xf6, 0xf6, 0xfd, 0xfc, 0xfd, 0xff, 0xf0, 0xec, 0xf2, 0xff, 0xf0, 0xe2, 0xf0, 0xff, 0xfd, 0xf2, 0xfc, 0xff, 0xb8, 0xb8, 0xb8, 0xb8, 0x59, 0x59, 0x59, 0x59, 0x21, 0x21, 0x21, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x1a, 0x1a, 0x1d, 0x4b, 0x4b, 0x4b, 0x4b, 0x99, 0x99, 0x99, 0x98, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xfd, 0xfe, 0xff, 0xf9, 0xf2, 0xf9, 0xff, 0xf1, 0xe4, 0xf3, 0xff, 0xf7, 0xea, 0xf7, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xbf, 0xbf, 0xbf, 0xbe, 0x57, 0x57, 0x57, 0x58, 0x1a, 0x1a, 0x1a, 0x1e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x1a, 0x1a, 0x1a, 0x14, 0x37, 0x37, 0x37, 0x38, 0x7e, 0x7e, 0x7e, 0x7f, 0xde, 0xde, 0xde, 0xde, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xf4, 0xf9, 0xff, 0xf0, 0xe0, 0xf0, 0xff, 0xf4, 0xdc, 0xf4, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xab, 0xab, 0xab, 0x4b, 0x4b, 0x4b, 0x4b, 0x15, 0x15, 0x15, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x14, 0x14, 0x0d, 0x2c, 0x2c, 0x2c, 0x29, 0x62, 0x62, 0x62, 0x63, 0xc1, 0xc1, 0xc1, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf4, 0xf8, 0xff, 0xeb, 0xdc, 0xeb, 0xff, 0xeb, 0xce, 0xea, 0xff, 0xf8, 0xdf, 0xf7, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x8b, 0x8b, 0x8b, 0x37, 0x37, 0x37, 0x38, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x1a, 0x1a, 0x1d, 0x4d, 0x4d, 0x4d, 0x4c, 0x9e, 0x9e, 0x9e, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf3, 0xe5, 0xf3, 0xff, 0xe6, 0xc9, 0xe6, 0xff, 0xef, 0xc8, 0xee, 0xff, 0xfc, 0xe6, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xd8, 0xd8, 0xd8, 0xd8, 0x68, 0x68, 0x68, 0x69, 0x28, 0x28, 0x28, 0x26, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x1a, 0x1a, 0x1a, 0x14, 0x37, 0x37, 0x37, 0x38, 0x7e, 0x7e, 0x7e, 0x7f, 0xe0, 0xe0, 0xe0, 0xe0, 0xfe, 0xfd, 0xfe, 0xff, 0xf8, 0xed, 0xf7, 0xff, 0xf0, 0xd2, 0xef, 0xff, 0xf1, 0xc3, 0xf0, 0xff, 0xf9, 0xce, 0xf8, 0xff, 0xff, 0xed, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xa6, 0xa6, 0xa7, 0x48, 0x48, 0x48, 0x4a, 0x15, 0x15, 0x15, 0x18, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x12, 0x12, 0x12, 0x0e, 0x18, 0x18, 0x18, 0x15, 0x1a, 0x1a, 0x1a, 0x1d, 0x1a, 0x1a, 0x1a, 0x1d, 0x1a, 0x1a, 0x1a, 0x1d, 0x1a, 0x1a, 0x1a, 0x1d, 0x18, 0x18, 0x18, 0x15, 0x10, 0x10, 0x10, 0x10, 0x1a, 0x1a, 0x1a, 0x14, 0x2e, 0x2e, 0x2e, 0x2c, 0x62, 0x62, 0x62, 0x63, 0xc1, 0xc1, 0xc1, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xf7, 0xff, 0xe6, 0xcd, 0xe4, 0xff, 0xe4, 0xb6, 0xe2, 0xff, 0xf0, 0xb8, 0xef, 0xff, 0xfa, 0xd7, 0xf9, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0xf1, 0x7c, 0x7c, 0x7c, 0x7d, 0x32, 0x32, 0x32, 0x33, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0b, 0x18, 0x18, 0x18, 0x15, 0x21, 0x21, 0x21, 0x1f, 0x24, 0x24, 0x24, 0x23, 0x2d, 0x2d, 0x2d, 0x2d, 0x3f, 0x3f, 0x3f, 0x3d, 0x4e, 0x4e, 0x4e, 0x4e, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x4e, 0x4e, 0x4e, 0x3f, 0x3f, 0x3f, 0x3d, 0x30, 0x30, 0x30, 0x30, 0x36, 0x36, 0x36, 0x34, 0x56, 0x56, 0x56, 0x56, 0x9e, 0x9e, 0x9e, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf9, 0xfc, 0xff, 0xf0, 0xde, 0xef, 0xff, 0xe7, 0xc1, 0xe4, 0xff, 0xea, 0xb7, 0xe8, 0xff, 0xf4, 0xc4, 0xf2, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xca, 0xca, 0xca, 0x62, 0x62, 0x62, 0x63, 0x28, 0x28, 0x28, 0x26, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x0d, 0x0d, 0x0d, 0x13, 0x22, 0x22, 0x22, 0x25, 0x3f, 0x3f, 0x3f, 0x3d, 0x51, 0x51, 0x51, 0x52, 0x59, 0x59, 0x59, 0x59, 0x68, 0x68, 0x68, 0x69, 0x82, 0x82, 0x82, 0x83, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0x9e, 0x9e, 0x9e, 0x9e, 0x82, 0x82, 0x82, 0x83, 0x6d, 0x6d, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f, 0x94, 0x94, 0x94, 0x94, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xed, 0xf5, 0xff, 0xed, 0xce, 0xeb, 0xff, 0xf4, 0xc2, 0xf1, 0xff, 0xf8, 0xc3, 0xf6, 0xff, 0xfb, 0xdc, 0xfa, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0xc5, 0x63, 0x63, 0x63, 0x64, 0x26, 0x26, 0x26, 0x28, 0x15, 0x15, 0x15, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x14, 0x14, 0x14, 0x0d, 0x1a, 0x1a, 0x1a, 0x1d, 0x34, 0x34, 0x34, 0x36, 0x56, 0x56, 0x56, 0x56, 0x82, 0x82, 0x82, 0x83, 0xa3, 0xa3, 0xa3, 0xa3, 0xab, 0xab, 0xab, 0xab, 0xbf, 0xbf, 0xbf, 0xbe, 0xdc, 0xdc, 0xdc, 0xdc, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xdc, 0xdc, 0xdc, 0xdc, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xf8, 0xff, 0xe9, 0xce, 0xe8, 0xff, 0xe8, 0xb7, 0xe7, 0xff, 0xee, 0xb0, 0xed, 0xff, 0xf3, 0xbc, 0xf2, 0xff, 0xfb, 0xe4, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xe5, 0xe5, 0xe5, 0x7d, 0x7d, 0x7d, 0x7e, 0x37, 0x37, 0x37, 0x38, 0x0e, 0x0e, 0x0e, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x0f, 0x11, 0x27, 0x27, 0x27, 0x27, 0x49, 0x49, 0x49, 0x49, 0x75, 0x75, 0x75, 0x74, 0x9f, 0x9f, 0x9f, 0xa0, 0xdc, 0xdc, 0xdc, 0xdc, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xf2, 0xfa, 0xff, 0xf3, 0xe4, 0xf2, 0xff, 0xf0, 0xe0, 0xef, 0xff, 0xee, 0xdc, 0xed, 0xff, 0xee, 0xd8, 0xee, 0xff, 0xee, 0xd7, 0xee, 0xff, 0xed, 0xdb, 0xed, 0xff, 0xee, 0xe2, 0xf0, 0xff, 0xf5, 0xea, 0xf6, 0xff, 0xfc, 0xf7, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf7, 0xf3, 0xf7, 0xff, 0xe8, 0xd1, 0xe8, 0xff, 0xe3, 0xb4, 0xe2, 0xff, 0xea, 0xab, 0xe9, 0xff, 0xf1, 0xad, 0xf1, 0xff, 0xf7, 0xc7, 0xf8, 0xff, 0xff, 0xea, 0xff, 0xff, 0xfa, 0xec, 0xfa, 0xff, 0xf6, 0xe8, 0xf5, 0xff, 0xfa, 0xf5, 0xfa, 0xff, 0xa3, 0xa3, 0xa3, 0xa3, 0x4d, 0x4d, 0x4d, 0x4c, 0x1d, 0x1d, 0x1d, 0x1a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x13, 0x2c, 0x2c, 0x2c, 0x2e, 0x59, 0x59, 0x59, 0x59, 0x8f, 0x8f, 0x8f, 0x90, 0xc7, 0xc7, 0xc7, 0xc7, 0xf6, 0xf6, 0xf6, 0xf6, 0xfb, 0xf4, 0xfb, 0xff, 0xf3, 0xde, 0xf2, 0xff, 0xed, 0xca, 0xec, 0xff, 0xe9, 0xba, 0xe7, 0xff, 0xe7, 0xb6, 0xe5, 0xff, 0xe6, 0xb4, 0xe4, 0xff, 0xe7, 0xb2, 0xe7, 0xff, 0xe9, 0xb3, 0xe9, 0xff, 0xe8, 0xbc, 0xe8, 0xff, 0xeb, 0xca, 0xec, 0xff, 0xf3, 0xd5, 0xf3, 0xff, 0xfc, 0xe5, 0xfb, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf1, 0xe1, 0xf2, 0xff, 0xe6, 0xc3, 0xe5, 0xff, 0xea, 0xb6, 0xe8, 0xff, 0xf4, 0xbb, 0xf3, 0xff, 0xfc, 0xc8, 0xfc, 0xff, 0xfe, 0xd3, 0xfd, 0xff, 0xf6, 0xd1, 0xf5, 0xff, 0xed, 0xc4, 0xeb, 0xff, 0xf0, 0xcd, 0xef, 0xff, 0xfb, 0xed, 0xfb, 0xff, 0xb9, 0xb9, 0xb9, 0xb9, 0x58, 0x58, 0x58, 0x57, 0x21, 0x21, 0x21, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x0f, 0x0f, 0x11, 0x2c, 0x2c, 0x2c, 0x2e, 0x61, 0x61, 0x61, 0x61, 0xa3, 0xa3, 0xa3, 0xa3, 0xe7, 0xe7, 0xe7, 0xe7, 0xfe, 0xfd, 0xfe, 0xff, 0xf8, 0xf0, 0xf8, 0xff, 0xec, 0xd1, 0xeb, 0xff, 0xe7, 0xb8, 0xe6, 0xff, 0xeb, 0xad, 0xe9, 0xff, 0xf4, 0xad, 0xf1, 0xff, 0xf5, 0xad, 0xf3, 0xff, 0xf1, 0xab, 0xef, 0xff, 0xf3, 0xaf, 0xf3, 0xff, 0xfa, 0xbe, 0xfa, 0xff, 0xfb, 0xc7, 0xfa, 0xff, 0xf6, 0xc5, 0xf5, 0xff, 0xef, 0xc0, 0xed, 0xff, 0xee, 0xc4, 0xed, 0xff, 0xef, 0xcc, 0xef, 0xff, 0xf0, 0xcf, 0xf1, 0xff, 0xf2, 0xc8, 0xf3, 0xff, 0xf7, 0xc0, 0xf6, 0xff, 0xf9, 0xc4, 0xf8, 0xff, 0xf4, 0xc6, 0xf4, 0xff, 0xf1, 0xbe, 0xf0, 0xff, 0xe9, 0xb3, 0xe6, 0xff, 0xeb, 0xba, 0xe8, 0xff, 0xf9, 0xdb, 0xf8, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xaf, 0xaf, 0xaf, 0xb0, 0x51, 0x51, 0x51, 0x52, 0x1b, 0x1b, 0x1b, 0x1c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x14, 0x14, 0x0d, 0x27, 0x27, 0x27, 0x27, 0x5a, 0x5a, 0x5a, 0x5b, 0xaa, 0xaa, 0xaa, 0xaa, 0xf7, 0xf7, 0xf7, 0xf7, 0xff, 0xfc, 0xff, 0xff, 0xf8, 0xe8, 0xf7, 0xff, 0xea, 0xc8, 0xe9, 0xff, 0xe6, 0xb3, 0xe6, 0xff, 0xf0, 0xb0, 0xef, 0xff, 0xf6, 0xac, 0xf5, 0xff, 0xf7, 0xa8, 0xf6, 0xff, 0xf8, 0xaa, 0xf6, 0xff, 0xf6, 0xb1, 0xf5, 0xff, 0xfb, 0xc0, 0xfa, 0xff, 0xfa, 0xc6, 0xfa, 0xff, 0xf4, 0xbc, 0xf4, 0xff, 0xf0, 0xaf, 0xef, 0xff, 0xeb, 0xb0, 0xeb, 0xff, 0xe6, 0xb2, 0xe7, 0xff, 0xe3, 0xb1, 0xe4, 0xff, 0xe8, 0xb4, 0xe9, 0xff, 0xf0, 0xb6, 0xf0, 0xff, 0xf4, 0xb5, 0xf4, 0xff, 0xf0, 0xaf, 0xef, 0xff, 0xed, 0xac, 0xec, 0xff, 0xed, 0xae, 0xeb, 0xff, 0xf0, 0xb9, 0xed, 0xff, 0xf8, 0xd7, 0xf7, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfa, 0x8b, 0x8b, 0x8b, 0x8b, 0x3f, 0x3f, 0x3f, 0x3d, 0x1a, 0x1a, 0x1a, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x1a, 0x1a, 0x1d, 0x4b, 0x4b, 0x4b, 0x4b, 0x99, 0x99, 0x99, 0x98, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xf8, 0xea, 0xf8, 0xff, 0xec, 0xc6, 0xeb, 0xff, 0xea, 0xae, 0xe8, 0xff, 0xf2, 0xab, 0xf0, 0xff, 0xf8, 0xae, 0xf8, 0xff, 0xf8, 0xab, 0xf8, 0xff, 0xf4, 0xa7, 0xf4, 0xff, 0xf6, 0xb2, 0xf4, 0xff, 0xfd, 0xcb, 0xfc, 0xff, 0xf9, 0xce, 0xf9, 0xff, 0xe9, 0xb9, 0xea, 0xff, 0xea, 0xb0, 0xea, 0xff, 0xf6, 0xbc, 0xf5, 0xff, 0xf9, 0xcb, 0xf9, 0xff, 0xf6, 0xcd, 0xf7, 0xff, 0xf3, 0xc7, 0xf4, 0xff, 0xf2, 0xc0, 0xf2, 0xff, 0xf3, 0xbb, 0xf4, 0xff, 0xf4, 0xb6, 0xf4, 0xff, 0xf4, 0xb4, 0xf3, 0xff, 0xf8, 0xb7, 0xf7, 0xff, 0xfa, 0xc9, 0xf9, 0xff, 0xfd, 0xe1, 0xfc, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xb9, 0xb9, 0xb9, 0x5d, 0x5d, 0x5d, 0x5d, 0x28, 0x28, 0x28, 0x26, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x18, 0x3d, 0x3d, 0x3d, 0x3b, 0x7e, 0x7e, 0x7e, 0x7f, 0xde, 0xde, 0xde, 0xde, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xec, 0xf8, 0xff, 0xec, 0xc8, 0xeb, 0xff, 0xe9, 0xb0, 0xe7, 0xff, 0xf1, 0xaa, 0xef, 0xff, 0xf5, 0xaa, 0xf3, 0xff, 0xf2, 0xa8, 0xf1, 0xff, 0xf2, 0xa8, 0xf2, 0xff, 0xf5, 0xb3, 0xf6, 0xff, 0xfb, 0xd1, 0xfb, 0xff, 0xfa, 0xdd, 0xfa, 0xff, 0xeb, 0xc4, 0xec, 0xff, 0xe6, 0xb8, 0xe7, 0xff, 0xf5, 0xcd, 0xf5, 0xff, 0xfe, 0xd9, 0xfe, 0xff, 0xfa, 0xd3, 0xfa, 0xff, 0xfa, 0xcc, 0xf9, 0xff, 0xfe, 0xcb, 0xfd, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xfd, 0xd8, 0xfd, 0xff, 0xfe, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0xec, 0x82, 0x82, 0x82, 0x83, 0x3a, 0x3a, 0x3a, 0x39, 0x0d, 0x0d, 0x0d, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x0e, 0x0e, 0x0e, 0x12, 0x1a, 0x1a, 0x1a, 0x1d, 0x21, 0x21, 0x21, 0x1f, 0x22, 0x22, 0x22, 0x25, 0x3d, 0x3d, 0x3d, 0x3b, 0x6d, 0x6d, 0x6d, 0x6c, 0xc1, 0xc1, 0xc1, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xf4, 0xda, 0xf3, 0xff, 0xf0, 0xc2, 0xee, 0xff, 0xf5, 0xc5, 0xf4, 0xff, 0xf9, 0xc7, 0xf8, 0xff, 0xf9, 0xc6, 0xf8, 0xff, 0xf6, 0xc1, 0xf5, 0xff, 0xf6, 0xc2, 0xf6, 0xff, 0xfb, 0xd4, 0xfb, 0xff, 0xff, 0xe9, 0xff, 0xff, 0xed, 0xdb, 0xef, 0xff, 0xe5, 0xc5, 0xe7, 0xff, 0xf6, 0xd1, 0xf7, 0xff, 0xf6, 0xd6, 0xf7, 0xff, 0xed, 0xc9, 0xec, 0xff, 0xee, 0xb8, 0xec, 0xff, 0xf4, 0xb0, 0xf1, 0xff, 0xf9, 0xb0, 0xf5, 0xff, 0xf8, 0xb5, 0xf6, 0xff, 0xf6, 0xbb, 0xf5, 0xff, 0xf1, 0xbe, 0xf1, 0xff, 0xed, 0xc4, 0xee, 0xff, 0xeb, 0xc3, 0xec, 0xff, 0xee, 0xbf, 0xef, 0xff, 0xf8, 0xdd, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xda, 0xda, 0xda, 0x6b, 0x6b, 0x6b, 0x6b, 0x26, 0x26, 0x26, 0x28, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x14, 0x14, 0x14, 0x19, 0x33, 0x33, 0x33, 0x32, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x52, 0x5b, 0x5b, 0x5b, 0x5c, 0x78, 0x78, 0x78, 0x77, 0xaf, 0xaf, 0xaf, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfa, 0xe3, 0xfa, 0xff, 0xfc, 0xdb, 0xfc, 0xff, 0xff, 0xdc, 0xfe, 0xff, 0xff, 0xd9, 0xfd, 0xff, 0xfe, 0xd5, 0xfc, 0xff, 0xfe, 0xd8, 0xfd, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xfb, 0xeb, 0xfb, 0xff, 0xed, 0xd9, 0xee, 0xff, 0xf0, 0xd3, 0xf1, 0xff, 0xf7, 0xcf, 0xf8, 0xff, 0xea, 0xbb, 0xeb, 0xff, 0xe7, 0xb1, 0xe6, 0xff, 0xee, 0xad, 0xec, 0xff, 0xf6, 0xaa, 0xf3, 0xff, 0xf8, 0xa9, 0xf4, 0xff, 0xf6, 0xab, 0xf3, 0xff, 0xf3, 0xac, 0xf0, 0xff, 0xed, 0xac, 0xec, 0xff, 0xe6, 0xac, 0xe7, 0xff, 0xe3, 0xac, 0xe4, 0xff, 0xeb, 0xaf, 0xeb, 0xff, 0xf8, 0xd9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0x6a, 0x6a, 0x6a, 0x6a, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x0f, 0x0f, 0x11, 0x30, 0x30, 0x30, 0x30, 0x61, 0x61, 0x61, 0x61, 0x9a, 0x9a, 0x9a, 0x9a, 0x9e, 0x9e, 0x9e, 0x9d, 0xa9, 0xa9, 0xa9, 0xa9, 0xc7, 0xc7, 0xc7, 0xc7, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xf3, 0xfb, 0xff, 0xf2, 0xe2, 0xf2, 0xff, 0xec, 0xd3, 0xec, 0xff, 0xec, 0xca, 0xec, 0xff, 0xef, 0xc2, 0xec, 0xff, 0xef, 0xbc, 0xeb, 0xff, 0xf1, 0xbe, 0xee, 0xff, 0xf9, 0xd3, 0xf7, 0xff, 0xfa, 0xe2, 0xfa, 0xff, 0xf5, 0xe0, 0xf5, 0xff, 0xf6, 0xe5, 0xf7, 0xff, 0xf9, 0xe5, 0xfa, 0xff, 0xf4, 0xd2, 0xf5, 0xff, 0xe9, 0xb6, 0xea, 0xff, 0xeb, 0xac, 0xeb, 0xff, 0xf4, 0xac, 0xf3, 0xff, 0xf9, 0xab, 0xf8, 0xff, 0xfc, 0xa9, 0xf9, 0xff, 0xfc, 0xaa, 0xf9, 0xff, 0xfa, 0xab, 0xf7, 0xff, 0xfa, 0xab, 0xf6, 0xff, 0xfa, 0xac, 0xf7, 0xff, 0xf8, 0xac, 0xf6, 0xff, 0xf6, 0xaa, 0xf5, 0xff, 0xf7, 0xac, 0xf6, 0xff, 0xfd, 0xcb, 0xfc, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xf2, 0x77, 0x77, 0x77, 0x76, 0x2b, 0x2b, 0x2b, 0x2a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x1d, 0x1d, 0x1a, 0x48, 0x48, 0x48, 0x47, 0x8f, 0x8f, 0x8f, 0x8f, 0xe2, 0xe2, 0xe2, 0xe2, 0xed, 0xeb, 0xec, 0xed, 0xf7, 0xf0, 0xf6, 0xf9, 0xfb, 0xf0, 0xfa, 0xff, 0xfa, 0xe7, 0xf8, 0xff, 0xf8, 0xdd, 0xf6, 0xff, 0xf3, 0xcd, 0xf1, 0xff, 0xea, 0xbb, 0xe8, 0xff, 0xe5, 0xb1, 0xe4, 0xff, 0xe6, 0xae, 0xe5, 0xff, 0xe9, 0xac, 0xe7, 0xff, 0xe9, 0xad, 0xe6, 0xff, 0xef, 0xc2, 0xec, 0xff, 0xf6, 0xda, 0xf6, 0xff, 0xee, 0xcc, 0xee, 0xff, 0xea, 0xbf, 0xe9, 0xff, 0xf7, 0xde, 0xf7, 0xff, 0xfa, 0xea, 0xfa, 0xff, 0xea, 0xc6, 0xeb, 0xff, 0xe8, 0xad, 0xe9, 0xff, 0xf5, 0xac, 0xf5, 0xff, 0xf8, 0xa7, 0xf7, 0xff, 0xfa, 0xa6, 0xf7, 0xff, 0xfc, 0xa9, 0xf9, 0xff, 0xfe, 0xab, 0xfb, 0xff, 0xfc, 0xa9, 0xf9, 0xff, 0xfb, 0xa8, 0xf7, 0xff, 0xfd, 0xaa, 0xf9, 0xff, 0xfd, 0xaa, 0xfa, 0xff, 0xfc, 0xaa, 0xf9, 0xff, 0xfb, 0xa8, 0xf7, 0xff, 0xfc, 0xb5, 0xf9, 0xff, 0xff, 0xe2, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x85, 0x85, 0x86, 0x32, 0x32, 0x32, 0x33, 0x14, 0x14, 0x14, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1a, 0x1a, 0x1a, 0x1d, 0x50, 0x50, 0x50, 0x50, 0xa2, 0xa2, 0xa2, 0xa2, 0xfe, 0xfe, 0xfe, 0xff, 0xf7, 0xf3, 0xf6, 0xff, 0xeb, 0xdf, 0xea, 0xff, 0xe5, 0xce, 0xe3, 0xff, 0xe6, 0xbf, 0xe2, 0xff, 0xe9, 0xb3, 0xe5, 0xff, 0xee, 0xad, 0xe9, 0xff, 0xf2, 0xab, 0xee, 0xff, 0xf4, 0xab, 0xf2, 0xff, 0xf3, 0xa9, 0xf2, 0xff, 0xf1, 0xa7, 0xf0, 0xff, 0xf4, 0xb5, 0xf3, 0xff, 0xfc, 0xd5, 0xfb, 0xff, 0xf0, 0xd4, 0xf1, 0xff, 0xe4, 0xb4, 0xe5, 0xff, 0xed, 0xaf, 0xec, 0xff, 0xf9, 0xd6, 0xf8, 0xff, 0xf6, 0xe6, 0xf6, 0xff, 0xe8, 0xc0, 0xe9, 0xff, 0xef, 0xab, 0xf1, 0xff, 0xfa, 0xaa, 0xfa, 0xff, 0xfa, 0xa8, 0xf8, 0xff, 0xfa, 0xa7, 0xf6, 0xff, 0xfb, 0xa9, 0xf6, 0xff, 0xfe, 0xab, 0xf9, 0xff, 0xfd, 0xaa, 0xf8, 0xff, 0xfc, 0xa9, 0xf8, 0xff, 0xfe, 0xaa, 0xfa, 0xff, 0xfe, 0xab, 0xfa, 0xff, 0xfe, 0xaa, 0xf9, 0xff, 0xfc, 0xa7, 0xf8, 0xff, 0xfa, 0xab, 0xf6, 0xff, 0xfb, 0xd7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x9a, 0x9a, 0x9a, 0x41, 0x41, 0x41, 0x3f, 0x0e, 0x0e, 0x0e, 0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x1d, 0x1d, 0x1a, 0x48, 0x48, 0x48, 0x47, 0x8f, 0x8f, 0x8f, 0x8f, 0xe7, 0xe7, 0xe7, 0xe8, 0xed, 0xeb, 0xed, 0xf5, 0xed, 0xe8, 0xed, 0xff, 0xe9, 0xdd, 0xe8, 0xff, 0xec, 0xd7, 0xea, 0xff, 0xef, 0xca, 0xec, 0xff, 0xf2, 0xba, 0xee, 0xff, 0xf6, 0xb4, 0xf2, 0xff, 0xf8, 0xb3, 0xf6, 0xff, 0xf7, 0xb3, 0xf6, 0xff, 0xf6, 0xb8, 0xf6, 0xff, 0xfa, 0xce, 0xfa, 0xff, 0xf9, 0xd3, 0xf9, 0xff, 0xe8, 0xb8, 0xe9, 0xff, 0xe9, 0xad, 0xe9, 0xff, 0xf0, 0xae, 0xef, 0xff, 0xf4, 0xca, 0xf3, 0xff, 0xfa, 0xe3, 0xfa, 0xff, 0xf0, 0xc4, 0xf0, 0xff, 0xf2, 0xaa, 0xf3, 0xff, 0xfb, 0xaa, 0xfa, 0xff, 0xf9, 0xa9, 0xf5, 0xff, 0xfa, 0xab, 0xf4, 0xff, 0xfc, 0xac, 0xf5, 0xff, 0xfc, 0xab, 0xf5, 0xff, 0xfe, 0xac, 0xf8, 0xff, 0xff, 0xac, 0xf9, 0xff, 0xfe, 0xab, 0xf9, 0xff, 0xfe, 0xa9, 0xf8, 0xff, 0xfe, 0xa8, 0xfa, 0xff, 0xfe, 0xa8, 0xfb, 0xff, 0xf8, 0xa8, 0xf5, 0xff, 0xf9, 0xd5, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xb8, 0xb8, 0xb8, 0x52, 0x52, 0x52, 0x51, 0x1c, 0x1c, 0x1c, 0x1b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x0f, 0x0f, 0x11, 0x30, 0x30, 0x30, 0x30, 0x61, 0x61, 0x61, 0x61, 0x9f, 0x9f, 0x9f, 0x9f, 0xaf, 0xaf, 0xaf, 0xaf, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfc, 0xe6, 0xfa, 0xff, 0xfc, 0xde, 0xfa, 0xff, 0xfc, 0xd3, 0xfb, 0xff, 0xfc, 0xc8, 0xfb, 0xff, 0xfe, 0xd2, 0xfd, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xf5, 0xc6, 0xf5, 0xff, 0xee, 0xaa, 0xee, 0xff, 0xf4, 0xab, 0xf3, 0xff, 0xee, 0xab, 0xed, 0xff, 0xed, 0xbb, 0xec, 0xff, 0xf9, 0xdc, 0xf9, 0xff, 0xf8, 0xcf, 0xf8, 0xff, 0xf3, 0xae, 0xf2, 0xff, 0xf7, 0xab, 0xf5, 0xff, 0xf7, 0xaa, 0xf2, 0xff, 0xf7, 0xaa, 0xf1, 0xff, 0xfa, 0xad, 0xf3, 0xff, 0xfb, 0xab, 0xf4, 0xff, 0xfd, 0xab, 0xf6, 0xff, 0xfe, 0xab, 0xf8, 0xff, 0xfe, 0xab, 0xf8, 0xff, 0xfe, 0xa8, 0xf8, 0xff, 0xfe, 0xa7, 0xfa, 0xff, 0xff, 0xaa, 0xfd, 0xff, 0xf8, 0xaa, 0xf6, 0xff, 0xf8, 0xd4, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xde, 0xde, 0xde, 0xde, 0x6d, 0x6d, 0x6d, 0x6c, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x14, 0x14, 0x14, 0x19, 0x36, 0x36, 0x36, 0x34, 0x5b, 0x5b, 0x5b, 0x5a, 0x73, 0x73, 0x73, 0x73, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfa, 0xe2, 0xf8, 0xff, 0xf8, 0xcd, 0xf6, 0xff, 0xf6, 0xbd, 0xf4, 0xff, 0xfa, 0xd1, 0xf8, 0xff, 0xfa, 0xdc, 0xf9, 0xff, 0xf2, 0xbc, 0xf0, 0xff, 0xf5, 0xaa, 0xf4, 0xff, 0xf9, 0xa9, 0xf8, 0xff, 0xf4, 0xa9, 0xf4, 0xff, 0xf1, 0xae, 0xef, 0xff, 0xf6, 0xc9, 0xf5, 0xff, 0xfd, 0xda, 0xfd, 0xff, 0xf1, 0xc0, 0xf1, 0xff, 0xee, 0xac, 0xed, 0xff, 0xf8, 0xab, 0xf5, 0xff, 0xfa, 0xab, 0xf6, 0xff, 0xf7, 0xab, 0xf3, 0xff, 0xf9, 0xa9, 0xf4, 0xff, 0xfe, 0xaa, 0xf8, 0xff, 0xfe, 0xab, 0xf9, 0xff, 0xff, 0xaa, 0xf9, 0xff, 0xff, 0xaa, 0xfa, 0xff, 0xff, 0xab, 0xfc, 0xff, 0xfe, 0xa9, 0xfc, 0xff, 0xf8, 0xaa, 0xf6, 0xff, 0xf9, 0xc9, 0xf8, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x8e, 0x8e, 0x8e, 0x39, 0x39, 0x39, 0x3a, 0x0f, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x18, 0x36, 0x36, 0x36, 0x34, 0x5b, 0x5b, 0x5b, 0x5c, 0xa3, 0xa3, 0xa3, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xef, 0xf5, 0xff, 0xeb, 0xd2, 0xea, 0xff, 0xed, 0xbd, 0xea, 0xff, 0xef, 0xaf, 0xec, 0xff, 0xf3, 0xb1, 0xf1, 0xff, 0xfa, 0xd3, 0xf9, 0xff, 0xf2, 0xd5, 0xf1, 0xff, 0xea, 0xb5, 0xe7, 0xff, 0xf5, 0xaa, 0xf3, 0xff, 0xfc, 0xa9, 0xfb, 0xff, 0xfc, 0xa9, 0xfb, 0xff, 0xfa, 0xa8, 0xf7, 0xff, 0xfa, 0xb4, 0xf7, 0xff, 0xfd, 0xd5, 0xfc, 0xff, 0xf6, 0xd6, 0xf6, 0xff, 0xec, 0xb4, 0xeb, 0xff, 0xf5, 0xa9, 0xf3, 0xff, 0xfb, 0xac, 0xf9, 0xff, 0xf7, 0xaa, 0xf4, 0xff, 0xf8, 0xa8, 0xf5, 0xff, 0xfd, 0xa9, 0xf9, 0xff, 0xff, 0xaa, 0xfa, 0xff, 0xff, 0xaa, 0xf9, 0xff, 0xfe, 0xaa, 0xf8, 0xff, 0xfd, 0xa9, 0xf8, 0xff, 0xfd, 0xa9, 0xf9, 0xff, 0xf9, 0xa9, 0xf7, 0xff, 0xfa, 0xba, 0xf9, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xba, 0xba, 0xba, 0x56, 0x56, 0x56, 0x56, 0x1a, 0x1a, 0x1a, 0x1e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x16, 0x16, 0x16, 0x17, 0x39, 0x39, 0x39, 0x3a, 0x75, 0x75, 0x75, 0x74, 0xc8, 0xc8, 0xc8, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xf9, 0xff, 0xe7, 0xcc, 0xe8, 0xff, 0xe1, 0xb4, 0xe0, 0xff, 0xea, 0xb0, 0xe7, 0xff, 0xf0, 0xab, 0xed, 0xff, 0xf8, 0xc1, 0xf7, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xec, 0xcf, 0xec, 0xff, 0xe4, 0xb0, 0xe3, 0xff, 0xf6, 0xaa, 0xf4, 0xff, 0xfe, 0xaa, 0xfb, 0xff, 0xfd, 0xa9, 0xfa, 0xff, 0xfc, 0xa8, 0xfa, 0xff, 0xf8, 0xaa, 0xf7, 0xff, 0xf6, 0xbf, 0xf7, 0xff, 0xf9, 0xda, 0xfa, 0xff, 0xf6, 0xcb, 0xf5, 0xff, 0xef, 0xaf, 0xed, 0xff, 0xf2, 0xa9, 0xf0, 0xff, 0xf7, 0xaa, 0xf5, 0xff, 0xfa, 0xa9, 0xf7, 0xff, 0xfe, 0xab, 0xfb, 0xff, 0xfd, 0xaa, 0xf9, 0xff, 0xfe, 0xaa, 0xf9, 0xff, 0xfe, 0xab, 0xf8, 0xff, 0xfb, 0xa8, 0xf6, 0xff, 0xfc, 0xa9, 0xf8, 0xff, 0xfb, 0xaa, 0xf8, 0xff, 0xfa, 0xaf, 0xf7, 0xff, 0xfd, 0xd2, 0xfc, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xef, 0xef, 0xef, 0xef, 0x7c, 0x7c, 0x7c, 0x7d, 0x32, 0x32, 0x32, 0x33, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x0f, 0x0f, 0x11, 0x2c, 0x2c, 0x2c, 0x2e, 0x65, 0x65, 0x65, 0x65, 0xaf, 0xaf, 0xaf, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf4, 0xf9, 0xff, 0xeb, 0xd1, 0xec, 0xff, 0xe7, 0xb3, 0xe7, 0xff, 0xf0, 0xaf, 0xee, 0xff, 0xf3, 0xad, 0xee, 0xff, 0xf5, 0xb3, 0xf2, 0xff, 0xfc, 0xd3, 0xfb, 0xff, 0xfd, 0xe5, 0xfe, 0xff, 0xe8, 0xc7, 0xeb, 0xff, 0xe3, 0xae, 0xe4, 0xff, 0xf7, 0xab, 0xf5, 0xff, 0xfd, 0xaa, 0xf8, 0xff, 0xfd, 0xaa, 0xf7, 0xff, 0xfb, 0xa9, 0xf9, 0xff, 0xf7, 0xa9, 0xf7, 0xff, 0xf1, 0xae, 0xf2, 0xff, 0xf6, 0xc6, 0xf7, 0xff, 0xfd, 0xd9, 0xfd, 0xff, 0xf6, 0xc8, 0xf4, 0xff, 0xf2, 0xb4, 0xef, 0xff, 0xf5, 0xad, 0xf2, 0xff, 0xf9, 0xad, 0xf7, 0xff, 0xfd, 0xae, 0xfb, 0xff, 0xfb, 0xaa, 0xf8, 0xff, 0xfc, 0xa9, 0xf8, 0xff, 0xfd, 0xab, 0xf9, 0xff, 0xfd, 0xaa, 0xf9, 0xff, 0xfc, 0xa8, 0xf8, 0xff, 0xfd, 0xaa, 0xf9, 0xff, 0xfb, 0xaa, 0xf7, 0xff, 0xfc, 0xbc, 0xf9, 0xff, 0xff, 0xe6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xaf, 0xb0, 0x51, 0x51, 0x51, 0x52, 0x1a, 0x1a, 0x1a, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x22, 0x22, 0x22, 0x25, 0x59, 0x59, 0x59, 0x59, 0xab, 0xab, 0xab, 0xab, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfa, 0xfe, 0xff, 0xf1, 0xde, 0xf1, 0xff, 0xe6, 0xba, 0xe6, 0xff, 0xef, 0xac, 0xee, 0xff, 0xf7, 0xaa, 0xf5, 0xff, 0xf8, 0xae, 0xf5, 0xff, 0xfb, 0xc8, 0xfa, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xf9, 0xe1, 0xfa, 0xff, 0xe7, 0xc1, 0xe9, 0xff, 0xe7, 0xae, 0xe6, 0xff, 0xf8, 0xab, 0xf4, 0xff, 0xfd, 0xaa, 0xf7, 0xff, 0xfc, 0xa9, 0xf5, 0xff, 0xfc, 0xaa, 0xf7, 0xff, 0xfa, 0xab, 0xf7, 0xff, 0xf4, 0xab, 0xf2, 0xff, 0xf3, 0xb1, 0xf1, 0xff, 0xf9, 0xc8, 0xf7, 0xff, 0xff, 0xe0, 0xfe, 0xff, 0xfc, 0xe0, 0xfb, 0xff, 0xf6, 0xca, 0xf4, 0xff, 0xf4, 0xb4, 0xf1, 0xff, 0xf5, 0xab, 0xf3, 0xff, 0xf9, 0xa9, 0xf6, 0xff, 0xfc, 0xaa, 0xf9, 0xff, 0xfc, 0xa9, 0xf9, 0xff, 0xfd, 0xab, 0xfb, 0xff, 0xfc, 0xaa, 0xfa, 0xff, 0xfc, 0xa9, 0xf8, 0xff, 0xfd, 0xa9, 0xf9, 0xff, 0xf9, 0xac, 0xf5, 0xff, 0xfb, 0xd1, 0xf9, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xeb, 0x78, 0x78, 0x78, 0x79, 0x30, 0x30, 0x30, 0x30, 0x12, 0x12, 0x12, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x1a, 0x1a, 0x14, 0x3f, 0x3f, 0x3f, 0x3d, 0x8a, 0x8a, 0x8a, 0x89, 0xf5, 0xf5, 0xf5, 0xf5, 0xff, 0xfd, 0xff, 0xff, 0xf7, 0xe7, 0xf7, 0xff, 0xe9, 0xc3, 0xe8, 0xff, 0xea, 0xb0, 0xe9, 0xff, 0xf4, 0xab, 0xf2, 0xff, 0xf9, 0xad, 0xf8, 0xff, 0xfd, 0xc1, 0xfc, 0xff, 0xfc, 0xd7, 0xfc, 0xff, 0xfa, 0xe1, 0xfa, 0xff, 0xf6, 0xd7, 0xf5, 0xff, 0xe9, 0xbc, 0xe7, 0xff, 0xea, 0xad, 0xe6, 0xff, 0xf7, 0xac, 0xf2, 0xff, 0xfd, 0xab, 0xf7, 0xff, 0xfb, 0xa9, 0xf6, 0xff, 0xfa, 0xa8, 0xf4, 0xff, 0xfa, 0xab, 0xf6, 0xff, 0xfa, 0xad, 0xf6, 0xff, 0xf5, 0xab, 0xf0, 0xff, 0xf5, 0xb8, 0xf3, 0xff, 0xfe, 0xe4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf1, 0xfc, 0xff, 0xf8, 0xd1, 0xf6, 0xff, 0xf2, 0xb4, 0xf0, 0xff, 0xf3, 0xaa, 0xf0, 0xff, 0xfb, 0xab, 0xf8, 0xff, 0xfc, 0xa9, 0xf9, 0xff, 0xfd, 0xaa, 0xfb, 0xff, 0xfd, 0xab, 0xfb, 0xff, 0xfc, 0xa9, 0xf9, 0xff, 0xfe, 0xaa, 0xfa, 0xff, 0xf7, 0xa7, 0xf3, 0xff, 0xf6, 0xba, 0xf2, 0xff, 0xfd, 0xe8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xa5, 0xa5, 0xa5, 0x47, 0x47, 0x47, 0x48, 0x16, 0x16, 0x16, 0x17, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1b, 0x1b, 0x1b, 0x1c, 0x52, 0x52, 0x52, 0x51, 0xae, 0xae, 0xae, 0xae, 0xff, 0xfe, 0xff, 0xff, 0xf5, 0xea, 0xf5, 0xff, 0xe7, 0xc3, 0xe6, 0xff, 0xe8, 0xad, 0xe8, 0xff, 0xf0, 0xad, 0xef, 0xff, 0xf7, 0xb8, 0xf6, 0xff, 0xfd, 0xca, 0xfd, 0xff, 0xfa, 0xd1, 0xfa, 0xff, 0xef, 0xc6, 0xee, 0xff, 0xf2, 0xc9, 0xf2, 0xff, 0xfa, 0xcf, 0xf9, 0xff, 0xee, 0xba, 0xec, 0xff, 0xea, 0xab, 0xe8, 0xff, 0xf4, 0xab, 0xf2, 0xff, 0xf8, 0xab, 0xf6, 0xff, 0xf9, 0xab, 0xf8, 0xff, 0xf9, 0xa9, 0xf6, 0xff, 0xfc, 0xab, 0xf9, 0xff, 0xfc, 0xac, 0xfa, 0xff, 0xf6, 0xaa, 0xf3, 0xff, 0xf8, 0xbf, 0xf6, 0xff, 0xfe, 0xe9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfe, 0xff, 0xf7, 0xd3, 0xf5, 0xff, 0xef, 0xb7, 0xec, 0xff, 0xf4, 0xad, 0xf0, 0xff, 0xfa, 0xaa, 0xf6, 0xff, 0xfc, 0xa9, 0xf9, 0xff, 0xfe, 0xa9, 0xfb, 0xff, 0xfd, 0xaa, 0xf9, 0xff, 0xfd, 0xaa, 0xf9, 0xff, 0xfa, 0xa9, 0xf7, 0xff, 0xf6, 0xad, 0xf2, 0xff, 0xfb, 0xd6, 0xf9, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xcb, 0xcb, 0xcb, 0xcb, 0x5f, 0x5f, 0x5f, 0x5e, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x21, 0x21, 0x21, 0x1f, 0x58, 0x58, 0x58, 0x57, 0xb4, 0xb4, 0xb4, 0xb4, 0xf9, 0xf6, 0xf9, 0xff, 0xed, 0xda, 0xed, 0xff, 0xec, 0xc8, 0xeb, 0xff, 0xf6, 0xcf, 0xf6, 0xff, 0xfa, 0xd7, 0xfa, 0xff, 0xfc, 0xe2, 0xfc, 0xff, 0xf8, 0xdd, 0xf8, 0xff, 0xea, 0xc1, 0xe9, 0xff, 0xe5, 0xb0, 0xe4, 0xff, 0xf3, 0xc5, 0xf2, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xf0, 0xbe, 0xf0, 0xff, 0xea, 0xac, 0xea, 0xff, 0xf2, 0xab, 0xf3, 0xff, 0xf2, 0xa9, 0xf5, 0xff, 0xf4, 0xaa, 0xf7, 0xff, 0xfa, 0xab, 0xfa, 0xff, 0xfe, 0xab, 0xfb, 0xff, 0xfd, 0xaa, 0xfb, 0xff, 0xf9, 0xad, 0xf7, 0xff, 0xfa, 0xd1, 0xfa, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xfb, 0xff, 0xf4, 0xd3, 0xf2, 0xff, 0xee, 0xb4, 0xea, 0xff, 0xf5, 0xab, 0xf1, 0xff, 0xfc, 0xaa, 0xf9, 0xff, 0xfe, 0xa9, 0xfa, 0xff, 0xfe, 0xaa, 0xf9, 0xff, 0xfb, 0xa9, 0xf7, 0xff, 0xfc, 0xac, 0xf9, 0xff, 0xf8, 0xaa, 0xf5, 0xff, 0xf9, 0xc5, 0xf7, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0xe1, 0x6b, 0x6b, 0x6b, 0x6b, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x1d, 0x1d, 0x1a, 0x48, 0x48, 0x48, 0x4a, 0x96, 0x96, 0x96, 0x97, 0xf1, 0xed, 0xf1, 0xf7, 0xf7, 0xec, 0xf7, 0xff, 0xfc, 0xf1, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf2, 0xfa, 0xff, 0xed, 0xcc, 0xeb, 0xff, 0xe6, 0xb0, 0xe3, 0xff, 0xee, 0xb1, 0xeb, 0xff, 0xf9, 0xce, 0xf8, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xef, 0xcb, 0xef, 0xff, 0xe9, 0xb0, 0xe9, 0xff, 0xf4, 0xab, 0xf6, 0xff, 0xf5, 0xa8, 0xf8, 0xff, 0xf4, 0xa8, 0xf7, 0xff, 0xf8, 0xa8, 0xf8, 0xff, 0xfe, 0xaa, 0xfa, 0xff, 0xfd, 0xaa, 0xf9, 0xff, 0xfb, 0xb3, 0xf8, 0xff, 0xfd, 0xdd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xdc, 0xdc, 0xdd, 0xac, 0xac, 0xac, 0xac, 0xc1, 0xc1, 0xc1, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf1, 0xfa, 0xff, 0xef, 0xcc, 0xec, 0xff, 0xee, 0xaf, 0xea, 0xff, 0xf9, 0xab, 0xf6, 0xff, 0xfe, 0xab, 0xf9, 0xff, 0xfd, 0xab, 0xf7, 0xff, 0xfc, 0xaa, 0xf7, 0xff, 0xfa, 0xaa, 0xf7, 0xff, 0xf9, 0xab, 0xf7, 0xff, 0xfd, 0xc3, 0xfc, 0xff, 0xff, 0xec, 0xff, 0xff, 0xdc, 0xdc, 0xdc, 0xdd, 0x6a, 0x6a, 0x6a, 0x6a, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x0e, 0x0e, 0x12, 0x2f, 0x2f, 0x2f, 0x31, 0x63, 0x63, 0x63, 0x64, 0xa5, 0xa5, 0xa5, 0xa5, 0xc3, 0xc3, 0xc3, 0xc3, 0xfa, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf3, 0xe0, 0xf2, 0xff, 0xea, 0xb9, 0xe7, 0xff, 0xf0, 0xad, 0xeb, 0xff, 0xf5, 0xb0, 0xf1, 0xff, 0xfb, 0xd1, 0xf9, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf1, 0xd8, 0xf0, 0xff, 0xe9, 0xb6, 0xe8, 0xff, 0xf5, 0xa8, 0xf5, 0xff, 0xfb, 0xa8, 0xfb, 0xff, 0xfb, 0xaa, 0xfb, 0xff, 0xfb, 0xa9, 0xf9, 0xff, 0xfd, 0xaa, 0xf9, 0xff, 0xfa, 0xa9, 0xf5, 0xff, 0xfa, 0xb5, 0xf7, 0xff, 0xff, 0xe2, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xb9, 0xb9, 0xb9, 0x77, 0x77, 0x77, 0x78, 0x7d, 0x7d, 0x7d, 0x7e, 0xc1, 0xc1, 0xc1, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe7, 0xf6, 0xff, 0xed, 0xbd, 0xeb, 0xff, 0xf1, 0xaa, 0xee, 0xff, 0xf9, 0xaa, 0xf4, 0xff, 0xfc, 0xac, 0xf5, 0xff, 0xfa, 0xaa, 0xf5, 0xff, 0xf7, 0xa8, 0xf4, 0xff, 0xf9, 0xb3, 0xf9, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xbf, 0xbf, 0xbf, 0x59, 0x59, 0x59, 0x59, 0x21, 0x21, 0x21, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x14, 0x14, 0x14, 0x19, 0x35, 0x35, 0x35, 0x35, 0x5f, 0x5f, 0x5f, 0x5e, 0x85, 0x85, 0x85, 0x86, 0xd2, 0xd2, 0xd2, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xfc, 0xff, 0xee, 0xcf, 0xec, 0xff, 0xeb, 0xb2, 0xe7, 0xff, 0xf6, 0xad, 0xf1, 0xff, 0xf8, 0xb1, 0xf2, 0xff, 0xfb, 0xd2, 0xf8, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf7, 0xe3, 0xf6, 0xff, 0xef, 0xbc, 0xed, 0xff, 0xf6, 0xa7, 0xf4, 0xff, 0xfd, 0xa7, 0xfc, 0xff, 0xfe, 0xab, 0xfd, 0xff, 0xff, 0xac, 0xfc, 0xff, 0xfc, 0xa9, 0xf8, 0xff, 0xf9, 0xa5, 0xf5, 0xff, 0xfc, 0xb6, 0xf9, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb6, 0xb6, 0xb6, 0x63, 0x63, 0x63, 0x64, 0x55, 0x55, 0x55, 0x54, 0x82, 0x82, 0x82, 0x83, 0xde, 0xde, 0xde, 0xde, 0xfe, 0xf8, 0xfd, 0xff, 0xf3, 0xd5, 0xf2, 0xff, 0xeb, 0xb2, 0xe9, 0xff, 0xf3, 0xaa, 0xef, 0xff, 0xf8, 0xa8, 0xf4, 0xff, 0xf9, 0xab, 0xf6, 0xff, 0xfa, 0xb6, 0xf9, 0xff, 0xfd, 0xd0, 0xfc, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0x8e, 0x8e, 0x8e, 0x8e, 0x41, 0x41, 0x41, 0x3f, 0x18, 0x18, 0x18, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x16, 0x16, 0x16, 0x17, 0x35, 0x35, 0x35, 0x35, 0x68, 0x68, 0x68, 0x69, 0xc8, 0xc8, 0xc8, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe6, 0xf7, 0xff, 0xea, 0xbd, 0xe9, 0xff, 0xee, 0xae, 0xec, 0xff, 0xf7, 0xad, 0xf3, 0xff, 0xf8, 0xb3, 0xf3, 0xff, 0xfc, 0xd5, 0xf9, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xfe, 0xec, 0xfd, 0xff, 0xf5, 0xc7, 0xf4, 0xff, 0xf7, 0xaa, 0xf5, 0xff, 0xfe, 0xa9, 0xfc, 0xff, 0xfe, 0xa9, 0xfc, 0xff, 0xfd, 0xaa, 0xfa, 0xff, 0xfb, 0xa9, 0xf7, 0xff, 0xfb, 0xa5, 0xf8, 0xff, 0xfd, 0xb0, 0xfb, 0xff, 0xfe, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xd6, 0xd6, 0xd6, 0x76, 0x76, 0x76, 0x75, 0x47, 0x47, 0x47, 0x48, 0x58, 0x58, 0x58, 0x57, 0x9a, 0x9a, 0x9a, 0x9a, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xf0, 0xf9, 0xff, 0xf4, 0xd2, 0xf2, 0xff, 0xf6, 0xbe, 0xf4, 0xff, 0xfb, 0xba, 0xfa, 0xff, 0xfd, 0xcb, 0xfd, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xf6, 0xaa, 0xaa, 0xaa, 0xaa, 0x59, 0x59, 0x59, 0x59, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x26, 0x26, 0x26, 0x28, 0x67, 0x67, 0x67, 0x68, 0xd8, 0xd8, 0xd8, 0xd8, 0xfe, 0xfc, 0xfe, 0xff, 0xf4, 0xdb, 0xf3, 0xff, 0xea, 0xb2, 0xe8, 0xff, 0xf4, 0xac, 0xf2, 0xff, 0xf8, 0xac, 0xf5, 0xff, 0xf7, 0xb4, 0xf4, 0xff, 0xfe, 0xdc, 0xfc, 0xff, 0xfa, 0xea, 0xf9, 0xff, 0xfa, 0xe7, 0xf9, 0xff, 0xfb, 0xd6, 0xfb, 0xff, 0xf6, 0xb3, 0xf4, 0xff, 0xf8, 0xa8, 0xf6, 0xff, 0xfd, 0xa9, 0xfb, 0xff, 0xfd, 0xaa, 0xf9, 0xff, 0xfc, 0xaa, 0xf7, 0xff, 0xfe, 0xa9, 0xf9, 0xff, 0xfb, 0xac, 0xf7, 0xff, 0xfb, 0xd0, 0xf9, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xa3, 0xa3, 0xa3, 0x58, 0x58, 0x58, 0x57, 0x43, 0x43, 0x43, 0x41, 0x60, 0x60, 0x60, 0x60, 0xa2, 0xa2, 0xa2, 0xa1, 0xdc, 0xdc, 0xdc, 0xdc, 0xfe, 0xf5, 0xfe, 0xff, 0xfe, 0xe7, 0xfd, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xdc, 0xdc, 0xdc, 0xdc, 0x9f, 0x9f, 0x9f, 0xa0, 0x61, 0x61, 0x61, 0x61, 0x2c, 0x2c, 0x2c, 0x2e, 0x0f, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x2b, 0x2b, 0x2b, 0x2a, 0x76, 0x76, 0x76, 0x75, 0xf0, 0xf0, 0xf0, 0xf0, 0xfc, 0xf5, 0xfd, 0xff, 0xf1, 0xce, 0xf0, 0xff, 0xef, 0xad, 0xeb, 0xff, 0xf9, 0xab, 0xf6, 0xff, 0xf6, 0xaa, 0xf5, 0xff, 0xf7, 0xbd, 0xf6, 0xff, 0xff, 0xe9, 0xfe, 0xff, 0xf1, 0xdd, 0xef, 0xff, 0xf1, 0xd4, 0xf0, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xf8, 0xca, 0xf7, 0xff, 0xf1, 0xac, 0xf0, 0xff, 0xf8, 0xa8, 0xf5, 0xff, 0xfd, 0xaa, 0xf8, 0xff, 0xfc, 0xab, 0xf6, 0xff, 0xfd, 0xab, 0xf7, 0xff, 0xf9, 0xac, 0xf4, 0xff, 0xf5, 0xbc, 0xf2, 0xff, 0xfb, 0xe4, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xe2, 0xe2, 0xe2, 0xe2, 0x7b, 0x7b, 0x7b, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x3d, 0x3d, 0x3b, 0x59, 0x59, 0x59, 0x59, 0x82, 0x82, 0x82, 0x83, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0x82, 0x82, 0x82, 0x83, 0x56, 0x56, 0x56, 0x56, 0x2c, 0x2c, 0x2c, 0x2e, 0x0d, 0x0d, 0x0d, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x14, 0x14, 0x0d, 0x32, 0x32, 0x32, 0x33, 0x85, 0x85, 0x85, 0x86, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xec, 0xf9, 0xff, 0xee, 0xc3, 0xec, 0xff, 0xf3, 0xac, 0xef, 0xff, 0xfb, 0xaa, 0xf7, 0xff, 0xf8, 0xac, 0xf6, 0xff, 0xfa, 0xd0, 0xf9, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xef, 0xd0, 0xee, 0xff, 0xee, 0xbe, 0xed, 0xff, 0xfe, 0xe0, 0xfe, 0xff, 0xfc, 0xe2, 0xfc, 0xff, 0xf6, 0xc1, 0xf4, 0xff, 0xf5, 0xac, 0xf1, 0xff, 0xfb, 0xaa, 0xf5, 0xff, 0xfc, 0xaa, 0xf6, 0xff, 0xfb, 0xaa, 0xf6, 0xff, 0xf9, 0xab, 0xf5, 0xff, 0xf4, 0xae, 0xf1, 0xff, 0xf8, 0xc9, 0xf7, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xaf, 0xaf, 0x58, 0x58, 0x58, 0x57, 0x2c, 0x2c, 0x2c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2c, 0x3e, 0x3e, 0x3e, 0x3e, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x3f, 0x3f, 0x3f, 0x3d, 0x22, 0x22, 0x22, 0x25, 0x0f, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x0e, 0x0e, 0x12, 0x41, 0x41, 0x41, 0x3f, 0x9a, 0x9a, 0x9a, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe8, 0xf6, 0xff, 0xee, 0xbe, 0xec, 0xff, 0xf6, 0xab, 0xf1, 0xff, 0xfb, 0xa8, 0xf6, 0xff, 0xfa, 0xb1, 0xf8, 0xff, 0xfd, 0xde, 0xfd, 0xff, 0xfc, 0xef, 0xfc, 0xff, 0xf1, 0xc5, 0xf0, 0xff, 0xef, 0xaf, 0xee, 0xff, 0xf6, 0xc8, 0xf5, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xfd, 0xdf, 0xfc, 0xff, 0xfa, 0xc0, 0xf6, 0xff, 0xf8, 0xad, 0xf3, 0xff, 0xf9, 0xaa, 0xf5, 0xff, 0xfb, 0xab, 0xf7, 0xff, 0xfa, 0xaa, 0xf6, 0xff, 0xf8, 0xa8, 0xf5, 0xff, 0xf8, 0xb1, 0xf6, 0xff, 0xfb, 0xd9, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xeb, 0x79, 0x79, 0x79, 0x7a, 0x35, 0x35, 0x35, 0x35, 0x14, 0x14, 0x14, 0x19, 0x16, 0x16, 0x16, 0x17, 0x1a, 0x1a, 0x1a, 0x1d, 0x1a, 0x1a, 0x1a, 0x1d, 0x1a, 0x1a, 0x1a, 0x1d, 0x1a, 0x1a, 0x1a, 0x1d, 0x1a, 0x1a, 0x1a, 0x1d, 0x18, 0x18, 0x18, 0x15, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1c, 0x1c, 0x1c, 0x1b, 0x52, 0x52, 0x52, 0x51, 0xb8, 0xb8, 0xb8, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xe4, 0xf4, 0xff, 0xec, 0xba, 0xea, 0xff, 0xf6, 0xaa, 0xf2, 0xff, 0xfc, 0xab, 0xf7, 0xff, 0xfc, 0xc6, 0xfb, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0xeb, 0xf8, 0xff, 0xee, 0xc1, 0xed, 0xff, 0xef, 0xaa, 0xec, 0xff, 0xef, 0xb2, 0xee, 0xff, 0xf2, 0xcb, 0xf2, 0xff, 0xfb, 0xe0, 0xfb, 0xff, 0xfe, 0xde, 0xfc, 0xff, 0xfb, 0xc6, 0xf8, 0xff, 0xf6, 0xb0, 0xf4, 0xff, 0xf7, 0xab, 0xf4, 0xff, 0xfb, 0xab, 0xf7, 0xff, 0xfc, 0xa8, 0xf8, 0xff, 0xf8, 0xa9, 0xf5, 0xff, 0xf5, 0xc2, 0xf4, 0xff, 0xfb, 0xec, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xa5, 0xa5, 0xa5, 0x49, 0x49, 0x49, 0x49, 0x14, 0x14, 0x14, 0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x27, 0x27, 0x27, 0x27, 0x6d, 0x6d, 0x6d, 0x6c, 0xde, 0xde, 0xde, 0xde, 0xff, 0xfb, 0xff, 0xff, 0xf3, 0xdc, 0xf3, 0xff, 0xe9, 0xb4, 0xe8, 0xff, 0xf3, 0xa9, 0xf0, 0xff, 0xfb, 0xb5, 0xf9, 0xff, 0xff, 0xe1, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xf8, 0xff, 0xed, 0xc3, 0xeb, 0xff, 0xf1, 0xaa, 0xec, 0xff, 0xf6, 0xac, 0xf3, 0xff, 0xf1, 0xb3, 0xf0, 0xff, 0xee, 0xc3, 0xee, 0xff, 0xf7, 0xdc, 0xf6, 0xff, 0xff, 0xe2, 0xff, 0xff, 0xfa, 0xca, 0xf9, 0xff, 0xf5, 0xb3, 0xf1, 0xff, 0xf7, 0xac, 0xf2, 0xff, 0xfb, 0xa9, 0xf6, 0xff, 0xfa, 0xa9, 0xf7, 0xff, 0xf3, 0xb2, 0xf1, 0xff, 0xf7, 0xd9, 0xf7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xcd, 0xcd, 0xcd, 0xce, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x1f, 0x21, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x10, 0x10, 0x10, 0x37, 0x37, 0x37, 0x38, 0x8c, 0x8c, 0x8c, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xf0, 0xcf, 0xf0, 0xff, 0xe7, 0xae, 0xe6, 0xff, 0xf4, 0xae, 0xf2, 0xff, 0xfd, 0xd1, 0xfc, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf4, 0xfb, 0xff, 0xf1, 0xcc, 0xef, 0xff, 0xf3, 0xac, 0xef, 0xff, 0xfb, 0xaa, 0xf7, 0xff, 0xf6, 0xac, 0xf3, 0xff, 0xed, 0xae, 0xea, 0xff, 0xed, 0xbc, 0xeb, 0xff, 0xf9, 0xd9, 0xf9, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xfb, 0xd2, 0xfa, 0xff, 0xf3, 0xb7, 0xef, 0xff, 0xf5, 0xab, 0xf1, 0xff, 0xfb, 0xab, 0xf9, 0xff, 0xf6, 0xaa, 0xf3, 0xff, 0xf7, 0xc5, 0xf6, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xec, 0xec, 0xec, 0xec, 0x72, 0x72, 0x72, 0x72, 0x26, 0x26, 0x26, 0x28, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x15, 0x15, 0x18, 0x4c, 0x4c, 0x4c, 0x4d, 0xae, 0xae, 0xae, 0xae, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xeb, 0xfa, 0xff, 0xe8, 0xc1, 0xe8, 0xff, 0xe9, 0xb0, 0xe9, 0xff, 0xfb, 0xcc, 0xfb, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xf8, 0xdc, 0xf8, 0xff, 0xf4, 0xb2, 0xf1, 0xff, 0xf7, 0xa8, 0xf3, 0xff, 0xfa, 0xa9, 0xf6, 0xff, 0xf9, 0xac, 0xf4, 0xff, 0xf1, 0xad, 0xed, 0xff, 0xec, 0xbb, 0xea, 0xff, 0xf7, 0xda, 0xf6, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xf9, 0xd3, 0xf8, 0xff, 0xf2, 0xb5, 0xf1, 0xff, 0xf7, 0xaa, 0xf5, 0xff, 0xfa, 0xa8, 0xf8, 0xff, 0xfa, 0xb7, 0xf9, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0x7c, 0x7c, 0x7c, 0x7d, 0x2d, 0x2d, 0x2d, 0x2d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x20, 0x20, 0x20, 0x5e, 0x5e, 0x5e, 0x5f, 0xca, 0xca, 0xca, 0xca, 0xff, 0xfc, 0xff, 0xff, 0xf3, 0xdc, 0xf3, 0xff, 0xea, 0xbd, 0xea, 0xff, 0xf6, 0xce, 0xf6, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xf0, 0xfc, 0xff, 0xf4, 0xc7, 0xf2, 0xff, 0xf2, 0xab, 0xf0, 0xff, 0xfa, 0xaa, 0xf7, 0xff, 0xfe, 0xad, 0xf9, 0xff, 0xf8, 0xae, 0xf4, 0xff, 0xed, 0xad, 0xe9, 0xff, 0xed, 0xbb, 0xea, 0xff, 0xf8, 0xdb, 0xf7, 0xff, 0xff, 0xe9, 0xff, 0xff, 0xf9, 0xcf, 0xf8, 0xff, 0xf4, 0xb3, 0xf2, 0xff, 0xf8, 0xaa, 0xf5, 0xff, 0xfc, 0xb4, 0xfa, 0xff, 0xfe, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x80, 0x80, 0x81, 0x31, 0x31, 0x31, 0x2f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x22, 0x22, 0x22, 0x25, 0x67, 0x67, 0x67, 0x68, 0xd2, 0xd2, 0xd2, 0xd2, 0xfd, 0xf7, 0xfd, 0xff, 0xf4, 0xd8, 0xf4, 0xff, 0xf5, 0xd3, 0xf5, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xac, 0xac, 0xac, 0xad, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0xac, 0xac, 0xac, 0xad, 0xfc, 0xfc, 0xfc, 0xfc, 0xfa, 0xec, 0xfa, 0xff, 0xf5, 0xc4, 0xf4, 0xff, 0xf6, 0xac, 0xf4, 0xff, 0xfa, 0xad, 0xf7, 0xff, 0xf8, 0xac, 0xf3, 0xff, 0xf7, 0xab, 0xf1, 0xff, 0xf1, 0xab, 0xec, 0xff, 0xec, 0xbc, 0xea, 0xff, 0xf7, 0xde, 0xf7, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xf8, 0xcc, 0xf6, 0xff, 0xf3, 0xb0, 0xf0, 0xff, 0xfa, 0xb3, 0xf7, 0xff, 0xff, 0xde, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x81, 0x81, 0x82, 0x31, 0x31, 0x31, 0x2f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x23, 0x23, 0x23, 0x24, 0x61, 0x61, 0x61, 0x61, 0xbf, 0xbf, 0xbf, 0xbf, 0xfb, 0xf6, 0xfc, 0xff, 0xf9, 0xe9, 0xf9, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xef, 0xef, 0xef, 0xef, 0xaa, 0xaa, 0xaa, 0xaa, 0x65, 0x65, 0x65, 0x65, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x65, 0x65, 0x65, 0x65, 0xab, 0xab, 0xab, 0xab, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xec, 0xfc, 0xff, 0xfa, 0xc9, 0xf9, 0xff, 0xf9, 0xb4, 0xf7, 0xff, 0xf6, 0xab, 0xf2, 0xff, 0xf8, 0xa9, 0xf3, 0xff, 0xf8, 0xab, 0xf4, 0xff, 0xed, 0xad, 0xeb, 0xff, 0xef, 0xc1, 0xed, 0xff, 0xfb, 0xe4, 0xfb, 0xff, 0xfd, 0xe5, 0xfd, 0xff, 0xf5, 0xbe, 0xf3, 0xff, 0xf7, 0xb5, 0xf5, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x81, 0x81, 0x82, 0x31, 0x31, 0x31, 0x2f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1b, 0x1b, 0x1b, 0x1c, 0x4d, 0x4d, 0x4d, 0x4c, 0x90, 0x90, 0x90, 0x91, 0xdd, 0xda, 0xdd, 0xde, 0xe7, 0xe4, 0xe7, 0xe8, 0xc8, 0xc8, 0xc8, 0xc8, 0x9a, 0x9a, 0x9a, 0x9a, 0x61, 0x61, 0x61, 0x61, 0x2f, 0x2f, 0x2f, 0x31, 0x14, 0x14, 0x14, 0x19, 0x14, 0x14, 0x14, 0x19, 0x2f, 0x2f, 0x2f, 0x31, 0x62, 0x62, 0x62, 0x63, 0xaa, 0xaa, 0xaa, 0xaa, 0xf7, 0xf7, 0xf7, 0xf7, 0xff, 0xf1, 0xfe, 0xff, 0xfd, 0xdd, 0xfc, 0xff, 0xfc, 0xc5, 0xf9, 0xff, 0xf8, 0xaf, 0xf5, 0xff, 0xf5, 0xab, 0xf3, 0xff, 0xf6, 0xac, 0xf3, 0xff, 0xf2, 0xb0, 0xef, 0xff, 0xf2, 0xca, 0xf1, 0xff, 0xfa, 0xe6, 0xfa, 0xff, 0xfc, 0xd4, 0xfa, 0xff, 0xfa, 0xc0, 0xf8, 0xff, 0xfe, 0xe2, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x81, 0x81, 0x82, 0x31, 0x31, 0x31, 0x2f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x0e, 0x0e, 0x12, 0x30, 0x30, 0x30, 0x30, 0x5b, 0x5b, 0x5b, 0x5a, 0x80, 0x80, 0x80, 0x81, 0x86, 0x86, 0x86, 0x87, 0x75, 0x75, 0x75, 0x74, 0x51, 0x51, 0x51, 0x52, 0x2c, 0x2c, 0x2c, 0x2e, 0x0d, 0x0d, 0x0d, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d, 0x13, 0x2f, 0x2f, 0x2f, 0x31, 0x61, 0x61, 0x61, 0x61, 0xa3, 0xa3, 0xa3, 0xa3, 0xe5, 0xe5, 0xe5, 0xe5, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xfb, 0xd7, 0xfa, 0xff, 0xf8, 0xc1, 0xf7, 0xff, 0xf8, 0xaf, 0xf7, 0xff, 0xf3, 0xaa, 0xf1, 0xff, 0xeb, 0xb6, 0xeb, 0xff, 0xf4, 0xd7, 0xf5, 0xff, 0xff, 0xe2, 0xfe, 0xff, 0xfd, 0xd7, 0xfc, 0xff, 0xfd, 0xea, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x80, 0x80, 0x80, 0x2c, 0x2c, 0x2c, 0x2e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x15, 0x15, 0x15, 0x18, 0x2e, 0x2e, 0x2e, 0x2c, 0x3f, 0x3f, 0x3f, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x24, 0x24, 0x24, 0x23, 0x0f, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x13, 0x2c, 0x2c, 0x2c, 0x2e, 0x59, 0x59, 0x59, 0x59, 0x8e, 0x8e, 0x8e, 0x8e, 0xc1, 0xc1, 0xc1, 0xc0, 0xe5, 0xe5, 0xe5, 0xe5, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xfc, 0xd2, 0xfc, 0xff, 0xf5, 0xbb, 0xf5, 0xff, 0xea, 0xb1, 0xeb, 0xff, 0xed, 0xc2, 0xed, 0xff, 0xfa, 0xe1, 0xfa, 0xff, 0xfe, 0xef, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xf4, 0xf4, 0xf4, 0xf4, 0x78, 0x78, 0x78, 0x79, 0x2e, 0x2e, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x15, 0x17, 0x17, 0x17, 0x16, 0x0f, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x0f, 0x11, 0x27, 0x27, 0x27, 0x27, 0x45, 0x45, 0x45, 0x46, 0x6d, 0x6d, 0x6d, 0x6c, 0x8e, 0x8e, 0x8e, 0x8e, 0xc1, 0xc1, 0xc1, 0xc0, 0xe5, 0xe5, 0xe5, 0xe5, 0xff, 0xf7, 0xff, 0xff, 0xfd, 0xe7, 0xfd, 0xff, 0xf5, 0xd2, 0xf5, 0xff, 0xeb, 0xc2, 0xeb, 0xff, 0xf3, 0xd5, 0xf2, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xd4, 0xd4, 0xd4, 0xd4, 0x68, 0x68, 0x68, 0x69, 0x28, 0x28, 0x28, 0x26, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x14, 0x14, 0x14, 0x0d, 0x1c, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x31, 0x2f, 0x45, 0x45, 0x45, 0x46, 0x6d, 0x6d, 0x6d, 0x6c, 0x8e, 0x8e, 0x8e, 0x8e, 0xbf, 0xbf, 0xbf, 0xbe, 0xdc, 0xdc, 0xdc, 0xdc, 0xff, 0xf7, 0xff, 0xff, 0xf8, 0xe6, 0xf7, 0xff, 0xf8, 0xe7, 0xf7, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xa2, 0xa2, 0xa2, 0xa1, 0x50, 0x50, 0x50, 0x50, 0x1a, 0x1a, 0x1a, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x11, 0x11, 0x11, 0x0f, 0x1c, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x31, 0x2f, 0x45, 0x45, 0x45, 0x46, 0x68, 0x68, 0x68, 0x69, 0x82, 0x82, 0x82, 0x83, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0x65, 0x65, 0x65, 0x65, 0x33, 0x33, 0x33, 0x32, 0x0e, 0x0e, 0x0e, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x11, 0x11, 0x11, 0x0f, 0x1c, 0x1c, 0x1c, 0x1b, 0x2d, 0x2d, 0x2d, 0x2d, 0x3f, 0x3f, 0x3f, 0x3d, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x33, 0x33, 0x33, 0x32, 0x14, 0x14, 0x14, 0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
+  0x52, 0x49, 0x4d, 0x47, 0x01, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x0f, 0x11, 0x22, 0x22,
+  0x22, 0x25, 0x3d, 0x3d, 0x3d, 0x3b, 0x48, 0x48, 0x48, 0x4a, 0x50, 0x50, 0x50, 0x50, 0x49, 0x49, 0x49, 0x49, 0x2f, 0x2f, 0x2f, 0x31, 0x14, 0x14, 0x14, 0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x02, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x13, 0x2c, 0x2c, 0x2c, 0x2e, 0x56, 0x56, 0x56, 0x56, 0x7e, 0x7e, 0x7e, 0x7f,
+  0x96, 0x96, 0x96, 0x97, 0xa2, 0xa2, 0xa2, 0xa1, 0x94, 0x94, 0x94, 0x94, 0x61, 0x61, 0x61, 0x61, 0x2f, 0x2f, 0x2f, 0x31, 0x0e, 0x0e, 0x0e, 0x12, 0x00, 0x00, 0x00, 0x04, 0xa7, 0x00, 0x00, 0x00,
+  0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x0f, 0x0f, 0x11, 0x2c, 0x2c, 0x2c, 0x2e, 0x61, 0x61, 0x61, 0x61, 0x9f, 0x9f, 0x9f, 0xa0, 0xd7, 0xd7, 0xd7, 0xd7, 0xf0, 0xee,
+  0xf0, 0xf7, 0xf7, 0xef, 0xf6, 0xff, 0xe9, 0xe5, 0xe9, 0xed, 0x95, 0x95, 0x95, 0x95, 0x48, 0x48, 0x48, 0x4a, 0x1d, 0x1d, 0x1d, 0x1a, 0x00, 0x00, 0x00, 0x06, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0x00, 0x00, 0x00, 0x03, 0x14, 0x14, 0x14, 0x0d, 0x27, 0x27, 0x27, 0x27, 0x5a, 0x5a, 0x5a, 0x5b, 0xaa, 0xaa, 0xaa, 0xaa, 0xf6, 0xf6, 0xf6, 0xf6, 0xfd, 0xfc, 0xfd, 0xff, 0xf2, 0xec, 0xf0, 0xff,
+  0xf0, 0xe2, 0xf0, 0xff, 0xfc, 0xf2, 0xfd, 0xff, 0xb8, 0xb8, 0xb8, 0xb8, 0x59, 0x59, 0x59, 0x59, 0x21, 0x21, 0x21, 0x1f, 0x00, 0x00, 0x00, 0x07, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x1a, 0x1a, 0x1d, 0x4b, 0x4b, 0x4b, 0x4b, 0x99, 0x99, 0x99, 0x98, 0xfb, 0xfb, 0xfb, 0xfb, 0xfe, 0xfd, 0xff, 0xff, 0xf9, 0xf2, 0xf9, 0xff, 0xf3, 0xe4,
+  0xf1, 0xff, 0xf7, 0xea, 0xf7, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xbf, 0xbf, 0xbf, 0xbe, 0x57, 0x57, 0x57, 0x58, 0x1a, 0x1a, 0x1a, 0x1e, 0x00, 0x00, 0x00, 0x06, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x1a, 0x1a, 0x1a, 0x14, 0x37, 0x37, 0x37, 0x38, 0x7e, 0x7e, 0x7e, 0x7f, 0xde, 0xde, 0xde, 0xde, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xf4, 0xf9, 0xff,
+  0xf0, 0xe0, 0xf0, 0xff, 0xf4, 0xdc, 0xf4, 0xff, 0xfd, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xab, 0xab, 0xab, 0x4b, 0x4b, 0x4b, 0x4b, 0x15, 0x15, 0x15, 0x18, 0x00, 0x00, 0x00, 0x04,
+  0xa5, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x14, 0x14, 0x14, 0x0d, 0x2c, 0x2c, 0x2c, 0x29, 0x62, 0x62, 0x62, 0x63, 0xc1, 0xc1, 0xc1, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf4,
+  0xf8, 0xff, 0xeb, 0xdc, 0xeb, 0xff, 0xea, 0xce, 0xeb, 0xff, 0xf7, 0xdf, 0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x8b, 0x8b, 0x8b, 0x37, 0x37, 0x37, 0x38, 0x10, 0x10,
+  0x10, 0x10, 0x00, 0x00, 0x00, 0x02, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x1a, 0x1a, 0x1d, 0x4d, 0x4d, 0x4d, 0x4c, 0x9e, 0x9e, 0x9e, 0x9d,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf3, 0xe5, 0xf3, 0xff, 0xe6, 0xc9, 0xe6, 0xff, 0xee, 0xc8, 0xef, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xd8, 0xd8, 0xd8, 0xd8,
+  0x68, 0x68, 0x68, 0x69, 0x28, 0x28, 0x28, 0x26, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x04, 0x81, 0x00, 0x00, 0x00, 0x07, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x1a, 0x1a, 0x1a, 0x14, 0x37, 0x37, 0x37, 0x38, 0x7e, 0x7e, 0x7e, 0x7f,
+  0xe0, 0xe0, 0xe0, 0xe0, 0xfe, 0xfd, 0xfe, 0xff, 0xf7, 0xed, 0xf8, 0xff, 0xef, 0xd2, 0xf0, 0xff, 0xf0, 0xc3, 0xf1, 0xff, 0xf8, 0xce, 0xf9, 0xff, 0xfe, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xa6, 0xa6, 0xa6, 0xa7, 0x48, 0x48, 0x48, 0x4a, 0x15, 0x15, 0x15, 0x18, 0x00, 0x00, 0x00, 0x05, 0x98, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x12, 0x12, 0x12, 0x0e, 0x18, 0x18, 0x18, 0x15, 0x81, 0x1a, 0x1a, 0x1a, 0x1d, 0x11, 0x18, 0x18, 0x18, 0x15, 0x10, 0x10, 0x10, 0x10,
+  0x1a, 0x1a, 0x1a, 0x14, 0x2e, 0x2e, 0x2e, 0x2c, 0x62, 0x62, 0x62, 0x63, 0xc1, 0xc1, 0xc1, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf0, 0xf8, 0xff, 0xe4, 0xcd, 0xe6, 0xff, 0xe2, 0xb6, 0xe4, 0xff,
+  0xef, 0xb8, 0xf0, 0xff, 0xf9, 0xd7, 0xfa, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0xf1, 0x7c, 0x7c, 0x7c, 0x7d, 0x32, 0x32, 0x32, 0x33, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x00, 0x00, 0x02,
+  0x97, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0b, 0x18, 0x18, 0x18, 0x15, 0x21, 0x21, 0x21, 0x1f, 0x24, 0x24, 0x24, 0x23, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x3f, 0x3f, 0x3f, 0x3d, 0x4e, 0x4e, 0x4e, 0x4e, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x4e, 0x4e, 0x4e, 0x3f, 0x3f, 0x3f, 0x3d, 0x30, 0x30, 0x30, 0x30, 0x36, 0x36,
+  0x36, 0x34, 0x56, 0x56, 0x56, 0x56, 0x9e, 0x9e, 0x9e, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf9, 0xfc, 0xff, 0xef, 0xde, 0xf0, 0xff, 0xe4, 0xc1, 0xe7, 0xff, 0xe8, 0xb7, 0xea, 0xff, 0xf2, 0xc4,
+  0xf4, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xca, 0xca, 0xca, 0x62, 0x62, 0x62, 0x63, 0x28, 0x28, 0x28, 0x26, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x95, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x0d, 0x0d, 0x0d, 0x13, 0x22, 0x22, 0x22, 0x25, 0x3f, 0x3f, 0x3f, 0x3d, 0x51, 0x51, 0x51, 0x52,
+  0x59, 0x59, 0x59, 0x59, 0x68, 0x68, 0x68, 0x69, 0x82, 0x82, 0x82, 0x83, 0x9e, 0x9e, 0x9e, 0x9e, 0xa2, 0xa2, 0xa2, 0xa1, 0xa2, 0xa2, 0xa2, 0xa1, 0x9e, 0x9e, 0x9e, 0x9e, 0x82, 0x82, 0x82, 0x83,
+  0x6d, 0x6d, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6f, 0x94, 0x94, 0x94, 0x94, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xed, 0xf6, 0xff, 0xeb, 0xce, 0xed, 0xff, 0xf1, 0xc2, 0xf4, 0xff,
+  0xf6, 0xc3, 0xf8, 0xff, 0xfa, 0xdc, 0xfb, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0xc5, 0x63, 0x63, 0x63, 0x64, 0x26, 0x26, 0x26, 0x28, 0x15, 0x15, 0x15, 0x0c,
+  0x00, 0x00, 0x00, 0x02, 0x94, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x14, 0x14, 0x14, 0x0d, 0x1a, 0x1a, 0x1a, 0x1d, 0x34, 0x34, 0x34, 0x36, 0x56, 0x56,
+  0x56, 0x56, 0x82, 0x82, 0x82, 0x83, 0xa3, 0xa3, 0xa3, 0xa3, 0xab, 0xab, 0xab, 0xab, 0xbf, 0xbf, 0xbf, 0xbe, 0xdc, 0xdc, 0xdc, 0xdc, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xdc, 0xdc, 0xdc, 0xdc, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xf8, 0xff, 0xe8, 0xce,
+  0xe9, 0xff, 0xe7, 0xb7, 0xe8, 0xff, 0xed, 0xb0, 0xee, 0xff, 0xf2, 0xbc, 0xf3, 0xff, 0xfb, 0xe4, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xe5, 0xe5, 0xe5, 0x7d, 0x7d,
+  0x7d, 0x7e, 0x37, 0x37, 0x37, 0x38, 0x0e, 0x0e, 0x0e, 0x12, 0x00, 0x00, 0x00, 0x04, 0x93, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x0f, 0x11,
+  0x27, 0x27, 0x27, 0x27, 0x49, 0x49, 0x49, 0x49, 0x75, 0x75, 0x75, 0x74, 0x9f, 0x9f, 0x9f, 0xa0, 0xdc, 0xdc, 0xdc, 0xdc, 0xff, 0xfe, 0xff, 0xff, 0xfa, 0xf2, 0xfb, 0xff, 0xf2, 0xe4, 0xf3, 0xff,
+  0xef, 0xe0, 0xf0, 0xff, 0xed, 0xdc, 0xee, 0xff, 0xee, 0xd8, 0xee, 0xff, 0xee, 0xd7, 0xee, 0xff, 0xed, 0xdb, 0xed, 0xff, 0xf0, 0xe2, 0xee, 0xff, 0xf6, 0xea, 0xf5, 0xff, 0xfd, 0xf7, 0xfc, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xf7, 0xf3, 0xf7, 0xff, 0xe8, 0xd1, 0xe8, 0xff, 0xe2, 0xb4, 0xe3, 0xff, 0xe9, 0xab, 0xea, 0xff, 0xf1, 0xad, 0xf1, 0xff, 0xf8, 0xc7, 0xf7, 0xff, 0xff, 0xea, 0xff, 0xff,
+  0xfa, 0xec, 0xfa, 0xff, 0xf5, 0xe8, 0xf6, 0xff, 0xfa, 0xf5, 0xfa, 0xff, 0xa3, 0xa3, 0xa3, 0xa3, 0x4d, 0x4d, 0x4d, 0x4c, 0x1d, 0x1d, 0x1d, 0x1a, 0x00, 0x00, 0x00, 0x06, 0x92, 0x00, 0x00, 0x00,
+  0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x13, 0x2c, 0x2c, 0x2c, 0x2e, 0x59, 0x59, 0x59, 0x59, 0x8f, 0x8f, 0x8f, 0x90, 0xc7, 0xc7, 0xc7, 0xc7, 0xf6, 0xf6,
+  0xf6, 0xf6, 0xfb, 0xf4, 0xfb, 0xff, 0xf2, 0xde, 0xf3, 0xff, 0xec, 0xca, 0xed, 0xff, 0xe7, 0xba, 0xe9, 0xff, 0xe5, 0xb6, 0xe7, 0xff, 0xe4, 0xb4, 0xe6, 0xff, 0xe7, 0xb2, 0xe7, 0xff, 0xe9, 0xb3,
+  0xe9, 0xff, 0xe8, 0xbc, 0xe8, 0xff, 0xec, 0xca, 0xeb, 0xff, 0xf3, 0xd5, 0xf3, 0xff, 0xfb, 0xe5, 0xfc, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf2, 0xe1, 0xf1, 0xff, 0xe5, 0xc3, 0xe6, 0xff, 0xe8, 0xb6,
+  0xea, 0xff, 0xf3, 0xbb, 0xf4, 0xff, 0xfc, 0xc8, 0xfc, 0xff, 0xfd, 0xd3, 0xfe, 0xff, 0xf5, 0xd1, 0xf6, 0xff, 0xeb, 0xc4, 0xed, 0xff, 0xef, 0xcd, 0xf0, 0xff, 0xfb, 0xed, 0xfb, 0xff, 0xb9, 0xb9,
+  0xb9, 0xb9, 0x58, 0x58, 0x58, 0x57, 0x21, 0x21, 0x21, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x91, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x0f, 0x0f, 0x11,
+  0x2c, 0x2c, 0x2c, 0x2e, 0x61, 0x61, 0x61, 0x61, 0xa3, 0xa3, 0xa3, 0xa3, 0xe7, 0xe7, 0xe7, 0xe7, 0xfe, 0xfd, 0xfe, 0xff, 0xf8, 0xf0, 0xf8, 0xff, 0xeb, 0xd1, 0xec, 0xff, 0xe6, 0xb8, 0xe7, 0xff,
+  0xe9, 0xad, 0xeb, 0xff, 0xf1, 0xad, 0xf4, 0xff, 0xf3, 0xad, 0xf5, 0xff, 0xef, 0xab, 0xf1, 0xff, 0xf3, 0xaf, 0xf3, 0xff, 0xfa, 0xbe, 0xfa, 0xff, 0xfa, 0xc7, 0xfb, 0xff, 0xf5, 0xc5, 0xf6, 0xff,
+  0xed, 0xc0, 0xef, 0xff, 0xed, 0xc4, 0xee, 0xff, 0xef, 0xcc, 0xef, 0xff, 0xf1, 0xcf, 0xf0, 0xff, 0xf3, 0xc8, 0xf2, 0xff, 0xf6, 0xc0, 0xf7, 0xff, 0xf8, 0xc4, 0xf9, 0xff, 0xf4, 0xc6, 0xf4, 0xff,
+  0xf0, 0xbe, 0xf1, 0xff, 0xe6, 0xb3, 0xe9, 0xff, 0xe8, 0xba, 0xeb, 0xff, 0xf8, 0xdb, 0xf9, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xaf, 0xaf, 0xaf, 0xb0, 0x51, 0x51, 0x51, 0x52, 0x1b, 0x1b, 0x1b, 0x1c,
+  0x00, 0x00, 0x00, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x14, 0x14, 0x14, 0x0d, 0x27, 0x27, 0x27, 0x27, 0x5a, 0x5a, 0x5a, 0x5b, 0xaa, 0xaa, 0xaa, 0xaa, 0xf7, 0xf7,
+  0xf7, 0xf7, 0xff, 0xfc, 0xff, 0xff, 0xf7, 0xe8, 0xf8, 0xff, 0xe9, 0xc8, 0xea, 0xff, 0xe6, 0xb3, 0xe6, 0xff, 0xef, 0xb0, 0xf0, 0xff, 0xf5, 0xac, 0xf6, 0xff, 0xf6, 0xa8, 0xf7, 0xff, 0xf6, 0xaa,
+  0xf8, 0xff, 0xf5, 0xb1, 0xf6, 0xff, 0xfa, 0xc0, 0xfb, 0xff, 0xfa, 0xc6, 0xfa, 0xff, 0xf4, 0xbc, 0xf4, 0xff, 0xef, 0xaf, 0xf0, 0xff, 0xeb, 0xb0, 0xeb, 0xff, 0xe7, 0xb2, 0xe6, 0xff, 0xe4, 0xb1,
+  0xe3, 0xff, 0xe9, 0xb4, 0xe8, 0xff, 0xf0, 0xb6, 0xf0, 0xff, 0xf4, 0xb5, 0xf4, 0xff, 0xef, 0xaf, 0xf0, 0xff, 0xec, 0xac, 0xed, 0xff, 0xeb, 0xae, 0xed, 0xff, 0xed, 0xb9, 0xf0, 0xff, 0xf7, 0xd7,
+  0xf8, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xfa, 0x8b, 0x8b, 0x8b, 0x8b, 0x3f, 0x3f, 0x3f, 0x3d, 0x1a, 0x1a, 0x1a, 0x14, 0x00, 0x00, 0x00, 0x04, 0x90, 0x00, 0x00, 0x00, 0x00, 0x24,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x1a, 0x1a, 0x1a, 0x1d, 0x4b, 0x4b, 0x4b, 0x4b, 0x99, 0x99, 0x99, 0x98, 0xfb, 0xfb, 0xfb, 0xfb, 0xff, 0xfc, 0xff, 0xff, 0xf8, 0xea, 0xf8, 0xff,
+  0xeb, 0xc6, 0xec, 0xff, 0xe8, 0xae, 0xea, 0xff, 0xf0, 0xab, 0xf2, 0xff, 0xf8, 0xae, 0xf8, 0xff, 0xf8, 0xab, 0xf8, 0xff, 0xf4, 0xa7, 0xf4, 0xff, 0xf4, 0xb2, 0xf6, 0xff, 0xfc, 0xcb, 0xfd, 0xff,
+  0xf9, 0xce, 0xf9, 0xff, 0xea, 0xb9, 0xe9, 0xff, 0xea, 0xb0, 0xea, 0xff, 0xf5, 0xbc, 0xf6, 0xff, 0xf9, 0xcb, 0xf9, 0xff, 0xf7, 0xcd, 0xf6, 0xff, 0xf4, 0xc7, 0xf3, 0xff, 0xf2, 0xc0, 0xf2, 0xff,
+  0xf4, 0xbb, 0xf3, 0xff, 0xf4, 0xb6, 0xf4, 0xff, 0xf3, 0xb4, 0xf4, 0xff, 0xf7, 0xb7, 0xf8, 0xff, 0xf9, 0xc9, 0xfa, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xb9, 0xb9, 0xb9, 0xb9, 0x5d, 0x5d, 0x5d, 0x5d, 0x28, 0x28, 0x28, 0x26, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x18, 0x3d, 0x3d, 0x3d, 0x3b, 0x7e, 0x7e, 0x7e, 0x7f, 0xde, 0xde,
+  0xde, 0xde, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xec, 0xf8, 0xff, 0xeb, 0xc8, 0xec, 0xff, 0xe7, 0xb0, 0xe9, 0xff, 0xef, 0xaa, 0xf1, 0xff, 0xf3, 0xaa, 0xf5, 0xff, 0xf1, 0xa8, 0xf2, 0xff, 0xf2, 0xa8,
+  0xf2, 0xff, 0xf6, 0xb3, 0xf5, 0xff, 0xfb, 0xd1, 0xfb, 0xff, 0xfa, 0xdd, 0xfa, 0xff, 0xec, 0xc4, 0xeb, 0xff, 0xe7, 0xb8, 0xe6, 0xff, 0xf5, 0xcd, 0xf5, 0xff, 0xfe, 0xd9, 0xfe, 0xff, 0xfa, 0xd3,
+  0xfa, 0xff, 0xf9, 0xcc, 0xfa, 0xff, 0xfd, 0xcb, 0xfe, 0xff, 0x80, 0xff, 0xce, 0xff, 0xff, 0x0a, 0xff, 0xd2, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xfd, 0xd8, 0xfd, 0xff, 0xfe, 0xef, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0xec, 0x82, 0x82, 0x82, 0x83, 0x3a, 0x3a, 0x3a, 0x39, 0x0d, 0x0d, 0x0d, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x00,
+  0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x0e, 0x0e, 0x0e, 0x12, 0x1a, 0x1a, 0x1a, 0x1d, 0x21, 0x21, 0x21, 0x1f, 0x22, 0x22, 0x22, 0x25, 0x3d, 0x3d,
+  0x3d, 0x3b, 0x6d, 0x6d, 0x6d, 0x6c, 0xc1, 0xc1, 0xc1, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xf3, 0xda, 0xf4, 0xff, 0xee, 0xc2, 0xf0, 0xff, 0xf4, 0xc5, 0xf5, 0xff, 0xf8, 0xc7,
+  0xf9, 0xff, 0xf8, 0xc6, 0xf9, 0xff, 0xf5, 0xc1, 0xf6, 0xff, 0xf6, 0xc2, 0xf6, 0xff, 0xfb, 0xd4, 0xfb, 0xff, 0xff, 0xe9, 0xff, 0xff, 0xef, 0xdb, 0xed, 0xff, 0xe7, 0xc5, 0xe5, 0xff, 0xf7, 0xd1,
+  0xf6, 0xff, 0xf7, 0xd6, 0xf6, 0xff, 0xec, 0xc9, 0xed, 0xff, 0xec, 0xb8, 0xee, 0xff, 0xf1, 0xb0, 0xf4, 0xff, 0xf5, 0xb0, 0xf9, 0xff, 0xf6, 0xb5, 0xf8, 0xff, 0xf5, 0xbb, 0xf6, 0xff, 0xf1, 0xbe,
+  0xf1, 0xff, 0xee, 0xc4, 0xed, 0xff, 0xec, 0xc3, 0xeb, 0xff, 0xef, 0xbf, 0xee, 0xff, 0xf8, 0xdd, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xda, 0xda, 0xda, 0x6b, 0x6b, 0x6b, 0x6b, 0x26, 0x26,
+  0x26, 0x28, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x14, 0x14, 0x14, 0x19, 0x33, 0x33, 0x33, 0x32,
+  0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x52, 0x5b, 0x5b, 0x5b, 0x5c, 0x78, 0x78, 0x78, 0x77, 0xaf, 0xaf, 0xaf, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xfe, 0xff,
+  0xfa, 0xe3, 0xfa, 0xff, 0xfc, 0xdb, 0xfc, 0xff, 0xfe, 0xdc, 0xff, 0xff, 0xfd, 0xd9, 0xff, 0xff, 0xfc, 0xd5, 0xfe, 0xff, 0xfd, 0xd8, 0xfe, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff,
+  0xfb, 0xeb, 0xfb, 0xff, 0xee, 0xd9, 0xed, 0xff, 0xf1, 0xd3, 0xf0, 0xff, 0xf8, 0xcf, 0xf7, 0xff, 0xeb, 0xbb, 0xea, 0xff, 0xe6, 0xb1, 0xe7, 0xff, 0xec, 0xad, 0xee, 0xff, 0xf3, 0xaa, 0xf6, 0xff,
+  0xf4, 0xa9, 0xf8, 0xff, 0xf3, 0xab, 0xf6, 0xff, 0xf0, 0xac, 0xf3, 0xff, 0xec, 0xac, 0xed, 0xff, 0xe7, 0xac, 0xe6, 0xff, 0xe4, 0xac, 0xe3, 0xff, 0xeb, 0xaf, 0xeb, 0xff, 0xf8, 0xd9, 0xf8, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0xdf, 0xdf, 0xdf, 0x6a, 0x6a, 0x6a, 0x6a, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x08, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x0f,
+  0x0f, 0x11, 0x30, 0x30, 0x30, 0x30, 0x61, 0x61, 0x61, 0x61, 0x9a, 0x9a, 0x9a, 0x9a, 0x9e, 0x9e, 0x9e, 0x9d, 0xa9, 0xa9, 0xa9, 0xa9, 0xc7, 0xc7, 0xc7, 0xc7, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+  0xff, 0xff, 0xfb, 0xf3, 0xfb, 0xff, 0xf2, 0xe2, 0xf2, 0xff, 0xec, 0xd3, 0xec, 0xff, 0xec, 0xca, 0xec, 0xff, 0xec, 0xc2, 0xef, 0xff, 0xeb, 0xbc, 0xef, 0xff, 0xee, 0xbe, 0xf1, 0xff, 0xf7, 0xd3,
+  0xf9, 0xff, 0xfa, 0xe2, 0xfa, 0xff, 0xf5, 0xe0, 0xf5, 0xff, 0xf7, 0xe5, 0xf6, 0xff, 0xfa, 0xe5, 0xf9, 0xff, 0xf5, 0xd2, 0xf4, 0xff, 0xea, 0xb6, 0xe9, 0xff, 0xeb, 0xac, 0xeb, 0xff, 0xf3, 0xac,
+  0xf4, 0xff, 0xf8, 0xab, 0xf9, 0xff, 0xf9, 0xa9, 0xfc, 0xff, 0xf9, 0xaa, 0xfc, 0xff, 0xf7, 0xab, 0xfa, 0xff, 0xf6, 0xab, 0xfa, 0xff, 0xf7, 0xac, 0xfa, 0xff, 0xf6, 0xac, 0xf8, 0xff, 0xf5, 0xaa,
+  0xf6, 0xff, 0xf6, 0xac, 0xf7, 0xff, 0xfc, 0xcb, 0xfd, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0xf2, 0x77, 0x77, 0x77, 0x76, 0x2b, 0x2b, 0x2b, 0x2a, 0x00, 0x00, 0x00, 0x0a, 0x8c, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x1d, 0x1d, 0x1a, 0x48, 0x48, 0x48, 0x47, 0x8f, 0x8f, 0x8f, 0x8f, 0xe2, 0xe2, 0xe2, 0xe2, 0xec, 0xeb, 0xed, 0xed, 0xf6, 0xf0, 0xf7, 0xf9,
+  0xfa, 0xf0, 0xfb, 0xff, 0xf8, 0xe7, 0xfa, 0xff, 0xf6, 0xdd, 0xf8, 0xff, 0xf1, 0xcd, 0xf3, 0xff, 0xe8, 0xbb, 0xea, 0xff, 0xe4, 0xb1, 0xe5, 0xff, 0xe5, 0xae, 0xe6, 0xff, 0xe7, 0xac, 0xe9, 0xff,
+  0xe6, 0xad, 0xe9, 0xff, 0xec, 0xc2, 0xef, 0xff, 0xf6, 0xda, 0xf6, 0xff, 0xee, 0xcc, 0xee, 0xff, 0xe9, 0xbf, 0xea, 0xff, 0xf7, 0xde, 0xf7, 0xff, 0xfa, 0xea, 0xfa, 0xff, 0xeb, 0xc6, 0xea, 0xff,
+  0xe9, 0xad, 0xe8, 0xff, 0xf5, 0xac, 0xf5, 0xff, 0xf7, 0xa7, 0xf8, 0xff, 0xf7, 0xa6, 0xfa, 0xff, 0xf9, 0xa9, 0xfc, 0xff, 0xfb, 0xab, 0xfe, 0xff, 0xf9, 0xa9, 0xfc, 0xff, 0xf7, 0xa8, 0xfb, 0xff,
+  0xf9, 0xaa, 0xfd, 0xff, 0xfa, 0xaa, 0xfd, 0xff, 0xf9, 0xaa, 0xfc, 0xff, 0xf7, 0xa8, 0xfb, 0xff, 0xf9, 0xb5, 0xfc, 0xff, 0xfe, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x85, 0x85, 0x86,
+  0x32, 0x32, 0x32, 0x33, 0x14, 0x14, 0x14, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x07, 0x1a, 0x1a, 0x1a, 0x1d, 0x50, 0x50, 0x50, 0x50, 0xa2, 0xa2,
+  0xa2, 0xa2, 0xfe, 0xfe, 0xfe, 0xff, 0xf6, 0xf3, 0xf7, 0xff, 0xea, 0xdf, 0xeb, 0xff, 0xe3, 0xce, 0xe5, 0xff, 0xe2, 0xbf, 0xe6, 0xff, 0xe5, 0xb3, 0xe9, 0xff, 0xe9, 0xad, 0xee, 0xff, 0xee, 0xab,
+  0xf2, 0xff, 0xf2, 0xab, 0xf4, 0xff, 0xf2, 0xa9, 0xf3, 0xff, 0xf0, 0xa7, 0xf1, 0xff, 0xf3, 0xb5, 0xf4, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xf1, 0xd4, 0xf0, 0xff, 0xe5, 0xb4, 0xe4, 0xff, 0xec, 0xaf,
+  0xed, 0xff, 0xf8, 0xd6, 0xf9, 0xff, 0xf6, 0xe6, 0xf6, 0xff, 0xe9, 0xc0, 0xe8, 0xff, 0xf1, 0xab, 0xef, 0xff, 0xfa, 0xaa, 0xfa, 0xff, 0xf8, 0xa8, 0xfa, 0xff, 0xf6, 0xa7, 0xfa, 0xff, 0xf6, 0xa9,
+  0xfb, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xaa, 0xfd, 0xff, 0xf8, 0xa9, 0xfc, 0xff, 0xfa, 0xaa, 0xfe, 0xff, 0xfa, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa7, 0xfc, 0xff, 0xf6, 0xab,
+  0xfa, 0xff, 0xf9, 0xd7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x9a, 0x9a, 0x9a, 0x41, 0x41, 0x41, 0x3f, 0x0e, 0x0e, 0x0e, 0x12, 0x00, 0x00, 0x00, 0x02, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x29,
+  0x00, 0x00, 0x00, 0x06, 0x1d, 0x1d, 0x1d, 0x1a, 0x48, 0x48, 0x48, 0x47, 0x8f, 0x8f, 0x8f, 0x8f, 0xe7, 0xe7, 0xe7, 0xe8, 0xed, 0xeb, 0xed, 0xf5, 0xed, 0xe8, 0xed, 0xff, 0xe8, 0xdd, 0xe9, 0xff,
+  0xea, 0xd7, 0xec, 0xff, 0xec, 0xca, 0xef, 0xff, 0xee, 0xba, 0xf2, 0xff, 0xf2, 0xb4, 0xf6, 0xff, 0xf6, 0xb3, 0xf8, 0xff, 0xf6, 0xb3, 0xf7, 0xff, 0xf6, 0xb8, 0xf6, 0xff, 0xfa, 0xce, 0xfa, 0xff,
+  0xf9, 0xd3, 0xf9, 0xff, 0xe9, 0xb8, 0xe8, 0xff, 0xe9, 0xad, 0xe9, 0xff, 0xef, 0xae, 0xf0, 0xff, 0xf3, 0xca, 0xf4, 0xff, 0xfa, 0xe3, 0xfa, 0xff, 0xf0, 0xc4, 0xf0, 0xff, 0xf3, 0xaa, 0xf2, 0xff,
+  0xfa, 0xaa, 0xfb, 0xff, 0xf5, 0xa9, 0xf9, 0xff, 0xf4, 0xab, 0xfa, 0xff, 0xf5, 0xac, 0xfc, 0xff, 0xf5, 0xab, 0xfc, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff,
+  0xf8, 0xa9, 0xfe, 0xff, 0xfa, 0xa8, 0xfe, 0xff, 0xfb, 0xa8, 0xfe, 0xff, 0xf5, 0xa8, 0xf8, 0xff, 0xf8, 0xd5, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xb8, 0xb8, 0xb8, 0x52, 0x52, 0x52, 0x51,
+  0x1c, 0x1c, 0x1c, 0x1b, 0x00, 0x00, 0x00, 0x05, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x0f, 0x0f, 0x11, 0x30, 0x30, 0x30, 0x30, 0x61, 0x61, 0x61, 0x61, 0x9f, 0x9f,
+  0x9f, 0x9f, 0xaf, 0xaf, 0xaf, 0xaf, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfa, 0xe6, 0xfc, 0xff, 0xfa, 0xde, 0xfc, 0xff, 0xfb, 0xd3,
+  0xfc, 0xff, 0xfb, 0xc8, 0xfc, 0xff, 0xfd, 0xd2, 0xfe, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xf5, 0xc6, 0xf5, 0xff, 0xee, 0xaa, 0xee, 0xff, 0xf3, 0xab, 0xf4, 0xff, 0xed, 0xab, 0xee, 0xff, 0xec, 0xbb,
+  0xed, 0xff, 0xf9, 0xdc, 0xf9, 0xff, 0xf8, 0xcf, 0xf8, 0xff, 0xf2, 0xae, 0xf3, 0xff, 0xf5, 0xab, 0xf7, 0xff, 0xf2, 0xaa, 0xf7, 0xff, 0xf1, 0xaa, 0xf7, 0xff, 0xf3, 0xad, 0xfa, 0xff, 0xf4, 0xab,
+  0xfb, 0xff, 0xf6, 0xab, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xfa, 0xa7, 0xfe, 0xff, 0xfd, 0xaa, 0xff, 0xff, 0xf6, 0xaa, 0xf8, 0xff, 0xf7, 0xd4,
+  0xf8, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xde, 0xde, 0xde, 0xde, 0x6d, 0x6d, 0x6d, 0x6c, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x2a,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x14, 0x14, 0x14, 0x19, 0x36, 0x36, 0x36, 0x34, 0x5b, 0x5b, 0x5b, 0x5a, 0x73, 0x73, 0x73, 0x73, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xf8, 0xe2, 0xfa, 0xff, 0xf6, 0xcd, 0xf8, 0xff, 0xf4, 0xbd, 0xf6, 0xff, 0xf8, 0xd1, 0xfa, 0xff, 0xf9, 0xdc, 0xfa, 0xff,
+  0xf0, 0xbc, 0xf2, 0xff, 0xf4, 0xaa, 0xf5, 0xff, 0xf8, 0xa9, 0xf9, 0xff, 0xf4, 0xa9, 0xf4, 0xff, 0xef, 0xae, 0xf1, 0xff, 0xf5, 0xc9, 0xf6, 0xff, 0xfd, 0xda, 0xfd, 0xff, 0xf1, 0xc0, 0xf1, 0xff,
+  0xed, 0xac, 0xee, 0xff, 0xf5, 0xab, 0xf8, 0xff, 0xf6, 0xab, 0xfa, 0xff, 0xf3, 0xab, 0xf7, 0xff, 0xf4, 0xa9, 0xf9, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff,
+  0xfa, 0xaa, 0xff, 0xff, 0xfc, 0xab, 0xff, 0xff, 0xfc, 0xa9, 0xfe, 0xff, 0xf6, 0xaa, 0xf8, 0xff, 0xf8, 0xc9, 0xf9, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x8e, 0x8e, 0x8e,
+  0x39, 0x39, 0x39, 0x3a, 0x0f, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x03, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x15,
+  0x15, 0x18, 0x36, 0x36, 0x36, 0x34, 0x5b, 0x5b, 0x5b, 0x5c, 0xa3, 0xa3, 0xa3, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xef, 0xf4, 0xff, 0xea, 0xd2, 0xeb, 0xff, 0xea, 0xbd,
+  0xed, 0xff, 0xec, 0xaf, 0xef, 0xff, 0xf1, 0xb1, 0xf3, 0xff, 0xf9, 0xd3, 0xfa, 0xff, 0xf1, 0xd5, 0xf2, 0xff, 0xe7, 0xb5, 0xea, 0xff, 0xf3, 0xaa, 0xf5, 0xff, 0xfb, 0xa9, 0xfc, 0xff, 0xfb, 0xa9,
+  0xfc, 0xff, 0xf7, 0xa8, 0xfa, 0xff, 0xf7, 0xb4, 0xfa, 0xff, 0xfc, 0xd5, 0xfd, 0xff, 0xf6, 0xd6, 0xf6, 0xff, 0xeb, 0xb4, 0xec, 0xff, 0xf3, 0xa9, 0xf5, 0xff, 0xf9, 0xac, 0xfb, 0xff, 0xf4, 0xaa,
+  0xf7, 0xff, 0xf5, 0xa8, 0xf8, 0xff, 0xf9, 0xa9, 0xfd, 0xff, 0xfa, 0xaa, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8, 0xa9, 0xfd, 0xff, 0xf9, 0xa9, 0xfd, 0xff, 0xf7, 0xa9,
+  0xf9, 0xff, 0xf9, 0xba, 0xfa, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xba, 0xba, 0xba, 0x56, 0x56, 0x56, 0x56, 0x1a, 0x1a, 0x1a, 0x1e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x01, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x16, 0x16, 0x16, 0x17, 0x39, 0x39, 0x39, 0x3a, 0x75, 0x75, 0x75, 0x74, 0xc8, 0xc8, 0xc8, 0xc9,
+  0xff, 0xff, 0xff, 0xff, 0xf9, 0xf0, 0xf8, 0xff, 0xe8, 0xcc, 0xe7, 0xff, 0xe0, 0xb4, 0xe1, 0xff, 0xe7, 0xb0, 0xea, 0xff, 0xed, 0xab, 0xf0, 0xff, 0xf7, 0xc1, 0xf8, 0xff, 0xff, 0xe0, 0xff, 0xff,
+  0xec, 0xcf, 0xec, 0xff, 0xe3, 0xb0, 0xe4, 0xff, 0xf4, 0xaa, 0xf6, 0xff, 0xfb, 0xaa, 0xfe, 0xff, 0xfa, 0xa9, 0xfd, 0xff, 0xfa, 0xa8, 0xfc, 0xff, 0xf7, 0xaa, 0xf8, 0xff, 0xf7, 0xbf, 0xf6, 0xff,
+  0xfa, 0xda, 0xf9, 0xff, 0xf5, 0xcb, 0xf6, 0xff, 0xed, 0xaf, 0xef, 0xff, 0xf0, 0xa9, 0xf2, 0xff, 0xf5, 0xaa, 0xf7, 0xff, 0xf7, 0xa9, 0xfa, 0xff, 0xfb, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xfd, 0xff,
+  0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf6, 0xa8, 0xfb, 0xff, 0xf8, 0xa9, 0xfc, 0xff, 0xf8, 0xaa, 0xfb, 0xff, 0xf7, 0xaf, 0xfa, 0xff, 0xfc, 0xd2, 0xfd, 0xff, 0xff, 0xf8, 0xff, 0xff,
+  0xef, 0xef, 0xef, 0xef, 0x7c, 0x7c, 0x7c, 0x7d, 0x32, 0x32, 0x32, 0x33, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x05, 0x0f, 0x0f, 0x0f, 0x11, 0x2c, 0x2c, 0x2c, 0x2e, 0x65, 0x65, 0x65, 0x65, 0xaf, 0xaf, 0xaf, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf4, 0xf9, 0xff, 0xec, 0xd1, 0xeb, 0xff, 0xe7, 0xb3,
+  0xe7, 0xff, 0xee, 0xaf, 0xf0, 0xff, 0xee, 0xad, 0xf3, 0xff, 0xf2, 0xb3, 0xf5, 0xff, 0xfb, 0xd3, 0xfc, 0xff, 0xfe, 0xe5, 0xfd, 0xff, 0xeb, 0xc7, 0xe8, 0xff, 0xe4, 0xae, 0xe3, 0xff, 0xf5, 0xab,
+  0xf7, 0xff, 0xf8, 0xaa, 0xfd, 0xff, 0xf7, 0xaa, 0xfd, 0xff, 0xf9, 0xa9, 0xfb, 0xff, 0xf7, 0xa9, 0xf7, 0xff, 0xf2, 0xae, 0xf1, 0xff, 0xf7, 0xc6, 0xf6, 0xff, 0xfd, 0xd9, 0xfd, 0xff, 0xf4, 0xc8,
+  0xf6, 0xff, 0xef, 0xb4, 0xf2, 0xff, 0xf2, 0xad, 0xf5, 0xff, 0xf7, 0xad, 0xf9, 0xff, 0xfb, 0xae, 0xfd, 0xff, 0xf8, 0xaa, 0xfb, 0xff, 0xf8, 0xa9, 0xfc, 0xff, 0xf9, 0xab, 0xfd, 0xff, 0xf9, 0xaa,
+  0xfd, 0xff, 0xf8, 0xa8, 0xfc, 0xff, 0xf9, 0xaa, 0xfd, 0xff, 0xf7, 0xaa, 0xfb, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xfe, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xaf, 0xb0, 0x51, 0x51,
+  0x51, 0x52, 0x1a, 0x1a, 0x1a, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x22, 0x22, 0x22, 0x25,
+  0x59, 0x59, 0x59, 0x59, 0xab, 0xab, 0xab, 0xab, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfa, 0xfe, 0xff, 0xf1, 0xde, 0xf1, 0xff, 0xe6, 0xba, 0xe6, 0xff, 0xee, 0xac, 0xef, 0xff, 0xf5, 0xaa, 0xf7, 0xff,
+  0xf5, 0xae, 0xf8, 0xff, 0xfa, 0xc8, 0xfb, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xfa, 0xe1, 0xf9, 0xff, 0xe9, 0xc1, 0xe7, 0xff, 0xe6, 0xae, 0xe7, 0xff, 0xf4, 0xab, 0xf8, 0xff, 0xf7, 0xaa, 0xfd, 0xff,
+  0xf5, 0xa9, 0xfc, 0xff, 0xf7, 0xaa, 0xfc, 0xff, 0xf7, 0xab, 0xfa, 0xff, 0xf2, 0xab, 0xf4, 0xff, 0xf1, 0xb1, 0xf3, 0xff, 0xf7, 0xc8, 0xf9, 0xff, 0xfe, 0xe0, 0xff, 0xff, 0xfb, 0xe0, 0xfc, 0xff,
+  0xf4, 0xca, 0xf6, 0xff, 0xf1, 0xb4, 0xf4, 0xff, 0xf3, 0xab, 0xf5, 0xff, 0xf6, 0xa9, 0xf9, 0xff, 0xf9, 0xaa, 0xfc, 0xff, 0xf9, 0xa9, 0xfc, 0xff, 0xfb, 0xab, 0xfd, 0xff, 0xfa, 0xaa, 0xfc, 0xff,
+  0xf8, 0xa9, 0xfc, 0xff, 0xf9, 0xa9, 0xfd, 0xff, 0xf5, 0xac, 0xf9, 0xff, 0xf9, 0xd1, 0xfb, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xeb, 0x78, 0x78, 0x78, 0x79, 0x30, 0x30, 0x30, 0x30,
+  0x12, 0x12, 0x12, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x1a, 0x1a, 0x14, 0x3f, 0x3f, 0x3f, 0x3d, 0x8a, 0x8a, 0x8a, 0x89, 0xf5, 0xf5,
+  0xf5, 0xf5, 0xff, 0xfd, 0xff, 0xff, 0xf7, 0xe7, 0xf7, 0xff, 0xe8, 0xc3, 0xe9, 0xff, 0xe9, 0xb0, 0xea, 0xff, 0xf2, 0xab, 0xf4, 0xff, 0xf8, 0xad, 0xf9, 0xff, 0xfc, 0xc1, 0xfd, 0xff, 0xfc, 0xd7,
+  0xfc, 0xff, 0xfa, 0xe1, 0xfa, 0xff, 0xf5, 0xd7, 0xf6, 0xff, 0xe7, 0xbc, 0xe9, 0xff, 0xe6, 0xad, 0xea, 0xff, 0xf2, 0xac, 0xf7, 0xff, 0xf7, 0xab, 0xfd, 0xff, 0xf6, 0xa9, 0xfb, 0xff, 0xf4, 0xa8,
+  0xfa, 0xff, 0xf6, 0xab, 0xfa, 0xff, 0xf6, 0xad, 0xfa, 0xff, 0xf0, 0xab, 0xf5, 0xff, 0xf3, 0xb8, 0xf5, 0xff, 0xfd, 0xe4, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf1, 0xfc, 0xff, 0xf6, 0xd1,
+  0xf8, 0xff, 0xf0, 0xb4, 0xf2, 0xff, 0xf0, 0xaa, 0xf3, 0xff, 0xf8, 0xab, 0xfb, 0xff, 0xf9, 0xa9, 0xfc, 0xff, 0xfb, 0xaa, 0xfd, 0xff, 0xfb, 0xab, 0xfd, 0xff, 0xf9, 0xa9, 0xfc, 0xff, 0xfa, 0xaa,
+  0xfe, 0xff, 0xf3, 0xa7, 0xf7, 0xff, 0xf2, 0xba, 0xf6, 0xff, 0xfd, 0xe8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xa5, 0xa5, 0xa5, 0x47, 0x47, 0x47, 0x48, 0x16, 0x16, 0x16, 0x17, 0x00, 0x00,
+  0x00, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x06, 0x1b, 0x1b, 0x1b, 0x1c, 0x52, 0x52, 0x52, 0x51, 0xae, 0xae, 0xae, 0xae, 0xff, 0xfe, 0xff, 0xff, 0xf5, 0xea, 0xf5, 0xff,
+  0xe6, 0xc3, 0xe7, 0xff, 0xe8, 0xad, 0xe8, 0xff, 0xef, 0xad, 0xf0, 0xff, 0xf6, 0xb8, 0xf7, 0xff, 0xfd, 0xca, 0xfd, 0xff, 0xfa, 0xd1, 0xfa, 0xff, 0xee, 0xc6, 0xef, 0xff, 0xf2, 0xc9, 0xf2, 0xff,
+  0xf9, 0xcf, 0xfa, 0xff, 0xec, 0xba, 0xee, 0xff, 0xe8, 0xab, 0xea, 0xff, 0xf2, 0xab, 0xf4, 0xff, 0xf6, 0xab, 0xf8, 0xff, 0xf8, 0xab, 0xf9, 0xff, 0xf6, 0xa9, 0xf9, 0xff, 0xf9, 0xab, 0xfc, 0xff,
+  0xfa, 0xac, 0xfc, 0xff, 0xf3, 0xaa, 0xf6, 0xff, 0xf6, 0xbf, 0xf8, 0xff, 0xfd, 0xe9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf3, 0xff, 0xff, 0xf5, 0xd3, 0xf7, 0xff,
+  0xec, 0xb7, 0xef, 0xff, 0xf0, 0xad, 0xf4, 0xff, 0xf6, 0xaa, 0xfa, 0xff, 0xf9, 0xa9, 0xfc, 0xff, 0xfb, 0xa9, 0xfe, 0xff, 0xf9, 0xaa, 0xfd, 0xff, 0xf9, 0xaa, 0xfd, 0xff, 0xf7, 0xa9, 0xfa, 0xff,
+  0xf2, 0xad, 0xf6, 0xff, 0xf9, 0xd6, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xcb, 0xcb, 0xcb, 0xcb, 0x5f, 0x5f, 0x5f, 0x5e, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x2c, 0x00, 0x00, 0x00, 0x07, 0x21, 0x21, 0x21, 0x1f, 0x58, 0x58, 0x58, 0x57, 0xb4, 0xb4, 0xb4, 0xb4, 0xf9, 0xf6, 0xf9, 0xff, 0xed, 0xda, 0xed, 0xff, 0xeb, 0xc8, 0xec, 0xff, 0xf6, 0xcf,
+  0xf6, 0xff, 0xfa, 0xd7, 0xfa, 0xff, 0xfc, 0xe2, 0xfc, 0xff, 0xf8, 0xdd, 0xf8, 0xff, 0xe9, 0xc1, 0xea, 0xff, 0xe4, 0xb0, 0xe5, 0xff, 0xf2, 0xc5, 0xf3, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xf0, 0xbe,
+  0xf0, 0xff, 0xea, 0xac, 0xea, 0xff, 0xf3, 0xab, 0xf2, 0xff, 0xf5, 0xa9, 0xf2, 0xff, 0xf7, 0xaa, 0xf4, 0xff, 0xfa, 0xab, 0xfa, 0xff, 0xfb, 0xab, 0xfe, 0xff, 0xfb, 0xaa, 0xfd, 0xff, 0xf7, 0xad,
+  0xf9, 0xff, 0xfa, 0xd1, 0xfa, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf3, 0xfc, 0xff, 0xf2, 0xd3, 0xf4, 0xff, 0xea, 0xb4,
+  0xee, 0xff, 0xf1, 0xab, 0xf5, 0xff, 0xf9, 0xaa, 0xfc, 0xff, 0xfa, 0xa9, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf7, 0xa9, 0xfb, 0xff, 0xf9, 0xac, 0xfc, 0xff, 0xf5, 0xaa, 0xf8, 0xff, 0xf7, 0xc5,
+  0xf9, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0xe1, 0x6b, 0x6b, 0x6b, 0x6b, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x06,
+  0x1d, 0x1d, 0x1d, 0x1a, 0x48, 0x48, 0x48, 0x4a, 0x96, 0x96, 0x96, 0x97, 0xf1, 0xed, 0xf1, 0xf7, 0xf7, 0xec, 0xf7, 0xff, 0xfc, 0xf1, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfa, 0xf2, 0xfa, 0xff, 0xeb, 0xcc, 0xed, 0xff, 0xe3, 0xb0, 0xe6, 0xff, 0xeb, 0xb1, 0xee, 0xff, 0xf8, 0xce, 0xf9, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xef, 0xcb, 0xef, 0xff, 0xe9, 0xb0, 0xe9, 0xff,
+  0xf6, 0xab, 0xf4, 0xff, 0xf8, 0xa8, 0xf5, 0xff, 0xf7, 0xa8, 0xf4, 0xff, 0xf8, 0xa8, 0xf8, 0xff, 0xfa, 0xaa, 0xfe, 0xff, 0xf9, 0xaa, 0xfd, 0xff, 0xf8, 0xb3, 0xfb, 0xff, 0xfc, 0xdd, 0xfd, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xdc, 0xdc, 0xdc, 0xdd, 0xac, 0xac, 0xac, 0xac, 0xc1, 0xc1, 0xc1, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf1, 0xfb, 0xff, 0xec, 0xcc, 0xef, 0xff, 0xea, 0xaf, 0xee, 0xff,
+  0xf6, 0xab, 0xf9, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf7, 0xab, 0xfd, 0xff, 0xf7, 0xaa, 0xfc, 0xff, 0xf7, 0xaa, 0xfa, 0xff, 0xf7, 0xab, 0xf9, 0xff, 0xfc, 0xc3, 0xfd, 0xff, 0xff, 0xec, 0xff, 0xff,
+  0xdc, 0xdc, 0xdc, 0xdd, 0x6a, 0x6a, 0x6a, 0x6a, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x0e, 0x0e, 0x12, 0x2f, 0x2f,
+  0x2f, 0x31, 0x63, 0x63, 0x63, 0x64, 0xa5, 0xa5, 0xa5, 0xa5, 0xc3, 0xc3, 0xc3, 0xc3, 0xfa, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xf2, 0xe0, 0xf3, 0xff, 0xe7, 0xb9,
+  0xea, 0xff, 0xeb, 0xad, 0xf0, 0xff, 0xf1, 0xb0, 0xf5, 0xff, 0xf9, 0xd1, 0xfb, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf0, 0xd8, 0xf1, 0xff, 0xe8, 0xb6, 0xe9, 0xff, 0xf5, 0xa8, 0xf5, 0xff, 0xfb, 0xa8,
+  0xfb, 0xff, 0xfb, 0xaa, 0xfb, 0xff, 0xf9, 0xa9, 0xfb, 0xff, 0xf9, 0xaa, 0xfd, 0xff, 0xf5, 0xa9, 0xfa, 0xff, 0xf7, 0xb5, 0xfa, 0xff, 0xfe, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xb9,
+  0xb9, 0xb9, 0x77, 0x77, 0x77, 0x78, 0x7d, 0x7d, 0x7d, 0x7e, 0xc1, 0xc1, 0xc1, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe7, 0xf7, 0xff, 0xeb, 0xbd, 0xed, 0xff, 0xee, 0xaa, 0xf1, 0xff, 0xf4, 0xaa,
+  0xf9, 0xff, 0xf5, 0xac, 0xfc, 0xff, 0xf5, 0xaa, 0xfa, 0xff, 0xf4, 0xa8, 0xf7, 0xff, 0xf9, 0xb3, 0xf9, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xbf, 0xbf, 0xbf, 0x59, 0x59,
+  0x59, 0x59, 0x21, 0x21, 0x21, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x14, 0x14, 0x14, 0x19, 0x35, 0x35, 0x35, 0x35,
+  0x5f, 0x5f, 0x5f, 0x5e, 0x85, 0x85, 0x85, 0x86, 0xd2, 0xd2, 0xd2, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xfc, 0xff, 0xec, 0xcf, 0xee, 0xff, 0xe7, 0xb2, 0xeb, 0xff, 0xf1, 0xad, 0xf6, 0xff,
+  0xf2, 0xb1, 0xf8, 0xff, 0xf8, 0xd2, 0xfb, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xf6, 0xe3, 0xf7, 0xff, 0xed, 0xbc, 0xef, 0xff, 0xf4, 0xa7, 0xf6, 0xff, 0xfc, 0xa7, 0xfd, 0xff, 0xfd, 0xab, 0xfe, 0xff,
+  0xfc, 0xac, 0xff, 0xff, 0xf8, 0xa9, 0xfc, 0xff, 0xf5, 0xa5, 0xf9, 0xff, 0xf9, 0xb6, 0xfc, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb6, 0xb6, 0xb6, 0x63, 0x63, 0x63, 0x64,
+  0x55, 0x55, 0x55, 0x54, 0x82, 0x82, 0x82, 0x83, 0xde, 0xde, 0xde, 0xde, 0xfd, 0xf8, 0xfe, 0xff, 0xf2, 0xd5, 0xf3, 0xff, 0xe9, 0xb2, 0xeb, 0xff, 0xef, 0xaa, 0xf3, 0xff, 0xf4, 0xa8, 0xf8, 0xff,
+  0xf6, 0xab, 0xf9, 0xff, 0xf9, 0xb6, 0xfa, 0xff, 0xfc, 0xd0, 0xfd, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0x8e, 0x8e, 0x8e, 0x8e, 0x41, 0x41, 0x41, 0x3f, 0x18, 0x18, 0x18, 0x15,
+  0x00, 0x00, 0x00, 0x04, 0x88, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x16, 0x16, 0x16, 0x17, 0x35, 0x35, 0x35, 0x35, 0x68, 0x68,
+  0x68, 0x69, 0xc8, 0xc8, 0xc8, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe6, 0xf7, 0xff, 0xe9, 0xbd, 0xea, 0xff, 0xec, 0xae, 0xee, 0xff, 0xf3, 0xad, 0xf7, 0xff, 0xf3, 0xb3, 0xf8, 0xff, 0xf9, 0xd5,
+  0xfc, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xfd, 0xec, 0xfe, 0xff, 0xf4, 0xc7, 0xf5, 0xff, 0xf5, 0xaa, 0xf7, 0xff, 0xfc, 0xa9, 0xfe, 0xff, 0xfc, 0xa9, 0xfe, 0xff, 0xfa, 0xaa, 0xfd, 0xff, 0xf7, 0xa9,
+  0xfb, 0xff, 0xf8, 0xa5, 0xfb, 0xff, 0xfb, 0xb0, 0xfd, 0xff, 0xfe, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xd6, 0xd6, 0xd6, 0x76, 0x76, 0x76, 0x75, 0x47, 0x47, 0x47, 0x48, 0x58, 0x58,
+  0x58, 0x57, 0x9a, 0x9a, 0x9a, 0x9a, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xf0, 0xf9, 0xff, 0xf2, 0xd2, 0xf4, 0xff, 0xf4, 0xbe, 0xf6, 0xff, 0xfa, 0xba, 0xfb, 0xff, 0xfd, 0xcb, 0xfd, 0xff, 0xff, 0xe0,
+  0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xf6, 0xaa, 0xaa, 0xaa, 0xaa, 0x59, 0x59, 0x59, 0x59, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x89, 0x00,
+  0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x26, 0x26, 0x26, 0x28, 0x67, 0x67, 0x67, 0x68, 0xd8, 0xd8, 0xd8, 0xd8, 0xfe, 0xfc, 0xfe, 0xff,
+  0xf3, 0xdb, 0xf4, 0xff, 0xe8, 0xb2, 0xea, 0xff, 0xf2, 0xac, 0xf4, 0xff, 0xf5, 0xac, 0xf8, 0xff, 0xf4, 0xb4, 0xf7, 0xff, 0xfc, 0xdc, 0xfe, 0xff, 0xf9, 0xea, 0xfa, 0xff, 0xf9, 0xe7, 0xfa, 0xff,
+  0xfb, 0xd6, 0xfb, 0xff, 0xf4, 0xb3, 0xf6, 0xff, 0xf6, 0xa8, 0xf8, 0xff, 0xfb, 0xa9, 0xfd, 0xff, 0xf9, 0xaa, 0xfd, 0xff, 0xf7, 0xaa, 0xfc, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf7, 0xac, 0xfb, 0xff,
+  0xf9, 0xd0, 0xfb, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xa3, 0xa3, 0xa3, 0x58, 0x58, 0x58, 0x57, 0x43, 0x43, 0x43, 0x41, 0x60, 0x60, 0x60, 0x60, 0xa2, 0xa2, 0xa2, 0xa1,
+  0xdc, 0xdc, 0xdc, 0xdc, 0xfe, 0xf5, 0xfe, 0xff, 0xfd, 0xe7, 0xfe, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xdc, 0xdc, 0xdc, 0xdc, 0x9f, 0x9f, 0x9f, 0xa0,
+  0x61, 0x61, 0x61, 0x61, 0x2c, 0x2c, 0x2c, 0x2e, 0x0f, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0a, 0x2b, 0x2b,
+  0x2b, 0x2a, 0x76, 0x76, 0x76, 0x75, 0xf0, 0xf0, 0xf0, 0xf0, 0xfd, 0xf5, 0xfc, 0xff, 0xf0, 0xce, 0xf1, 0xff, 0xeb, 0xad, 0xef, 0xff, 0xf6, 0xab, 0xf9, 0xff, 0xf5, 0xaa, 0xf6, 0xff, 0xf6, 0xbd,
+  0xf7, 0xff, 0xfe, 0xe9, 0xff, 0xff, 0xef, 0xdd, 0xf1, 0xff, 0xf0, 0xd4, 0xf1, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xf7, 0xca, 0xf8, 0xff, 0xf0, 0xac, 0xf1, 0xff, 0xf5, 0xa8, 0xf8, 0xff, 0xf8, 0xaa,
+  0xfd, 0xff, 0xf6, 0xab, 0xfc, 0xff, 0xf7, 0xab, 0xfd, 0xff, 0xf4, 0xac, 0xf9, 0xff, 0xf2, 0xbc, 0xf5, 0xff, 0xfb, 0xe4, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xe2, 0xe2, 0xe2, 0xe2, 0x7b, 0x7b,
+  0x7b, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x3d, 0x3d, 0x3d, 0x3b, 0x59, 0x59, 0x59, 0x59, 0x82, 0x82, 0x82, 0x83, 0x82, 0xa2, 0xa2, 0xa2, 0xa1, 0x05, 0x82, 0x82, 0x82, 0x83, 0x56, 0x56, 0x56, 0x56,
+  0x2c, 0x2c, 0x2c, 0x2e, 0x0d, 0x0d, 0x0d, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x14, 0x14, 0x14, 0x0d, 0x32, 0x32,
+  0x32, 0x33, 0x85, 0x85, 0x85, 0x86, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xec, 0xf8, 0xff, 0xec, 0xc3, 0xee, 0xff, 0xef, 0xac, 0xf3, 0xff, 0xf7, 0xaa, 0xfb, 0xff, 0xf6, 0xac, 0xf8, 0xff, 0xf9, 0xd0,
+  0xfa, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xee, 0xd0, 0xef, 0xff, 0xed, 0xbe, 0xee, 0xff, 0xfe, 0xe0, 0xfe, 0xff, 0xfc, 0xe2, 0xfc, 0xff, 0xf4, 0xc1, 0xf6, 0xff, 0xf1, 0xac, 0xf5, 0xff, 0xf5, 0xaa,
+  0xfb, 0xff, 0xf6, 0xaa, 0xfc, 0xff, 0xf6, 0xaa, 0xfb, 0xff, 0xf5, 0xab, 0xf9, 0xff, 0xf1, 0xae, 0xf4, 0xff, 0xf7, 0xc9, 0xf8, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf,
+  0xaf, 0xaf, 0x58, 0x58, 0x58, 0x57, 0x2c, 0x2c, 0x2c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2c, 0x3e, 0x3e, 0x3e, 0x3e, 0x82, 0x50, 0x50, 0x50, 0x50, 0x04, 0x3f, 0x3f, 0x3f, 0x3d, 0x22, 0x22, 0x22, 0x25,
+  0x0f, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x0e, 0x0e, 0x12, 0x41, 0x41, 0x41, 0x3f, 0x9a, 0x9a,
+  0x9a, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe8, 0xf6, 0xff, 0xec, 0xbe, 0xee, 0xff, 0xf1, 0xab, 0xf6, 0xff, 0xf6, 0xa8, 0xfb, 0xff, 0xf8, 0xb1, 0xfa, 0xff, 0xfd, 0xde, 0xfd, 0xff, 0xfc, 0xef,
+  0xfc, 0xff, 0xf0, 0xc5, 0xf1, 0xff, 0xee, 0xaf, 0xef, 0xff, 0xf5, 0xc8, 0xf6, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xfc, 0xdf, 0xfd, 0xff, 0xf6, 0xc0, 0xfa, 0xff, 0xf3, 0xad, 0xf8, 0xff, 0xf5, 0xaa,
+  0xf9, 0xff, 0xf7, 0xab, 0xfb, 0xff, 0xf6, 0xaa, 0xfa, 0xff, 0xf5, 0xa8, 0xf8, 0xff, 0xf6, 0xb1, 0xf8, 0xff, 0xfb, 0xd9, 0xfb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xeb, 0x79, 0x79,
+  0x79, 0x7a, 0x35, 0x35, 0x35, 0x35, 0x14, 0x14, 0x14, 0x19, 0x16, 0x16, 0x16, 0x17, 0x82, 0x1a, 0x1a, 0x1a, 0x1d, 0x03, 0x18, 0x18, 0x18, 0x15, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x01, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x05, 0x1c, 0x1c, 0x1c, 0x1b, 0x52, 0x52, 0x52, 0x51, 0xb8, 0xb8, 0xb8, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xe4,
+  0xf4, 0xff, 0xea, 0xba, 0xec, 0xff, 0xf2, 0xaa, 0xf6, 0xff, 0xf7, 0xab, 0xfc, 0xff, 0xfb, 0xc6, 0xfc, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0xeb, 0xf8, 0xff, 0xed, 0xc1, 0xee, 0xff, 0xec, 0xaa,
+  0xef, 0xff, 0xee, 0xb2, 0xef, 0xff, 0xf2, 0xcb, 0xf2, 0xff, 0xfb, 0xe0, 0xfb, 0xff, 0xfc, 0xde, 0xfe, 0xff, 0xf8, 0xc6, 0xfb, 0xff, 0xf4, 0xb0, 0xf6, 0xff, 0xf4, 0xab, 0xf7, 0xff, 0xf7, 0xab,
+  0xfb, 0xff, 0xf8, 0xa8, 0xfc, 0xff, 0xf5, 0xa9, 0xf8, 0xff, 0xf4, 0xc2, 0xf5, 0xff, 0xfb, 0xec, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xa5, 0xa5, 0xa5, 0x49, 0x49, 0x49, 0x49, 0x14, 0x14,
+  0x14, 0x19, 0x00, 0x00, 0x00, 0x09, 0x82, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x27, 0x27, 0x27, 0x27, 0x6d, 0x6d, 0x6d, 0x6c, 0xde, 0xde, 0xde, 0xde, 0xff, 0xfb, 0xff, 0xff, 0xf3, 0xdc, 0xf3, 0xff, 0xe8, 0xb4, 0xe9, 0xff, 0xf0, 0xa9,
+  0xf3, 0xff, 0xf9, 0xb5, 0xfb, 0xff, 0xfe, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xec, 0xf7, 0xff, 0xeb, 0xc3, 0xed, 0xff, 0xec, 0xaa, 0xf1, 0xff, 0xf3, 0xac, 0xf6, 0xff, 0xf0, 0xb3,
+  0xf1, 0xff, 0xee, 0xc3, 0xee, 0xff, 0xf6, 0xdc, 0xf7, 0xff, 0xff, 0xe2, 0xff, 0xff, 0xf9, 0xca, 0xfa, 0xff, 0xf1, 0xb3, 0xf5, 0xff, 0xf2, 0xac, 0xf7, 0xff, 0xf6, 0xa9, 0xfb, 0xff, 0xf7, 0xa9,
+  0xfa, 0xff, 0xf1, 0xb2, 0xf3, 0xff, 0xf7, 0xd9, 0xf7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xcd, 0xcd, 0xcd, 0xce, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x1f, 0x21, 0x00, 0x00, 0x00, 0x07, 0x95, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x10, 0x10, 0x10, 0x10, 0x37, 0x37, 0x37, 0x38, 0x8c, 0x8c, 0x8c, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xf0, 0xcf, 0xf0, 0xff,
+  0xe6, 0xae, 0xe7, 0xff, 0xf2, 0xae, 0xf4, 0xff, 0xfc, 0xd1, 0xfd, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf4, 0xfa, 0xff, 0xef, 0xcc, 0xf1, 0xff, 0xef, 0xac, 0xf3, 0xff,
+  0xf7, 0xaa, 0xfb, 0xff, 0xf3, 0xac, 0xf6, 0xff, 0xea, 0xae, 0xed, 0xff, 0xeb, 0xbc, 0xed, 0xff, 0xf9, 0xd9, 0xf9, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xfa, 0xd2, 0xfb, 0xff, 0xef, 0xb7, 0xf3, 0xff,
+  0xf1, 0xab, 0xf5, 0xff, 0xf9, 0xab, 0xfb, 0xff, 0xf3, 0xaa, 0xf6, 0xff, 0xf6, 0xc5, 0xf7, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xec, 0xec, 0xec, 0xec, 0x72, 0x72, 0x72, 0x72, 0x26, 0x26, 0x26, 0x28,
+  0x00, 0x00, 0x00, 0x09, 0x95, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x15, 0x15, 0x15, 0x18, 0x4c, 0x4c, 0x4c, 0x4d, 0xae, 0xae, 0xae, 0xae, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xeb,
+  0xf9, 0xff, 0xe8, 0xc1, 0xe8, 0xff, 0xe9, 0xb0, 0xe9, 0xff, 0xfb, 0xcc, 0xfb, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xf8, 0xdc,
+  0xf8, 0xff, 0xf1, 0xb2, 0xf4, 0xff, 0xf3, 0xa8, 0xf7, 0xff, 0xf6, 0xa9, 0xfa, 0xff, 0xf4, 0xac, 0xf9, 0xff, 0xed, 0xad, 0xf1, 0xff, 0xea, 0xbb, 0xec, 0xff, 0xf6, 0xda, 0xf7, 0xff, 0xff, 0xe8,
+  0xff, 0xff, 0xf8, 0xd3, 0xf9, 0xff, 0xf1, 0xb5, 0xf2, 0xff, 0xf5, 0xaa, 0xf7, 0xff, 0xf8, 0xa8, 0xfa, 0xff, 0xf9, 0xb7, 0xfa, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0x7c, 0x7c,
+  0x7c, 0x7d, 0x2d, 0x2d, 0x2d, 0x2d, 0x00, 0x00, 0x00, 0x0b, 0x95, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x20, 0x20, 0x20, 0x20, 0x5e, 0x5e, 0x5e, 0x5f, 0xca, 0xca, 0xca, 0xca,
+  0xff, 0xfc, 0xff, 0xff, 0xf3, 0xdc, 0xf3, 0xff, 0xea, 0xbd, 0xea, 0xff, 0xf6, 0xce, 0xf6, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1,
+  0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xf0, 0xfd, 0xff, 0xf2, 0xc7, 0xf4, 0xff, 0xf0, 0xab, 0xf2, 0xff, 0xf7, 0xaa, 0xfa, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf4, 0xae, 0xf8, 0xff, 0xe9, 0xad, 0xed, 0xff,
+  0xea, 0xbb, 0xed, 0xff, 0xf7, 0xdb, 0xf8, 0xff, 0xff, 0xe9, 0xff, 0xff, 0xf8, 0xcf, 0xf9, 0xff, 0xf2, 0xb3, 0xf4, 0xff, 0xf5, 0xaa, 0xf8, 0xff, 0xfa, 0xb4, 0xfc, 0xff, 0xfe, 0xdf, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x80, 0x80, 0x80, 0x81, 0x31, 0x31, 0x31, 0x2f, 0x00, 0x00, 0x00, 0x0b, 0x95, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x08, 0x22, 0x22, 0x22, 0x25, 0x67, 0x67,
+  0x67, 0x68, 0xd2, 0xd2, 0xd2, 0xd2, 0xfd, 0xf7, 0xfd, 0xff, 0xf4, 0xd8, 0xf4, 0xff, 0xf5, 0xd3, 0xf5, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xac, 0xac, 0xac, 0xad, 0x7e, 0x7e,
+  0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0xac, 0xac, 0xac, 0xad, 0xfc, 0xfc, 0xfc, 0xfc, 0xfa, 0xec, 0xfa, 0xff, 0xf4, 0xc4, 0xf5, 0xff, 0xf4, 0xac, 0xf6, 0xff, 0xf7, 0xad, 0xfa, 0xff, 0xf3, 0xac,
+  0xf8, 0xff, 0xf1, 0xab, 0xf7, 0xff, 0xec, 0xab, 0xf1, 0xff, 0xea, 0xbc, 0xec, 0xff, 0xf7, 0xde, 0xf7, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xf6, 0xcc, 0xf8, 0xff, 0xf0, 0xb0, 0xf3, 0xff, 0xf7, 0xb3,
+  0xfa, 0xff, 0xfe, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x81, 0x81, 0x82, 0x31, 0x31, 0x31, 0x2f, 0x00, 0x00, 0x00, 0x0b, 0x95, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x08,
+  0x23, 0x23, 0x23, 0x24, 0x61, 0x61, 0x61, 0x61, 0xbf, 0xbf, 0xbf, 0xbf, 0xfc, 0xf6, 0xfb, 0xff, 0xf9, 0xe9, 0xf9, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xef, 0xef, 0xef, 0xef, 0xaa, 0xaa, 0xaa, 0xaa,
+  0x65, 0x65, 0x65, 0x65, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x65, 0x65, 0x65, 0x65, 0xab, 0xab, 0xab, 0xab, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xec, 0xfc, 0xff, 0xf9, 0xc9, 0xfa, 0xff,
+  0xf7, 0xb4, 0xf9, 0xff, 0xf2, 0xab, 0xf6, 0xff, 0xf3, 0xa9, 0xf8, 0xff, 0xf4, 0xab, 0xf8, 0xff, 0xeb, 0xad, 0xed, 0xff, 0xed, 0xc1, 0xef, 0xff, 0xfb, 0xe4, 0xfb, 0xff, 0xfd, 0xe5, 0xfd, 0xff,
+  0xf3, 0xbe, 0xf5, 0xff, 0xf5, 0xb5, 0xf7, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x81, 0x81, 0x82, 0x31, 0x31, 0x31, 0x2f, 0x00, 0x00, 0x00, 0x0b, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x1b, 0x1b, 0x1b, 0x1c, 0x4d, 0x4d, 0x4d, 0x4c, 0x90, 0x90, 0x90, 0x91, 0xdd, 0xda, 0xdd, 0xde, 0xe7, 0xe4, 0xe7, 0xe8, 0xc8, 0xc8, 0xc8, 0xc8, 0x9a, 0x9a,
+  0x9a, 0x9a, 0x61, 0x61, 0x61, 0x61, 0x2f, 0x2f, 0x2f, 0x31, 0x14, 0x14, 0x14, 0x19, 0x14, 0x14, 0x14, 0x19, 0x2f, 0x2f, 0x2f, 0x31, 0x62, 0x62, 0x62, 0x63, 0xaa, 0xaa, 0xaa, 0xaa, 0xf7, 0xf7,
+  0xf7, 0xf7, 0xfe, 0xf1, 0xff, 0xff, 0xfc, 0xdd, 0xfd, 0xff, 0xf9, 0xc5, 0xfc, 0xff, 0xf5, 0xaf, 0xf8, 0xff, 0xf3, 0xab, 0xf5, 0xff, 0xf3, 0xac, 0xf6, 0xff, 0xef, 0xb0, 0xf2, 0xff, 0xf1, 0xca,
+  0xf2, 0xff, 0xfa, 0xe6, 0xfa, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xf8, 0xc0, 0xfa, 0xff, 0xfe, 0xe2, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x81, 0x81, 0x82, 0x31, 0x31, 0x31, 0x2f, 0x00, 0x00,
+  0x00, 0x0b, 0x95, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x0e, 0x0e, 0x12, 0x30, 0x30, 0x30, 0x30, 0x5b, 0x5b, 0x5b, 0x5a, 0x80, 0x80, 0x80, 0x81, 0x86, 0x86, 0x86, 0x87,
+  0x75, 0x75, 0x75, 0x74, 0x51, 0x51, 0x51, 0x52, 0x2c, 0x2c, 0x2c, 0x2e, 0x0d, 0x0d, 0x0d, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d, 0x13, 0x2f, 0x2f, 0x2f, 0x31,
+  0x61, 0x61, 0x61, 0x61, 0xa3, 0xa3, 0xa3, 0xa3, 0xe5, 0xe5, 0xe5, 0xe5, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xfa, 0xd7, 0xfb, 0xff, 0xf7, 0xc1, 0xf8, 0xff, 0xf7, 0xaf, 0xf8, 0xff,
+  0xf1, 0xaa, 0xf3, 0xff, 0xeb, 0xb6, 0xeb, 0xff, 0xf5, 0xd7, 0xf4, 0xff, 0xfe, 0xe2, 0xff, 0xff, 0xfc, 0xd7, 0xfd, 0xff, 0xfc, 0xea, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x80, 0x80, 0x80,
+  0x2c, 0x2c, 0x2c, 0x2e, 0x00, 0x00, 0x00, 0x0b, 0x95, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x15, 0x15, 0x15, 0x18, 0x2e, 0x2e, 0x2e, 0x2c, 0x3f, 0x3f,
+  0x3f, 0x3d, 0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x35, 0x35, 0x24, 0x24, 0x24, 0x23, 0x0f, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x13, 0x2c, 0x2c, 0x2c, 0x2e, 0x59, 0x59, 0x59, 0x59, 0x8e, 0x8e, 0x8e, 0x8e, 0xc1, 0xc1, 0xc1, 0xc0, 0xe5, 0xe5, 0xe5, 0xe5, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xec,
+  0xff, 0xff, 0xfc, 0xd2, 0xfc, 0xff, 0xf5, 0xbb, 0xf5, 0xff, 0xeb, 0xb1, 0xea, 0xff, 0xed, 0xc2, 0xed, 0xff, 0xfa, 0xe1, 0xfa, 0xff, 0xfe, 0xef, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xf4, 0xf4,
+  0xf4, 0xf4, 0x78, 0x78, 0x78, 0x79, 0x2e, 0x2e, 0x2e, 0x2c, 0x00, 0x00, 0x00, 0x0b, 0x95, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09,
+  0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x15, 0x17, 0x17, 0x17, 0x16, 0x0f, 0x0f, 0x0f, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x0f, 0x11, 0x27, 0x27, 0x27, 0x27, 0x45, 0x45, 0x45, 0x46, 0x6d, 0x6d, 0x6d, 0x6c, 0x8e, 0x8e, 0x8e, 0x8e,
+  0xc1, 0xc1, 0xc1, 0xc0, 0xe5, 0xe5, 0xe5, 0xe5, 0xff, 0xf7, 0xff, 0xff, 0xfd, 0xe7, 0xfd, 0xff, 0xf5, 0xd2, 0xf5, 0xff, 0xeb, 0xc2, 0xeb, 0xff, 0xf2, 0xd5, 0xf3, 0xff, 0xff, 0xf4, 0xff, 0xff,
+  0xff, 0xfd, 0xff, 0xff, 0xd4, 0xd4, 0xd4, 0xd4, 0x68, 0x68, 0x68, 0x69, 0x28, 0x28, 0x28, 0x26, 0x00, 0x00, 0x00, 0x09, 0x96, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x14, 0x14, 0x14, 0x0d, 0x1c, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x31, 0x2f, 0x45, 0x45, 0x45, 0x46, 0x6d, 0x6d, 0x6d, 0x6c, 0x8e, 0x8e, 0x8e, 0x8e,
+  0xbf, 0xbf, 0xbf, 0xbe, 0xdc, 0xdc, 0xdc, 0xdc, 0xff, 0xf7, 0xff, 0xff, 0xf7, 0xe6, 0xf8, 0xff, 0xf7, 0xe7, 0xf8, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xa2, 0xa2, 0xa2, 0xa1,
+  0x50, 0x50, 0x50, 0x50, 0x1a, 0x1a, 0x1a, 0x1d, 0x00, 0x00, 0x00, 0x07, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x11, 0x11,
+  0x11, 0x0f, 0x1c, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x31, 0x2f, 0x45, 0x45, 0x45, 0x46, 0x68, 0x68, 0x68, 0x69, 0x82, 0x82, 0x82, 0x83, 0x82, 0xa2, 0xa2, 0xa2, 0xa1, 0x03, 0x65, 0x65, 0x65, 0x65,
+  0x33, 0x33, 0x33, 0x32, 0x0e, 0x0e, 0x0e, 0x12, 0x00, 0x00, 0x00, 0x04, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x11, 0x11,
+  0x11, 0x0f, 0x1c, 0x1c, 0x1c, 0x1b, 0x2d, 0x2d, 0x2d, 0x2d, 0x3f, 0x3f, 0x3f, 0x3d, 0x82, 0x50, 0x50, 0x50, 0x50, 0x03, 0x33, 0x33, 0x33, 0x32, 0x14, 0x14, 0x14, 0x19, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x02, 0x8e, 0x00, 0x00, 0x00, 0x00,
 };
 
 const lv_img_dsc_t logo = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 56,
   .header.h = 56,
-  .data_size = 3136 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+  .data_size = 7849,
   .data = logo_map,
 };
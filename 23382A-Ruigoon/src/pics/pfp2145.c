@@ -21,138 +21,57 @@
 #define LV_ATTRIBUTE_IMG_PFP2145
 #endif
 
+/* Packed by tools/img_pack.py: 22x26, 187 colours, palette, 2288 bytes unpacked.
+ * Decoded on demand by imgcache.cpp */
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_PFP2145 uint8_t pfp2145_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0xbf, 0xfd, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0x9f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0x9f, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0x9f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x3f, 0xfe, 0xff, 0xbf, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xfe, 0xff, 0x1f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0x1f, 0xfe, 0xff, 0x9f, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xfe, 0xff, 0x5f, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0xdf, 0xfe, 0xff, 0x1f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x9f, 0xfe, 0xff, 0x3f, 0xfe, 0xff, 0x7f, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x1f, 0xfe, 0xff, 0x1f, 0xfe, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x1f, 0xfe, 0xff, 0x1f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0x9f, 0xfd, 0xff, 0x1f, 0xfd, 0xff, 0xff, 0xfc, 0xff, 0x7f, 0xfe, 0xff, 0xbf, 0xfd, 0xff, 0xdf, 0xfe, 0xff, 0xbf, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0x9f, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x1f, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0x1f, 0xfe, 0xff, 0x3f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0x5f, 0xfe, 0xff, 0x3f, 0xfe, 0xff, 0x3f, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0xdf, 0xfe, 0xff, 0x3f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfe, 0xff, 0xdf, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0x1f, 0xfe, 0xff, 0x1f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x1f, 0xfd, 0xff, 0x1f, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0x9f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0x3f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9f, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0x7f, 0xfe, 0xff, 0x9f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xfe, 0xff, 0x3f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0x9f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7f, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0x1f, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0x3f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0xff, 0x1f, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xfe, 0xff, 0x1f, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x3f, 0xfd, 0xff, 0x7f, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfd, 0xff, 0x9f, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0x1f, 0xff, 0xff, 0xdf, 0xfd, 0xff, 0x5f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x5f, 0xfd, 0xff, 0x3f, 0xfe, 0xff, 0xdf, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0x7f, 0xff, 0xff, 0x5f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x1f, 0xfd, 0xff, 0x3f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x7f, 0xfe, 0xff, 0x5f, 0xff, 0xff, 0x7f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0xdf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0xbf, 0xfe, 0xff, 0x3f, 0xff, 0xff, 0x1f, 0xfd, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xfe, 0xff, 0x3f, 0xfd, 0xff, 0x3f, 0xfd, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x1f, 0xfe, 0xff, 0x1f, 0xfd, 0xff, 0xbf, 0xfd, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x5f, 0xfd, 0xff, 0x7f, 0xfe, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x3f, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xfd, 0x9f, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0xbf, 0xff, 0xfd, 0x9f, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0x5f, 0xff, 0xfe, 0x3f, 0xff, 0xfd, 0xbf, 0xff, 0xfd, 0x9f, 0xff, 0xfd, 0xdf, 0xff, 0xfd, 0xdf, 0xff, 0xfd, 0x3f, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xfd, 0x1f, 0xff, 0xfd, 0x3f, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0x1f, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x5f, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfe, 0xbf, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x7f, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0x3f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0xdf, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0x1f, 0xff, 0xfd, 0x1f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xfd, 0x9f, 0xff, 0xfd, 0x1f, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xfd, 0xbf, 0xff, 0xfe, 0xdf, 0xff, 0xfd, 0xbf, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0xdf, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0xbf, 0xff, 0xfd, 0x1f, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0x1f, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5f, 0xff, 0xfe, 0x5f, 0xff, 0xfe, 0x3f, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0xdf, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x3f, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xfc, 0xdf, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x3f, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0x1f, 0xff, 0xfd, 0x1f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xfd, 0x1f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0x9f, 0xff, 0xfd, 0x9f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0x5f, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0x9f, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0x7f, 0xff, 0xfd, 0x9f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x3f, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xbf, 0xff, 0xfd, 0x7f, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x3f, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xfd, 0x1f, 0xff, 0xff, 0x7f, 0xff, 0xfe, 0x5f, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xfd, 0x1f, 0xff, 0xfd, 0x5f, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xfd, 0x1f, 0xff, 0xff, 0x7f, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x9f, 0xff, 0xfd, 0x9f, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xfd, 0xdf, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x3f, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfd, 0x5f, 0xff, 0xfe, 0x3f, 0xff, 0xfe, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xfd, 0x1f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x1f, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xfd, 0x5f, 0xff, 0xfd, 0x3f, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0x3f, 0xff, 0xfd, 0x1f, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xfd, 0x3f, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0x5f, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0x1f, 0xff, 0xfd, 0x1f, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x5f, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0x5f, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfc, 0xed, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfc, 0xde, 0xfb, 0xff, 0xfd, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfb, 0xdc, 0xfa, 0xff, 0xfc, 0xd2, 0xfa, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfc, 0xb8, 0xf8, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfc, 0xd9, 0xfa, 0xff, 0xfc, 0xb4, 0xf8, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfe, 0xf8, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xfc, 0xad, 0xf8, 0xff, 0xfc, 0xcc, 0xfa, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfc, 0xca, 0xfa, 0xff, 0xfe, 0xb0, 0xf9, 0xff, 0xfe, 0xac, 0xf9, 0xff, 0xfc, 0xc6, 0xfa, 0xff, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xd2, 0xfa, 0xff, 0xfd, 0xb1, 0xf9, 0xff, 0xfc, 0xda, 0xfa, 0xff, 0xfb, 0xce, 0xf9, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xfa, 0xfd, 0xff, 0xfd, 0xbd, 0xfa, 0xff, 0xfe, 0xa2, 0xf8, 0xff, 0xfd, 0xa6, 0xf8, 0xff, 0xfb, 0xc5, 0xfa, 0xff, 0xfd, 0xb3, 0xf9, 0xff, 0xfe, 0xaf, 0xf9, 0xff, 0xfd, 0xb6, 0xf9, 0xff, 0xfd, 0xb6, 0xf9, 0xff, 0xfd, 0xa5, 0xf8, 0xff, 0xfd, 0xdd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfc, 0xc0, 0xf9, 0xff, 0xfe, 0x9e, 0xf8, 0xff, 0xfe, 0xa3, 0xf8, 0xff, 0xfc, 0xd0, 0xfa, 0xff, 0xfc, 0xc1, 0xf9, 0xff, 0xfc, 0xd0, 0xfa, 0xff, 0xfc, 0xda, 0xfa, 0xff, 0xfd, 0xcd, 0xfa, 0xff, 0xfd, 0xc6, 0xfa, 0xff, 0xfc, 0xda, 0xfb, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfc, 0xd2, 0xfa, 0xff, 0xfd, 0xd6, 0xfb, 0xff, 0xfc, 0xde, 0xfb, 0xff, 0xfb, 0xeb, 0xfb, 0xff, 0xfc, 0xcf, 0xfa, 0xff, 0xfc, 0xc3, 0xf9, 0xff, 0xfe, 0xab, 0xf9, 0xff, 0xfe, 0xb6, 0xf9, 0xff, 0xfe, 0xb9, 0xfa, 0xff, 0xfd, 0xc4, 0xfa, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xfc, 0xdc, 0xfb, 0xff, 0xfd, 0xc0, 0xfa, 0xff, 0xfd, 0xc1, 0xf9, 0xff, 0xfc, 0xe9, 0xfb, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xfc, 0xc0, 0xf9, 0xff, 0xfe, 0xa1, 0xf8, 0xff, 0xff, 0xab, 0xf8, 0xff, 0xfe, 0xa8, 0xf8, 0xff, 0xff, 0xa3, 0xf8, 0xff, 0xfd, 0xb2, 0xf9, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfc, 0xd5, 0xfa, 0xff, 0xfd, 0xaf, 0xf9, 0xff, 0xfe, 0x9e, 0xf8, 0xff, 0xfd, 0x9d, 0xf7, 0xff, 0xfb, 0xca, 0xf9, 0xff, 0xfc, 0xb4, 0xf8, 0xff, 0xfc, 0xd8, 0xfb, 0xff, 0xfd, 0xb3, 0xf9, 0xff, 0xfe, 0xa8, 0xf9, 0xff, 0xff, 0xab, 0xf9, 0xff, 0xfe, 0xab, 0xf9, 0xff, 0xff, 0xac, 0xf9, 0xff, 0xfe, 0xa5, 0xf8, 0xff, 0xfd, 0xe5, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xfd, 0xd6, 0xfb, 0xff, 0xfc, 0xcf, 0xfa, 0xff, 0xfc, 0xd4, 0xfa, 0xff, 0xfd, 0x9e, 0xf8, 0xff, 0xfc, 0xd0, 0xfb, 0xff, 0xfc, 0xc1, 0xfa, 0xff, 0xfe, 0xa5, 0xf8, 0xff, 0xff, 0xab, 0xf9, 0xff, 0xfe, 0xab, 0xf9, 0xff, 0xff, 0xac, 0xf9, 0xff, 0xfe, 0xa4, 0xf8, 0xff, 0xfe, 0xe1, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfc, 0xc8, 0xfa, 0xff, 0xfc, 0xc7, 0xfa, 0xff, 0xfd, 0xc4, 0xfa, 0xff, 0xfe, 0xa2, 0xf8, 0xff, 0xfd, 0xb7, 0xf9, 0xff, 0xfc, 0xd7, 0xfb, 0xff, 0xfe, 0xa4, 0xf8, 0xff, 0xfe, 0xac, 0xf9, 0xff, 0xfe, 0xa9, 0xf9, 0xff, 0xff, 0xac, 0xf9, 0xff, 0xfe, 0xa4, 0xf8, 0xff, 0xfd, 0xd8, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xc4, 0xf9, 0xff, 0xfe, 0x98, 0xf8, 0xff, 0xfc, 0xdb, 0xfb, 0xff, 0xfe, 0xba, 0xfa, 0xff, 0xff, 0xa7, 0xf8, 0xff, 0xfe, 0xa5, 0xf8, 0xff, 0xfc, 0xce, 0xfa, 0xff, 0xfd, 0xc1, 0xf9, 0xff, 0xfe, 0xa1, 0xf8, 0xff, 0xff, 0xac, 0xf9, 0xff, 0xfe, 0xab, 0xf9, 0xff, 0xff, 0xa5, 0xf8, 0xff, 0xfd, 0xbd, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xe8, 0xfb, 0xff, 0xfd, 0x9f, 0xf8, 0xff, 0xfd, 0xbe, 0xfa, 0xff, 0xfc, 0xf1, 0xfc, 0xff, 0xfe, 0xae, 0xf9, 0xff, 0xff, 0xa9, 0xf8, 0xff, 0xfe, 0xab, 0xf9, 0xff, 0xfe, 0xa8, 0xf8, 0xff, 0xfc, 0xe6, 0xfb, 0xff, 0xfc, 0xc9, 0xfa, 0xff, 0xfe, 0xa4, 0xf8, 0xff, 0xfe, 0xac, 0xf9, 0xff, 0xff, 0xab, 0xf9, 0xff, 0xfe, 0xa7, 0xf8, 0xff, 0xfd, 0xec, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf7, 0xfd, 0xff, 0xfc, 0xb0, 0xf8, 0xff, 0xfd, 0xb6, 0xf9, 0xff, 0xfb, 0xd1, 0xfa, 0xff, 0xfd, 0xcd, 0xfa, 0xff, 0xfe, 0xb0, 0xf9, 0xff, 0xff, 0xa8, 0xf8, 0xff, 0xfe, 0xac, 0xf9, 0xff, 0xfe, 0xa5, 0xf8, 0xff, 0xfc, 0xe6, 0xfb, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0xbf, 0xf9, 0xff, 0xfe, 0xa5, 0xf8, 0xff, 0xff, 0xad, 0xf9, 0xff, 0xfe, 0xa4, 0xf8, 0xff, 0xfd, 0xcf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xfd, 0xea, 0xfc, 0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xfd, 0xab, 0xf8, 0xff, 0xfd, 0xdb, 0xfc, 0xff, 0xfd, 0xba, 0xf9, 0xff, 0xff, 0xa6, 0xf8, 0xff, 0xff, 0xa9, 0xf9, 0xff, 0xfd, 0xaf, 0xf9, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xfc, 0xff, 0xfd, 0xac, 0xf8, 0xff, 0xff, 0xad, 0xf9, 0xff, 0xfe, 0xa4, 0xf8, 0xff, 0xfd, 0xc3, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfb, 0xd9, 0xfb, 0xff, 0xfd, 0x9e, 0xf8, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfc, 0xc8, 0xfa, 0xff, 0xff, 0xa4, 0xf8, 0xff, 0xfe, 0xa8, 0xf8, 0xff, 0xfd, 0xb6, 0xf9, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xce, 0xfb, 0xff, 0xfd, 0x9e, 0xf7, 0xff, 0xfd, 0xa8, 0xf8, 0xff, 0xfc, 0xe9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xbf, 0xfa, 0xff, 0xfe, 0xa1, 0xf8, 0xff, 0xfc, 0xed, 0xfb, 0xff, 0xfd, 0xdc, 0xfb, 0xff, 0xfe, 0xa3, 0xf8, 0xff, 0xfe, 0xab, 0xf9, 0xff, 0xfe, 0xaf, 0xf9, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfd, 0xd3, 0xfb, 0xff, 0xfd, 0xeb, 0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfe, 0xb0, 0xf9, 0xff, 0xfe, 0xaf, 0xf9, 0xff, 0xfc, 0xdc, 0xfb, 0xff, 0xfc, 0xdf, 0xfb, 0xff, 0xfc, 0xb8, 0xf9, 0xff, 0xfe, 0xa6, 0xf8, 0xff, 0xfe, 0xa5, 0xf8, 0xff, 0xfd, 0xd7, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfd, 0xa6, 0xf8, 0xff, 0xfd, 0xc4, 0xfa, 0xff, 0xfd, 0xd7, 0xfb, 0xff, 0xfc, 0xba, 0xf9, 0xff, 0xfc, 0xed, 0xfb, 0xff, 0xfd, 0xa9, 0xf8, 0xff, 0xff, 0xa5, 0xf8, 0xff, 0xfd, 0xb3, 0xf9, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xeb, 0xfd, 0xff, 0xfd, 0x9f, 0xf8, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xfd, 0xe0, 0xfc, 0xff, 0xfe, 0x9c, 0xf8, 0xff, 0xfc, 0xcd, 0xf9, 0xff, 0xfc, 0xe9, 0xfb, 0xff, 0xfd, 0xab, 0xf9, 0xff, 0xfe, 0xa3, 0xf8, 0xff, 0xfd, 0xe1, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xd4, 0xfb, 0xff, 0xfd, 0xb6, 0xf9, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xe9, 0xfc, 0xff, 0xfd, 0xa7, 0xf8, 0xff, 0xfe, 0xa2, 0xf8, 0xff, 0xfc, 0xd3, 0xfa, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xfe, 0x9f, 0xf8, 0xff, 0xfd, 0xcb, 0xfa, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xd0, 0xf9, 0xff, 0xfd, 0xef, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfc, 0xbe, 0xf9, 0xff, 0xff, 0xa3, 0xf8, 0xff, 0xfe, 0xa4, 0xf8, 0xff, 0xfc, 0xe6, 0xfb, 0xff, 0xfc, 0xc6, 0xf9, 0xff, 0xfd, 0xbc, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xfd, 0xff, 0xfc, 0xf5, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfc, 0xc0, 0xf9, 0xff, 0xfe, 0xa0, 0xf8, 0xff, 0xfd, 0xb2, 0xf9, 0xff, 0xfc, 0xe6, 0xfc, 0xff, 0xfd, 0xc6, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfc, 0xdb, 0xfa, 0xff, 0xfd, 0xa7, 0xf8, 0xff, 0xfc, 0xca, 0xfa, 0xff, 0xfb, 0xef, 0xfb, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xef, 0xfc, 0xff, 0xfc, 0xc4, 0xf9, 0xff, 0xfc, 0xf7, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-#endif
+  0x52, 0x49, 0x4d, 0x47, 0x01, 0x01, 0xbb, 0x00, 0x16, 0x00, 0x1a, 0x00, 0xf7, 0x9d, 0xfd, 0xff, 0xf7, 0x9e, 0xfd, 0xff, 0xf8, 0x98, 0xfe, 0xff, 0xf8, 0x9c, 0xfe, 0xff, 0xf8, 0x9e, 0xfd, 0xff,
+  0xf8, 0x9e, 0xfe, 0xff, 0xf8, 0x9f, 0xfd, 0xff, 0xf8, 0x9f, 0xfe, 0xff, 0xf8, 0xa0, 0xfe, 0xff, 0xf8, 0xa1, 0xfe, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf8, 0xa3, 0xff, 0xff,
+  0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf8, 0xa5, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xa6, 0xff, 0xff,
+  0xf8, 0xa7, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf8, 0xa9, 0xfd, 0xff, 0xf8, 0xa9, 0xff, 0xff,
+  0xf8, 0xab, 0xfd, 0xff, 0xf8, 0xab, 0xff, 0xff, 0xf8, 0xac, 0xfd, 0xff, 0xf8, 0xad, 0xfc, 0xff, 0xf8, 0xb0, 0xfc, 0xff, 0xf8, 0xb4, 0xfc, 0xff, 0xf8, 0xb8, 0xfc, 0xff, 0xf9, 0xa8, 0xfe, 0xff,
+  0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xab, 0xfd, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xad, 0xff, 0xff,
+  0xf9, 0xae, 0xfe, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff,
+  0xf9, 0xb6, 0xfe, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xb8, 0xfc, 0xff, 0xf9, 0xba, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xf9, 0xbe, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff,
+  0xf9, 0xc0, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xf9, 0xc3, 0xfc, 0xff, 0xf9, 0xc4, 0xfd, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xf9, 0xca, 0xfb, 0xff, 0xf9, 0xcd, 0xfc, 0xff,
+  0xf9, 0xce, 0xfb, 0xff, 0xf9, 0xd0, 0xfc, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xfa, 0xba, 0xfe, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff,
+  0xfa, 0xc0, 0xfd, 0xff, 0xfa, 0xc1, 0xfc, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xc5, 0xfb, 0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xfa, 0xc7, 0xfc, 0xff,
+  0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff,
+  0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xd1, 0xfb, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xfa, 0xd5, 0xfc, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xfa, 0xda, 0xfc, 0xff,
+  0xfa, 0xdc, 0xfb, 0xff, 0xfb, 0xce, 0xfc, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfb, 0xd0, 0xfc, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff,
+  0xfb, 0xd7, 0xfd, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xfb, 0xd8, 0xfd, 0xff, 0xfb, 0xd9, 0xfb, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xfb, 0xdc, 0xfd, 0xff,
+  0xfb, 0xde, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfb, 0xe1, 0xfd, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xfb, 0xe8, 0xfc, 0xff, 0xfb, 0xe9, 0xfc, 0xff,
+  0xfb, 0xeb, 0xfb, 0xff, 0xfb, 0xed, 0xfc, 0xff, 0xfc, 0xdb, 0xfd, 0xff, 0xfc, 0xdd, 0xfd, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xfc, 0xe1, 0xfe, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xfc, 0xe5, 0xfd, 0xff,
+  0xfc, 0xe6, 0xfc, 0xff, 0xfc, 0xe9, 0xfc, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfc, 0xea, 0xfd, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfc, 0xed, 0xfc, 0xff,
+  0xfc, 0xef, 0xfd, 0xff, 0xfc, 0xf0, 0xfc, 0xff, 0xfc, 0xf1, 0xfc, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0xff, 0xfc, 0xf5, 0xfc, 0xff, 0xfc, 0xf5, 0xfd, 0xff, 0xfc, 0xf8, 0xfd, 0xff,
+  0xfd, 0xeb, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfd, 0xf7, 0xfc, 0xff, 0xfd, 0xf7, 0xfd, 0xff,
+  0xfd, 0xf8, 0xfe, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfd, 0xfa, 0xfc, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfd, 0xfc, 0xfd, 0xff,
+  0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff,
+  0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xba, 0x05, 0xb1, 0xba, 0x96, 0x8c, 0xba,
+  0xb1, 0x8b, 0xba, 0x07, 0xb1, 0xb8, 0xb1, 0xa3, 0x75, 0x94, 0xba, 0xb1, 0x8b, 0xba, 0x07, 0xb1, 0xb8, 0xb3, 0x65, 0x5f, 0xb3, 0xb8, 0xb1, 0x86, 0xba, 0x00, 0xb4, 0x82, 0xb1, 0x06, 0xba, 0x99,
+  0x23, 0x83, 0xba, 0xae, 0xb2, 0x84, 0xba, 0x0d, 0xb7, 0xb4, 0xb1, 0xb2, 0xba, 0xb8, 0xb4, 0xaf, 0xb3, 0x63, 0x22, 0x99, 0xba, 0xb1, 0x84, 0xba, 0x0f, 0xb8, 0xb4, 0xb8, 0xb1, 0xb4, 0xac, 0xaa,
+  0x9d, 0xb4, 0x90, 0x20, 0x59, 0xa8, 0xad, 0xba, 0xb1, 0x82, 0xba, 0x10, 0xb1, 0xba, 0xb1, 0xb9, 0xa1, 0x57, 0x30, 0x2a, 0x52, 0x91, 0x5f, 0x31, 0x64, 0x45, 0xa0, 0xba, 0xb1, 0x82, 0xba, 0x10,
+  0xb1, 0xb8, 0xb4, 0x9f, 0x4a, 0x0a, 0x12, 0x51, 0x33, 0x2f, 0x34, 0x34, 0x0f, 0x80, 0xba, 0xae, 0xb1, 0x81, 0xba, 0x26, 0xb8, 0xb1, 0xb8, 0xb3, 0x3d, 0x05, 0x0b, 0x5d, 0x3e, 0x5d, 0x64, 0x5a,
+  0x53, 0x71, 0xa7, 0xb8, 0xb1, 0xb8, 0xba, 0xba, 0xb8, 0xba, 0xb2, 0xae, 0xb4, 0x96, 0x5f, 0x6b, 0x75, 0x7d, 0x5c, 0x40, 0x28, 0x35, 0x47, 0x50, 0xa5, 0xba, 0xb1, 0x81, 0xba, 0x11, 0xb4, 0xb2,
+  0xb4, 0xa4, 0x73, 0x4d, 0x3f, 0x7c, 0x7a, 0x3d, 0x09, 0x1e, 0x19, 0x0c, 0x32, 0xa3, 0xba, 0xb1, 0x80, 0xba, 0x12, 0xb1, 0xba, 0xa6, 0x62, 0x2e, 0x05, 0x00, 0x43, 0x22, 0x6e, 0x33, 0x24, 0x29,
+  0x28, 0x2b, 0x10, 0x84, 0xba, 0xae, 0x80, 0xba, 0x13, 0xb1, 0xba, 0xb1, 0x97, 0x83, 0x6b, 0x5c, 0x61, 0x04, 0x68, 0x4e, 0x10, 0x29, 0x28, 0x2b, 0x0d, 0x82, 0xba, 0xae, 0xb8, 0x80, 0xba, 0x7f,
+  0xb4, 0xb1, 0xba, 0xa3, 0x55, 0x54, 0x50, 0x0a, 0x36, 0x6c, 0x0d, 0x2a, 0x25, 0x2b, 0x0d, 0x6f, 0xb9, 0xaf, 0xb1, 0xba, 0xba, 0xb8, 0xb1, 0xb8, 0xa9, 0x41, 0x02, 0x72, 0x48, 0x17, 0x10, 0x5b,
+  0x3f, 0x09, 0x2b, 0x28, 0x11, 0x3a, 0xa9, 0xb8, 0xb1, 0xba, 0xba, 0xb4, 0xb2, 0xb4, 0x7b, 0x06, 0x4b, 0x8f, 0x2d, 0x1c, 0x28, 0x19, 0x79, 0x56, 0x0d, 0x2a, 0x29, 0x16, 0x8b, 0xba, 0xb1, 0xba,
+  0xba, 0xb1, 0xba, 0x9b, 0x21, 0x34, 0x5e, 0x5a, 0x30, 0x1a, 0x2a, 0x10, 0x79, 0xa8, 0x3c, 0x10, 0x2c, 0x0d, 0x67, 0xba, 0xae, 0xb8, 0xba, 0xb1, 0xba, 0x90, 0x89, 0x93, 0x1d, 0x7f, 0x39, 0x14,
+  0x26, 0x2e, 0xab, 0xba, 0x8e, 0x1f, 0x2c, 0x0d, 0x4f, 0xba, 0xae, 0xb8, 0xba, 0xb4, 0xb1, 0xae, 0xa9, 0x70, 0x04, 0x88, 0x55, 0x0e, 0x19, 0x34, 0xae, 0xb2, 0xb4, 0x66, 0x01, 0x18, 0x86, 0xba,
+  0x16, 0xb1, 0xba, 0xba, 0xb8, 0xb1, 0xb8, 0xb4, 0x4c, 0x09, 0x7e, 0x74, 0x0b, 0x28, 0x2f, 0x9a, 0xb4, 0xb4, 0x9a, 0x69, 0x8a, 0xb3, 0xb8, 0xb1, 0x80, 0xba, 0x12, 0xb1, 0xba, 0xa0, 0x30, 0x2f,
+  0x73, 0x76, 0x37, 0x13, 0x10, 0x6d, 0xb4, 0xb5, 0xb1, 0xb9, 0xb8, 0xb1, 0xba, 0xb8, 0x80, 0xba, 0x12, 0xb1, 0xba, 0x98, 0x12, 0x50, 0x6d, 0x38, 0x7e, 0x1b, 0x11, 0x33, 0x9e, 0xb4, 0xb1, 0xae,
+  0xb1, 0xb4, 0xb8, 0xb8, 0x80, 0xba, 0x0e, 0xb1, 0xba, 0x95, 0x06, 0x78, 0x81, 0x03, 0x44, 0x7c, 0x27, 0x0b, 0x77, 0xb4, 0xb6, 0xb1, 0x83, 0xba, 0x0f, 0xb1, 0xaf, 0xb9, 0x6a, 0x34, 0xb3, 0x87,
+  0x15, 0x0a, 0x60, 0x78, 0x07, 0x58, 0xb3, 0xb6, 0xb1, 0x83, 0xba, 0x0f, 0xb1, 0xb8, 0xa9, 0x46, 0x8d, 0xba, 0xb0, 0x3b, 0x0c, 0x0d, 0x79, 0x42, 0x49, 0xb4, 0xb8, 0xb1, 0x83, 0xba, 0x0f, 0xb1,
+  0xba, 0xa2, 0x92, 0xb4, 0xb2, 0xb4, 0x9c, 0x3d, 0x08, 0x32, 0x85, 0x53, 0xb4, 0xb8, 0xb1, 0x82, 0xba,
 };
 
 const lv_img_dsc_t pfp2145 = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
   .header.always_zero = 0,
   .header.reserved = 0,
-  .header.w = 22, //22
-  .header.h = 26, //25
-  .data_size = 616 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+  .header.w = 22,
+  .header.h = 26,
+  .data_size = 1265,
   .data = pfp2145_map,
 };
@@ -0,0 +1,1824 @@
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "liblvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMG_ROBOTATLAS
+#define LV_ATTRIBUTE_IMG_ROBOTATLAS
+#endif
+
+/* Packed by tools/img_pack.py: 36x864, 616 colours, RGBA, 124416 bytes unpacked.
+ * Decoded on demand by imgcache.cpp */
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_ROBOTATLAS uint8_t robotAtlas_map[] = {
+  0x52, 0x49, 0x4d, 0x47, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x60, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfc, 0xed, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff,
+  0xff, 0xff, 0x08, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfc, 0xf8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x08, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfa, 0xdc,
+  0xfb, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xfe, 0xff, 0xfe, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xf8, 0xb8, 0xfc, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x83, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xf8, 0xb4,
+  0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0xff,
+  0x10, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfd, 0xf8, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xf8, 0xad, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0x11, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xfd, 0xfa, 0xfe, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xfc, 0xf3, 0xfc, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xf9, 0xb1, 0xfd, 0xff,
+  0xfa, 0xda, 0xfc, 0xff, 0xf9, 0xce, 0xfb, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff,
+  0xff, 0xff, 0x11, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xfa, 0xfc, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xfa,
+  0xc5, 0xfb, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0xa5, 0xfd, 0xff, 0xfc, 0xdd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xf8, 0x9e, 0xfe, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xda,
+  0xfc, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xfd, 0xf1, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfb, 0xeb, 0xfb, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xc3, 0xfc, 0xff, 0xf9, 0xab, 0xfe, 0xff,
+  0xf9, 0xb6, 0xfe, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xfb, 0xdc,
+  0xfc, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xfb, 0xe9, 0xfc, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xf8, 0xa1, 0xfe, 0xff, 0xf8, 0xab, 0xff, 0xff, 0xf8, 0xa8,
+  0xfe, 0xff, 0xf8, 0xa3, 0xff, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfa, 0xd5, 0xfc, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf8, 0x9e, 0xfe, 0xff,
+  0xf7, 0x9d, 0xfd, 0xff, 0xf9, 0xca, 0xfb, 0xff, 0xf8, 0xb4, 0xfc, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff,
+  0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfa, 0xcf,
+  0xfc, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xf8, 0x9e, 0xfd, 0xff, 0xfb, 0xd0, 0xfc, 0xff, 0xfa, 0xc1, 0xfc, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xac,
+  0xff, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xfc, 0xe1, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xc7, 0xfc, 0xff,
+  0xfa, 0xc4, 0xfd, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff,
+  0xf8, 0xa4, 0xfe, 0xff, 0xfb, 0xd8, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xc4, 0xfd, 0xff, 0xf8, 0x98, 0xfe, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfa, 0xba,
+  0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xf8, 0xa1, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa5,
+  0xff, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xe8, 0xfc, 0xff, 0xf8, 0x9f, 0xfd, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfc, 0xf1, 0xfc, 0xff, 0xf9, 0xae, 0xfe, 0xff,
+  0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff,
+  0xf8, 0xa7, 0xfe, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf7, 0xfc, 0xff, 0xf8, 0xb0, 0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfa, 0xd1, 0xfb, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf8, 0xa8,
+  0xff, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xad, 0xff, 0xff, 0xf8, 0xa4,
+  0xfe, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xfc, 0xea, 0xfd, 0xff, 0xfc, 0xf5, 0xfd, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xfc, 0xdb, 0xfd, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf8, 0xa6, 0xff, 0xff,
+  0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xfc, 0xff, 0xf8, 0xac, 0xfd, 0xff, 0xf9, 0xad, 0xff, 0xff, 0xf8, 0xa4, 0xfe, 0xff,
+  0xfa, 0xc3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfb, 0xd9, 0xfb, 0xff, 0xf8, 0x9e, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf8, 0xa8,
+  0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xce, 0xfc, 0xff, 0xf7, 0x9e, 0xfd, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xfc, 0xe9,
+  0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf8, 0xa1, 0xfe, 0xff, 0xfb, 0xed, 0xfc, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff,
+  0xf9, 0xaf, 0xfe, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xb8, 0xfc, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xa5,
+  0xfe, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfd, 0xf4, 0xfd, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xf9, 0xba, 0xfc, 0xff, 0xfb, 0xed, 0xfc, 0xff, 0xf8, 0xa9, 0xfd, 0xff, 0xf8, 0xa5, 0xff, 0xff,
+  0xf9, 0xb3, 0xfd, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xeb,
+  0xfe, 0xff, 0xf8, 0x9f, 0xfd, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xf8, 0x9c, 0xfe, 0xff, 0xf9, 0xcd, 0xfc, 0xff, 0xfb, 0xe9, 0xfc, 0xff, 0xf9, 0xab, 0xfd, 0xff, 0xf8, 0xa3,
+  0xfe, 0xff, 0xfb, 0xe1, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xf8, 0xa7, 0xfd,
+  0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xf8, 0x9f, 0xfe, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xd0, 0xfc, 0xff,
+  0xfc, 0xef, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf9, 0xbe, 0xfc, 0xff, 0xf8, 0xa3, 0xff, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff,
+  0xfa, 0xbc, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfc, 0xf5, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xf9,
+  0xc0, 0xfc, 0xff, 0xf8, 0xa0, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfc, 0xe6, 0xfc, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0x36, 0x9f, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0x24, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xc2, 0x82, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0x96, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x12, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0x0e, 0x87, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x01, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0x50, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xb5, 0xfe, 0xfe, 0xfe, 0x73, 0xff, 0xff, 0xff, 0x31, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0x92, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x07, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf2, 0xfd, 0xe5, 0xfc, 0xed,
+  0xfc, 0xa3, 0xff, 0xfd, 0xff, 0x61, 0xfe, 0xfe, 0xfe, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd4, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xfa, 0xfd, 0xff,
+  0xfc, 0xf0, 0xfd, 0xff, 0xfb, 0xe5, 0xfc, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0x20, 0x82, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfc, 0xe8, 0xfc, 0xff,
+  0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x62, 0x81, 0xff, 0xff, 0xff, 0xff, 0x12,
+  0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff,
+  0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa4, 0x80, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfd, 0xee, 0xfd, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfa, 0xbb, 0xfe, 0xff, 0xfb, 0xcf, 0xfe, 0xff,
+  0xfc, 0xec, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xec, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x89, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+  0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x0f, 0xfb, 0xdc, 0xfc, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xf9, 0xb5, 0xfc, 0xff, 0xfa, 0xbb, 0xfc, 0xff,
+  0xfa, 0xcf, 0xfc, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xf9, 0xc3,
+  0xfc, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfe, 0xfd,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x97, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xf3, 0xfe, 0xff, 0xfc, 0xe2, 0xfd, 0xff, 0xfb, 0xdf, 0xfd, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfa, 0xcf, 0xfd, 0xff, 0xfb, 0xe2, 0xfc, 0xff,
+  0xfb, 0xe9, 0xfb, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfc, 0xda, 0xfd, 0xff,
+  0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xfb, 0xd6, 0xfc, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf8, 0x9e, 0xfe, 0xff, 0xf8, 0xb5, 0xfc, 0xff, 0xf9, 0xca,
+  0xfc, 0xff, 0xfb, 0xe0, 0xfc, 0xff, 0xfa, 0xdb, 0xfb, 0xff, 0xf9, 0xbd, 0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfb, 0xd7,
+  0xfc, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0x88, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfb, 0xd8, 0xfd, 0xff,
+  0xfa, 0xcf, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf8, 0xb6, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf8, 0xaa, 0xff, 0xff,
+  0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
+  0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xfb, 0xe0,
+  0xfd, 0xff, 0xfa, 0xc0, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xf8, 0xa3, 0xfd, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xaa,
+  0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xfb, 0xdb, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf7, 0xfd, 0xff,
+  0xfa, 0xd8, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xfa, 0xb8, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfb, 0xce, 0xfc, 0xff,
+  0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfc, 0xde, 0xfd, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0xc7, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9,
+  0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf9, 0xb5,
+  0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfc, 0xe4, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xfc, 0xff, 0xfb, 0xe3, 0xfd, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xf9, 0xc5, 0xfc, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xf9, 0xb8, 0xfe, 0xff,
+  0xf8, 0xaa, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xa8, 0xfe, 0xff,
+  0xf9, 0xb6, 0xfe, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff,
+  0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xf8, 0xac, 0xfd, 0xff, 0xfc, 0xda,
+  0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf9, 0xaa,
+  0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfc, 0xe6, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x89, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xe6, 0xfd, 0xff, 0xfa, 0xba, 0xfd, 0xff,
+  0xf9, 0xba, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf8, 0xa6, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xfd, 0xf3, 0xfe, 0xff, 0xfe, 0xfa, 0xfd, 0xff,
+  0xf9, 0xc6, 0xfc, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfc, 0xe4, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x31, 0x89, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfb, 0xcb,
+  0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfb, 0xe3, 0xfd, 0xff, 0xf9, 0xbb, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xfe, 0xfc,
+  0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xdd, 0xfd, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfc, 0xd7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfd, 0xf4, 0xfd, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xf9, 0xb7, 0xfe, 0xff, 0xfb, 0xd6, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff,
+  0xfc, 0xe1, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfc, 0xe1, 0xfe, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xa4, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0xfc, 0xda, 0xfe, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xfb, 0xd4, 0xfc, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xf8, 0xa7,
+  0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfc, 0xe4,
+  0xfc, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x62, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0xa8, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xe8, 0xfd, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff,
+  0xfa, 0xd6, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff,
+  0xfe, 0xf6, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x89, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff,
+  0xff, 0xc2, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfa, 0xde, 0xfc, 0xff, 0xfb, 0xe2, 0xfd, 0xff, 0xfe, 0xf4, 0xfe, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfa, 0xc1,
+  0xfd, 0xff, 0xf8, 0xa7, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf9, 0xa9, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x02,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xfe, 0xfe, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0x61, 0xfd, 0xfb, 0xfc, 0xa3, 0xfc, 0xf5,
+  0xfc, 0xe5, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xb0,
+  0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfe, 0xff, 0xfe, 0x31, 0xfe, 0xfe, 0xff, 0x73, 0xfe, 0xfd, 0xfe, 0xb5, 0xfc, 0xee, 0xfd, 0xf7,
+  0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfa, 0xd8, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x50, 0x92, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfb, 0xe0, 0xfd, 0x01, 0xf9, 0xb4, 0xfd, 0x43, 0xf8, 0xa6, 0xfe, 0x85, 0xfa, 0xc3, 0xfd, 0xc7,
+  0xfb, 0xdc, 0xfc, 0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0e, 0x96, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xfb, 0xd5, 0xfd, 0x12, 0xfc, 0xe3, 0xfe, 0x54, 0xfe, 0xff, 0xfe, 0x96, 0xff, 0xfe, 0xff, 0xd8, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0xff, 0xc2, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+  0x9f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x36,
+  0xff, 0xff, 0xff, 0x75, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0x53, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0x5a, 0x81, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0x31, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd9, 0x83, 0xff, 0xff, 0xff,
+  0xff, 0x01, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x0f, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7c, 0x85, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff,
+  0xff, 0x6c, 0x95, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0x87, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0x4a, 0x93, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x9e, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x28, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x41,
+  0x83, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x80, 0xfe, 0xff, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x85, 0xfe, 0xfe, 0xfe,
+  0x06, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x81, 0xff, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xe3, 0xff,
+  0xfc, 0xff, 0x63, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x05, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfc, 0xef, 0xfc, 0xc0, 0xfd, 0xf5, 0xfd, 0x41, 0x89,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfd, 0xf0, 0xfe, 0xff, 0xfe, 0xf9, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfc, 0xec, 0xfc, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfc, 0xf5, 0xfd,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0x9e, 0xff, 0xff, 0xff, 0x1f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfc, 0xe3, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8,
+  0xa3, 0xfe, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfc, 0xdb, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xf8,
+  0xba, 0xfc, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x86, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xff, 0x28, 0x80, 0xff, 0xff, 0xff, 0xff, 0x16, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfa, 0xd0, 0xfd, 0xff, 0xfb, 0xdb, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfa,
+  0xcd, 0xfc, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9, 0xbb, 0xfc, 0xff, 0xfa, 0xbe, 0xfc, 0xff, 0xfa, 0xc3, 0xfc, 0xff, 0xfc, 0xf4, 0xfc, 0xff, 0xfc,
+  0xe9, 0xfc, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xf9, 0xc2, 0xfc, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0x86, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf8, 0xaa, 0xfd, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfb, 0xe2, 0xfb,
+  0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfd, 0xfb, 0xfc,
+  0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x86, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x4a, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xf9,
+  0xbc, 0xfc, 0xff, 0xf9, 0xc9, 0xfb, 0xff, 0xf9, 0xc9, 0xfc, 0xff, 0xfb, 0xe6, 0xfb, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xfa,
+  0xc3, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xd2, 0xfc, 0xff, 0xfc, 0xee, 0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+  0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xca, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xf9, 0xfe, 0xff, 0xfc, 0xed, 0xfd, 0xff, 0xf9,
+  0xc7, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xf9, 0xb7, 0xfc, 0xff, 0xfb, 0xd2, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf8,
+  0xa5, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xb4, 0xfe, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x86, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf6, 0xfc, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xfa, 0xba, 0xfd, 0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xfa, 0xbe, 0xfd,
+  0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xfa, 0xc4, 0xfc, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xb2, 0xfe,
+  0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xfc, 0xf3, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff,
+  0x0f, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xec, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xf2, 0xfd, 0xff, 0xfb,
+  0xda, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xf9, 0xae, 0xff, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xfa,
+  0xc8, 0xfc, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x86, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xf9, 0xc6, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfa, 0xc3, 0xfd,
+  0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xfa, 0xc5, 0xfc, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe,
+  0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x86, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfa, 0xc2, 0xfc,
+  0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xf8, 0xab, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfa, 0xcb, 0xfd,
+  0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xfa, 0xc4, 0xfe, 0xff, 0xfd, 0xee, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x86, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfa, 0xbb, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xfa, 0xd0, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf8,
+  0xa6, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf8,
+  0xab, 0xfe, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x86, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xfe, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xf9, 0xb1, 0xfd,
+  0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfb, 0xdd, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfb, 0xd0, 0xfd, 0xff, 0xfd, 0xf5, 0xfd,
+  0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xb3, 0xfe, 0xff, 0xfc, 0xe4, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x86, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xd0, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xf8, 0xa1, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf9,
+  0xac, 0xfd, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9,
+  0xaa, 0xff, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x87, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0xff, 0xff, 0xff, 0x1f, 0xfe, 0xfe, 0xfe, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfc, 0xea, 0xfc,
+  0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xf8, 0xad, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfb, 0xd0, 0xfd, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfe, 0xff, 0xfe,
+  0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9, 0xad, 0xff, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xfd, 0xf0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x06, 0x89, 0x00, 0x00, 0x00, 0x00, 0x16, 0xfe, 0xfd, 0xfd, 0x41, 0xfd, 0xf8, 0xfc, 0xc0, 0xfc, 0xf0, 0xfd, 0xff, 0xfd, 0xf5, 0xfe, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf8, 0xb5, 0xfd, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf8, 0xa4, 0xfd, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x13, 0xfe, 0xfd, 0xfe, 0x63, 0xfe, 0xfe, 0xff, 0xe3, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xe8, 0xfd,
+  0xff, 0xf8, 0xb0, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xfa, 0xdb, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe,
+  0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfa, 0xcf, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xc0, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xfe, 0xff, 0x06, 0xfe, 0xff, 0xfe, 0x85, 0xfd, 0xf7, 0xfd, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa,
+  0xcb, 0xfc, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfb, 0xe4, 0xfd, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x41, 0x90, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfb, 0xe2, 0xfd, 0x28, 0xf9, 0xb8, 0xfd, 0xa7, 0xf8, 0xa4, 0xfe, 0xff, 0xfa,
+  0xd3, 0xfc, 0xff, 0xf9, 0xc5, 0xfc, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x93, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf9, 0xab, 0xfd, 0x4a, 0xfa, 0xcb, 0xfd, 0xca, 0xfb, 0xd4, 0xfc, 0xff, 0xfb,
+  0xcc, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfc, 0xff, 0xff, 0xff, 0x1f, 0x95, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfa, 0xcb, 0xfd, 0x6c, 0xfd, 0xef, 0xfe, 0xec, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x7c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xff, 0xfe, 0x0f, 0xff, 0xfe, 0xff, 0x8e, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xff, 0xff, 0xff, 0xd9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xfe, 0xfe, 0x31, 0xff, 0xff, 0xff, 0xb1, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x5a, 0x9c, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x75, 0xff, 0xff, 0xff,
+  0x36, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0x11, 0x9d, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
+  0x30, 0xff, 0xff, 0xff, 0xe4, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff,
+  0xe4, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x97, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x84, 0xff, 0xff,
+  0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x95, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x86, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff,
+  0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x88, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff,
+  0xff, 0xff, 0x11, 0x91, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xff, 0xff,
+  0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x80,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01,
+  0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xfe,
+  0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf7, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd,
+  0xf5, 0xfd, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfd, 0xf6, 0xfe, 0xff, 0xfd, 0xf5, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xfe, 0xfe, 0xfe, 0x11, 0x89, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff,
+  0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xfc, 0xef, 0xfd,
+  0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xf9, 0xc7, 0xfc, 0xff, 0xfa, 0xbb, 0xfd, 0xff, 0xfa, 0xbb, 0xfd, 0xff, 0xfa, 0xc3, 0xfc, 0xff, 0xfc, 0xde, 0xfe, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x03, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xc5, 0xff, 0xfd, 0xff, 0x11, 0x87, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff,
+  0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfc, 0xdb, 0xfc,
+  0xff, 0xf9, 0xaa, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xf9, 0xaf, 0xfe,
+  0xff, 0xfc, 0xd8, 0xfe, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfe, 0xfa, 0xfe,
+  0xff, 0xfd, 0xf3, 0xfd, 0xc5, 0xfc, 0xef, 0xfc, 0x11, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xf9, 0xfe, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xf7, 0xa1, 0xfd, 0xff, 0xf9,
+  0xbf, 0xfc, 0xff, 0xfa, 0xd3, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xfa, 0xbf, 0xfc, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfe,
+  0xfc, 0xfe, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfa, 0xdd, 0xfb, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfc, 0xee, 0xfc, 0xff, 0xfd, 0xf2, 0xfd, 0xc5, 0xff,
+  0xff, 0xff, 0x11, 0x83, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xfd,
+  0xff, 0xfb, 0xd9, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfa, 0xc1, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf9, 0xc1, 0xfb,
+  0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xfa, 0xdc, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfa, 0xc3, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfb, 0xe2, 0xfc,
+  0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xf9, 0xc8, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfb, 0xd9, 0xfc, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xc5, 0xfe, 0xfe, 0xfe, 0x11, 0x81, 0x00, 0x00, 0x00, 0x00, 0x61, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xf9,
+  0xbb, 0xfd, 0xff, 0xf8, 0xa7, 0xfd, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xf9,
+  0xba, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xfa,
+  0xcf, 0xfc, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf9, 0xb3, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf8,
+  0xa6, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfe,
+  0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd,
+  0xf3, 0xfd, 0xff, 0xfb, 0xcc, 0xfd, 0xff, 0xf9, 0xb7, 0xfc, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xf9, 0xba, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf8,
+  0xa7, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xc4, 0xfc, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xfa,
+  0xcb, 0xfd, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xb0, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xf9, 0xb9, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xf9, 0xb1, 0xfe,
+  0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf8, 0xae, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe,
+  0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00, 0x19, 0xfe, 0xfe, 0xfe, 0x11, 0xfe, 0xfe, 0xfe, 0xc5, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0xfd, 0xec, 0xfd, 0xff, 0xfc, 0xda, 0xfe, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfb, 0xe0, 0xfd, 0xff, 0xf9,
+  0xbc, 0xfd, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xb4, 0xfe, 0xff, 0xfa, 0xd5, 0xfc, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9,
+  0xaa, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff,
+  0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x83, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xff, 0x11, 0xfe, 0xfc, 0xfd, 0xc5, 0xfc, 0xf2, 0xfc, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfa,
+  0xc0, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9,
+  0xad, 0xfe, 0xff, 0xfa, 0xbb, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xa8, 0xff, 0xff, 0xf9,
+  0xae, 0xfe, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff,
+  0xff, 0xff, 0x30, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xfd, 0xf8, 0xfc, 0x11, 0xfc, 0xf6, 0xfc, 0xc5, 0xfd, 0xf4, 0xfd, 0xff, 0xfd, 0xf3, 0xfe, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfc, 0xe4, 0xfd,
+  0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfe, 0xf3, 0xfe, 0xff, 0xfe, 0xfa, 0xfe,
+  0xff, 0xfc, 0xeb, 0xfc, 0xff, 0xf8, 0xad, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xfb, 0xd5, 0xfe, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x87, 0x00, 0x00, 0x00, 0x00, 0x18, 0xfe, 0xfd, 0xfe, 0x11, 0xfe,
+  0xfe, 0xff, 0xc5, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9,
+  0xb6, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xf8, 0xac, 0xfd, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9,
+  0xbc, 0xfd, 0xff, 0xfd, 0xec, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x89,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0xfe, 0xfe, 0xff, 0x11, 0xfe, 0xff, 0xfe, 0xc5, 0xfc, 0xe7, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xf9, 0xbf, 0xfd,
+  0xff, 0xf8, 0xa8, 0xff, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xfd, 0xf5, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xac, 0xff,
+  0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff,
+  0x30, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x14, 0xfd, 0xfa, 0xfd, 0x11, 0xfb, 0xe2, 0xfd, 0xc5, 0xf8, 0xb1, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf8,
+  0xa8, 0xfe, 0xff, 0xfc, 0xdf, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfa,
+  0xbc, 0xfd, 0xff, 0xfd, 0xea, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x8d, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0xf9, 0xbd, 0xfc, 0x11, 0xf8, 0xa7, 0xfe, 0xc5, 0xf9, 0xb6, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfe, 0xff, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf4, 0xfe, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xf8, 0xb1, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfc, 0xd6, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf9, 0xa9, 0xfd, 0x11, 0xfa, 0xbd, 0xfd, 0xc5, 0xfb, 0xd6, 0xfc, 0xff, 0xfa,
+  0xbf, 0xfd, 0xff, 0xfb, 0xdb, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfd,
+  0xf2, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x91, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfc, 0xe2, 0xfc,
+  0x11, 0xfb, 0xd2, 0xfd, 0xc5, 0xfb, 0xd6, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x04, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xe4, 0xff, 0xfe, 0xff, 0x30, 0x93, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfb, 0xd9, 0xfd, 0x11, 0xfe, 0xff, 0xfe, 0xc5, 0xff, 0xfe, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xfe, 0xff, 0x30, 0x95, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfe, 0xff, 0x11, 0xff, 0xfe, 0xff, 0xc5, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff,
+  0x03, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x97, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xfe, 0xfe, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x82,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x80, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff,
+  0xff, 0xff, 0x30, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0x30, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xee,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x1f, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xb1, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x8e, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0x41, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xec, 0x83, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x96, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xca, 0x86, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x63, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff,
+  0xa7, 0x88, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x85, 0x8b, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x85, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x83, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x28, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa7, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xff, 0xff,
+  0x1f, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe,
+  0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x4a, 0x88, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff,
+  0x7c, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfb, 0xe0, 0xfd, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xfb, 0xd9, 0xfc, 0xff, 0xfc, 0xe5, 0xfd,
+  0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xca, 0x86, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf5, 0xfc,
+  0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfb, 0xeb, 0xfc, 0xff, 0xfb, 0xe6, 0xfd, 0xff, 0xfc, 0xee, 0xfd, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xfa, 0xc7, 0xfd,
+  0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6c, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0xb7, 0x80, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xf1, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xf9,
+  0xaf, 0xfd, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf8, 0xae, 0xfc, 0xff, 0xf9, 0xc0, 0xfd, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8,
+  0xa8, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfd, 0xee, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x01, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0x0f, 0x82, 0x00, 0x00,
+  0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 0x75, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfc, 0xeb, 0xfc, 0xff, 0xfb, 0xe8, 0xfd, 0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa,
+  0xcb, 0xfc, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xf9, 0xc2, 0xfc, 0xff, 0xfb, 0xe8, 0xfc, 0xff, 0xfb, 0xe6, 0xfb, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xf9, 0xbd, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfb,
+  0xd2, 0xfd, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0x8e, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0xfe, 0xfe, 0xfe, 0xd3, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfb, 0xd9, 0xfd,
+  0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xfa, 0xbb, 0xfc, 0xff, 0xf8, 0xa9, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfa, 0xbc, 0xfe, 0xff, 0xf9, 0xb5, 0xfe,
+  0xff, 0xf8, 0xa1, 0xfd, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfb, 0xe0, 0xfb, 0xff, 0xfa, 0xd9, 0xfb, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfb, 0xd5, 0xfc,
+  0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xfe,
+  0x31, 0x82, 0x00, 0x00, 0x00, 0x00, 0x16, 0xfe, 0xfe, 0xfe, 0x53, 0xfd, 0xfc, 0xfd, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfc, 0xdc, 0xfd, 0xff, 0xfb, 0xd1, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf9,
+  0xb0, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf9, 0xb7, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf8,
+  0xa7, 0xfe, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfb, 0xcb, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xc3, 0xfd, 0xff, 0xfa,
+  0xc6, 0xfd, 0xff, 0x80, 0xfb, 0xdf, 0xfc, 0xff, 0x04, 0xfb, 0xde, 0xfd, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfc, 0xea, 0xfd, 0xff, 0xfd, 0xf0, 0xfd, 0xb1, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x1e, 0xfc, 0xf7, 0xfc, 0xb1, 0xfb, 0xe4, 0xfc, 0xff, 0xfa, 0xd5, 0xfd, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfb,
+  0xe7, 0xfc, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa,
+  0xc2, 0xfc, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xa6, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xb3, 0xfe, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf9,
+  0xb5, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfe, 0xf9, 0xfe, 0x53, 0x82,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0xfd, 0xfa, 0xfd, 0x31, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfa, 0xd0, 0xfc,
+  0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xf9, 0xbc, 0xfe, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf9, 0xc3, 0xfd,
+  0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xa8, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9, 0xb3, 0xfd,
+  0xff, 0xfa, 0xd8, 0xfc, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xd3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xfe, 0xfe, 0xff, 0x8e, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf8, 0xfd, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa,
+  0xc6, 0xfc, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xf9, 0xc0, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf9,
+  0xa9, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xfa, 0xbe, 0xfe, 0xff, 0xfb, 0xd6, 0xfc, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfa,
+  0xd3, 0xfc, 0xff, 0xfc, 0xee, 0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0x75, 0x82, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xfe, 0xff, 0xfe, 0x0f, 0xfe, 0xfd, 0xfe, 0xec, 0xfb, 0xd5, 0xfc, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xf8, 0xb3, 0xfd, 0xff, 0xfa, 0xd7, 0xfc,
+  0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xfd, 0xe8, 0xfe, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfc, 0xe7, 0xfc, 0xff, 0xf9, 0xb6, 0xfd,
+  0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfc, 0xf3, 0xfd, 0xff, 0xfd, 0xf8, 0xfe,
+  0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xb7, 0xff, 0xff, 0xff, 0x36, 0x83, 0x00, 0x00, 0x00, 0x00, 0x14, 0xfc, 0xef, 0xfd, 0x6c, 0xfa, 0xc8, 0xfd, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf8,
+  0xad, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfd, 0xf9, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9,
+  0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81,
+  0xfe, 0xfe, 0xfe, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0x5a, 0x86, 0x00, 0x00, 0x00, 0x00, 0x11, 0xf8, 0xb0, 0xfd, 0xca, 0xf8, 0xa3, 0xfe, 0xff, 0xfa,
+  0xd2, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfd, 0xeb, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xf9,
+  0xc1, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf9, 0xbe, 0xfe, 0xff, 0xfc, 0xdf, 0xfe, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81,
+  0xfe, 0xfe, 0xfe, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x7c, 0x88, 0x00, 0x00, 0x00, 0x00, 0x12, 0xf8, 0xa7, 0xfe, 0x4a, 0xf9, 0xb7, 0xfd, 0xff, 0xfa,
+  0xda, 0xfc, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xfc, 0xe8, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xf8,
+  0xad, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xb2, 0xfe, 0xff, 0xfb, 0xdd, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x1f, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x14, 0xfb, 0xd9, 0xfc, 0xa7, 0xfa, 0xd0, 0xfc, 0xff, 0xfa,
+  0xbf, 0xfd, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8,
+  0xa6, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfb, 0xdb, 0xfd, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x41, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x12, 0xfb, 0xd2, 0xfd, 0x28, 0xfa, 0xcc, 0xfd, 0xff, 0xfc, 0xe5, 0xfe, 0xff, 0xfe, 0xff, 0xfd,
+  0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfb, 0xd1, 0xfd,
+  0xff, 0xfe, 0xf3, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x63, 0x8f, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0xfe, 0xfe, 0xfe, 0x85, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xf8, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfd, 0xed, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xfe, 0xff, 0x06, 0xff, 0xfe, 0xff, 0xe3, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x28, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x63, 0x81, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xfe, 0xff, 0xff, 0x03, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xca, 0xff, 0xfe, 0xff, 0x4a, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x81, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0x6c, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x41, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+  0xff, 0x8e, 0xff, 0xff, 0xff, 0x0f, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0x31,
+  0x9c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x53, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xc2, 0x99, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x13, 0xff,
+  0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0xd9, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x1f, 0x94, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x01, 0xff,
+  0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xc7, 0x85, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x61, 0x91, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x31, 0xff,
+  0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0xf7, 0x88, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa3, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x20, 0xff,
+  0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0xe6, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xe5, 0x89, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x31, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff,
+  0x80, 0xff, 0xff, 0xff, 0xc2, 0x81, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0x80,
+  0xfe, 0xfe, 0xfe, 0xff, 0x02, 0xfd, 0xf8, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xff, 0xff, 0xff, 0x73, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81,
+  0xfe, 0xfe, 0xfe, 0xff, 0x0e, 0xfd, 0xf9, 0xfd, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfb, 0xdb, 0xfc,
+  0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xb5, 0x86, 0x00, 0x00, 0x00, 0x00, 0x16, 0xfe, 0xfe, 0xfe, 0xea, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfb, 0xe2, 0xfd,
+  0xff, 0xfc, 0xee, 0xfd, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfb, 0xcb, 0xfc, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfe, 0xf7, 0xfd, 0xff, 0xfe, 0xfb, 0xfd, 0xff, 0xfe, 0xfe, 0xfd,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x01, 0x85, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0xfe, 0xfd, 0xfe, 0xa8, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf4, 0xfd,
+  0xff, 0xfc, 0xee, 0xfc, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xf8, 0xa6, 0xfe,
+  0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfc, 0xe7, 0xfc, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe,
+  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x43, 0x85, 0x00, 0x00, 0x00, 0x00, 0x17, 0xfd, 0xf9, 0xfc, 0x66, 0xfc, 0xef, 0xfc, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xfb, 0xd5, 0xfd,
+  0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfa, 0xcf, 0xfb, 0xff, 0xfa, 0xc8, 0xfd,
+  0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf8, 0xad, 0xfc, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xb0, 0xfd,
+  0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x85, 0x85, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0xfd, 0xf8, 0xfd, 0x24, 0xfd, 0xf8, 0xfd, 0xff, 0xfb, 0xe7, 0xfd, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xf9, 0xb9, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xad, 0xfe,
+  0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfb, 0xcc, 0xfd, 0xff, 0xfa, 0xcf, 0xfd, 0xff, 0xfb, 0xde, 0xfd, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xc6, 0xfc,
+  0xff, 0xf9, 0xcc, 0xfc, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfb, 0xd4, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x86, 0x00, 0x00, 0x00, 0x00, 0x17, 0xfe, 0xfe, 0xff, 0xd8, 0xfe, 0xfc, 0xff, 0xff, 0xfe,
+  0xfe, 0xfd, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9,
+  0xae, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xfb, 0xe3, 0xfb, 0xff, 0xf9,
+  0xc5, 0xfc, 0xff, 0xf9, 0xb3, 0xfc, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+  0x12, 0x85, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xff, 0xfe, 0x96, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfb,
+  0xda, 0xfc, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0x80, 0xf8, 0xa9, 0xff, 0xff, 0x09, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfb, 0xce, 0xfc, 0xff, 0xfa, 0xca, 0xfc,
+  0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xfa, 0xbe, 0xfc, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfd, 0xf1, 0xfe, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x01, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x85, 0x00, 0x00, 0x00, 0x00, 0x17, 0xfe, 0xfb, 0xfe, 0x54, 0xfc, 0xec, 0xfd, 0xff, 0xf9, 0xb8, 0xfc, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xf9, 0xbc, 0xfd,
+  0xff, 0xfa, 0xdd, 0xfc, 0xff, 0xf9, 0xb5, 0xfc, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xbc, 0xfd,
+  0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xfa, 0xc1, 0xfc, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfb, 0xd2, 0xfd,
+  0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x96, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfb, 0xde, 0xfd,
+  0x12, 0xfa, 0xce, 0xfc, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaf, 0xfe,
+  0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf8, 0xa8, 0xff,
+  0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfb, 0xe0, 0xfc, 0xff, 0xfc, 0xed, 0xfc, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xfe, 0xfa, 0xfe,
+  0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xd8, 0x86, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xf8, 0xaa, 0xfd, 0xc7, 0xf8, 0xa3, 0xfe, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa,
+  0xd1, 0xfc, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xb9, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfd, 0xe8, 0xfe, 0xff, 0xfd, 0xef, 0xfd, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfa,
+  0xc7, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xbb, 0xfe, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf9,
+  0xb7, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0xb3, 0xfc, 0xff, 0xf9, 0xcc, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa, 0xdf, 0xfb, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe,
+  0xf6, 0xfe, 0x24, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xf9, 0xac, 0xfd, 0x85, 0xfa, 0xc7, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xfa, 0xbe, 0xfd,
+  0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xe7, 0xfc, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xa9, 0xfe,
+  0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xfa, 0xb8, 0xfe, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xd2, 0xfc,
+  0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfb, 0xd4, 0xfc, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfc, 0xed, 0xfd, 0xff, 0xfc, 0xee, 0xfc, 0x66, 0x85, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfb,
+  0xd2, 0xfc, 0x43, 0xfb, 0xda, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf9, 0xb2, 0xfe, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0x80, 0xfe, 0xff, 0xfe, 0xff, 0x12, 0xfc, 0xf2, 0xfc,
+  0xff, 0xf9, 0xbd, 0xfc, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xa8, 0xff, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xfa, 0xbf, 0xfd,
+  0xff, 0xfb, 0xde, 0xfd, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfb, 0xea, 0xfc, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfd, 0xfc, 0xfd,
+  0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xa8, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfb, 0xd4, 0xfd, 0x01, 0xfa, 0xcb, 0xfd, 0xf7, 0xfa, 0xc3, 0xfd, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfd,
+  0xf2, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xe6, 0xfd, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9,
+  0xa9, 0xff, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfa, 0xc1, 0xfe, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe,
+  0xf4, 0xfe, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xea, 0x86,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0xfd, 0xf4, 0xfe, 0xb5, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf4, 0xfd,
+  0xff, 0xfa, 0xca, 0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xfd, 0xee, 0xfe,
+  0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfe, 0xff, 0x73, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x08, 0xfe, 0xf6, 0xfe, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xb5, 0xfe,
+  0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x84, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xc2,
+  0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x1d, 0x85, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0xfe, 0xfe, 0x31, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfb, 0xcb, 0xfd, 0xff, 0xfc, 0xdd, 0xfe, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0x50,
+  0xff, 0xff, 0xff, 0x0e, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe5, 0x80, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xe6, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0x20, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa3, 0x81, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
+  0xff, 0xb5, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x31, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x61, 0x81, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xc7, 0xff, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x01, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0x1f, 0x81, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0x13, 0x99, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xff, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0x24, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x97, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe,
+  0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xfe, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xfb, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xff,
+  0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xfd, 0xf7, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd,
+  0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x10, 0xfc, 0xf5, 0xfc, 0xff, 0xf9, 0xd0,
+  0xfc, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfd, 0xeb, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xea, 0xfd, 0xff, 0xf8, 0xb0,
+  0xfc, 0xff, 0xfb, 0xe8, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfa, 0xd5, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0x80, 0xfe,
+  0xfe, 0xfe, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x14, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0x9f, 0xfd, 0xff, 0xf8, 0xa6,
+  0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfb, 0xd9, 0xfb, 0xff, 0xfc, 0xf5, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0x9f, 0xfd, 0xff, 0xf9, 0xc4, 0xfd, 0xff, 0xfd, 0xfb,
+  0xfd, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x15, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xfa, 0xc4, 0xfd,
+  0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf8, 0xa1, 0xfe, 0xff, 0xf8, 0x9e, 0xfd, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xfa, 0xd1, 0xfb, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xf8, 0x98, 0xfe, 0xff, 0xfa, 0xc8, 0xfc,
+  0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xf8, 0x9e, 0xfe, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x15, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xfc, 0xe0, 0xfd, 0xff,
+  0xfb, 0xd7, 0xfd, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xfb, 0xed, 0xfc, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfc, 0xdb, 0xfd, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfc, 0xf1, 0xfc, 0xff, 0xfb, 0xdb, 0xfc, 0xff,
+  0xfa, 0xc7, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf7, 0x9d, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xfd, 0xfa, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x16, 0xfd, 0xf7, 0xfd, 0xff, 0xf9, 0xbe, 0xfc, 0xff, 0xf8, 0xa7, 0xfd, 0xff, 0xf8,
+  0x9c, 0xfe, 0xff, 0xf9, 0xba, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfa,
+  0xba, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xf9, 0xca, 0xfb, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xf8, 0x9e, 0xfe, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfd,
+  0xfa, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x16, 0xf9, 0xc0, 0xfc, 0xff, 0xf8, 0xa3,
+  0xff, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xf9, 0xcd, 0xfc, 0xff, 0xfb, 0xed, 0xfc, 0xff, 0xf9, 0xb8, 0xfc, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf8, 0xa6, 0xff, 0xff, 0xf8, 0xa8,
+  0xff, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xf8, 0x9e, 0xfd, 0xff, 0xf8, 0xb4, 0xfc, 0xff, 0xfb, 0xe9, 0xfc, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xf8, 0xa3,
+  0xfe, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0xf8, 0xa0, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfb, 0xe9, 0xfc, 0xff, 0xf8, 0xa9, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa8, 0xfe,
+  0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfb, 0xd0, 0xfc, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xfb, 0xe8, 0xfb,
+  0xff, 0xfb, 0xeb, 0xfb, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff,
+  0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x16, 0xf9, 0xb2, 0xfd, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xf9, 0xab, 0xfd, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf8, 0xa5, 0xfe, 0xff,
+  0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfa, 0xc1, 0xfc, 0xff,
+  0xf9, 0xb3, 0xfd, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfa, 0xc5, 0xfb, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x16, 0xfc, 0xe6, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xf8, 0x9f, 0xfe, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf9,
+  0xb3, 0xfd, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xf8,
+  0xa4, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf8, 0xa1, 0xfe, 0xff, 0xf9, 0xc3, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xfd,
+  0xf8, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x15, 0xfa, 0xc6, 0xfd, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xfa, 0xcb,
+  0xfd, 0xff, 0xfb, 0xe1, 0xfd, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfa, 0xc9,
+  0xfc, 0xff, 0xf8, 0xa1, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xf9, 0xaf,
+  0xfe, 0xff, 0xfc, 0xf3, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x19, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xf0,
+  0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xb6,
+  0xfe, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfb, 0xce, 0xfc, 0xff, 0xf8, 0xac, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0x80, 0xf9, 0xac, 0xff,
+  0xff, 0x0a, 0xf8, 0xa3, 0xff, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xf8, 0xad, 0xfc, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xfd, 0xf5,
+  0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x15, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xf7, 0x9e, 0xfd, 0xff, 0xf9, 0xad, 0xff, 0xff, 0xf9, 0xad, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa4, 0xfe,
+  0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xf8, 0xa5, 0xfd, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf8, 0xb4, 0xfc,
+  0xff, 0xf8, 0xb8, 0xfc, 0xff, 0xfa, 0xdc, 0xfb, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0x15, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfb, 0xd8, 0xfd, 0xff,
+  0xfc, 0xe1, 0xfe, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfc, 0xdd, 0xfd, 0xff, 0xf9, 0xce, 0xfb, 0xff, 0xfd, 0xff, 0xfc, 0xff,
+  0xfd, 0xf5, 0xfd, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0x08, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xe9, 0xfc, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x08, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xf8, 0xfd, 0xff, 0xfc, 0xed, 0xfc, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x07,
+  0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x87, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x01, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xfe, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x8d, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xff, 0xa8, 0xff,
+  0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0x24, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xfe, 0xfe, 0x1f, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0x13, 0x98, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x01, 0x94, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xfd, 0xfb, 0xfc, 0xa3, 0xfd, 0xfe, 0xfd, 0xff, 0x83, 0xfe, 0xfe, 0xfe, 0xff, 0x07, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x31, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfc, 0xf5, 0xfc, 0xe5, 0xfa, 0xde, 0xfc, 0xff, 0xfd,
+  0xe8, 0xfd, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0x20, 0x8c, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0xfe, 0xff, 0xfe, 0x31, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xe2, 0xfd, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfc, 0xda, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xf4, 0xfc, 0xff, 0xfe, 0xf9, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff,
+  0x0e, 0x88, 0x00, 0x00, 0x00, 0x00, 0x10, 0xfe, 0xfe, 0xff, 0x73, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xf4, 0xfe, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xfb,
+  0xcb, 0xfe, 0xff, 0xfc, 0xe6, 0xfd, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfb, 0xe3, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x1d, 0x85, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0xfe, 0xfd, 0xfe, 0xb5, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfb, 0xd4, 0xfc, 0xff, 0xf9, 0xb7, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfa,
+  0xba, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfa, 0xd8, 0xfd, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xfc,
+  0xf3, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x36, 0x84, 0x00, 0x00, 0x00, 0x00, 0x10, 0xfb, 0xe0, 0xfd, 0x01, 0xfc,
+  0xee, 0xfd, 0xf7, 0xfa, 0xc7, 0xfc, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfb, 0xd6, 0xfc, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf8,
+  0xac, 0xfd, 0xff, 0xf9, 0xc5, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xfb, 0xe0, 0xfd, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfb, 0xd6, 0xfc, 0xff, 0xfc, 0xe2, 0xfd, 0xff, 0x80,
+  0xfe, 0xfe, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xea, 0x85, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf9, 0xb4, 0xfd, 0x43, 0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff,
+  0xf8, 0xa7, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfb, 0xe3, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfc, 0xda, 0xfd, 0xff, 0xfa, 0xce, 0xfd, 0xff,
+  0xfb, 0xd8, 0xfc, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfa, 0xc0, 0xfc, 0xff, 0xfb, 0xd8, 0xfd, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfb, 0xdf, 0xfd, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x83, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa8, 0x85, 0x00, 0x00, 0x00, 0x00, 0x15, 0xf8, 0xa6, 0xfe, 0x85, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xd6, 0xfc,
+  0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf9, 0xbb, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfb, 0xd1, 0xfc,
+  0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf8, 0x9e, 0xfe, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x66, 0x85, 0x00, 0x00, 0x00, 0x00, 0x16, 0xfa, 0xc3, 0xfd, 0xc7, 0xfa, 0xd8, 0xfc, 0xff, 0xfb, 0xdf, 0xfc,
+  0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xa6, 0xff, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf8, 0xaa, 0xff,
+  0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfa, 0xb8, 0xfe, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf8, 0xb5, 0xfc, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfb, 0xdc, 0xfc,
+  0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x24, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0xfb, 0xd5, 0xfd, 0x12, 0xfb, 0xdc, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xf9, 0xa9, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xac, 0xfe,
+  0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xa3, 0xfd, 0xff, 0xf8, 0xb6, 0xfc,
+  0xff, 0xf9, 0xca, 0xfc, 0xff, 0xfa, 0xcf, 0xfd, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xfd, 0xee, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xd8, 0x85, 0x00, 0x00, 0x00, 0x00, 0x17, 0xfc, 0xe3, 0xfe, 0x54, 0xfb, 0xd2, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfa, 0xc3, 0xfd,
+  0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xa9, 0xfe,
+  0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfb, 0xe0, 0xfc, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xf9, 0xa9, 0xfe,
+  0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x96, 0x85, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0xfe, 0xff, 0xfe, 0x96, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe,
+  0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf3, 0xfe, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfb, 0xce, 0xfc, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfa, 0xc3, 0xfd,
+  0xff, 0xfa, 0xdb, 0xfb, 0xff, 0xfb, 0xe9, 0xfb, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x54, 0x85, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xfe, 0xff, 0xd8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xf9, 0xc2, 0xfd,
+  0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xf9, 0xbd, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xc3, 0xfc, 0xff, 0xf9, 0xb5, 0xfc,
+  0xff, 0xfa, 0xbb, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x12, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xff, 0x24, 0x83, 0xfe, 0xfe, 0xfe, 0xff, 0x14, 0xfd, 0xf8, 0xfd, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfb, 0xdd, 0xfd, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf9,
+  0xab, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfa,
+  0xbb, 0xfc, 0xff, 0xfb, 0xcf, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x85,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x66, 0x80, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf9,
+  0xb2, 0xfd, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8,
+  0xaa, 0xff, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x85, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa8, 0x80, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xaa, 0xff,
+  0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfe, 0xfc, 0xfe,
+  0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x43, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xea, 0x81, 0xff, 0xff,
+  0xff, 0xff, 0x16, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xe4, 0xfc, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9,
+  0xb6, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa,
+  0xc9, 0xfc, 0xff, 0xfc, 0xec, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x01, 0x84,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x36, 0x81, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfc,
+  0xe1, 0xfe, 0xff, 0xfc, 0xd7, 0xfd, 0xff, 0xfc, 0xe4, 0xfd, 0xff, 0xfc, 0xe6, 0xfd, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfc, 0xe4, 0xfe, 0xff, 0xfc, 0xde, 0xfd, 0xff, 0xfb, 0xdb, 0xfd, 0xff, 0xfb,
+  0xd6, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff,
+  0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfc, 0xda, 0xfd,
+  0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0x73, 0x88, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x0e, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x31, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x20, 0xff, 0xfe, 0xff, 0x62, 0xff, 0xfe, 0xff, 0xa4, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7,
+  0xfe, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfb, 0xe5, 0xfc, 0xff, 0xfd, 0xf2, 0xfd, 0xe5, 0x91, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xb5,
+  0xff, 0xff, 0xff, 0xf7, 0x80, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x02, 0xfe, 0xfd, 0xfe, 0xff,
+  0xfd, 0xf6, 0xfd, 0xff, 0xfc, 0xed, 0xfc, 0xa3, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+  0xff, 0x61, 0x98, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0x1f, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff,
+  0xff, 0xc2, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x53, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfe,
+  0xfe, 0xfe, 0x9e, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0x31, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0xfd, 0xfd, 0x41, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x0f, 0x99, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfd,
+  0xf8, 0xfc, 0xc0, 0xfd, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0x6c, 0x97, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0xfe, 0xfd, 0xfe, 0x63, 0xfc, 0xf0, 0xfd, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0x4a, 0x94, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0xfe, 0xff, 0x06, 0xfe, 0xfe, 0xff,
+  0xe3, 0xfd, 0xf5, 0xfe, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfe, 0xf4, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x02, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x28, 0x92, 0x00, 0x00, 0x00, 0x00, 0x10, 0xfe, 0xff, 0xfe, 0x85, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xd9, 0xfd,
+  0xff, 0xf8, 0xa1, 0xfd, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x06, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x12, 0xfb, 0xe2, 0xfd, 0x28, 0xfd,
+  0xf7, 0xfd, 0xff, 0xfc, 0xe8, 0xfd, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xfa, 0xbb, 0xfe, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfd,
+  0xff, 0xfd, 0xff, 0xfc, 0xf2, 0xfd, 0xff, 0xfd, 0xf6, 0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x63, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf9, 0xb8, 0xfd, 0xa7, 0xf9, 0xbb, 0xfd, 0xff, 0xf8, 0xb0, 0xfd, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xfb, 0xcf, 0xfd,
+  0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xfd, 0xf9, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff,
+  0x41, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x17, 0xf9, 0xab, 0xfd, 0x4a, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xb5, 0xfd, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xfa,
+  0xd1, 0xfc, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfa, 0xd0, 0xfd, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xf9, 0xc6, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfc, 0xed, 0xfd, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x1f, 0x89, 0x00, 0x00, 0x00, 0x00, 0x12, 0xfa, 0xcb, 0xfd, 0xca, 0xfa, 0xd3, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xdb, 0xfc, 0xff, 0xfa, 0xd7, 0xfc,
+  0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfb, 0xdd, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xae, 0xfd,
+  0xff, 0xf9, 0xc7, 0xfd, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff,
+  0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x7c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x14, 0xfa, 0xcb, 0xfd, 0x6c, 0xfb, 0xd4, 0xfc, 0xff, 0xf9, 0xc5, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xb9, 0xfd,
+  0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf8, 0xad, 0xfd, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfb, 0xe4, 0xfc,
+  0xff, 0xfa, 0xba, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xfa, 0xd0, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0x5a, 0x84, 0x00, 0x00, 0x00, 0x00, 0x12, 0xfe, 0xff, 0xfe, 0x0f, 0xfd, 0xef, 0xfe, 0xec, 0xfb, 0xcc, 0xfd,
+  0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xa6, 0xff,
+  0xff, 0xf8, 0xab, 0xff, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfb, 0xdb, 0xfd,
+  0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x36, 0x82, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xfe, 0xff, 0x8e, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xfb, 0xe4, 0xfd, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xfb, 0xd0, 0xfd, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xf9, 0xaf,
+  0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xae, 0xff, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xf8, 0xaa,
+  0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x75,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x16, 0xfe, 0xfe, 0xfe, 0x31, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd,
+  0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfb, 0xd0, 0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf8, 0xa8,
+  0xfe, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xf9, 0xc9, 0xfb, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xfc, 0xe3, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xd3, 0x82, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfa, 0xda,
+  0xfc, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfa, 0xc5, 0xfc, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xf9, 0xb7, 0xfc, 0xff, 0xf9, 0xc9, 0xfc, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xfa, 0xce,
+  0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x53,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x53, 0x81, 0xff, 0xff, 0xff, 0xff, 0x14, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfd, 0xf2, 0xfd, 0xff,
+  0xfd, 0xf4, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xc4, 0xfc, 0xff,
+  0xfb, 0xd2, 0xfc, 0xff, 0xfb, 0xe6, 0xfb, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xb1, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd3, 0x81, 0xff, 0xff, 0xff, 0xff, 0x14, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf8, 0xa2,
+  0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfb, 0xe2, 0xfb, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf8, 0xa3,
+  0xfe, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x31, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0x75, 0x82, 0xff, 0xff, 0xff, 0xff, 0x14, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfa, 0xcf, 0xfd, 0xff, 0xf8, 0xa4, 0xfd, 0xff, 0xf9, 0xad, 0xff, 0xff,
+  0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff,
+  0xfa, 0xc8, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xf9, 0xbb, 0xfc, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8e, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0xb7, 0x80, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xa9,
+  0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xfa, 0xbe,
+  0xfc, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfd, 0xf0, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xec, 0xff, 0xff, 0xff, 0x0f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xfe, 0xff, 0xff, 0x11, 0xfe, 0xf2,
+  0xfe, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xf9, 0xb3, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xa9,
+  0xff, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xb4, 0xfe, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xc3, 0xfc, 0xff, 0xfc, 0xdb, 0xfd, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf0, 0xfe, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfc, 0xe4, 0xfd, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xfa, 0xc4,
+  0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xb2, 0xfe, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfc, 0xf4, 0xfc, 0xff, 0xfe, 0xfc,
+  0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xca, 0x89, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
+  0xff, 0x9e, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfd, 0xee,
+  0xfe, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfc, 0xe9, 0xfc, 0xff, 0xfe, 0xfc,
+  0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x4a, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xfe, 0xff, 0x41, 0xff, 0xfe,
+  0xff, 0xc0, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfd,
+  0xfd, 0xff, 0xfc, 0xf3, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xf9, 0xd2, 0xfc, 0xff,
+  0xfa, 0xd3, 0xfc, 0xff, 0xf9, 0xc2, 0xfc, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28,
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x85, 0x80, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xfe, 0xfb, 0xfe, 0xff, 0xfc, 0xee, 0xfc, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xf8, 0xba, 0xfc, 0xff, 0xfc, 0xec, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x85, 0x92, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xe3, 0xfe, 0xfe, 0xfe, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xff, 0xfc, 0xff, 0x63, 0x97, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xf5,
+  0xfd, 0xff, 0xfc, 0xef, 0xfc, 0xc0, 0x99, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf5, 0xfd, 0x41, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0x9e, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0x03, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xfe, 0xfe, 0x11, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0x30, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x11, 0xfe, 0xfe,
+  0xfe, 0xc5, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfd, 0xf8, 0xfc, 0x11, 0xfe, 0xfc, 0xfd, 0xc5, 0xff, 0xfe, 0xff, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x99, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xfd, 0xfe, 0x11, 0xfc, 0xf6, 0xfc, 0xc5, 0xfc, 0xf2,
+  0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0xfe, 0xfe, 0xff, 0x11, 0xfe, 0xfe, 0xff, 0xc5, 0xfd, 0xf4, 0xfd, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfd, 0xec, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x95, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfd, 0xfa, 0xfd, 0x11, 0xfe, 0xff, 0xfe, 0xc5, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xf3,
+  0xfe, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfc, 0xda, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x93, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf9, 0xbd, 0xfc, 0x11, 0xfb, 0xe2, 0xfd, 0xc5, 0xfc, 0xe7, 0xfd, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfe, 0xfa, 0xfd, 0xff,
+  0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x91, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf9, 0xa9, 0xfd, 0x11, 0xf8, 0xa7, 0xfe, 0xc5, 0xf8, 0xb1, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xf9, 0xbf,
+  0xfd, 0xff, 0xfc, 0xe4, 0xfd, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xb9, 0xfe, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x12, 0xfc, 0xe2, 0xfc, 0x11, 0xfa, 0xbd, 0xfd, 0xc5,
+  0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff,
+  0xfb, 0xcc, 0xfd, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4,
+  0xff, 0xff, 0xff, 0x30, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x14, 0xfb, 0xd9, 0xfd, 0x11, 0xfb, 0xd2, 0xfd, 0xc5, 0xfb, 0xd6, 0xfc, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfa, 0xd9,
+  0xfc, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf9, 0xb7, 0xfc, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfb, 0xdc,
+  0xfd, 0xff, 0xfb, 0xd9, 0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x8b, 0x00,
+  0x00, 0x00, 0x00, 0x16, 0xff, 0xfe, 0xff, 0x11, 0xfe, 0xff, 0xfe, 0xc5, 0xfb, 0xd6, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf9, 0xbf, 0xfd, 0xff,
+  0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfb, 0xe0, 0xfd, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff,
+  0xfa, 0xcf, 0xfc, 0xff, 0xfd, 0xf9, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30,
+  0x89, 0x00, 0x00, 0x00, 0x00, 0x18, 0xfe, 0xfe, 0xfe, 0x11, 0xff, 0xfe, 0xff, 0xc5, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xdb, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xf8, 0xa8,
+  0xfe, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfa, 0xcf,
+  0xfc, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x87, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfc, 0xdf, 0xfd, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xf9, 0xb6, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff,
+  0xf8, 0xa5, 0xff, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xf9, 0xba, 0xfe, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfe, 0xf7, 0xfe, 0xff,
+  0xfd, 0xf6, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x85, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xf5, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xac,
+  0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfa, 0xc1, 0xfc, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfc, 0xdb, 0xfc, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfd, 0xf7, 0xfe, 0xff, 0xfe, 0xfe,
+  0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x81, 0xff,
+  0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x10, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xf3, 0xfe, 0xff, 0xfa, 0xbb, 0xfd, 0xff, 0xf9, 0xa9, 0xfe,
+  0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xb3, 0xfe, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xf9, 0xaa, 0xfd, 0xff, 0xfc, 0xe1, 0xfd,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xb0, 0x82, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xf4, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xf9, 0xb4, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9,
+  0xbb, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf7, 0xa1, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x80, 0xff, 0xff, 0xff, 0xff,
+  0x14, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfc, 0xeb, 0xfc,
+  0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfa, 0xd5, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xf8, 0xa7, 0xfd, 0xff, 0xf9, 0xc1, 0xfb, 0xff, 0xf9, 0xbf, 0xfc,
+  0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff,
+  0xff, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xf8, 0xb1, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf8, 0xac, 0xfd, 0xff, 0xf8, 0xad, 0xfd, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf8, 0xad, 0xfe,
+  0xff, 0xf8, 0xae, 0xfe, 0xff, 0xfa, 0xc4, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfa, 0xd3, 0xfd, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xf9, 0xc7, 0xfc,
+  0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
+  0x30, 0xff, 0xff, 0xff, 0xe4, 0x80, 0xff, 0xfe, 0xff, 0xff, 0x13, 0xfd, 0xf2, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9,
+  0xaa, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xfb,
+  0xdd, 0xfc, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfa, 0xbb, 0xfd, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xfc, 0xd6, 0xfe, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9,
+  0xab, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xfa, 0xdc, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfa, 0xbb, 0xfd, 0xff, 0xfd,
+  0xf6, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xea, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xf9,
+  0xbc, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xa8, 0xff, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xf9,
+  0xc6, 0xfc, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xfa, 0xc3, 0xfc, 0xff, 0xfd, 0xf5, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x85, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xfe, 0xff, 0x30, 0xff, 0xfe, 0xff, 0xe4, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xec, 0xfd, 0xff, 0xfb, 0xd5, 0xfe, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xf9,
+  0xb0, 0xfe, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xfa, 0xc3, 0xfc, 0xff, 0xfa, 0xbf, 0xfc, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfc, 0xde, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x87, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xfe, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfa,
+  0xb9, 0xfe, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfc, 0xd8, 0xfe, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x89, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0x30, 0xff,
+  0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xfa,
+  0xcb, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf9,
+  0xb9, 0xfd, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff,
+  0xc5, 0xff, 0xff, 0xff, 0x11, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf9, 0xc8, 0xfc, 0xff, 0xfd,
+  0xf1, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x91, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfc, 0xec, 0xfd,
+  0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x93, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfb,
+  0xd9, 0xfc, 0xff, 0xfa, 0xdd, 0xfb, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x95, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff,
+  0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfe, 0xfa, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xc5, 0xfe, 0xfe, 0xfe, 0x11, 0x97, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xfc, 0xee, 0xfc, 0xff, 0xfd, 0xf3, 0xfd, 0xc5, 0xff, 0xfd, 0xff, 0x11, 0x99, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff,
+  0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf2, 0xfd, 0xc5, 0xfc, 0xef, 0xfc, 0x11, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x30, 0xff,
+  0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xb0, 0xfe, 0xfe, 0xfe,
+  0x11, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x75, 0xff, 0xff, 0xff, 0x36, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe,
+  0xfe, 0xfe, 0x53, 0xfe, 0xfe, 0xfe, 0xd3, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfd, 0xfa, 0xfd, 0x31, 0xfc, 0xf7, 0xfc, 0xb1, 0xfd, 0xfc, 0xfd,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x98, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xff, 0xfe, 0x0f, 0xfe, 0xfe, 0xff, 0x8e, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x97, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xfc, 0xef, 0xfd, 0x6c, 0xfe, 0xfd, 0xfe, 0xec, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfa, 0xd5, 0xfd, 0xff, 0xfc, 0xdc, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf8, 0xa7, 0xfe, 0x4a, 0xf8, 0xb0, 0xfd, 0xca, 0xfa, 0xc8, 0xfd, 0xff, 0xfb,
+  0xd5, 0xfc, 0xff, 0xfe, 0xf8, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfb, 0xd1, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x1f, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfb, 0xd2, 0xfd, 0x28, 0xfb, 0xd9, 0xfc, 0xa7, 0xf9, 0xb7, 0xfd, 0xff, 0xf8, 0xa3, 0xfe,
+  0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xfe, 0xff, 0x06, 0xfe, 0xfe, 0xfe, 0x85, 0xfa,
+  0xcc, 0xfd, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xf8, 0xb3, 0xfd, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfa,
+  0xc7, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x41, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x13, 0xfe, 0xfe, 0xfe, 0x63, 0xff, 0xfe, 0xff, 0xe3, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xe5, 0xfe, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf8, 0xab, 0xfd,
+  0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xfa, 0xc1, 0xfd,
+  0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff,
+  0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xf8,
+  0xa8, 0xfe, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xbb, 0xfc, 0xff, 0xfc,
+  0xeb, 0xfc, 0xff, 0xfc, 0xf1, 0xfd, 0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x9e, 0x80, 0xff, 0xff, 0xff, 0xff, 0x14, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfc,
+  0xe8, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xbc, 0xfe, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xf8,
+  0xa9, 0xfd, 0xff, 0xfb, 0xe8, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
+  0xff, 0xff, 0x06, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd0, 0x82, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0xfd, 0xeb, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfa,
+  0xc8, 0xfc, 0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfb, 0xeb, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x85, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x53, 0x82, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x11, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xfd, 0xf9, 0xfe, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xb7, 0xfe, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff,
+  0xf9, 0xad, 0xfd, 0xff, 0xfb, 0xe6, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28,
+  0x87, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf6,
+  0xfe, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xe8, 0xfe, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa9,
+  0xff, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfc, 0xee, 0xfd, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x87, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff,
+  0xfd, 0xf2, 0xfd, 0xff, 0xf9, 0xc0, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xfa, 0xbc, 0xfe, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa, 0xc9, 0xfc, 0xff,
+  0xfc, 0xe3, 0xfc, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a,
+  0x87, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf8, 0xa5,
+  0xfe, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfc, 0xe7, 0xfc, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf8, 0xa7,
+  0xfe, 0xff, 0xf9, 0xb5, 0xfe, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x87, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xec, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0xed, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff,
+  0xf9, 0xbb, 0xfd, 0xff, 0xf9, 0xc3, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf8, 0xa1, 0xfd, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xf8, 0xae, 0xfc, 0xff, 0xf9, 0xae, 0xfd, 0xff,
+  0xfb, 0xe0, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x6c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff,
+  0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfb, 0xcb, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf9, 0xc2, 0xfc, 0xff,
+  0xf9, 0xc0, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+  0xff, 0xec, 0xff, 0xff, 0xff, 0x0f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xfe, 0xff, 0xca, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf3, 0xfe, 0xff, 0xfb, 0xdb, 0xfd, 0xff,
+  0xf9, 0xb2, 0xfe, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xa8, 0xff, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xba, 0xfd, 0xff,
+  0xfb, 0xe0, 0xfb, 0xff, 0xfb, 0xe8, 0xfc, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x8e, 0x87, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xfe, 0xff, 0x4a, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfd, 0xfe, 0xfd, 0xff, 0xfb, 0xdd, 0xfd, 0xff, 0xf9, 0xbe, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xa6, 0xfe, 0xff,
+  0xf9, 0xb6, 0xfd, 0xff, 0xfa, 0xd9, 0xfb, 0xff, 0xfb, 0xe6, 0xfb, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xfb, 0xd9, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x31, 0x87, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xff, 0xff, 0xa7, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfc, 0xdf, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff,
+  0xf9, 0xbf, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xb1, 0x87, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xf9, 0xb3, 0xfe, 0xff,
+  0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xf9, 0xbd, 0xfc, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0x84, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x53, 0x87, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfa, 0xbe, 0xfe, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xf9, 0xc3, 0xfd, 0xff, 0xf9, 0xb4, 0xfd, 0xff,
+  0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0xff, 0xd0, 0x87, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x0a, 0xfc, 0xf3, 0xfd, 0xff, 0xfb, 0xd6,
+  0xfc, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xfd, 0xee, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x1f, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfb, 0xdf,
+  0xfc, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x41, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf7,
+  0xfe, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfa, 0xd8, 0xfc, 0xff, 0xf9, 0xb5, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x63, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfc, 0xee, 0xfc, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x06, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xfb, 0xde, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x28, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
+  0xff, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0x4a, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xec,
+  0xff, 0xff, 0xff, 0x6c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xd9, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfc, 0xea,
+  0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0x8e, 0xff, 0xff, 0xff, 0x0f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfd, 0xf0, 0xfd, 0xb1, 0xfe, 0xf9, 0xfe, 0x31, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xb7, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xd3, 0xfe, 0xf9, 0xfe, 0x53, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0x75, 0xff, 0x00, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
+  0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0x1d, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xf8, 0xfd, 0x24, 0xfd, 0xf9, 0xfc, 0x66, 0xfe, 0xfd, 0xfe, 0xa8, 0xfe, 0xfe, 0xfe, 0xea, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x80, 0x97, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfb, 0xde, 0xfd, 0x12, 0xfe, 0xfb, 0xfe, 0x54, 0xfe, 0xff, 0xfe, 0x96, 0xfe, 0xfe, 0xff, 0xd8, 0xfd, 0xf8, 0xfd, 0xff, 0xfc,
+  0xef, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x93, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xfb, 0xd4, 0xfd, 0x01, 0xfb, 0xd2, 0xfc,
+  0x43, 0xf9, 0xac, 0xfd, 0x85, 0xf8, 0xaa, 0xfd, 0xc7, 0xfa, 0xce, 0xfc, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfb, 0xe7, 0xfd, 0xff, 0xfa, 0xd7, 0xfc,
+  0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x11, 0xfe, 0xfe, 0xfe, 0x31, 0xff,
+  0xfe, 0xff, 0x73, 0xfd, 0xf4, 0xfe, 0xb5, 0xfa, 0xcb, 0xfd, 0xf7, 0xfb, 0xda, 0xfc, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf9, 0xb8, 0xfc, 0xff, 0xfd,
+  0xf0, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x50, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xe5, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xfb, 0xd1, 0xfd,
+  0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xf9, 0xb9, 0xfc, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x92, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc2, 0x81, 0xff, 0xff, 0xff, 0xff, 0x11, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xdc, 0xfd,
+  0xff, 0xf9, 0xb2, 0xfe, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xf9, 0xb9, 0xfd,
+  0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0xff, 0xa8, 0x82, 0xff, 0xff, 0xff, 0xff, 0x11, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xf2, 0xfe, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xae, 0xfe,
+  0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xfa, 0xdd, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x66, 0x82, 0xff, 0xff, 0xff, 0xff,
+  0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x0e, 0xfd, 0xf3, 0xfd, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xb5, 0xfc, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xfb, 0xe6,
+  0xfc, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x62, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x24, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x0f, 0xff, 0xfd, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xf9, 0xb9, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfa, 0xbd, 0xfd, 0xff,
+  0xfa, 0xc2, 0xfc, 0xff, 0xfc, 0xee, 0xfc, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x8a, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfe, 0xfc,
+  0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfb, 0xcc,
+  0xfd, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x8a, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x97, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfa, 0xca, 0xfd, 0xff,
+  0xfc, 0xe6, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xe8, 0xfe, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xb8, 0xfd, 0xff,
+  0xfa, 0xcf, 0xfd, 0xff, 0xfa, 0xcf, 0xfb, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x31, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf8, 0xa6,
+  0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xef, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa9,
+  0xff, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfb, 0xde, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xfb, 0xe2, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfb, 0xcb, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xbd, 0xfc, 0xff, 0xfc, 0xe7, 0xfc, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff,
+  0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfc, 0xee, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xfe, 0xff, 0xc7, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfc, 0xdd, 0xfe, 0xff, 0xf9, 0xb5, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xc8,
+  0xfd, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfe, 0xf7,
+  0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x01, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xfe, 0xff, 0x85,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff,
+  0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa, 0xcc, 0xfd, 0xff,
+  0xfb, 0xcb, 0xfc, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0x89, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xac,
+  0xff, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfa, 0xc1, 0xfc, 0xff, 0xfb, 0xce, 0xfc, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xf8, 0xad,
+  0xfc, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x85, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xe1, 0xfd, 0xff,
+  0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff,
+  0xf9, 0xcc, 0xfc, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xee,
+  0xfe, 0xff, 0xfa, 0xc1, 0xfe, 0xff, 0xf9, 0xa8, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfb, 0xe8,
+  0xfb, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfe, 0xf7, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x13, 0x89, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf8,
+  0xfe, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfb, 0xe3,
+  0xfb, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfe, 0xfb, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xff, 0xff, 0xff, 0x55, 0x89, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa,
+  0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfa, 0xb8, 0xfe, 0xff, 0xf9, 0xbb, 0xfe, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xf9, 0xc5, 0xfc, 0xff, 0xf8, 0xa9,
+  0xfe, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfc, 0xe7, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x97,
+  0x8a, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfb, 0xde, 0xfd, 0xff, 0xfa, 0xcb,
+  0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfa, 0xbe, 0xfc, 0xff, 0xf9, 0xb3, 0xfc, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xfe, 0xfb,
+  0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xd9, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff,
+  0xff, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfa, 0xc4,
+  0xfd, 0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xfb, 0xd4, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x24, 0x89, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xf4, 0xfe, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfb, 0xe0, 0xfc, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfd, 0xf1, 0xfe, 0xff, 0xfe, 0xf6,
+  0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x66,
+  0x89, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfb, 0xea, 0xfc, 0xff, 0xfa, 0xd2,
+  0xfc, 0xff, 0xf8, 0xb3, 0xfc, 0xff, 0xfc, 0xed, 0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff,
+  0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xd4, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd,
+  0xfe, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf9, 0xcc, 0xfc, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+  0xc2, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfb, 0xd4, 0xfc, 0xff, 0xfa,
+  0xce, 0xfc, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff,
+  0x61, 0xff, 0xff, 0xff, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfa,
+  0xd6, 0xfc, 0xff, 0xfa, 0xdf, 0xfb, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+  0xb5, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x31, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd,
+  0xfc, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
+  0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x01, 0x93, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0xc2, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf8, 0xfd,
+  0xff, 0xfc, 0xed, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xd8, 0xff, 0xff, 0xff, 0x96, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x12, 0x97, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff,
+  0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xea, 0xfe, 0xf8, 0xfe, 0xa8, 0xfc, 0xee, 0xfc, 0x66, 0xfe, 0xf6, 0xfe, 0x24, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
+  0x1d, 0xff, 0xff, 0xff, 0x36, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0xff, 0x10, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xfc, 0xe6, 0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf8, 0xa0, 0xfe, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xf5, 0xfc, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00,
+  0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0xff, 0x10, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfb, 0xe6, 0xfc,
+  0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa3, 0xff, 0xff, 0xf9, 0xbe, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xf9, 0xd0, 0xfc, 0xff, 0xfd, 0xff, 0xfd,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0xff, 0x10, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff,
+  0xfe, 0xff, 0xfd, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xf8, 0x9f, 0xfe, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xf8, 0xa7, 0xfd, 0xff, 0xfc, 0xe9, 0xfd, 0xff,
+  0xfe, 0xff, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00,
+  0x00, 0x82, 0xff, 0xff, 0xff, 0xff, 0x10, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xe1, 0xfd, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf9, 0xab, 0xfd, 0xff, 0xfb,
+  0xe9, 0xfc, 0xff, 0xf9, 0xcd, 0xfc, 0xff, 0xf8, 0x9c, 0xfe, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xf8, 0x9f, 0xfd, 0xff, 0xfd, 0xeb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf8, 0xa9, 0xfd,
+  0xff, 0xfb, 0xed, 0xfc, 0xff, 0xf9, 0xba, 0xfc, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9,
+  0xb8, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xeb, 0xfd,
+  0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa3, 0xfe,
+  0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfb, 0xed, 0xfc, 0xff, 0xf8, 0xa1, 0xfe, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe9, 0xfc, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xf7,
+  0x9e, 0xfd, 0xff, 0xfb, 0xce, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xfa,
+  0xc8, 0xfc, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xf8, 0x9e, 0xfd, 0xff, 0xfb, 0xd9, 0xfb, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xad, 0xff,
+  0xff, 0xf8, 0xac, 0xfd, 0xff, 0xfc, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf8, 0xa6, 0xff, 0xff, 0xf9, 0xba, 0xfd,
+  0xff, 0xfc, 0xdb, 0xfd, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xfc, 0xf5, 0xfd, 0xff, 0xfc, 0xea, 0xfd, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xad, 0xff, 0xff, 0xf8,
+  0xa5, 0xfe, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfa,
+  0xcd, 0xfd, 0xff, 0xfa, 0xd1, 0xfb, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0xb0, 0xfc, 0xff, 0xfd, 0xf7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xac, 0xfe,
+  0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfc, 0xf1, 0xfc,
+  0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xf8, 0x9f, 0xfd, 0xff, 0xfb, 0xe8, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9,
+  0xac, 0xff, 0xff, 0xf8, 0xa1, 0xfe, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xfa, 0xba, 0xfe, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xf8,
+  0x98, 0xfe, 0xff, 0xf9, 0xc4, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xd8, 0xfd, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xa9, 0xfe,
+  0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xfa, 0xc8, 0xfc,
+  0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe1, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9,
+  0xab, 0xff, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfa, 0xc1, 0xfc, 0xff, 0xfb, 0xd0, 0xfc, 0xff, 0xf8, 0x9e, 0xfd, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfc,
+  0xe3, 0xfc, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff,
+  0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xf8, 0xb4, 0xfc, 0xff, 0xf9, 0xca, 0xfb, 0xff, 0xf7, 0x9d, 0xfd, 0xff, 0xf8, 0x9e, 0xfe, 0xff, 0xf9, 0xaf, 0xfd,
+  0xff, 0xfa, 0xd5, 0xfc, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf8, 0xa3, 0xff, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf8, 0xab, 0xff, 0xff, 0xf8,
+  0xa1, 0xfe, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xfb, 0xe9, 0xfc, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xf9, 0xb6, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xc3, 0xfc,
+  0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfb, 0xeb, 0xfb, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe,
+  0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf9,
+  0xc1, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf8, 0x9e, 0xfe, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xdd,
+  0xfd, 0xff, 0xf8, 0xa5, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xfa, 0xc5, 0xfb, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xf8, 0xa2,
+  0xfe, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfd, 0xfa, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xf9, 0xce, 0xfb, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xfa, 0xd2, 0xfc,
+  0xff, 0xfc, 0xf3, 0xfc, 0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf8, 0xad, 0xfc, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfe, 0xf5, 0xfe, 0xff,
+  0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0xff, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xf8, 0xb4, 0xfc, 0xff,
+  0xfa, 0xd9, 0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xf8, 0xb8, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xfe, 0xff,
+  0xfe, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfa, 0xdc, 0xfb, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xed, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+  0x8a, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xed, 0xfc, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0x36, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff, 0xa8, 0xff,
+  0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0x24, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc2, 0x81, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xd8, 0xfe,
+  0xff, 0xfe, 0x96, 0xfc, 0xe3, 0xfe, 0x54, 0xfb, 0xd5, 0xfd, 0x12, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0e, 0x82, 0xff, 0xff, 0xff, 0xff, 0x08, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xfa, 0xc3, 0xfd, 0xc7, 0xf8, 0xa6, 0xfe, 0x85, 0xf9, 0xb4, 0xfd, 0x43, 0xfb, 0xe0, 0xfd, 0x01, 0x92,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x50, 0x82, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9,
+  0xc6, 0xfc, 0xff, 0xfa, 0xd8, 0xfc, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfc, 0xee, 0xfd, 0xf7, 0xfe, 0xfd, 0xfe, 0xb5, 0xfe, 0xfe, 0xff, 0x73, 0xfe, 0xff, 0xfe, 0x31, 0x8f,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0x92, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfa, 0xc7, 0xfc,
+  0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xf5, 0xfc, 0xe5, 0xfd, 0xfb, 0xfc, 0xa3, 0xff, 0xff, 0xff, 0x61, 0xfe, 0xfe, 0xfe, 0x1f, 0x8b, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x0e, 0xfd, 0xf4, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf9, 0xa9, 0xfd,
+  0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf8, 0xa7, 0xfd, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xf4, 0xfe, 0xff, 0xfb, 0xe2, 0xfd, 0xff, 0xfa, 0xde, 0xfc,
+  0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfa,
+  0xc7, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfa,
+  0xc5, 0xfd, 0xff, 0xfd, 0xe8, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xfe, 0xff,
+  0x62, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfc, 0xe4, 0xfc, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfb, 0xd4, 0xfc,
+  0xff, 0xf9, 0xac, 0xfd, 0xff, 0xfc, 0xda, 0xfe, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x89, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0xff, 0xfe, 0xff, 0xa4, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xe1, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfc,
+  0xe5, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfb,
+  0xd6, 0xfc, 0xff, 0xf9, 0xb7, 0xfe, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x24, 0x89, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0xe6, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd7, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xab, 0xff,
+  0xff, 0xf8, 0xac, 0xfe, 0xff, 0xfb, 0xdd, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xbb, 0xfe,
+  0xff, 0xfb, 0xe3, 0xfd, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfb, 0xcb, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xd9, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfc, 0xe4, 0xfd, 0xff, 0xf8,
+  0xa6, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfd, 0xf3, 0xfe, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8,
+  0xa6, 0xff, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xba, 0xfd, 0xff, 0xfc, 0xe6, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfc, 0xe6, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf8, 0xa6, 0xfe,
+  0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfc, 0xda, 0xfd, 0xff, 0xf8, 0xac, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfe, 0xfd, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xf9, 0xb6, 0xfe, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfa,
+  0xcd, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xf9, 0xc5, 0xfc, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xfb,
+  0xe3, 0xfd, 0xff, 0xfc, 0xf4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0x88, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff,
+  0x01, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe4, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xaa, 0xfe,
+  0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfb, 0xd8, 0xfc,
+  0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfe, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x89, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xde, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9,
+  0xac, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfb, 0xce, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfa, 0xb8, 0xfe, 0xff, 0xfb,
+  0xd1, 0xfc, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xfa, 0xd8, 0xfd, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x85, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfb, 0xdb, 0xfd,
+  0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xf8, 0xa3, 0xfd,
+  0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xc0, 0xfc, 0xff, 0xfb, 0xe0, 0xfd, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfa,
+  0xc8, 0xfc, 0xff, 0xf8, 0xb6, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfb, 0xd8, 0xfd, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xb2, 0xfd,
+  0xff, 0xf9, 0xbd, 0xfc, 0xff, 0xfa, 0xdb, 0xfb, 0xff, 0xfb, 0xe0, 0xfc, 0xff, 0xf9, 0xca, 0xfc, 0xff, 0xf8, 0xb5, 0xfc, 0xff, 0xf8, 0x9e, 0xfe, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfb, 0xd6, 0xfc,
+  0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x55, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfc, 0xda, 0xfd, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfa,
+  0xd0, 0xfc, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfb, 0xe9, 0xfb, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfa, 0xcf, 0xfd, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfb,
+  0xdf, 0xfd, 0xff, 0xfc, 0xe2, 0xfd, 0xff, 0xfc, 0xf3, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x89, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0xff, 0xff, 0xff, 0x97, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf9, 0xb8, 0xfd,
+  0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xf9, 0xc3, 0xfc, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfa, 0xd1, 0xfc,
+  0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x31, 0x89, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xf9,
+  0xbc, 0xfc, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfa, 0xbb, 0xfc, 0xff, 0xf9, 0xb5, 0xfc, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xfa,
+  0xbc, 0xfd, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x03, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x89, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf9,
+  0xc1, 0xfc, 0xff, 0xfc, 0xec, 0xfc, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfb, 0xcf, 0xfe, 0xff, 0xfa, 0xbb, 0xfe, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfd,
+  0xee, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa4, 0x89, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfc,
+  0xe9, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff,
+  0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x62, 0x89, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff,
+  0xff, 0xff, 0xa8, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x20, 0x89, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0xc2, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfb, 0xe5, 0xfc, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x02, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xd4, 0x8b,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0xfe, 0xfe, 0x1f, 0xff, 0xfd, 0xff, 0x61, 0xfc, 0xed, 0xfc, 0xa3, 0xfd, 0xf2, 0xfd, 0xe5, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x92, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x31, 0xfe, 0xfe, 0xfe, 0x73, 0xff, 0xff, 0xff,
+  0xb5, 0xff, 0xff, 0xff, 0xf7, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x50, 0x92, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff,
+  0x85, 0xff, 0xff, 0xff, 0xc7, 0x87, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0e, 0x96, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff,
+  0x96, 0xff, 0xff, 0xff, 0xd8, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xc2, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff,
+  0xa8, 0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0x75, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0x53, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x5a, 0x81, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xb1, 0xfe, 0xfe, 0xfe, 0x31, 0x9a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd9, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0x8e, 0xfe, 0xff, 0xfe, 0x0f, 0x97, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xff, 0x7c, 0x82, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xef, 0xfe, 0xec, 0xfa, 0xcb, 0xfd, 0x6c, 0x95,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xcc, 0xfd, 0xff, 0xfb, 0xd4, 0xfc, 0xff, 0xfa, 0xcb, 0xfd, 0xca, 0xf9, 0xab, 0xfd, 0x4a, 0x93, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff,
+  0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x08, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xfa,
+  0xbf, 0xfd, 0xff, 0xf9, 0xc5, 0xfc, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xb8, 0xfd, 0xa7, 0xfb, 0xe2, 0xfd, 0x28, 0x90, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xfe, 0xff,
+  0x41, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x08, 0xfb,
+  0xe4, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0x85, 0xfe,
+  0xfe, 0xff, 0x06, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xfe, 0xff, 0xc0, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfa, 0xcf, 0xfd,
+  0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xdb, 0xfc,
+  0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xb0, 0xfd, 0xff, 0xfc, 0xe8, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xe3, 0xfe, 0xfd, 0xfe, 0x63, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff,
+  0xff, 0xff, 0x63, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xf8, 0xa4, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfd,
+  0xf2, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xf8, 0xb5, 0xfd, 0xff, 0xf9,
+  0xb5, 0xfd, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xf5, 0xfe, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfd, 0xf8, 0xfc, 0xc0, 0xfe, 0xfd, 0xfd, 0x41, 0x89, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0xe3, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf0, 0xfe, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xad, 0xff,
+  0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfb, 0xd0, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xad, 0xfd, 0xff, 0xfb, 0xe6, 0xfc,
+  0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0x9e, 0xff, 0xff, 0xff, 0x1f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd,
+  0xf5, 0xfd, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xf9,
+  0xb8, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf8, 0xa1, 0xfd, 0xff, 0xfb,
+  0xd7, 0xfd, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x86, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff,
+  0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xe4, 0xfd, 0xff, 0xf9, 0xb3, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xab, 0xfe,
+  0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfb, 0xd0, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xfb, 0xdd, 0xfd,
+  0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xfe, 0xf4, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0x86, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfb, 0xff, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xf8,
+  0xa8, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf8, 0xa6, 0xff, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfa, 0xd0, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xfa, 0xbb, 0xfe, 0xff, 0xfd,
+  0xf7, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x86, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff,
+  0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 0xfe, 0xff, 0xfa, 0xc4, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xab, 0xff,
+  0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xab, 0xff, 0xff, 0xf9, 0xbe, 0xfd,
+  0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x14, 0xfc, 0xe7, 0xfd,
+  0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfa, 0xc5, 0xfc, 0xff, 0xf9, 0xa8, 0xfe,
+  0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xf9, 0xc6, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x86, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9,
+  0xab, 0xff, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xae, 0xff, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfa,
+  0xcb, 0xfc, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xfc, 0xf2, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff,
+  0xff, 0xff, 0x0f, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xec, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfe,
+  0xff, 0xfc, 0xf3, 0xfd, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xf9, 0xb2, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xfa, 0xc4, 0xfc,
+  0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xfa, 0xba, 0xfd, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xca, 0xfc,
+  0xff, 0xfd, 0xf6, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x86, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0x8e, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xf9,
+  0xb4, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfb, 0xd2, 0xfc, 0xff, 0xf9, 0xb7, 0xfc, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa,
+  0xc8, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xc7, 0xfd, 0xff, 0xfc, 0xed, 0xfd, 0xff, 0xfd, 0xf9, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xca, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x31, 0x80, 0xff, 0xff, 0xff, 0xff, 0x16, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xee, 0xfc, 0xff, 0xf9, 0xd2, 0xfc, 0xff, 0xf9,
+  0xb9, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfb, 0xe6, 0xfb, 0xff, 0xf9,
+  0xc9, 0xfc, 0xff, 0xf9, 0xc9, 0xfb, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x86, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xb1, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9, 0xb9, 0xfd,
+  0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfb, 0xe2, 0xfb, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xf8, 0xaa, 0xfd, 0xff, 0xf9, 0xaf, 0xfe,
+  0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x86, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xf9,
+  0xc2, 0xfc, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xfc, 0xe9, 0xfc, 0xff, 0xfc, 0xf4, 0xfc, 0xff, 0xfa, 0xc3, 0xfc, 0xff, 0xfa, 0xbe, 0xfc, 0xff, 0xf9, 0xbb, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9,
+  0xb6, 0xfd, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfb, 0xdb, 0xfd, 0xff, 0xfa, 0xd0, 0xfd, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x28, 0x86, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xd0, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd,
+  0xf2, 0xfd, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xf8, 0xba, 0xfc, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xdb, 0xfd, 0xff, 0xf9,
+  0xae, 0xfe, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfc, 0xe3, 0xfd, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x87, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff,
+  0x1f, 0xfe, 0xfe, 0xfe, 0x9e, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xf5, 0xfd, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfc, 0xec, 0xfc, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfd, 0xf0, 0xfe, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xfd, 0xf5, 0xfc,
+  0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xe3, 0xff, 0xff, 0xff, 0x06, 0x89, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xf5, 0xfd, 0x41, 0xfc, 0xef, 0xfc, 0xc0, 0xfd, 0xf1, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x0d, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x63, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xfc, 0xff, 0x63, 0xfe, 0xfe, 0xfe, 0xe3, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x03, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xc0, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xfe, 0xfe, 0x06, 0xff, 0xff, 0xff, 0x85, 0x82, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xff, 0xfe, 0xff, 0x01, 0xff, 0xfe, 0xfe, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x41, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xa7, 0x8a, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0xff, 0x9e, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xca, 0x87, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
+  0xff, 0x1f, 0x95, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xec, 0x85, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x7c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x8e, 0x83, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xd9, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xb1,
+  0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x5a, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7,
+  0x9f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x75, 0xff, 0xff, 0xff, 0x36, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff,
+  0xff, 0x30, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0x11, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5,
+  0xff, 0xff, 0xff, 0x11, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xfe, 0xfe, 0xfe, 0x11, 0x97, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xc5,
+  0xff, 0xfe, 0xff, 0x11, 0x95, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xfe, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xc5, 0xfb, 0xd9, 0xfd, 0x11, 0x93, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xff, 0xfe, 0xff, 0x30, 0xff, 0xfe, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x05, 0xff, 0xfd,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfb, 0xd2, 0xfd, 0xc5, 0xfc, 0xe2, 0xfc, 0x11, 0x91, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0x30,
+  0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xdb, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfb, 0xd6, 0xfc, 0xff, 0xfa, 0xbd, 0xfd, 0xc5, 0xf8, 0xa9, 0xfe, 0x11,
+  0x8f, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xd6, 0xfe, 0xff, 0xfa, 0xc0,
+  0xfd, 0xff, 0xf8, 0xb1, 0xfd, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfd, 0xf4, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xf8, 0xa9,
+  0xfe, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xc5, 0xf9, 0xbd, 0xfc, 0x11, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xea, 0xfe, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfa, 0xc0, 0xfd, 0xff,
+  0xfd, 0xf4, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xdf, 0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xf8, 0xab, 0xfe, 0xff,
+  0xf8, 0xb1, 0xfd, 0xff, 0xfb, 0xe2, 0xfd, 0xc5, 0xfd, 0xfa, 0xfd, 0x11, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfe, 0xfd,
+  0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf5, 0xfe, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xb1,
+  0xfd, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xc5, 0xfe, 0xfe, 0xff, 0x11, 0x89, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xec, 0xfd, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xac, 0xfd, 0xff,
+  0xfb, 0xe1, 0xfc, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xf9, 0xb6, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfa, 0xd7, 0xfc, 0xff,
+  0xf8, 0xab, 0xfd, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xc5, 0xfe, 0xfd, 0xfe, 0x11, 0x87, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff,
+  0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xfb, 0xd5, 0xfe, 0xff, 0xf8, 0xab,
+  0xfe, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xad, 0xfd, 0xff, 0xfc, 0xeb, 0xfc, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfe, 0xf3, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf9, 0xad,
+  0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfc, 0xe4, 0xfd, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfd, 0xf3, 0xfe, 0xff, 0xfd, 0xf4,
+  0xfd, 0xff, 0xfc, 0xf6, 0xfc, 0xc5, 0xfd, 0xf8, 0xfc, 0x11, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf9, 0xa8, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xac, 0xff, 0xff,
+  0xf9, 0xb4, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfa, 0xbb, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xfa, 0xcc, 0xfd, 0xff,
+  0xfb, 0xd7, 0xfc, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xfe, 0xfc, 0xfd, 0xc5,
+  0xff, 0xff, 0xff, 0x11, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x19, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfd, 0xf2, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xfa, 0xd5, 0xfc, 0xff,
+  0xf9, 0xb4, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfb, 0xe0, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfa, 0xbf, 0xfd, 0xff,
+  0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xfc, 0xda, 0xfe, 0xff, 0xfd, 0xec, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xc5, 0xfe, 0xfe, 0xfe, 0x11,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf8,
+  0xfe, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf8, 0xae,
+  0xfe, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xf9, 0xb4,
+  0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xb9, 0xfe, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x80, 0xff, 0xff, 0xff, 0xff, 0x61,
+  0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff,
+  0xf9, 0xaa, 0xff, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xfa, 0xc4, 0xfc, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xba, 0xfe, 0xff,
+  0xfb, 0xd6, 0xfd, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf9, 0xb7, 0xfc, 0xff, 0xfb, 0xcc, 0xfd, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff,
+  0xfa, 0xc0, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xbc, 0xfd, 0xff,
+  0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xb3, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfd, 0xf9, 0xfd, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xb0, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xf5, 0xfe, 0xff,
+  0xfc, 0xec, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xf9, 0xc4, 0xfc, 0xff,
+  0xf9, 0xc0, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf8, 0xa7, 0xfd, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfa, 0xbe, 0xfd, 0xff,
+  0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xfe, 0xfe, 0xfe, 0x11, 0xfe, 0xfe, 0xfe, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xfc, 0xec,
+  0xfd, 0xff, 0xfb, 0xd9, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf9, 0xc8, 0xfc, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xc3,
+  0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfa, 0xdc, 0xfc, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xf9, 0xc1, 0xfb, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xc1,
+  0xfc, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfb, 0xd9, 0xfc, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x83, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xff, 0x11, 0xfd, 0xf2, 0xfd, 0xc5, 0xfc, 0xee, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff,
+  0xfa, 0xdd, 0xfb, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfa, 0xbf, 0xfc, 0xff,
+  0xf9, 0xc0, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfa, 0xd3, 0xfd, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf7, 0xa1, 0xfd, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff,
+  0xfd, 0xf2, 0xfd, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfd, 0xf9, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4,
+  0xff, 0xff, 0xff, 0x30, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xfc, 0xef, 0xfc, 0x11, 0xfd, 0xf3, 0xfd, 0xc5, 0xfe, 0xfa, 0xfe, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xfc, 0xd8, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xaf,
+  0xfe, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9, 0xaa, 0xfd, 0xff, 0xfc, 0xdb, 0xfc, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x87, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfd, 0xff, 0x11,
+  0xfe, 0xfe, 0xfe, 0xc5, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x11, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfc, 0xde, 0xfe, 0xff, 0xfa, 0xc3,
+  0xfc, 0xff, 0xfa, 0xbb, 0xfd, 0xff, 0xfa, 0xbb, 0xfd, 0xff, 0xf9, 0xc7, 0xfc, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfd, 0xf6,
+  0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x89, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0xfe, 0xfe, 0xfe, 0x11, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf5, 0xfe, 0xff, 0xfd, 0xf6, 0xfe, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfd, 0xf7, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x8b, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x80, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x0b, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xe4, 0xff, 0xff, 0xff, 0x30, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x80, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xff, 0xfe, 0xff, 0x03, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x8f, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x91, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x88, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+  0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x86, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff,
+  0xff, 0x30, 0x95, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x84, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x97, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x11,
+  0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff,
+  0xff, 0x30, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xee, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x1f, 0x9c, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0x8e, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x41, 0x98, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x96, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfe, 0xff, 0x4a, 0xff, 0xfe, 0xff, 0xca, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x63, 0x93, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x28, 0xff,
+  0xff, 0xff, 0xa7, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xe3, 0xff, 0xfe, 0xff, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff,
+  0x06, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xed, 0xfe, 0xff, 0xfd, 0xf4, 0xfd,
+  0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0x85, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xf3, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff,
+  0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xe5, 0xfe, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfb, 0xd2, 0xfd, 0x28, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfb, 0xdb, 0xfd, 0xff, 0xf9, 0xb0, 0xfe,
+  0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfb, 0xdc, 0xfd,
+  0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfb, 0xd9, 0xfc, 0xa7, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x9e, 0x80, 0xff, 0xff, 0xff, 0xff,
+  0x12, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfb, 0xdd, 0xfd, 0xff, 0xf9, 0xb2, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xac, 0xff,
+  0xff, 0xf8, 0xad, 0xfe, 0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xe8, 0xfd, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xf8, 0xab, 0xfd,
+  0xff, 0xfa, 0xda, 0xfc, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0x4a, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x81,
+  0xfe, 0xfe, 0xfe, 0xff, 0x11, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xfc, 0xdf, 0xfe, 0xff, 0xf9, 0xbe, 0xfe, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa7, 0xfe,
+  0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xeb, 0xfe, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xfa, 0xce, 0xfc,
+  0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf8, 0xb0, 0xfd, 0xca, 0x86, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x81,
+  0xfe, 0xfe, 0xfe, 0xff, 0x14, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xab, 0xff,
+  0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xf9, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf8, 0xaa, 0xfe,
+  0xff, 0xf8, 0xad, 0xfe, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfc, 0xef, 0xfd, 0x6c, 0x83, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff,
+  0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe,
+  0xf7, 0xfe, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfc, 0xf3, 0xfd, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9,
+  0xaa, 0xff, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfc, 0xe7, 0xfc, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfd, 0xe8, 0xfe, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9,
+  0xb4, 0xfd, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xf8, 0xb3, 0xfd, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xec, 0xfe, 0xff, 0xfe, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0xff, 0xff, 0xff, 0x75, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xee, 0xfc,
+  0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfb, 0xd6, 0xfc, 0xff, 0xfa, 0xbe, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe,
+  0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xf9, 0xc0, 0xfd, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf8, 0xaa, 0xfe,
+  0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfe, 0xf8, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0x8e, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x1e, 0xfe, 0xfe, 0xfe, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfa,
+  0xd8, 0xfc, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xa8, 0xff, 0xff, 0xf8,
+  0xa5, 0xfe, 0xff, 0xf9, 0xc3, 0xfd, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf9, 0xbc, 0xfe, 0xff, 0xfb,
+  0xdc, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfa, 0xfd, 0x31, 0x82,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0xfe, 0xf9, 0xfe, 0x53, 0xfd, 0xf2, 0xfd, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xf9, 0xc1, 0xfc,
+  0xff, 0xf9, 0xb5, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xf9, 0xb3, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xa6, 0xfe, 0xff, 0xf9, 0xad, 0xfe,
+  0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfb, 0xd8, 0xfc,
+  0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfa, 0xd5, 0xfd, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfc, 0xf7, 0xfc,
+  0xb1, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xf0, 0xfd, 0xb1, 0xfc, 0xea, 0xfd, 0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xfb, 0xde, 0xfd, 0xff, 0x80, 0xfb, 0xdf, 0xfc, 0xff,
+  0x16, 0xfa, 0xc6, 0xfd, 0xff, 0xf9, 0xc3, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfb, 0xcb, 0xfc, 0xff, 0xf9, 0xb9, 0xfd,
+  0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xb7, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9, 0xac, 0xfe,
+  0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfb, 0xd1, 0xfe, 0xff, 0xfc, 0xdc, 0xfd, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0x53, 0x82, 0x00, 0x00,
+  0x00, 0x00, 0x1e, 0xfe, 0xf9, 0xfe, 0x31, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd,
+  0xfb, 0xfd, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xd9, 0xfb, 0xff, 0xfb, 0xe0, 0xfb, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf8,
+  0xa1, 0xfd, 0xff, 0xf9, 0xb5, 0xfe, 0xff, 0xfa, 0xbc, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xf8, 0xa9, 0xfd, 0xff, 0xfa, 0xbb, 0xfc, 0xff, 0xfa,
+  0xc1, 0xfd, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xd3, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0xfe, 0xfe, 0xfe, 0x8e, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfa, 0xfe,
+  0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xbd, 0xfc, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xfb, 0xe6, 0xfb, 0xff, 0xfb, 0xe8, 0xfc, 0xff, 0xf9, 0xc2, 0xfc, 0xff, 0xfa, 0xcd, 0xfc,
+  0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xfb, 0xe8, 0xfd, 0xff, 0xfc, 0xeb, 0xfc, 0xff, 0xfd, 0xfa, 0xfd,
+  0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0x75, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xec, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x13, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xee, 0xfe, 0xff, 0xf9, 0xb0, 0xfe,
+  0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xf9, 0xc0, 0xfd, 0xff, 0xf8, 0xae, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xc9, 0xfc,
+  0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfc, 0xf1, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x36, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x6c, 0x80, 0xff, 0xff,
+  0xff, 0xff, 0x17, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xfa,
+  0xd2, 0xfc, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xfc, 0xee, 0xfd, 0xff, 0xfb, 0xe6, 0xfd, 0xff, 0xfb, 0xeb, 0xfc, 0xff, 0xfb,
+  0xe1, 0xfc, 0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff,
+  0xff, 0xff, 0x5a, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xca, 0x80, 0xff, 0xff, 0xff, 0xff, 0x14, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd,
+  0xfb, 0xfe, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfb, 0xd9, 0xfc, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xfb, 0xe0, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xff,
+  0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x7c, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x4a, 0x80, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfc,
+  0xec, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x1f, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa7, 0x81, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x41, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+  0x28, 0x83, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x63, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+  0x85, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0xe3, 0x88, 0xff, 0xff,
+  0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x28, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0x86, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xca, 0xff,
+  0xff, 0xff, 0x4a, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x83, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0x6c, 0x98, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xff, 0x41, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x0f, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0x31, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x53, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff,
+  0xff, 0xc2, 0x99, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0xd9, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0xff, 0x1f, 0x94, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x43, 0xff, 0xfe, 0xff, 0x85, 0xff, 0xfe, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x61, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0x73,
+  0xff, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa3, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xa4,
+  0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x05, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb,
+  0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xe5, 0x89, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff,
+  0xff, 0x0e, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xd4, 0x82, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfc, 0xdd, 0xfe, 0xff, 0xfb, 0xcb, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0x31, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff,
+  0xff, 0x80, 0xff, 0xff, 0xff, 0xc2, 0x80, 0xff, 0xff, 0xff, 0xff, 0x84, 0xfe, 0xfe, 0xfe, 0xff, 0x08, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfb, 0xd3, 0xfd,
+  0xff, 0xf9, 0xb5, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x02, 0xff, 0xfe, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x73, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xfe,
+  0xff, 0xfd, 0xee, 0xfe, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xfa, 0xca, 0xfd,
+  0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf4, 0xfe, 0xb5, 0x86, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0xfe, 0xfe, 0xfe, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfe,
+  0xf4, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfa, 0xc1, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9,
+  0xa9, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfc, 0xe6, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd,
+  0xf2, 0xfe, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfa, 0xcb, 0xfd, 0xf7, 0xfb, 0xd4, 0xfd, 0x01, 0x85, 0x00, 0x00, 0x00, 0x00, 0x12, 0xfe, 0xf8, 0xfe, 0xa8, 0xfd, 0xf8, 0xfd,
+  0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfb, 0xea, 0xfc, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfb, 0xde, 0xfd,
+  0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xa8, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xbd, 0xfc,
+  0xff, 0xfc, 0xf2, 0xfc, 0xff, 0x80, 0xfe, 0xff, 0xfe, 0xff, 0x05, 0xfd, 0xf3, 0xfd, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xf9, 0xb2, 0xfe, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xfb,
+  0xd2, 0xfc, 0x43, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfc, 0xee, 0xfc, 0x66, 0xfc, 0xed, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfb, 0xd4, 0xfc, 0xff, 0xfa, 0xce, 0xfc,
+  0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfa, 0xb8, 0xfe, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe,
+  0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfc, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfc, 0xe7, 0xfd,
+  0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf9, 0xac, 0xfd, 0x85, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfe,
+  0xf6, 0xfe, 0x24, 0xfe, 0xf8, 0xfe, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfa, 0xdf, 0xfb, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf9, 0xcc, 0xfc, 0xff, 0xf8, 0xb3, 0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9,
+  0xb7, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf9, 0xbb, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xfa,
+  0xc7, 0xfd, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfd, 0xef, 0xfd, 0xff, 0xfd, 0xe8, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xf9, 0xb9, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfa,
+  0xd1, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf8, 0xaa, 0xfd, 0xc7, 0x86, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfe, 0xfe, 0xfe, 0xd8, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfd,
+  0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xfc, 0xed, 0xfc, 0xff, 0xfb, 0xe0, 0xfc, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xf8, 0xac, 0xfe,
+  0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xaf, 0xfd,
+  0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xfa, 0xce, 0xfc,
+  0xff, 0xfb, 0xde, 0xfd, 0x12, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x96, 0x80, 0xff, 0xfe, 0xff, 0xff, 0x17, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xf9, 0xfd,
+  0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfa, 0xc1, 0xfc, 0xff, 0xfb, 0xd1, 0xfc,
+  0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xb5, 0xfc, 0xff, 0xfa, 0xdd, 0xfc,
+  0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xf9, 0xb8, 0xfc, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfe, 0xfb, 0xfe, 0x54, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x54, 0xff,
+  0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x09, 0xfd, 0xf1, 0xfe, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfa, 0xbe, 0xfc, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfa, 0xce, 0xfc,
+  0xff, 0xfa, 0xca, 0xfc, 0xff, 0xfb, 0xce, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0x80, 0xf8, 0xa9, 0xff, 0xff, 0x08, 0xf9, 0xb1, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfb,
+  0xda, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0x96, 0x85, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xff, 0x12, 0x80, 0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xf9, 0xb3, 0xfc, 0xff, 0xf9,
+  0xc5, 0xfc, 0xff, 0xfb, 0xe3, 0xfb, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9,
+  0xae, 0xfe, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfe,
+  0xfe, 0xfd, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xd8, 0x86, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xd4, 0xfe, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xf9, 0xcc, 0xfc,
+  0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xfb, 0xde, 0xfd, 0xff, 0xfa, 0xcf, 0xfd, 0xff, 0xfb, 0xcc, 0xfd, 0xff, 0xfa, 0xbd, 0xfd,
+  0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xb9, 0xfc, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfb, 0xe7, 0xfd, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfd, 0xf8, 0xfd,
+  0x24, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x85, 0x80, 0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfb, 0xd2, 0xfd,
+  0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xf8, 0xad, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xf9, 0xb8, 0xfd,
+  0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfa, 0xcf, 0xfb, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xfb, 0xcf, 0xfd,
+  0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xfc, 0xef, 0xfc, 0xff, 0xfd, 0xf9, 0xfc, 0x66, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x43, 0x80, 0xff, 0xff, 0xff, 0xff,
+  0x17, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfc, 0xe7, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfb, 0xcf, 0xfd,
+  0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfc, 0xee, 0xfc,
+  0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfe,
+  0xa8, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf7, 0x80, 0xff, 0xff, 0xff, 0xff, 0x16, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfb, 0xfd, 0xff, 0xfe, 0xf7, 0xfd, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfb, 0xcb, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfc, 0xee, 0xfd,
+  0xff, 0xfb, 0xe2, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xea, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb5, 0x80, 0xff, 0xff, 0xff, 0xff,
+  0x0e, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xec, 0xfd,
+  0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0x81, 0xfe, 0xfe,
+  0xfe, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+  0x73, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x02, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0x80, 0xfe, 0xfe,
+  0xfe, 0xff, 0x04, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff,
+  0xc2, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x1d, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x31, 0x85, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x0e, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0xff, 0xe5, 0x87, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xa4, 0xff,
+  0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0x20, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa3, 0x88, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xb5, 0xff,
+  0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x31, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x61, 0x85, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0x85, 0xff,
+  0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x01, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1f, 0x81, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0x97, 0xff,
+  0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0x13, 0x99, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0x24, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x01, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x05, 0xfe, 0xfd, 0xfe, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd,
+  0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x03, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfc, 0xed, 0xfc, 0x00, 0xfc, 0xed, 0xfc, 0xff, 0xfc, 0xf8, 0xfd,
+  0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff,
+  0xff, 0xff, 0x08, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfc, 0xe9, 0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x16, 0xfd, 0xf1, 0xfd, 0x00, 0xfd, 0xf1, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfa, 0xd2,
+  0xfc, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xf9, 0xce, 0xfb, 0xff, 0xfc, 0xdd, 0xfd, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfd, 0xfb,
+  0xfd, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfc, 0xe1, 0xfe, 0xff, 0xfb, 0xd8, 0xfd, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa8,
+  0xfd, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+  0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfa, 0xdc, 0xfb, 0xff, 0xf8, 0xb8, 0xfc, 0xff, 0xf8, 0xb4, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xf8, 0xa5, 0xfd, 0xff, 0xfb, 0xda, 0xfc,
+  0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xad, 0xff,
+  0xff, 0xf9, 0xad, 0xff, 0xff, 0xf7, 0x9e, 0xfd, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xf8, 0xad, 0xfc, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff,
+  0xfa, 0xc6, 0xfd, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xf8, 0xa3, 0xff, 0xff, 0x80, 0xf9, 0xac, 0xff, 0xff, 0x0b, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xac,
+  0xfd, 0xff, 0xfb, 0xce, 0xfc, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xf2, 0xfc, 0xff,
+  0xfa, 0xd2, 0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xf9, 0xb6, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff,
+  0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfc, 0xf0, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x15,
+  0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xf3, 0xfc, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff,
+  0xf9, 0xab, 0xff, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa1, 0xfe, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfb, 0xe1, 0xfd, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff,
+  0xff, 0xff, 0x16, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xf9, 0xc3, 0xfc, 0xff, 0xf8,
+  0xa1, 0xfe, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xfe,
+  0xfd, 0xfe, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf8, 0x9f, 0xfe, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfc, 0xe6, 0xfc, 0xff, 0x87,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x16, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xfa, 0xc5, 0xfb, 0xff, 0xf9, 0xc1,
+  0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xfa, 0xc1, 0xfc, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf8, 0xa5,
+  0xfe, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf9, 0xab, 0xfd, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xfb, 0xe6,
+  0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x16, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xf9, 0xb0, 0xfe,
+  0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfb, 0xeb, 0xfb, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xfb, 0xd0, 0xfc, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf8, 0xa5, 0xfe,
+  0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xa9, 0xfd, 0xff, 0xfb, 0xe9, 0xfc,
+  0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa0, 0xfe, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x16, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfb, 0xe9, 0xfc, 0xff, 0xf8, 0xb4, 0xfc, 0xff, 0xf8, 0x9e, 0xfd, 0xff,
+  0xf8, 0xa2, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf8, 0xa6, 0xff, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf9, 0xb8, 0xfc, 0xff,
+  0xfb, 0xed, 0xfc, 0xff, 0xf9, 0xcd, 0xfc, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xf8, 0xa3, 0xff, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x16, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xf8, 0x9e, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xf9,
+  0xca, 0xfb, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xba, 0xfe, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfb,
+  0xdc, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xba, 0xfc, 0xff, 0xf8, 0x9c, 0xfe, 0xff, 0xf8, 0xa7, 0xfd, 0xff, 0xf9, 0xbe, 0xfc, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00,
+  0x81, 0xff, 0xff, 0xff, 0xff, 0x15, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfa, 0xfc, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfa, 0xc0,
+  0xfd, 0xff, 0xf7, 0x9d, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfc, 0xf1, 0xfc, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfc, 0xdb, 0xfd, 0xff, 0xfc, 0xea,
+  0xfc, 0xff, 0xfb, 0xed, 0xfc, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x87, 0x00,
+  0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xf1, 0xfd,
+  0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xf8, 0x9e, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xf8, 0x98, 0xfe, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfa, 0xd1, 0xfb, 0xff, 0xf8, 0xab, 0xfd,
+  0xff, 0xf8, 0x9e, 0xfd, 0xff, 0xf8, 0xa1, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfb, 0xe5, 0xfb, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff,
+  0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xfd, 0xfc, 0xfd, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xf9, 0xc4, 0xfd, 0xff, 0xf8, 0x9f, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfc, 0xf5, 0xfd, 0xff,
+  0xfb, 0xd9, 0xfb, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xf8, 0x9f, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0x87, 0x00, 0x00, 0x00, 0x00, 0x83, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x10, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xd5, 0xfc, 0xff, 0xfd, 0xf2, 0xfd, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfb, 0xe8, 0xfc, 0xff, 0xf8, 0xb0, 0xfc, 0xff, 0xfc, 0xea, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xfa, 0xfd, 0xff,
+  0xfd, 0xf4, 0xfd, 0xff, 0xfd, 0xeb, 0xfe, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xf9, 0xd0, 0xfc, 0xff, 0xfc, 0xf5, 0xfc, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xff,
+  0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd,
+  0xf7, 0xfc, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xfb, 0xfc,
+  0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xff, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xfe, 0xfe, 0xfe, 0xff, 0x02, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x87,
+  0x00, 0x00, 0x00, 0x00, 0x97, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0x24, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xfe, 0xfe,
+  0x1f, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff,
+  0x13, 0x98, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xfd, 0xff, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x01, 0x94, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xfc, 0xed, 0xfc, 0xa3, 0xfd, 0xf6, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0x31, 0x91, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfd, 0xf2, 0xfd, 0xe5, 0xfb,
+  0xe5, 0xfc, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0x06, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xfe, 0xff, 0xa4, 0xff, 0xfe, 0xff, 0x62, 0xff, 0xff, 0xff, 0x20, 0x8c, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x31, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfd, 0xfe, 0xfd, 0xff,
+  0xfb, 0xe7, 0xfc, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff,
+  0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x06, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff,
+  0xff, 0x0e, 0x88, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfe, 0xfe, 0xfe, 0x73, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff,
+  0xfb, 0xdb, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfc, 0xda, 0xfd, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x1d, 0x85, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff,
+  0xff, 0xb5, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf9, 0xbc,
+  0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfb, 0xdb, 0xfd, 0xff, 0xfc, 0xde, 0xfd, 0xff, 0xfc, 0xe4, 0xfe, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfc, 0xe6, 0xfd, 0xff, 0xfc, 0xe4,
+  0xfd, 0xff, 0xfc, 0xd7, 0xfd, 0xff, 0xfc, 0xe1, 0xfe, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xff, 0xff, 0xff, 0x36, 0x84, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xfe, 0xff, 0xfc, 0xec, 0xfc, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8, 0xa5,
+  0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xb6, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfc, 0xe4, 0xfc, 0xff, 0xfe, 0xff,
+  0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xea, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x43, 0x80, 0xff, 0xff, 0xff, 0xff, 0x13,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff,
+  0xf9, 0xab, 0xff, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa5, 0xfe, 0xff,
+  0xfa, 0xcb, 0xfd, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa8, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0x85, 0x80, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xd0,
+  0xfc, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa6,
+  0xfe, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xff, 0xff, 0xff, 0x66, 0x85, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf9,
+  0xfe, 0xff, 0xfb, 0xcf, 0xfe, 0xff, 0xfa, 0xbb, 0xfc, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xab,
+  0xff, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfb, 0xdd, 0xfd, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0x83, 0xfe,
+  0xfe, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xff, 0x24, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x12, 0x80, 0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xfb, 0xfe, 0xff, 0xfa, 0xbb, 0xfe, 0xff, 0xf9, 0xb5, 0xfc, 0xff, 0xf9, 0xc3, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xbd, 0xfc, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xf9, 0xaa, 0xfe, 0xff,
+  0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd8, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0x54, 0x80, 0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xfa, 0xc9, 0xfc, 0xff,
+  0xfb, 0xe9, 0xfb, 0xff, 0xfa, 0xdb, 0xfb, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfb, 0xce, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff,
+  0xfd, 0xf3, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0x96, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x96, 0x80, 0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+  0xfe, 0xfb, 0xfe, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfb, 0xe0, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xc7, 0xfc, 0xff,
+  0xf9, 0xba, 0xfd, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xfb, 0xd9, 0xfd, 0xff,
+  0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xfc, 0xe3, 0xfe, 0x54, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0xd8, 0x80, 0xff, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfd, 0xee, 0xfd, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xfa, 0xbe, 0xfd, 0xff,
+  0xfa, 0xcf, 0xfd, 0xff, 0xf9, 0xca, 0xfc, 0xff, 0xf8, 0xb6, 0xfc, 0xff, 0xf8, 0xa3, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff,
+  0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xa9, 0xfd, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xf9, 0xc6, 0xfc, 0xff,
+  0xfb, 0xdc, 0xfc, 0xff, 0xfb, 0xd5, 0xfd, 0x12, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x24, 0x81, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xf8, 0xb5, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xc9, 0xfd, 0xff,
+  0xfa, 0xb8, 0xfe, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf8, 0xa6, 0xff, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff,
+  0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfa, 0xd8, 0xfc, 0xff, 0xfa, 0xc3, 0xfd, 0xc7, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x66, 0x82, 0xff,
+  0xff, 0xff, 0xff, 0x15, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xf8, 0x9e, 0xfe, 0xff,
+  0xfa, 0xcf, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf9, 0xbb, 0xfe, 0xff,
+  0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0x85, 0x85, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xa8, 0x83, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x10, 0xfb, 0xdf, 0xfd, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfb, 0xd8, 0xfd, 0xff, 0xfa, 0xc0, 0xfc,
+  0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfc, 0xda, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfb, 0xe3, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xc1, 0xfc,
+  0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xf8, 0xa7, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xb4, 0xfd, 0x43, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xea, 0x84,
+  0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x10, 0xfc, 0xe2, 0xfd, 0xff, 0xfb, 0xd6, 0xfc, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfb, 0xe0, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xf9, 0xb9,
+  0xfd, 0xff, 0xf9, 0xc5, 0xfc, 0xff, 0xf8, 0xac, 0xfd, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfb, 0xd6, 0xfc, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xc1,
+  0xfd, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xfc, 0xee, 0xfd, 0xf7, 0xfb, 0xe0, 0xfd, 0x01, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x36, 0x86, 0xff, 0xff, 0xff, 0xff, 0x11, 0xfe, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xf3, 0xfe, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xfa, 0xd8, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfb, 0xda,
+  0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfa, 0xba, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xb7, 0xfe, 0xff, 0xfb, 0xd4, 0xfc, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xfe,
+  0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xb5, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xc2, 0x85, 0xff, 0xff, 0xff, 0xff, 0x10, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfb, 0xe3, 0xfd, 0xff, 0xfd, 0xf7,
+  0xfd, 0xff, 0xfc, 0xe6, 0xfd, 0xff, 0xfb, 0xcb, 0xfe, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfe, 0xf4, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe,
+  0xff, 0x73, 0x88, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xd4, 0x80, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf9, 0xfd, 0xff, 0xfc, 0xf4,
+  0xfc, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfc, 0xda, 0xfe, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfb, 0xe2, 0xfd, 0xff, 0xfe, 0xfc,
+  0xfe, 0xff, 0xfe, 0xff, 0xfe, 0x31, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0xe6, 0x81, 0xff, 0xff, 0xff,
+  0xff, 0x0b, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xf8, 0xff, 0xff, 0xfd, 0xe8, 0xfd, 0xff, 0xfa, 0xde, 0xfc, 0xff, 0xfc, 0xf5, 0xfc, 0xe5, 0x91, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0x73,
+  0xff, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x83, 0xfe, 0xfe, 0xfe, 0xff, 0x01, 0xfd, 0xfe,
+  0xfd, 0xff, 0xfd, 0xfb, 0xfc, 0xa3, 0x94, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xc7, 0x82, 0xff, 0xff, 0xff,
+  0xff, 0x03, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x61, 0x98, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x55,
+  0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0x1f, 0x9c, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xc2, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff,
+  0x1f, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x53, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfe, 0xfe, 0xfe, 0x9e, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xff,
+  0xff, 0xff, 0x31, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0xf5, 0xfd, 0x41, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x0f, 0x99, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfc, 0xef, 0xfc, 0xc0, 0xfc, 0xf5, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0x6c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xfc, 0xff, 0x63, 0xfd, 0xf1, 0xfd,
+  0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0x4a, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xfe, 0xfe, 0xfe, 0x06, 0xfe, 0xfe, 0xfe, 0xe3, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfb,
+  0xd8, 0xfc, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x28, 0x92, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x85, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xec, 0xfc,
+  0xff, 0xf8, 0xba, 0xfc, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfc, 0xee, 0xfc, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0x06, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xf9, 0xc2, 0xfc, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xf9, 0xd2, 0xfc, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xfe, 0xfc, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
+  0x63, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xf9,
+  0xc4, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfc, 0xf3, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xc0, 0xff, 0xfe, 0xff, 0x41, 0x8b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xff, 0x4a, 0x80, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xe9, 0xfc, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xf9,
+  0xb7, 0xfd, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfd, 0xee, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x1f, 0x89, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xff, 0xca, 0x80, 0xff, 0xff, 0xff, 0xff, 0x14, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xf4, 0xfc, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfa,
+  0xc3, 0xfd, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xf9, 0xb2, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xfa, 0xc4, 0xfe, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xfc, 0xe4, 0xfd, 0xff, 0xfd,
+  0xf5, 0xfd, 0xff, 0xfd, 0xf0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x7c, 0x87,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x6c, 0x80, 0xff, 0xff, 0xff, 0xff, 0x11, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfc, 0xdb, 0xfd, 0xff, 0xfa,
+  0xc3, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xf9, 0xb4, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8,
+  0xab, 0xfe, 0xff, 0xf9, 0xb3, 0xfe, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0x80, 0xff, 0xfe, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0x5a, 0x84, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf0, 0xfe, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfa, 0xbe, 0xfc, 0xff, 0xfa, 0xc7, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xf9,
+  0xad, 0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf8,
+  0xa6, 0xfe, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff,
+  0xb7, 0xff, 0xff, 0xff, 0x36, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8e, 0x80, 0xff, 0xff, 0xff, 0xff, 0x14, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe,
+  0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xf9, 0xbb, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xab, 0xff,
+  0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xad, 0xff, 0xff, 0xf8, 0xa4, 0xfd, 0xff, 0xfa, 0xcf, 0xfd,
+  0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x75, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x31, 0x81, 0xff, 0xff,
+  0xff, 0xff, 0x14, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfb, 0xe2, 0xfb, 0xff, 0xfa,
+  0xd6, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf9,
+  0xbe, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+  0xd3, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb1, 0x81, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfc, 0xe1, 0xfd,
+  0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfb, 0xe6, 0xfb, 0xff, 0xfb, 0xd2, 0xfc, 0xff, 0xfa, 0xc4, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xf9, 0xbd, 0xfd,
+  0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x53, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x53, 0x82, 0xff, 0xff, 0xff, 0xff, 0x18, 0xff,
+  0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xf9, 0xc9, 0xfc, 0xff, 0xf9,
+  0xb7, 0xfc, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xfa, 0xc5, 0xfc, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xb1, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd3, 0x84, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xe3, 0xfd, 0xff, 0xfa,
+  0xcd, 0xfc, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xf9, 0xc9, 0xfb, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf8,
+  0xa8, 0xfe, 0xff, 0xfb, 0xd0, 0xfd, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0x31, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x75, 0x84, 0xff, 0xff, 0xff, 0xff, 0x16, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xf8, 0xaa, 0xfd, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa,
+  0xbe, 0xfd, 0xff, 0xf9, 0xae, 0xff, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xfb, 0xd0, 0xfd, 0xff, 0xfb,
+  0xd2, 0xfd, 0xff, 0xfb, 0xda, 0xfd, 0xff, 0xfb, 0xe4, 0xfd, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x8e, 0x82, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0xb7, 0x84, 0xff, 0xff, 0xff, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x12, 0xfb, 0xdb, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfb, 0xd3, 0xfd, 0xff,
+  0xfa, 0xc8, 0xfc, 0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf8, 0xab, 0xff, 0xff, 0xf8, 0xa6, 0xff, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff,
+  0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfb, 0xcc, 0xfd, 0xff, 0xfd, 0xef, 0xfe, 0xec, 0xfe, 0xff, 0xfe, 0x0f,
+  0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xd9, 0x82, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xfa, 0xd0, 0xfd, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xba, 0xfd, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xf9, 0xbe, 0xfd, 0xff,
+  0xf9, 0xb9, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xf8, 0xad, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xc5, 0xfc, 0xff,
+  0xfb, 0xd4, 0xfc, 0xff, 0xfa, 0xcb, 0xfd, 0x6c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xfc, 0x81, 0xff, 0xff, 0xff, 0xff, 0x12, 0xfe, 0xff, 0xff, 0xff,
+  0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xf9, 0xc7, 0xfd, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xc8, 0xfd, 0xff,
+  0xfc, 0xe0, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfb, 0xdd, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xfa, 0xdb, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff,
+  0xfa, 0xd3, 0xfc, 0xff, 0xfa, 0xcb, 0xfd, 0xca, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xed, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xc3,
+  0xfd, 0xff, 0xf9, 0xc6, 0xfd, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xfa, 0xd0, 0xfd, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf8, 0xb5, 0xfd, 0xff, 0xf8, 0xa7,
+  0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xab, 0xfd, 0x4a, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf9, 0xfe, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xfb, 0xda, 0xfd, 0xff,
+  0xfc, 0xea, 0xfc, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf8, 0xb0, 0xfd, 0xff,
+  0xf9, 0xbb, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xa7, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xf6, 0xfc, 0xff, 0xfc, 0xf2, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfa, 0xbb, 0xfe, 0xff, 0xf9, 0xb1,
+  0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xfc, 0xe8, 0xfd, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfb, 0xe2, 0xfd, 0x28, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xf8, 0xa1, 0xfd, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0x85, 0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfd, 0xff, 0xff, 0xfe, 0xf4, 0xfe, 0xff, 0xfb, 0xd7, 0xfd, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfd, 0xf5, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xe3, 0xfe, 0xfe, 0xff, 0x06, 0x94, 0x00, 0x00, 0x00,
+  0x00, 0x0b, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0x63, 0x97, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xec,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xfd, 0xf8, 0xfc, 0xc0, 0x99, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0x41, 0x9b, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0x9e, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x53,
+  0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xfe, 0xfe, 0x11, 0xff, 0xff, 0xff, 0xb0,
+  0xff, 0xff, 0xff, 0x30, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x11, 0xfe, 0xfe, 0xfe, 0xc5, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x9b, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xfc, 0xef, 0xfc, 0x11, 0xfd, 0xf2, 0xfd, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xfd, 0xff, 0x11, 0xfd, 0xf3, 0xfd, 0xc5, 0xfc, 0xee, 0xfc, 0xff, 0xfd, 0xfb, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfe, 0xfe, 0xfe, 0x11, 0xfe, 0xfe, 0xfe, 0xc5, 0xfe, 0xfa, 0xfe, 0xff, 0xfb, 0xdf, 0xfc, 0xff,
+  0xfc, 0xec, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfa, 0xdd, 0xfb, 0xff, 0xfb, 0xd9, 0xfc, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x93, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x11,
+  0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff,
+  0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x91, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff,
+  0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xf9, 0xc8, 0xfc, 0xff, 0xfa, 0xce,
+  0xfc, 0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff,
+  0xff, 0x30, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x80, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd,
+  0xfd, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xe2, 0xfc, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfa, 0xc9,
+  0xfd, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff,
+  0xff, 0x30, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x80, 0xff, 0xff, 0xff, 0xff, 0x11, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xfd, 0xf2,
+  0xfd, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x89, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x80, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa,
+  0xfe, 0xff, 0xfc, 0xd8, 0xfe, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xb8,
+  0xfd, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xfe,
+  0xff, 0x30, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x81, 0xff, 0xff, 0xff, 0xff, 0x14, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfc, 0xde, 0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfa, 0xbf, 0xfc, 0xff, 0xfa, 0xc3, 0xfc, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xf8, 0xa7,
+  0xff, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfb, 0xd5, 0xfe, 0xff, 0xfd, 0xec, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd,
+  0xfe, 0xff, 0xff, 0xfe, 0xff, 0xe4, 0xff, 0xfe, 0xff, 0x30, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xc5, 0x82, 0xff, 0xff, 0xff, 0xff, 0x15, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf5, 0xfe, 0xff, 0xfa, 0xc3, 0xfc, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xf8, 0xab,
+  0xfe, 0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xa8, 0xff, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfd, 0xea,
+  0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x11,
+  0xff, 0xff, 0xff, 0xc5, 0x82, 0xff, 0xff, 0xff, 0xff, 0x17, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf6, 0xfe, 0xff, 0xfa, 0xbb, 0xfd, 0xff, 0xf8, 0xa5,
+  0xfe, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfa, 0xdc, 0xfc, 0xff, 0xf9, 0xc0, 0xfc, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab,
+  0xff, 0xff, 0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xfc, 0xd6, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xb0, 0x83, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfb, 0xfc, 0xff, 0xfa, 0xbb, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xfa, 0xcf,
+  0xfc, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xac,
+  0xff, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0x80, 0xff, 0xfe, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x84, 0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xf9, 0xc7, 0xfc, 0xff, 0xfb, 0xd3, 0xfd, 0xff,
+  0xfa, 0xd3, 0xfd, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfa, 0xc4, 0xfc, 0xff, 0xf8, 0xae, 0xfe, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xf9, 0xb4, 0xfd, 0xff,
+  0xf8, 0xad, 0xfd, 0xff, 0xf8, 0xac, 0xfd, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xb1, 0xfd, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x82, 0xff,
+  0xff, 0xff, 0xff, 0x14, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf9, 0xc1, 0xfb, 0xff,
+  0xf8, 0xa7, 0xfd, 0xff, 0xfa, 0xbc, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xd5, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfc, 0xeb, 0xfc, 0xff, 0xfb, 0xe1, 0xfc, 0xff,
+  0xfa, 0xcb, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+  0xff, 0xe4, 0xff, 0xff, 0xff, 0x30, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x81, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf7, 0xa1, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xa7,
+  0xfe, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xb4, 0xfe, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfd, 0xf4,
+  0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0x03, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff,
+  0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x80, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xf9, 0xaa, 0xfd, 0xff,
+  0xfa, 0xc9, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xf9, 0xb3, 0xfe, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xfa, 0xbb, 0xfd, 0xff,
+  0xfe, 0xf3, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xc5, 0xff,
+  0xff, 0xff, 0x11, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0x80, 0xff, 0xff, 0xff, 0xff, 0x17, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xf7, 0xfe, 0xff, 0xfa,
+  0xd3, 0xfc, 0xff, 0xfc, 0xdb, 0xfc, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfa, 0xc1, 0xfc, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf9,
+  0xa9, 0xff, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfd, 0xf5, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+  0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff,
+  0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf6, 0xfd, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfd, 0xf2, 0xfd,
+  0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xf9, 0xba, 0xfe, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xad, 0xfe,
+  0xff, 0xf9, 0xb6, 0xfe, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xfc, 0xdf, 0xfd, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x87, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfa,
+  0xcb, 0xfd, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf8, 0xa4, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xa8, 0xff, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfb,
+  0xdb, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xc5, 0xfe, 0xfe, 0xfe, 0x11, 0x89, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff,
+  0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf9, 0xfe, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfa, 0xca, 0xfd,
+  0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfb, 0xe0, 0xfd, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xf9, 0xbb, 0xfd,
+  0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xc5, 0xff, 0xfe, 0xff, 0x11, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0x30, 0xff,
+  0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfb, 0xd9, 0xfc, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfc, 0xea, 0xfc, 0xff, 0xf9,
+  0xb7, 0xfc, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfa, 0xcd, 0xfc, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfb,
+  0xde, 0xfc, 0xff, 0xfb, 0xd6, 0xfc, 0xff, 0xfb, 0xd2, 0xfd, 0xc5, 0xfb, 0xd9, 0xfd, 0x11, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfb, 0xcc, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfa, 0xbf, 0xfd,
+  0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfa, 0xbd, 0xfd, 0xc5, 0xfc, 0xe2, 0xfc,
+  0x11, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0xf9, 0xb9, 0xfe, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfc, 0xe4, 0xfd, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xf8,
+  0xb1, 0xfd, 0xff, 0xf8, 0xa7, 0xfe, 0xc5, 0xf8, 0xa9, 0xfe, 0x11, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfc, 0xe9, 0xfd, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xfe, 0xfa, 0xfd, 0xff, 0xfe, 0xfa, 0xfd,
+  0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfb, 0xe2, 0xfd, 0xc5, 0xf9, 0xbd, 0xfc, 0x11, 0x93, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xfe, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfc, 0xda, 0xfe, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfd, 0xf3, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xfe, 0xc5, 0xfd, 0xfa, 0xfd, 0x11, 0x95, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xec, 0xfd, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xc5, 0xfe, 0xfe, 0xff, 0x11, 0x97, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff,
+  0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xfc, 0xf6, 0xfc, 0xc5, 0xfe,
+  0xfd, 0xfe, 0x11, 0x99, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfd,
+  0xc5, 0xfd, 0xf8, 0xfc, 0x11, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xe4, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xc5, 0xff, 0xff, 0xff, 0x11, 0x9d,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xb0, 0xfe, 0xfe, 0xfe, 0x11, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0xc5, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0xff, 0xff, 0x75, 0xff, 0xff, 0xff, 0x36, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xf9, 0xfe, 0x53, 0xfe, 0xfe, 0xfe, 0xd3, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x9b,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xfe, 0xf9, 0xfe, 0x31, 0xfd, 0xf0, 0xfd, 0xb1, 0xfd, 0xf2, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x5a, 0x98, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0x0f, 0xfe, 0xfe, 0xfe, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xea, 0xfd, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xec, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe,
+  0xff, 0xfb, 0xe7, 0xfc, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x94, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xfb,
+  0xd5, 0xfc, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x1f, 0x91, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xa7, 0x80, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xde, 0xfd, 0xff, 0xf9,
+  0xc0, 0xfc, 0xff, 0xfd, 0xf7, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x8f, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x85, 0x82, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9,
+  0xc1, 0xfc, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfc, 0xee, 0xfc, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x41, 0x8d,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xe3, 0x82, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe,
+  0xfc, 0xfe, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xb5, 0xfc, 0xff, 0xfa, 0xd8, 0xfc, 0xff, 0xfa, 0xd3, 0xfc, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0xc0, 0x82, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfe, 0xff, 0xfe, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0xfa, 0xfe, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf9, 0xb3, 0xfd, 0xff, 0xfa,
+  0xc8, 0xfd, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfd, 0xee, 0xfe, 0xff, 0xfb,
+  0xd2, 0xfd, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xfb, 0xd6, 0xfc, 0xff, 0xfc, 0xf3, 0xfd, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff,
+  0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x06, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd0, 0x84, 0xff, 0xff, 0xff, 0xff, 0x11, 0xfe, 0xff, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xe0, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf9, 0xc3, 0xfd, 0xff, 0xfa, 0xd1, 0xfd,
+  0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xfa, 0xbe, 0xfe, 0xff, 0xfa, 0xcd, 0xfd, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x85, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x53, 0x84, 0xff, 0xff, 0xff, 0xff, 0x12, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfb, 0xfe,
+  0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xf8, 0xa8, 0xfd, 0xff, 0xf9, 0xbd, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xb3, 0xfe, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xf8, 0xa7, 0xff,
+  0xff, 0xf9, 0xac, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfe, 0xf2, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x28, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xb1, 0x82, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xe5, 0xfd,
+  0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xfa, 0xd4, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xaa, 0xfe,
+  0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfc, 0xdf, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xa7, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x31, 0x82, 0xff, 0xff, 0xff, 0xff, 0x14, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xd9, 0xfc,
+  0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfb, 0xe6, 0xfb, 0xff, 0xfa, 0xd9, 0xfb, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf9, 0xa6, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe,
+  0xff, 0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xbe, 0xfe, 0xff, 0xfb, 0xdd, 0xfd, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0x4a, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8e, 0x81, 0xff, 0xff, 0xff, 0xff, 0x14, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe,
+  0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xfb, 0xe8, 0xfc, 0xff, 0xfb, 0xe0, 0xfb, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf9, 0xa8, 0xff,
+  0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf8, 0xa5, 0xff, 0xff, 0xf9, 0xb2, 0xfe, 0xff, 0xfb, 0xdb, 0xfd, 0xff, 0xfe, 0xf3, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xca, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xec, 0x80, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xfe, 0xff,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xeb, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf9, 0xc0, 0xfd, 0xff, 0xf9, 0xc2, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfb, 0xcb, 0xfc,
+  0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xb0, 0xfe,
+  0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x6c, 0x80,
+  0xff, 0xff, 0xff, 0xff, 0x16, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfb, 0xe0, 0xfd, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xf8, 0xae, 0xfc, 0xff, 0xfa, 0xcd, 0xfc,
+  0xff, 0xf8, 0xa1, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xc3, 0xfd, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf8, 0xa7, 0xfe,
+  0xff, 0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfd, 0xed, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff,
+  0x0f, 0x87, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xe5, 0xfd, 0xff, 0xf9,
+  0xb2, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xcb, 0xfc, 0xff, 0xf9, 0xb5, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf9, 0xbb, 0xfd, 0xff, 0xfb,
+  0xe1, 0xfc, 0xff, 0xfc, 0xe7, 0xfc, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xb2, 0xfd, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x87, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfc, 0xe3, 0xfc, 0xff, 0xfa, 0xc9, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa, 0xbc, 0xfe,
+  0xff, 0xf8, 0xaa, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xc0, 0xfd, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfb, 0xd1, 0xfc,
+  0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x31, 0x87, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc,
+  0xee, 0xfd, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xfd,
+  0xe8, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfd, 0xf2, 0xfd, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x87, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfb, 0xe6, 0xfd, 0xff, 0xf9, 0xad, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xf9, 0xb7, 0xfe,
+  0xff, 0xf8, 0xac, 0xfe, 0xff, 0xf8, 0xa7, 0xff, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfa, 0xc9, 0xfd, 0xff, 0xfd, 0xf9, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x80, 0xfe, 0xfe,
+  0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x53, 0x87, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xeb, 0xfc, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xfa, 0xc8, 0xfc, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf8, 0xa4,
+  0xff, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xfd, 0xeb, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xd0, 0x87, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
+  0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfb, 0xe8, 0xfd, 0xff, 0xf8, 0xa9, 0xfd, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfb, 0xd8, 0xfc, 0xff, 0xf9, 0xbc,
+  0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xaa, 0xfe, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfc, 0xe8, 0xfd, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfd,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x1f, 0x88, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf5, 0xfc, 0xff, 0xfc, 0xf1, 0xfd, 0xff, 0xfc, 0xeb, 0xfc, 0xff, 0xfa, 0xbb, 0xfc, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfb, 0xe7,
+  0xfc, 0xff, 0xfb, 0xdc, 0xfc, 0xff, 0xfa, 0xc6, 0xfc, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xb8, 0xfe, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfe, 0xff,
+  0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x41, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xff, 0xff, 0xc0,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xfa, 0xc1, 0xfd, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xfa, 0xce, 0xfd, 0xff,
+  0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfc, 0xe5, 0xfe, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xe3, 0xfe, 0xfe, 0xfe, 0x63, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xf9, 0xb0, 0xfe, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfb, 0xd9, 0xfd, 0xff, 0xf8, 0xa2, 0xfe, 0xff, 0xf8, 0xb3,
+  0xfd, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfa, 0xda, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0x85, 0xff, 0xfe, 0xff, 0x06, 0x8f, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xf9, 0xb2, 0xfd, 0xff,
+  0xfa, 0xcc, 0xfc, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xf8, 0xab, 0xfd, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf8, 0xa3, 0xfe, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xfb, 0xd9, 0xfc, 0xa7,
+  0xfb, 0xd2, 0xfd, 0x28, 0x91, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7,
+  0xfe, 0xff, 0xfb, 0xd1, 0xfe, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xf8, 0xfd, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xf8, 0xb0, 0xfd, 0xca, 0xf8, 0xa7,
+  0xfe, 0x4a, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xdc, 0xfd, 0xff,
+  0xfa, 0xd5, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xec, 0xfc, 0xef, 0xfd, 0x6c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xfb, 0xe4, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0x8e, 0xfe, 0xff, 0xfe, 0x0f, 0x98, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xfc, 0xf7, 0xfc, 0xb1, 0xfd, 0xfa, 0xfd, 0x31,
+  0x9b, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xb7, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xd3, 0xfe, 0xfe, 0xfe, 0x53, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x36,
+  0xff, 0xff, 0xff, 0x75, 0xff, 0x00, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0x1d, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfe, 0xf6, 0xfe,
+  0x24, 0xfc, 0xee, 0xfc, 0x66, 0xfe, 0xf8, 0xfe, 0xa8, 0xfe, 0xfe, 0xfe, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x97, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x12, 0xff,
+  0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x96, 0xfe, 0xfe, 0xfe, 0xd8, 0xfe, 0xf8, 0xfe, 0xff, 0xfc, 0xed, 0xfd, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xc2, 0x93, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf5, 0xfd, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xfd, 0xfc, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0e, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0xf7, 0x81, 0xff, 0xff, 0xff, 0xff,
+  0x09, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfa, 0xdf, 0xfb, 0xff, 0xfa, 0xd6, 0xfc, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xe5, 0x85,
+  0xff, 0xff, 0xff, 0xff, 0x09, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfb, 0xd4, 0xfc, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc2, 0x87, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfe, 0xfe, 0xfe,
+  0xff, 0x07, 0xfd, 0xf3, 0xfd, 0xff, 0xf9, 0xcc, 0xfc, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xd4, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa8, 0x85, 0xff, 0xff, 0xff, 0xff, 0x0e, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xed, 0xfc, 0xff, 0xf8, 0xb3, 0xfc, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfb, 0xea, 0xfc, 0xff, 0xfd, 0xfb, 0xfd, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x66, 0x83, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xfd, 0xf1, 0xfe, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfb, 0xe0,
+  0xfc, 0xff, 0xf9, 0xb6, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xfe, 0xf4, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x62, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x24, 0x83, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf1,
+  0xfd, 0xff, 0xfb, 0xd4, 0xfe, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xfa, 0xc4, 0xfd, 0xff, 0xf9, 0xb7, 0xfd, 0xff, 0xf9, 0xb1, 0xfd, 0xff, 0xfb, 0xd3,
+  0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xd9,
+  0x81, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfb, 0xd2, 0xfd, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xf9, 0xb3,
+  0xfc, 0xff, 0xfa, 0xbe, 0xfc, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfa, 0xc6, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfa, 0xcb, 0xfd, 0xff, 0xfb, 0xde, 0xfd, 0xff, 0xfd, 0xfe, 0xfd, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x97, 0x81, 0xff, 0xff, 0xff, 0xff, 0x12, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfc, 0xe7, 0xfc, 0xff, 0xf9, 0xb0, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xc5, 0xfc, 0xff, 0xf9, 0xc4, 0xfc, 0xff, 0xfa, 0xcc,
+  0xfc, 0xff, 0xf9, 0xc1, 0xfd, 0xff, 0xf9, 0xbb, 0xfe, 0xff, 0xfa, 0xb8, 0xfe, 0xff, 0xfa, 0xbf, 0xfd, 0xff, 0xfd, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x55, 0x81, 0xff, 0xff, 0xff, 0xff, 0x12, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfb, 0xfd, 0xff, 0xf9, 0xc1, 0xfc, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xfb, 0xe3, 0xfb, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xf9, 0xbc, 0xfc, 0xff, 0xf8, 0xac,
+  0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x13, 0x80, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xf7, 0xfd, 0xff, 0xfb, 0xd7, 0xfc, 0xff, 0xfa, 0xd1, 0xfd, 0xff, 0xfb, 0xdd, 0xfc, 0xff, 0xfb, 0xe8, 0xfb, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xf8, 0xa8,
+  0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xa8, 0xff, 0xff, 0xfa, 0xc1, 0xfe, 0xff, 0xfd, 0xee, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xfc, 0xef, 0xfd, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xf9, 0xbf, 0xfd, 0xff, 0xf9, 0xcc, 0xfc, 0xff, 0xfa, 0xd0, 0xfc, 0xff, 0xfa, 0xca, 0xfc, 0xff, 0xf9, 0xb0, 0xfd, 0xff,
+  0xf9, 0xa8, 0xfe, 0xff, 0xf9, 0xab, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xaa, 0xff, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfc, 0xe1, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff,
+  0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x01, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf8, 0xa6, 0xfe, 0xff, 0xf8, 0xad, 0xfc, 0xff, 0xf9, 0xc6, 0xfc, 0xff, 0xf9, 0xae, 0xfd, 0xff, 0xfb, 0xce,
+  0xfc, 0xff, 0xfa, 0xc1, 0xfc, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xac, 0xfe, 0xff, 0xf9, 0xa9, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfd, 0xf7,
+  0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf8, 0xfe, 0xff, 0xfb, 0xdb, 0xfc, 0xff, 0xfb, 0xcb, 0xfc, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xfa, 0xcf, 0xfc, 0xff,
+  0xf8, 0xa4, 0xfe, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xfb, 0xd1, 0xfc, 0xff, 0xf9, 0xb5, 0xfd, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff,
+  0xf8, 0xac, 0xfe, 0xff, 0xfb, 0xd3, 0xfd, 0xff, 0xfe, 0xf5, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x85, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff,
+  0xff, 0x01, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xf7, 0xfe, 0xff, 0xfd, 0xf1, 0xfd, 0xff, 0xfb, 0xd5, 0xfc, 0xff, 0xfa, 0xc7,
+  0xfc, 0xff, 0xfa, 0xc5, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xf9, 0xb4, 0xfd, 0xff, 0xf8, 0xa9,
+  0xfe, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xa9, 0xff, 0xff, 0xf9, 0xb5, 0xfe, 0xff, 0xfc, 0xdd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xc7, 0x8a, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xee, 0xfd, 0xff, 0xf9, 0xbb, 0xfd, 0xff,
+  0xf9, 0xb8, 0xfd, 0xff, 0xfb, 0xce, 0xfd, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xaa, 0xfe, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfc, 0xe7, 0xfc, 0xff,
+  0xf9, 0xbd, 0xfc, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf9, 0xac, 0xff, 0xff, 0xf8, 0xa7, 0xfe, 0xff, 0xfb, 0xcb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x13, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfb, 0xe2,
+  0xfd, 0xff, 0xf9, 0xac, 0xfd, 0xff, 0xfa, 0xc8, 0xfd, 0xff, 0xfb, 0xde, 0xfd, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf8, 0xab, 0xfe, 0xff, 0xfd, 0xef,
+  0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xf2, 0xfc, 0xff, 0xf9, 0xbc, 0xfd, 0xff, 0xf8, 0xa8, 0xfe, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xfb, 0xdf, 0xfc, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x89, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff,
+  0xfe, 0xfc, 0xfe, 0xff, 0xfa, 0xcf, 0xfc, 0xff, 0xf9, 0xaf, 0xfd, 0xff, 0xfa, 0xcf, 0xfb, 0xff, 0xfa, 0xcf, 0xfd, 0xff, 0xf9, 0xb8, 0xfd, 0xff, 0xf8, 0xa9, 0xff, 0xff, 0xf9, 0xa9, 0xff, 0xff,
+  0xf9, 0xaf, 0xfd, 0xff, 0xfd, 0xe8, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xe6, 0xfd, 0xff, 0xfa, 0xca, 0xfd, 0xff, 0xfb, 0xd4, 0xfd, 0xff, 0xfd, 0xf6, 0xfd, 0xff,
+  0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0xe6, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfa, 0xd2, 0xfc, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xf9, 0xc2, 0xfd, 0xff, 0xfb, 0xcc, 0xfd, 0xff, 0xfa, 0xcc, 0xfd, 0xff, 0xf9, 0xb1, 0xfe, 0xff, 0xf8, 0xa6,
+  0xfe, 0xff, 0xf9, 0xaf, 0xfe, 0xff, 0xfb, 0xd6, 0xfd, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfe, 0xf6, 0xfe, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xa4, 0xfe, 0xfe, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9, 0xfd, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfc, 0xee, 0xfc, 0xff, 0xfa, 0xc2, 0xfc, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xfb, 0xe1, 0xfc, 0xff, 0xfa, 0xc4, 0xfd, 0xff,
+  0xf8, 0xa5, 0xfe, 0xff, 0xf9, 0xab, 0xfe, 0xff, 0xf9, 0xb9, 0xfe, 0xff, 0xfc, 0xe7, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xfe, 0xff,
+  0xfe, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x24, 0x89, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xfe,
+  0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfd, 0xf4, 0xfd, 0xff, 0xfa, 0xbd, 0xfd, 0xff, 0xf9, 0xad, 0xfe, 0xff, 0xfb, 0xe6, 0xfc, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xf9, 0xb5, 0xfc, 0xff, 0xf8, 0xa6,
+  0xfe, 0xff, 0xf8, 0xa5, 0xfe, 0xff, 0xfa, 0xbe, 0xfd, 0xff, 0xfd, 0xf3, 0xfd, 0xff, 0x80, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x66, 0x89, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfa, 0xb9, 0xfe, 0xff, 0xf9,
+  0xb0, 0xfe, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xfa, 0xcc, 0xfc, 0xff, 0xfa, 0xdd, 0xfc, 0xff, 0xf9, 0xbe, 0xfd, 0xff, 0xf9, 0xae, 0xfe, 0xff, 0xf8, 0xa9, 0xfe, 0xff, 0xfa, 0xce, 0xfd, 0xff, 0xfd,
+  0xf2, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xa8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0xd4, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xfe, 0xff, 0xfa, 0xc2, 0xfd, 0xff, 0xf9, 0xb9, 0xfd, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xfa, 0xc0, 0xfd, 0xff, 0xf9,
+  0xbc, 0xfd, 0xff, 0xfa, 0xd9, 0xfc, 0xff, 0xfa, 0xd1, 0xfc, 0xff, 0xf9, 0xba, 0xfd, 0xff, 0xf9, 0xb2, 0xfe, 0xff, 0xfb, 0xdc, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xc2, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xff, 0xfb, 0xcf, 0xfd, 0xff, 0xf9, 0xb9, 0xfc, 0xff, 0xfc, 0xe8, 0xfc, 0xff, 0xfb, 0xd1, 0xfd, 0xff, 0xf8, 0xa6, 0xfd, 0xff, 0xf8, 0xad, 0xfe, 0xff, 0xfa,
+  0xcc, 0xfc, 0xff, 0xfb, 0xde, 0xfc, 0xff, 0xf9, 0xbf, 0xfc, 0xff, 0xfa, 0xc3, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff,
+  0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0x1f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+  0xff, 0xfe, 0xfa, 0xfe, 0xff, 0xfb, 0xd5, 0xfd, 0xff, 0xf9, 0xbd, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xf0, 0xfd, 0xff, 0xf9, 0xb8, 0xfc, 0xff, 0xf8, 0xa4, 0xff, 0xff, 0xf8, 0xa3, 0xfe,
+  0xff, 0xfa, 0xc7, 0xfd, 0xff, 0xfb, 0xda, 0xfc, 0xff, 0xfa, 0xcb, 0xfd, 0xf7, 0xfd, 0xf4, 0xfe, 0xb5, 0xff, 0xfe, 0xff, 0x73, 0xfe, 0xfe, 0xfe, 0x31, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff,
+  0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xd7, 0xfc, 0xff, 0xfb, 0xe7, 0xfd, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfe,
+  0xfe, 0xfe, 0xff, 0xfc, 0xec, 0xfd, 0xff, 0xfa, 0xce, 0xfc, 0xff, 0xf8, 0xaa, 0xfd, 0xc7, 0xf9, 0xac, 0xfd, 0x85, 0xfb, 0xd2, 0xfc, 0x43, 0xfb, 0xd4, 0xfd, 0x01, 0x93, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xff, 0xff, 0xff, 0xc2, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfc, 0xef, 0xfc, 0xff, 0xfd, 0xf8, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xd8, 0xfe, 0xff, 0xfe,
+  0x96, 0xfe, 0xfb, 0xfe, 0x54, 0xfb, 0xde, 0xfd, 0x12, 0x97, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xea, 0xfe, 0xfd, 0xfe, 0xa8, 0xfd,
+  0xf9, 0xfc, 0x66, 0xfd, 0xf8, 0xfd, 0x24, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0x36, 0xdd, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_img_dsc_t robotAtlas = {
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = 36,
+  .header.h = 864,
+  .data_size = 57178,
+  .data = robotAtlas_map,
+};
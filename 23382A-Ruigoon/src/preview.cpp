@@ -0,0 +1,141 @@
+#include "preview.hpp"
+#include <array>
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "screen.hpp"
+
+/**
+ * @file preview.cpp
+ * @brief This file contains the task that builds the auton selector's preview paths.
+ * @details A dry run executes the whole routine as if matchState were DISABLED, which for skills
+ * took long enough to freeze the touch screen when it ran in the click handler. This task dry runs
+ * every registered auton for the current alliance, the requested one first, and keeps the results.
+ * Only this task sees the dry run's state, opcontrol carries on with the real matchState and
+ * sideMirrored. It still moves currentPoint like a real run, so that's saved first and put back
+ * after. autonPath only records during dry runs, so it belongs to this task.
+ */
+
+class PreviewSlot {
+    public:
+        std::shared_ptr<const AutonPreview> preview;
+        uint32_t generation = 0;  // built for this preview_generation
+};
+
+static std::atomic<pros::task_t> dry_run_task{nullptr};
+static bool dry_run_mirrored = false;
+
+static pros::Mutex table_mutex;
+static std::vector<std::array<PreviewSlot, PREVIEW_ALLIANCES>> table;
+static uint32_t preview_generation = 1;
+static int requested_auton = -1;
+
+static bool slot_ready(size_t auton, Alliances alliance) {
+    return auton < table.size() && table[auton][alliance].generation == preview_generation;
+}
+
+std::shared_ptr<const AutonPreview> preview_get(size_t auton, Alliances alliance) {
+    table_mutex.take();
+    std::shared_ptr<const AutonPreview> preview = slot_ready(auton, alliance) ? table[auton][alliance].preview : nullptr;
+    table_mutex.give();
+    return preview;
+}
+
+void preview_request(size_t auton) {
+    table_mutex.take();
+    requested_auton = auton;
+    table_mutex.give();
+}
+
+void preview_invalidate() {
+    table_mutex.take();
+    preview_generation++;
+    table_mutex.give();
+}
+
+//
+// Dry run state
+//
+
+void dry_run_begin(bool mirrored) {
+    dry_run_mirrored = mirrored;
+    dry_run_task = pros::c::task_get_current();
+}
+
+void dry_run_end() { dry_run_task = nullptr; }
+
+bool dry_running() { return dry_run_task == pros::c::task_get_current(); }
+
+MatchStates match_state() { return dry_running() ? MatchStates::DISABLED : matchState; }
+
+bool side_mirrored() { return dry_running() ? dry_run_mirrored : sideMirrored; }
+
+//
+// Preview table
+//
+
+// The requested preview, then every other auton, for the alliance on screen. False when all are built
+static bool preview_next(size_t& auton, Alliances& alliance, uint32_t& generation) {
+    table_mutex.take();
+    // Recordings can be added after boot
+    if (table.size() < auton_sel.autons.size()) table.resize(auton_sel.autons.size());
+    generation = preview_generation;
+    alliance = allianceColor;
+    bool found = requested_auton >= 0 && requested_auton < (int)table.size() && !slot_ready(requested_auton, alliance);
+    if (found) auton = requested_auton;
+    for (size_t i = 0; i < table.size() && !found; i++) {
+        if (slot_ready(i, alliance)) continue;
+        auton = i;
+        found = true;
+    }
+    table_mutex.give();
+    return found;
+}
+
+// Runs for allianceColor as it is, the selector is the only thing that changes it
+static std::shared_ptr<const AutonPreview> dry_run(const AutonObj& auton) {
+    Coordinate point = currentPoint;
+
+    dry_run_begin(auton.mirrored);
+    currentPoint = {};
+    autonPath.clear();
+    auton.callback();
+    dry_run_end();
+
+    auto preview = std::make_shared<AutonPreview>();
+    if (!autonPath.empty()) preview->start = autonPath.front();
+    preview->path = injectPath(autonPath.to_vector(), 1);
+    if (autonPath.dropped()) print(auton.name + ": preview cut short, " + std::to_string(autonPath.dropped()) + " points over");
+
+    currentPoint = point;
+    return preview;
+}
+
+void preview_task() {
+    while (true) {
+        size_t auton;
+        Alliances alliance;
+        uint32_t generation;
+        if (!preview_next(auton, alliance, generation)) {
+            pros::delay(PREVIEW_IDLE);
+            continue;
+        }
+
+        preview_mutex.take();
+        if (preview_paused) {
+            preview_mutex.give();
+            pros::delay(PREVIEW_IDLE);
+            continue;
+        }
+        // The list only grows, so the entry is still there
+        AutonObj obj = auton_sel.autons[auton];
+        std::shared_ptr<const AutonPreview> preview = dry_run(obj);
+        preview_mutex.give();
+
+        // Tapping the alliance mid run mixes both transforms, so that one is thrown away
+        table_mutex.take();
+        if (allianceColor == alliance) table[auton][alliance] = {preview, generation};
+        table_mutex.give();
+        // Let the UI and everything else above this task run between dry runs
+        pros::delay(1);
+    }
+}
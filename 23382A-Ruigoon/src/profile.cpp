@@ -0,0 +1,183 @@
+#include "profile.hpp"
+#include <cmath>
+#include "EZ-Template/util.hpp"
+#include "drive.hpp"
+#include "feedforward.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file profile.cpp
+ * @brief This file contains the jerk limited S-curve motion profile and the task that applies it.
+ * @details The profile is built once when a motion starts. Each tick the task samples it by time
+ * or by the distance covered so far, turns the profile's velocity and acceleration into a voltage
+ * through the feedforward model and uses that as the motion's speed cap.
+ */
+
+//
+// Profile
+//
+
+static const double SEGMENT_JERK[7] = {1, 0, -1, 0, -1, 0, 1};
+
+double SCurveProfile::accel_distance(double velocity, double max_acceleration, double max_jerk, double times[2]) {
+    if (velocity * max_jerk >= max_acceleration * max_acceleration) {
+        // Reaches max acceleration, and holds it
+        times[0] = max_acceleration / max_jerk;
+        times[1] = velocity / max_acceleration - times[0];
+    } else {
+        times[0] = sqrt(velocity / max_jerk);
+        times[1] = 0;
+    }
+    // The ramp is symmetric, so the average speed is half the peak
+    return velocity * (2 * times[0] + times[1]) / 2;
+}
+
+SCurveProfile::SCurveProfile(double distance, double max_velocity, double max_acceleration, double max_jerk) {
+    length = fabs(distance);
+    jerk = max_jerk;
+    if (length <= 0 || max_velocity <= 0 || max_acceleration <= 0 || max_jerk <= 0) return;
+
+    double times[2];
+    double velocity = max_velocity;
+    if (2 * accel_distance(velocity, max_acceleration, max_jerk, times) > length) {
+        // Too short to reach max velocity, find the peak that just fits
+        double low = 0, high = max_velocity;
+        for (int i = 0; i < 40; i++) {
+            velocity = (low + high) / 2;
+            if (2 * accel_distance(velocity, max_acceleration, max_jerk, times) > length) high = velocity;
+            else low = velocity;
+        }
+        velocity = low;
+    }
+    double ramp = accel_distance(velocity, max_acceleration, max_jerk, times);
+    double cruise = (length - 2 * ramp) / velocity;
+
+    double segments[7] = {times[0], times[1], times[0], fmax(cruise, 0), times[0], times[1], times[0]};
+    for (int i = 0; i < 7; i++) {
+        durations[i] = segments[i];
+        const ProfileState& s = starts[i];
+        double t = durations[i], j = SEGMENT_JERK[i] * jerk;
+        starts[i + 1].time = s.time + t;
+        starts[i + 1].acceleration = s.acceleration + j * t;
+        starts[i + 1].velocity = s.velocity + s.acceleration * t + j * t * t / 2;
+        starts[i + 1].position = s.position + s.velocity * t + s.acceleration * t * t / 2 + j * t * t * t / 6;
+    }
+    total = starts[7].time;
+}
+
+ProfileState SCurveProfile::at_time(double time) const {
+    if (time <= 0) return starts[0];
+    if (time >= total) return starts[7];
+    int i = 0;
+    while (i < 6 && time >= starts[i + 1].time) i++;
+
+    const ProfileState& s = starts[i];
+    double t = time - s.time, j = SEGMENT_JERK[i] * jerk;
+    ProfileState state;
+    state.time = time;
+    state.acceleration = s.acceleration + j * t;
+    state.velocity = s.velocity + s.acceleration * t + j * t * t / 2;
+    state.position = s.position + s.velocity * t + s.acceleration * t * t / 2 + j * t * t * t / 6;
+    return state;
+}
+
+ProfileState SCurveProfile::at_distance(double distance) const {
+    if (distance <= 0) return starts[0];
+    if (distance >= length) return starts[7];
+
+    // Position only ever increases, so bisect on time
+    double low = 0, high = total;
+    for (int i = 0; i < 30; i++) {
+        double mid = (low + high) / 2;
+        if (at_time(mid).position < distance) low = mid;
+        else high = mid;
+    }
+    return at_time(high);
+}
+
+//
+// Task
+//
+
+enum ProfileAxes {PROFILE_DRIVE = 0, PROFILE_TURN = 1};
+
+static pros::Mutex profile_mutex;
+static bool active = false;
+static ProfileAxes axis;
+static SCurveProfile profile;
+static ProfileSampling mode;
+static int max_speed;
+static uint32_t start_time;
+static double start_left, start_right, start_heading;
+
+// Wheel speed in in/s for a heading rate in deg/s, turning in place
+static double wheel_speed(double degrees) { return util::to_rad(degrees) * TRACK_WIDTH / 2; }
+
+static void profile_begin(ProfileAxes new_axis, SCurveProfile new_profile, int speed, ProfileSampling sampling) {
+    profile_mutex.take();
+    axis = new_axis;
+    profile = new_profile;
+    mode = sampling;
+    max_speed = abs(speed);
+    start_time = pros::millis();
+    start_left = chassis.drive_sensor_left();
+    start_right = chassis.drive_sensor_right();
+    start_heading = chassis.drive_imu_get();
+    active = profile.duration() > 0;
+    profile_mutex.give();
+}
+
+void profile_drive_start(double distance, int speed, ProfileSampling sampling) {
+    SCurveProfile p(distance, get_velocity(abs(speed)), drive_profile_limits.acceleration, drive_profile_limits.jerk);
+    profile_begin(PROFILE_DRIVE, p, speed, sampling);
+}
+
+void profile_turn_start(double degrees, int speed, ProfileSampling sampling) {
+    double max_velocity = util::to_deg(get_velocity(abs(speed)) / (TRACK_WIDTH / 2));
+    SCurveProfile p(degrees, max_velocity, turn_profile_limits.acceleration, turn_profile_limits.jerk);
+    profile_begin(PROFILE_TURN, p, speed, sampling);
+}
+
+void profile_stop() {
+    profile_mutex.take();
+    active = false;
+    profile_mutex.give();
+}
+
+void profile_iterate() {
+    profile_mutex.take();
+    if (active && chassis.drive_mode_get() == ez::DISABLE) active = false;
+    if (active) {
+        double covered = axis == PROFILE_DRIVE ? (fabs(chassis.drive_sensor_left() - start_left) + fabs(chassis.drive_sensor_right() - start_right)) / 2
+                                               : fabs(chassis.drive_imu_get() - start_heading);
+        double elapsed = (pros::millis() - start_time) / 1000.0;
+        ProfileState state = mode == BY_TIME ? profile.at_time(elapsed) : profile.at_distance(covered);
+
+        double velocity = state.velocity, acceleration = state.acceleration;
+        if (axis == PROFILE_TURN) {
+            velocity = wheel_speed(velocity);
+            acceleration = wheel_speed(acceleration);
+        }
+        double voltage = (ff_left.voltage(velocity, acceleration) + ff_right.voltage(velocity, acceleration)) / 2;
+
+        bool done = mode == BY_TIME ? elapsed >= profile.duration() : covered >= profile.distance();
+        if (done) {
+            // Hand the end of the motion back to the PID at full speed
+            chassis.pid_speed_max_set(max_speed);
+            active = false;
+        } else {
+            chassis.pid_speed_max_set(util::clamp(voltage, max_speed, fmin(PROFILE_MIN_SPEED, max_speed)));
+        }
+    }
+    profile_mutex.give();
+}
+
+void profile_task() {
+    uint32_t now = pros::millis();
+    while (true) {
+        profile_iterate();
+        pros::Task::delay_until(&now, ez::util::DELAY_TIME);
+    }
+}
@@ -0,0 +1,299 @@
+#include "recorder.hpp"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "EZ-Template/util.hpp"
+#include "controls.hpp"
+#include "ctrlscreen.hpp"
+#include "drive.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "screen.hpp"
+#include "sdwriter.hpp"
+#include "telemetry.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file recorder.cpp
+ * @brief This file contains driver recording and replay.
+ * @details Opcontrol sessions are stored as delta-encoded frames of driver input and mechanism state,
+ * and can be played back through driver_control() as an autonomous routine.
+ */
+
+class ReplayHeader {
+    public:
+        char magic[4] = {'R', 'P', 'L', 'Y'};
+        uint8_t version = 1;
+        uint8_t period = ez::util::DELAY_TIME;  // ms between frames
+        uint16_t reserved = 0;
+        uint32_t frames = 0;
+        float x = 0, y = 0, t = 0;  // start pose in the authored frame
+};
+
+//
+// Recording
+//
+
+static bool recording = false;
+static ReplayHeader record_header;
+static std::vector<uint8_t> record_buffer;
+static DriverInput record_last;
+static uint8_t record_last_mechanism = 0;
+static bool replay_taken[REPLAY_SLOTS] = {};  // slots with a file on the card
+
+template <typename T>
+static void put(std::vector<uint8_t>& buffer, T value) {
+    uint8_t bytes[sizeof(T)];
+    memcpy(bytes, &value, sizeof(T));
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+static T take(const std::vector<uint8_t>& buffer, size_t& index) {
+    T value;
+    memcpy(&value, buffer.data() + index, sizeof(T));
+    index += sizeof(T);
+    return value;
+}
+
+// Odom pose in the frame the routine is authored in, so replays follow the alliance / side transform
+static Coordinate authored_pose() { return transform_point({chassis.odom_x_get(), chassis.odom_y_get(), chassis.odom_theta_get()}); }
+
+bool recording_active() { return recording; }
+
+void recording_start() {
+    Coordinate start = authored_pose();
+    record_header = ReplayHeader();
+    record_header.x = start.x;
+    record_header.y = start.y;
+    record_header.t = start.t;
+    record_buffer.clear();
+    record_buffer.reserve(16384);
+    recording = true;
+    controller_rumble(".");
+    controller_print(2, "REC");
+    telemetry_event("recording start");
+    print("Recording started");
+}
+
+void recording_iterate() {
+    if (!recording) return;
+    bool first = record_header.frames == 0;
+    uint8_t mechanism = rollerState | piston_states_get() << 3;
+
+    uint8_t fields = 0;
+    for (int i = 0; i < 4; i++) {
+        if (first || driver_input.analog[i] != record_last.analog[i]) fields |= 1 << i;
+    }
+    if (first || driver_input.buttons != record_last.buttons) fields |= FRAME_BUTTONS;
+    if (first || mechanism != record_last_mechanism) fields |= FRAME_MECHANISM;
+    if (record_header.frames % REPLAY_KEYFRAME_TICKS == 0) fields |= FRAME_POSE;
+
+    record_buffer.push_back(fields);
+    for (int i = 0; i < 4; i++) {
+        if (fields & (1 << i)) put<int8_t>(record_buffer, driver_input.analog[i]);
+    }
+    if (fields & FRAME_BUTTONS) put<uint16_t>(record_buffer, driver_input.buttons);
+    if (fields & FRAME_MECHANISM) put<uint8_t>(record_buffer, mechanism);
+    if (fields & FRAME_POSE) {
+        Coordinate pose = authored_pose();
+        put<int16_t>(record_buffer, pose.x * 100);
+        put<int16_t>(record_buffer, pose.y * 100);
+        put<uint16_t>(record_buffer, pose.t * 100);
+    }
+
+    record_last = driver_input;
+    record_last_mechanism = mechanism;
+    record_header.frames++;
+}
+
+void recording_stop() {
+    if (!recording) return;
+    recording = false;
+
+    // Use the first empty slot, and overwrite the last one when they are all taken. Slots were
+    // checked once at startup, so this doesn't touch the card from the driver task
+    int slot = REPLAY_SLOTS - 1;
+    for (int i = 0; i < REPLAY_SLOTS; i++) {
+        if (!replay_taken[i]) {
+            slot = i;
+            break;
+        }
+    }
+    char path[32];
+    snprintf(path, sizeof(path), REPLAY_FILE_FORMAT, slot);
+
+    std::string data((const char*)&record_header, sizeof(record_header));
+    data.append((const char*)record_buffer.data(), record_buffer.size());
+    controller_clear(2);
+    if (!pros::usd::is_installed() || !sd_write(path, data)) {
+        print("Replay not saved, no SD card");
+        controller_print(2, "REC NOT SAVED", CTRL_HIGH, 3000);
+        controller_rumble("---", CTRL_HIGH);
+        return;
+    }
+    replay_taken[slot] = true;
+    telemetry_event("recording saved " + std::to_string(slot));
+    controller_rumble("..");
+    controller_print(2, "SAVED " + std::to_string(slot), CTRL_NORMAL, 2000);
+    print("Saved replay " + std::to_string(slot) + " (" + std::to_string(record_buffer.size()) + " B)");
+}
+
+//
+// Replay
+//
+
+// Recorded pose at a keyframe, in the authored frame
+class ReplayKey {
+    public:
+        uint32_t frame;
+        Coordinate pose;
+};
+
+static bool replaying = false;
+static ReplayHeader replay_headers[REPLAY_SLOTS];
+static std::vector<uint8_t> replay_data[REPLAY_SLOTS];
+static std::vector<ReplayKey> replay_keys[REPLAY_SLOTS];
+
+// Reads the frame at index into the running state, only the fields it carries change. Returns the
+// frame's field bits
+static uint8_t frame_read(const std::vector<uint8_t>& data, size_t& index, DriverInput& input, uint16_t& buttons, uint8_t& mechanism, Coordinate& pose) {
+    uint8_t fields = data[index++];
+    for (int axis = 0; axis < 4; axis++) {
+        if (fields & (1 << axis)) input.analog[axis] = take<int8_t>(data, index);
+    }
+    if (fields & FRAME_BUTTONS) buttons = take<uint16_t>(data, index);
+    if (fields & FRAME_MECHANISM) mechanism = take<uint8_t>(data, index);
+    if (fields & FRAME_POSE) {
+        pose.x = take<int16_t>(data, index) / 100.0;
+        pose.y = take<int16_t>(data, index) / 100.0;
+        pose.t = take<uint16_t>(data, index) / 100.0;
+    }
+    return fields;
+}
+
+// Where the recording was at a frame, between the keyframes either side of it. key is the last
+// keyframe at or before the frame and only moves forward, so a whole replay walks the list once
+static Coordinate replay_pose_at(const std::vector<ReplayKey>& keys, size_t& key, uint32_t frame) {
+    while (key + 1 < keys.size() && keys[key + 1].frame <= frame) key++;
+    const ReplayKey& from = keys[key];
+    if (key + 1 == keys.size() || frame <= from.frame) return from.pose;
+    const ReplayKey& to = keys[key + 1];
+    double fraction = (double)(frame - from.frame) / (to.frame - from.frame);
+    Coordinate pose = from.pose;
+    pose.x += (to.pose.x - from.pose.x) * fraction;
+    pose.y += (to.pose.y - from.pose.y) * fraction;
+    pose.t += util::wrap_angle(to.pose.t - from.pose.t) * fraction;
+    return pose;
+}
+
+bool replay_active() { return replaying; }
+
+static bool replay_load(int slot) {
+    char path[32];
+    snprintf(path, sizeof(path), REPLAY_FILE_FORMAT, slot);
+    FILE* file = sd_open(path, "rb");
+    if (!file) return false;
+    replay_taken[slot] = true;
+
+    ReplayHeader header;
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, "RPLY", 4) == 0 && header.version == 1;
+    if (valid) {
+        uint8_t chunk[512];
+        size_t read;
+        replay_data[slot].clear();
+        while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) replay_data[slot].insert(replay_data[slot].end(), chunk, chunk + read);
+        replay_headers[slot] = header;
+
+        // Index the keyframes up front, the replay interpolates toward the next one every frame
+        const std::vector<uint8_t>& data = replay_data[slot];
+        DriverInput input;
+        uint16_t buttons = 0;
+        uint8_t mechanism = STOP;
+        Coordinate pose;
+        replay_keys[slot].clear();
+        for (size_t i = 0, frame = 0; i < data.size(); frame++) {
+            if (frame_read(data, i, input, buttons, mechanism, pose) & FRAME_POSE) replay_keys[slot].push_back({(uint32_t)frame, pose});
+        }
+        valid = !replay_keys[slot].empty();
+    }
+    fclose(file);
+    return valid;
+}
+
+void replay_run(int slot) {
+    const ReplayHeader& header = replay_headers[slot];
+    const std::vector<uint8_t>& data = replay_data[slot];
+    const std::vector<ReplayKey>& keys = replay_keys[slot];
+    set_position(header.x, header.y, header.t);
+
+    DriverInput input;
+    uint16_t buttons = 0;
+    uint8_t mechanism = STOP;
+    Coordinate keyframe;
+    size_t key = 0;
+    uint32_t now = pros::millis();
+    if (match_state() == MatchStates::AUTO) {
+        replaying = true;
+        chassis.drive_mode_set(ez::DISABLE);
+    }
+
+    size_t i = 0;
+    for (uint32_t frame = 0; i < data.size(); frame++) {
+        uint8_t fields = frame_read(data, i, input, buttons, mechanism, keyframe);
+        input.buttons_set(buttons);
+
+        if (match_state() != MatchStates::AUTO) {
+            // Preview: step the robot icon through the keyframes
+            if (fields & FRAME_POSE) {
+                Coordinate pose = transform_point(keyframe);
+                currentPoint.x = pose.x;
+                currentPoint.y = pose.y;
+                currentPoint.t = pose.t;
+                currentPoint.left = KEY;
+                currentPoint.right = header.period * REPLAY_KEYFRAME_TICKS;
+                autonPath.push_back(currentPoint);
+            }
+            continue;
+        }
+
+        // Odometry drift compensation, every frame against where the recording was at this frame
+        Coordinate target = transform_point(replay_pose_at(keys, key, frame));
+        double theta = util::to_rad(chassis.odom_theta_get());
+        double error_x = target.x - chassis.odom_x_get();
+        double error_y = target.y - chassis.odom_y_get();
+        double forward_fix = REPLAY_KP_DRIVE * (error_x * sin(theta) + error_y * cos(theta));
+        double turn_fix = REPLAY_KP_TURN * util::wrap_angle(target.t - chassis.odom_theta_get());
+
+        driver_input = input;
+        if (side_mirrored()) {
+            // A reflected field turns the other way
+            driver_input.analog[pros::E_CONTROLLER_ANALOG_LEFT_X] = -input.analog[pros::E_CONTROLLER_ANALOG_LEFT_X];
+            driver_input.analog[pros::E_CONTROLLER_ANALOG_RIGHT_X] = -input.analog[pros::E_CONTROLLER_ANALOG_RIGHT_X];
+        }
+        driver_input.analog[pros::E_CONTROLLER_ANALOG_LEFT_Y] = util::clamp(driver_input.analog[pros::E_CONTROLLER_ANALOG_LEFT_Y] + util::clamp(forward_fix, REPLAY_CORRECTION_MAX), 127);
+        driver_input.analog[pros::E_CONTROLLER_ANALOG_RIGHT_X] = util::clamp(driver_input.analog[pros::E_CONTROLLER_ANALOG_RIGHT_X] + util::clamp(turn_fix, REPLAY_CORRECTION_MAX), 127);
+        driver_control();
+
+        // The recorded result wins over any toggle the replay fell out of step with
+        if (rollerState != (RollerStates)(mechanism & 0x07)) set_rollers((RollerStates)(mechanism & 0x07));
+        piston_states_set(mechanism >> 3);
+
+        pros::Task::delay_until(&now, header.period);
+    }
+
+    if (match_state() == MatchStates::AUTO) {
+        chassis.drive_set(0, 0);
+        driver_input = DriverInput();
+        replaying = false;
+    }
+}
+
+void replay_register_all() {
+    if (!pros::usd::is_installed()) return;
+    for (int slot = 0; slot < REPLAY_SLOTS; slot++) {
+        if (!replay_load(slot)) continue;
+        auton_sel.selector_populate({{[slot]() { replay_run(slot); }, "Replay " + std::to_string(slot), cyan}});
+    }
+}
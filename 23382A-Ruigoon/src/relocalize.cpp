@@ -0,0 +1,214 @@
+#include "relocalize.hpp"
+#include <cmath>
+#include <cstdio>
+#include "EZ-Template/util.hpp"
+#include "controls.hpp"
+#include "ekf.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "odometry.hpp"
+#include "pros/rtos.hpp"
+#include "screen.hpp"
+#include "sdwriter.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file relocalize.cpp
+ * @brief This file contains distance sensor relocalisation against the field walls.
+ * @details When the robot is square to a wall, the distance sensors pointing at it say exactly
+ * how far away it is. Odom x / y are corrected from that, either all at once with relocalize_snap()
+ * between motions or a little every reading while continuous fusion is on.
+ */
+
+// Distance sensors only report valid confidence past 200 mm
+static const int MIN_CONFIDENCE = 30;
+static const int MIN_RANGE_MM = 200;
+static const size_t LOG_MAX = 2000;
+static const int SNAP_SENSORS = 8;  // most sensors a snap averages
+
+static bool continuous = false;
+
+//
+// Field model
+//
+
+// Match and skills fields have the same structures, only the blocks on them differ. Everything is
+// at sensor height and square to the field, measured off the field images at 1.5 px per inch. The
+// center goals cross diagonally, readings off them disagree with the model by more than the gates
+// and get thrown out
+static const double LONG_GOAL_Y = 48;        // center line of each long goal
+static const double LONG_GOAL_HALF = 2.25;   // half its width
+static const double LONG_GOAL_END = 25;      // its ends, either side of the center line
+static const double LOADER_FACE = 67.5;      // front of the match loaders on the x walls
+static const double LOADER_HALF = 2.5;       // half their width, centered on the long goal lines
+static const double PARK_FACE = 55.5;        // open side of the park zones on the x walls
+static const double PARK_HALF = 9;           // half their width, centered on y = 0
+
+static const std::vector<WallSegment> field_structures = {
+    // Perimeter
+    {WALL_X, -72, -72, 72},
+    {WALL_X, 72, -72, 72},
+    {WALL_Y, -72, -72, 72},
+    {WALL_Y, 72, -72, 72},
+
+    // Long goals, both faces and both ends
+    {WALL_Y, LONG_GOAL_Y - LONG_GOAL_HALF, -LONG_GOAL_END, LONG_GOAL_END},
+    {WALL_Y, LONG_GOAL_Y + LONG_GOAL_HALF, -LONG_GOAL_END, LONG_GOAL_END},
+    {WALL_X, -LONG_GOAL_END, LONG_GOAL_Y - LONG_GOAL_HALF, LONG_GOAL_Y + LONG_GOAL_HALF},
+    {WALL_X, LONG_GOAL_END, LONG_GOAL_Y - LONG_GOAL_HALF, LONG_GOAL_Y + LONG_GOAL_HALF},
+    {WALL_Y, -LONG_GOAL_Y - LONG_GOAL_HALF, -LONG_GOAL_END, LONG_GOAL_END},
+    {WALL_Y, -LONG_GOAL_Y + LONG_GOAL_HALF, -LONG_GOAL_END, LONG_GOAL_END},
+    {WALL_X, -LONG_GOAL_END, -LONG_GOAL_Y - LONG_GOAL_HALF, -LONG_GOAL_Y + LONG_GOAL_HALF},
+    {WALL_X, LONG_GOAL_END, -LONG_GOAL_Y - LONG_GOAL_HALF, -LONG_GOAL_Y + LONG_GOAL_HALF},
+
+    // Match loaders, only their fronts face the field
+    {WALL_X, -LOADER_FACE, LONG_GOAL_Y - LOADER_HALF, LONG_GOAL_Y + LOADER_HALF},
+    {WALL_X, -LOADER_FACE, -LONG_GOAL_Y - LOADER_HALF, -LONG_GOAL_Y + LOADER_HALF},
+    {WALL_X, LOADER_FACE, LONG_GOAL_Y - LOADER_HALF, LONG_GOAL_Y + LOADER_HALF},
+    {WALL_X, LOADER_FACE, -LONG_GOAL_Y - LOADER_HALF, -LONG_GOAL_Y + LOADER_HALF},
+
+    // Park zone barriers, open toward the field on the x walls
+    {WALL_X, -PARK_FACE, -PARK_HALF, PARK_HALF},
+    {WALL_Y, -PARK_HALF, -72, -PARK_FACE},
+    {WALL_Y, PARK_HALF, -72, -PARK_FACE},
+    {WALL_X, PARK_FACE, -PARK_HALF, PARK_HALF},
+    {WALL_Y, -PARK_HALF, PARK_FACE, 72},
+    {WALL_Y, PARK_HALF, PARK_FACE, 72},
+};
+
+const std::vector<WallSegment>& field_walls() { return field_structures; }
+
+double field_wall_distance(double x, double y, double theta, WallAxis* axis) {
+    double dx = sin(theta), dy = cos(theta);
+    double best = INFINITY;
+    WallAxis hit = WALL_NONE;
+    for (const WallSegment& wall : field_walls()) {
+        double along = wall.axis == WALL_X ? dx : dy;
+        if (fabs(along) < 1e-6) continue;
+        double distance = ((wall.axis == WALL_X ? wall.at - x : wall.at - y)) / along;
+        if (distance <= 0 || distance >= best) continue;
+        double across = wall.axis == WALL_X ? y + distance * dy : x + distance * dx;
+        if (across < wall.from || across > wall.to) continue;
+        best = distance;
+        hit = wall.axis;
+    }
+    if (axis) *axis = hit;
+    return best;
+}
+
+//
+// Corrections
+//
+
+// How far the odom pose is from where one sensor says it is, along the wall's axis. Returns WALL_NONE
+// if the sensor has nothing usable
+static WallAxis sensor_error(const WallSensor& mount, double& dx, double& dy) {
+    int32_t reading = mount.sensor->get();
+    if (reading == PROS_ERR || reading < MIN_RANGE_MM || mount.sensor->get_confidence() < MIN_CONFIDENCE) return WALL_NONE;
+    double measured = reading / 25.4;
+    if (measured > RELOCALIZE_MAX_RANGE) return WALL_NONE;
+
+    double theta = util::to_rad(chassis.odom_theta_get());
+    double x = chassis.odom_x_get() + mount.x * cos(theta) + mount.y * sin(theta);
+    double y = chassis.odom_y_get() - mount.x * sin(theta) + mount.y * cos(theta);
+    double beam = theta + util::to_rad(mount.angle);
+
+    WallAxis axis;
+    double expected = field_wall_distance(x, y, beam, &axis);
+    if (axis == WALL_NONE) return WALL_NONE;
+
+    // Reading farther than expected means the robot is farther from the wall, so back away along the beam
+    double error = measured - expected;
+    dx = axis == WALL_X ? -error * sin(beam) : 0;
+    dy = axis == WALL_Y ? -error * cos(beam) : 0;
+    return axis;
+}
+
+// True when the heading is within tolerance of a wall
+static bool square_to_wall() {
+    double off = fmod(chassis.odom_theta_get(), 90);
+    if (off < 0) off += 90;
+    return fmin(off, 90 - off) <= RELOCALIZE_SQUARE_TOLERANCE;
+}
+
+// The flush runs from disabled() while this task may still be correcting
+static pros::Mutex log_mutex;
+
+static void correction_log(const char* name, bool snap, double x, double y, double dx, double dy) {
+    log_mutex.take();
+    if (relocalize_log.size() < LOG_MAX) relocalize_log.push_back({pros::millis(), name, snap, x, y, dx, dy});
+    log_mutex.give();
+}
+
+static void correction_apply(double dx, double dy) {
+    double x = chassis.odom_x_get(), y = chassis.odom_y_get();
+    if (dx != 0) chassis.odom_x_set(x + dx);
+    if (dy != 0) chassis.odom_y_set(y + dy);
+    odometry_shift(dx, dy);
+}
+
+bool relocalize_snap() {
+    if (match_state() == MatchStates::DISABLED || !square_to_wall()) return false;
+
+    // Average the sensors that see the same wall axis
+    const WallSensor* used[SNAP_SENSORS];
+    double used_dx[SNAP_SENSORS], used_dy[SNAP_SENSORS];
+    double sum_x = 0, sum_y = 0;
+    int count = 0, count_x = 0, count_y = 0;
+    for (const WallSensor& mount : wall_sensors) {
+        double dx, dy;
+        WallAxis axis = sensor_error(mount, dx, dy);
+        if (axis == WALL_NONE || hypot(dx, dy) > RELOCALIZE_SNAP_MAX || count == SNAP_SENSORS) continue;
+        if (axis == WALL_X) sum_x += dx, count_x++;
+        else sum_y += dy, count_y++;
+        used[count] = &mount;
+        used_dx[count] = dx;
+        used_dy[count++] = dy;
+    }
+    if (count == 0) return false;
+
+    // Each sensor is logged with its share of the average, so the rows add up to the snap
+    double x = chassis.odom_x_get(), y = chassis.odom_y_get();
+    for (int i = 0; i < count; i++) {
+        correction_log(used[i]->name, true, x, y, count_x ? used_dx[i] / count_x : 0, count_y ? used_dy[i] / count_y : 0);
+    }
+    correction_apply(count_x ? sum_x / count_x : 0, count_y ? sum_y / count_y : 0);
+    ekf_reset(chassis.odom_x_get(), chassis.odom_y_get(), chassis.odom_theta_get());
+    return true;
+}
+
+// Only an auton turns it on, a dry run for the preview leaves it alone
+void relocalize_continuous_set(bool enabled) {
+    if (enabled && match_state() != MatchStates::AUTO) return;
+    continuous = enabled;
+}
+bool relocalize_continuous_get() { return continuous; }
+
+void relocalize_task() {
+    while (true) {
+        if (continuous && matchState == MatchStates::AUTO && square_to_wall()) {
+            for (const WallSensor& mount : wall_sensors) {
+                double dx, dy;
+                if (sensor_error(mount, dx, dy) == WALL_NONE || hypot(dx, dy) > RELOCALIZE_FUSE_GATE) continue;
+                correction_log(mount.name, false, chassis.odom_x_get(), chassis.odom_y_get(), dx * RELOCALIZE_FUSE_GAIN, dy * RELOCALIZE_FUSE_GAIN);
+                correction_apply(dx * RELOCALIZE_FUSE_GAIN, dy * RELOCALIZE_FUSE_GAIN);
+            }
+        }
+        // Distance sensors refresh about every 33 ms
+        pros::delay(RELOCALIZE_PERIOD);
+    }
+}
+
+void relocalize_log_flush() {
+    // Taken out under the lock so the card write doesn't hold up the task
+    std::vector<WallCorrection> entries;
+    log_mutex.take();
+    entries.swap(relocalize_log);
+    log_mutex.give();
+    if (entries.empty()) return;
+
+    std::string rows;
+    for (const WallCorrection& entry : entries) {
+        rows += sd_format("%lu,%s,%d,%.2f,%.2f,%.3f,%.3f\n", (unsigned long)entry.time, entry.sensor, entry.snap, entry.x, entry.y, entry.dx, entry.dy);
+    }
+    if (sd_append(RELOCALIZE_LOG_FILE, rows)) print("Logged " + std::to_string(entries.size()) + " wall corrections");
+}
@@ -1,4 +1,6 @@
+#include <atomic>
 #include <cstddef>
+#include <memory>
 #include <string>
 #include "autons.hpp"
 #include "controls.hpp"
@@ -17,8 +19,10 @@
 #include "liblvgl/widgets/lv_img.h"
 #include "liblvgl/widgets/lv_label.h"
 #include "main.h"  // IWYU pragma: keep
+#include "preview.hpp"
 #include "subsystems.hpp"
 #include "screen.hpp"
+#include "sdwriter.hpp"
 
 #include "pros/misc.hpp"
 #include <fstream>
@@ -48,6 +52,7 @@ lv_obj_t* autonTable = lv_list_create(autoSelector);
 lv_obj_t* autonUp = lv_label_create(autoSelector);
 lv_obj_t* autonDown = lv_label_create(autoSelector);
 lv_obj_t* autonField = lv_img_create(autoSelector);
+lv_obj_t* autonTrail = lv_obj_create(autonField);
 lv_obj_t* autonRobot = lv_img_create(autonField);
 lv_obj_t* angleViewer;
 lv_obj_t* angleText;
@@ -64,6 +69,7 @@ LV_IMG_DECLARE(pfp2145);
 LV_IMG_DECLARE(matchField);
 LV_IMG_DECLARE(skillsField);
 LV_IMG_DECLARE(logo);
+LV_IMG_DECLARE(robotAtlas);
 
 // // // // // // Tasks & Non-UI // // // // // //
 
@@ -98,7 +104,7 @@ void load_selected_auton_from_sd() {
         print(1, "SD card not found. Defaulting to doNothing.");
         return;
     }
-    FILE* file = fopen(SD_SELECTED_AUTON_FILE, "r");
+    FILE* file = sd_open(SD_SELECTED_AUTON_FILE);
     if (!file) {
         auton_sel.selector_callback = doNothing;
         auton_sel.selector_name = "no name";
@@ -115,6 +121,8 @@ void load_selected_auton_from_sd() {
     if (found) {
         auton_sel.selector_callback = found->callback;
         auton_sel.selector_name = found->name;
+        auton_sel.selector_mirrored = found->mirrored;
+        sideMirrored = found->mirrored;
         print(1, "Loaded auton: " + found->name);
     } else {
         auton_sel.selector_callback = doNothing;
@@ -123,66 +131,172 @@ void load_selected_auton_from_sd() {
     }
 }
 
-// Save selected auton to SD card
-void save_selected_auton_to_sd(const std::string& name) {
-    if (!pros::usd::is_installed()) return;
-    FILE* file = fopen(SD_SELECTED_AUTON_FILE, "w");
-    if (!file) return;
-    fprintf(file, "%s\n", name.c_str());
-    fclose(file);
-}
+// Save selected auton to SD card, in the background so a slow card doesn't hold up the UI
+void save_selected_auton_to_sd(const std::string& name) { sd_write(SD_SELECTED_AUTON_FILE, name + "\n"); }
 
 void AutonSel::selector_populate(vector<AutonObj> auton_list) { autons.insert(autons.end(), auton_list.begin(), auton_list.end()); }
 
-void angleCheckTask() {
-    while(true) {
-        if(aligning) {
-            auto target = autonPath.size() > 0 ? autonPath[0].t : 0;
-            auto current = fmod(chassis.odom_theta_get(), 360);
-            lv_label_set_text(angleText,
-                              (util::to_string_with_precision(current, 2) + " °" + "\ntarget: " + util::to_string_with_precision(target, 2)).c_str());
-            if(target + 0.15 >= current && target - 0.15 <= current)
-                lv_obj_set_style_bg_color(angleViewer, green, LV_PART_MAIN);
-            else
-                lv_obj_set_style_bg_color(angleViewer, red, LV_PART_MAIN);
-        }
-        pros::delay(10);
+//
+// Bindings
+//
+
+// Alignment check, only polled while its message box is open. The label shows two decimals, so
+// smaller changes than that aren't worth a redraw
+static void alignLabel();
+static std::atomic<double> previewHeading{0};
+static double alignTarget() { return previewHeading; }
+
+static Binding<double> alignHeading([] { return pose_latest().t; }, [](const double&) { alignLabel(); }, 0.005, 50);
+static Binding<double> alignGoal(alignTarget, [](const double&) { alignLabel(); }, 0.005, 50);
+static Binding<bool> alignOnTarget([] { return fabs(alignTarget() - pose_latest().t) <= 0.15; },
+                                   [](const bool& aligned) { lv_obj_set_style_bg_color(angleViewer, aligned ? green : red, LV_PART_MAIN); });
+static BindingBase* alignBindings[] = {&alignHeading, &alignGoal, &alignOnTarget};
+
+static void alignLabel() {
+    lv_label_set_text(angleText, (util::to_string_with_precision(alignHeading.value(), 2) + " °" + "\ntarget: " +
+                                  util::to_string_with_precision(alignGoal.value(), 2)).c_str());
+}
+
+static void alignBindingsEnable(bool enable) {
+    for(BindingBase* binding : alignBindings) {
+        binding->enabled = enable;
+        binding->invalidate();
     }
 }
 
+// Alliance indicator follows allianceColor whoever changes it
+static Binding<Alliances> allianceBinding([] { return allianceColor; }, [](const Alliances& color) { colorSet(color, allianceInd); });
+
+// Odom readout on the console, which rebuilds the whole console label on every print
+static Binding<double> odomX([] { return chassis.odom_x_get(); }, [](const double& x) { print(1, "X: " + std::to_string(x)); }, 0.01, 100);
+static Binding<double> odomY([] { return chassis.odom_y_get(); }, [](const double& y) { print(2, "Y: " + std::to_string(y)); }, 0.01, 100);
+static Binding<double> odomT([] { return chassis.odom_theta_get(); }, [](const double& t) { print(3, "A: " + std::to_string(t)); }, 0.01, 100);
+
+static void bindingsInit() {
+    alignBindingsEnable(false);
+    for(BindingBase* binding : alignBindings) bindings_add(binding);
+    bindings_add(&allianceBinding);
+    bindings_add(&odomX);
+    bindings_add(&odomY);
+    bindings_add(&odomT);
+}
+
 int pathIter = 0;
-vector<Coordinate> pathDisplay;
+// Only pathViewerTask swaps the shown preview, everything else asks for one through resetViewer
+static std::shared_ptr<const AutonPreview> shownPreview;
+static std::atomic<bool> previewWanted{false};
+static std::atomic<int> wantedAuton{-1};
+static const vector<Coordinate> noPath;
+
+//
+// Path trail
+//
+
+// lv_line keeps a pointer to its points, so they live here until the next selection
+static vector<vector<lv_point_t>> trailPoints;
+
+static lv_point_t fieldPoint(const Coordinate& point) { return {(lv_coord_t)(108 + 1.5 * point.x), (lv_coord_t)(108 - 1.5 * point.y)}; }
+
+// Commanded speed, bucketed so a whole stretch at one speed is a single line
+static int speedBand(const Coordinate& point) {
+    double speed = (fabs(point.left) + fabs(point.right)) / 2;
+    return speed < 40 ? 0 : speed < 70 ? 1 : speed < 100 ? 2 : 3;
+}
+
+static void trailLine(vector<lv_point_t> points, int band) {
+    static const lv_color32_t bandColors[4] = {blue, green, yellow, red};
+    trailPoints.push_back(points);
+    lv_obj_t* line = lv_line_create(autonTrail);
+    lv_line_set_points(line, trailPoints.back().data(), trailPoints.back().size());
+    lv_obj_set_style_line_width(line, 2, LV_PART_MAIN);
+    lv_obj_set_style_line_rounded(line, true, LV_PART_MAIN);
+    lv_obj_set_style_line_color(line, bandColors[band], LV_PART_MAIN);
+    lv_obj_set_style_line_opa(line, 200, LV_PART_MAIN);
+}
+
+static void trailMarker(const Coordinate& point) {
+    lv_point_t at = fieldPoint(point);
+    lv_obj_t* dot = lv_obj_create(autonTrail);
+    lv_obj_remove_style_all(dot);
+    lv_obj_set_size(dot, 6, 6);
+    lv_obj_set_pos(dot, at.x - 3, at.y - 3);
+    lv_obj_set_style_radius(dot, LV_RADIUS_CIRCLE, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(dot, 255, LV_PART_MAIN);
+    lv_obj_set_style_bg_color(dot, point.event == EVENT_WAIT ? white : point.event == EVENT_ROLLERS ? orange : violet, LV_PART_MAIN);
+    lv_obj_clear_flag(dot, LV_OBJ_FLAG_CLICKABLE);
+}
+
+// Draws the whole route once under the preview robot. Stretches are coloured by commanded speed,
+// slow to fast blue, green, yellow, red, with dots where it waits (white), runs the rollers
+// (orange) or moves a piston (violet)
+static void drawPathTrail(const vector<Coordinate>& path) {
+    lv_obj_clean(autonTrail);
+    trailPoints.clear();
+    trailPoints.reserve(path.size());
+
+    vector<lv_point_t> stretch;
+    int band = -1;
+    for(size_t i = 0; i < path.size(); i++) {
+        const Coordinate& point = path[i];
+        // Waits and markers have no speed of their own and carry on the stretch they're on
+        int pointBand = point.left == KEY ? band : speedBand(point);
+        if(i > 0 && pointBand != band && band != -1 && stretch.size() > 1) {
+            trailLine(stretch, band);
+            stretch = {stretch.back()};
+        }
+        if(pointBand != -1) band = pointBand;
+        stretch.push_back(fieldPoint(point));
+        if(point.event != EVENT_NONE) trailMarker(point);
+    }
+    if(stretch.size() > 1) trailLine(stretch, band == -1 ? 0 : band);
+}
 
 void resetViewer(bool full) {
     if(full) {
-        auto preference = matchState;
-        matchState = MatchStates::DISABLED;
-        autonPath = {};
-        auton_sel.selector_callback();
-        pathDisplay = injectPath(autonPath, 1);
-        matchState = preference;
-        lv_img_set_src(autonField, &(currentField == Fields::MATCH ? matchField : skillsField));
+        AutonObj* selected = find_auton_by_name(auton_sel.selector_name);
+        wantedAuton = selected ? selected - auton_sel.autons.data() : -1;
+        if(selected) preview_request(wantedAuton);
+        previewWanted = true;
+    }
+    pathIter = 0;
+}
+
+// Swaps in the wanted preview once the preview task has built it
+static void showPreview() {
+    if(!previewWanted.exchange(false)) return;
+    int auton = wantedAuton;
+    std::shared_ptr<const AutonPreview> preview = auton >= 0 ? preview_get(auton, allianceColor) : std::make_shared<AutonPreview>();
+    if(!preview) {
+        previewWanted = true;
+        return;
     }
+    shownPreview = preview;
+    previewHeading = preview->start.t;
+    drawPathTrail(preview->path);
+    lv_img_set_src(autonField, &(currentField == Fields::MATCH ? matchField : skillsField));
     pathIter = 0;
 }
 
+// Shows the robotAtlas frame nearest the heading. Frames are square and stacked top to bottom,
+// so picking one is just an offset and LVGL copies it instead of rotating the sprite
+static void setRobotHeading(double heading) {
+    int size = robotAtlas.header.w;
+    int frames = robotAtlas.header.h / size;
+    int frame = (int)lround(heading * frames / 360) % frames;
+    if(frame < 0) frame += frames;
+    lv_img_set_offset_y(autonRobot, -frame * size);
+}
+
 void pathViewerTask() {
     while(true) {
-        if (allianceColor == BLUE) {
-            pathDisplay[pathIter].x = -pathDisplay[pathIter].x;
-            pathDisplay[pathIter].y = -pathDisplay[pathIter].y;
-            pathDisplay[pathIter].t = 360 - pathDisplay[pathIter].t;
-            if (pathDisplay[pathIter].t == 0) {
-                pathDisplay[pathIter].t = 180;
-            } else if (pathDisplay[pathIter].t == 180) {
-                pathDisplay[pathIter].t = 0;
-            }
-        }
+        showPreview();
+        const vector<Coordinate>& pathDisplay = shownPreview ? shownPreview->path : noPath;
         if(pathIter < pathDisplay.size() && pathDisplay.size() > 1 && playing) {
+            int half = robotAtlas.header.w / 2;
             lv_obj_clear_flag(autonRobot, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_set_pos(autonRobot, (1.5 * pathDisplay[pathIter].x) + 97, 95 - (1.5 * pathDisplay[pathIter].y));
+            lv_obj_set_pos(autonRobot, (1.5 * pathDisplay[pathIter].x) + 108 - half, 108 - (1.5 * pathDisplay[pathIter].y) - half);
             if(pathIter < pathDisplay.size() - 1) {
-                lv_img_set_angle(autonRobot, 10 * (pathDisplay[pathIter].t));
+                setRobotHeading(pathDisplay[pathIter].t);
                 if(pathDisplay[pathIter].left == KEY)
                     pros::delay(pathDisplay[pathIter].right);
                 else {
@@ -197,9 +311,6 @@ void pathViewerTask() {
             pros::delay(1000);
             resetViewer(false);
         }
-        print(1, "X: " + std::to_string(chassis.odom_x_get()));
-        print(2, "Y: " + std::to_string(chassis.odom_y_get()));
-        print(3, "A: " + std::to_string(chassis.odom_theta_get()));
         pros::delay(10);
     }
 }
@@ -222,6 +333,9 @@ void colorSet(Alliances color, lv_obj_t* object) {
 //
 
 void uiInit() {
+    // Packed images in src/pics need their decoder before anything shows them
+    img_cache_init();
+
     // pushback style setup
     lv_style_init(&pushback);
     lv_style_set_bg_color(&pushback, theme_color);
@@ -280,6 +394,7 @@ void uiInit() {
 
     // Set color for allianceInd
     colorSet(allianceColor, allianceInd);
+    bindingsInit();
 
     // Initialize screens
     autoSelectorInit();
@@ -301,6 +416,8 @@ static void selectAuton(lv_event_t* e) {
     lv_obj_add_state(target, LV_STATE_CHECKED);
     auton_sel.selector_callback = (*getAuton).callback;
     auton_sel.selector_name = (*getAuton).name;
+    auton_sel.selector_mirrored = (*getAuton).mirrored;
+    sideMirrored = (*getAuton).mirrored;
     // Set currentField based on selected auton
     if ((*getAuton).callback.target<void(*)()>() && *(*getAuton).callback.target<void(*)()>() == skills) {
         currentField = Fields::SKILLS;
@@ -321,7 +438,10 @@ static void autonDownEvent(lv_event_t* e) {
     lv_obj_scroll_by_bounded(autonTable, 0, -lv_obj_get_height(autonTable), LV_ANIM_ON); 
     lv_obj_scroll_by_bounded(console_container, 0, -lv_obj_get_height(console_container), LV_ANIM_ON);}
 
-static void angleCheckCloseEvent(lv_event_t* e) { aligning = false; }
+static void angleCheckCloseEvent(lv_event_t* e) {
+    aligning = false;
+    alignBindingsEnable(false);
+}
 
 lv_event_cb_t AngleCheckCloseEvent = angleCheckCloseEvent;
 
@@ -329,6 +449,7 @@ static void angleCheckEvent(lv_event_t* e) {
     angleViewer = lv_msgbox_create(NULL, "check alignment", "0°", NULL, true);
     angleText = lv_msgbox_get_text(angleViewer);
     aligning = true;
+    alignBindingsEnable(true);
 
     lv_obj_add_event_cb(lv_msgbox_get_close_btn(angleViewer), AngleCheckCloseEvent, LV_EVENT_PRESSED, NULL);
     lv_obj_add_style(lv_msgbox_get_close_btn(angleViewer), &pushback, LV_PART_MAIN);
@@ -348,10 +469,7 @@ static void pauseEvent(lv_event_t* e) {
 
 static void colorEvent(lv_event_t* e) {
     allianceColor = (Alliances)(((int)allianceColor + 1) % 3);
-    colorSet(allianceColor, allianceInd);
-    if (allianceColor == RED) chassis.drive_angle_set(chassis.odom_theta_get() + 90);
-    if (allianceColor == BLUE) chassis.drive_angle_set(chassis.odom_theta_get() + 180);
-    if (allianceColor == NONE) chassis.drive_angle_set(chassis.odom_theta_get() - 270);
+    // The wrappers transform every pose for the new alliance, so one dry run rebuilds the preview
     resetViewer(true);
     print(2, std::string("Alliance: ") + allianceColorNames[(int)allianceColor]);
 }
@@ -381,6 +499,7 @@ void refresh_console_label() {
 
 void print(int line, const std::string& msg) {
     if (line < 0 || line >= STRUCTURED_LINES) return;
+    if (structured_log[line] == msg) return;
     structured_log[line] = msg;
     refresh_console_label();
 }
@@ -411,6 +530,130 @@ static void toggleConsoleEvent(lv_event_t* e) {
     }
 }
 
+//
+// Config editor
+//
+
+// One row per config field, built the first time the page opens
+static lv_obj_t* configEditor = nullptr;
+static lv_obj_t* configTitle;
+static lv_obj_t* configValues[CFG_COUNT];
+
+static void configValueShow(ConfigKeys key) {
+    if(!configValues[key]) return;  // retired
+    double step = config_fields[key].step;
+    int decimals = step >= 1 ? 0 : step >= 0.1 ? 1 : step >= 0.01 ? 2 : 3;
+    lv_label_set_text(configValues[key], util::to_string_with_precision(config_get(key), decimals).c_str());
+}
+
+// Steps a field, live, so the change can be tried before it's saved
+static void configStep(lv_event_t* e, int direction) {
+    ConfigKeys key = (ConfigKeys)(intptr_t)lv_event_get_user_data(e);
+    config_set(key, config_get(key) + direction * config_fields[key].step);
+    configValueShow(key);
+    config_apply();
+    lv_label_set_text(configTitle, "config *");
+}
+
+static void configUpEvent(lv_event_t* e) { configStep(e, 1); }
+static void configDownEvent(lv_event_t* e) { configStep(e, -1); }
+
+static void configSaveEvent(lv_event_t* e) {
+    lv_label_set_text(configTitle, config_save() ? "config saved" : "config not saved, SD busy");
+}
+
+static void configDefaultsEvent(lv_event_t* e) {
+    config_reset();
+    config_apply();
+    for(int i = 0; i < CFG_COUNT; i++) configValueShow((ConfigKeys)i);
+    lv_label_set_text(configTitle, "config * defaults");
+}
+
+static void configBackEvent(lv_event_t* e) {
+    lv_scr_load(autoSelector);
+    // Speeds and track width feed the preview
+    preview_invalidate();
+    resetViewer(true);
+}
+
+static lv_obj_t* configButton(lv_obj_t* parent, const char* text, lv_event_cb_t callback, void* user_data, bool repeat) {
+    lv_obj_t* button = lv_btn_create(parent);
+    lv_obj_add_style(button, &pushback, LV_PART_MAIN);
+    lv_obj_set_style_outline_width(button, 1, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(button, 180, LV_STATE_PRESSED);
+    lv_obj_set_height(button, 30);
+    lv_obj_add_event_cb(button, callback, LV_EVENT_CLICKED, user_data);
+    if(repeat) lv_obj_add_event_cb(button, callback, LV_EVENT_LONG_PRESSED_REPEAT, user_data);
+    lv_obj_t* label = lv_label_create(button);
+    lv_label_set_text(label, text);
+    lv_obj_center(label);
+    return button;
+}
+
+static void configEditorBuild() {
+    configEditor = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(configEditor, black, LV_PART_MAIN);
+
+    configTitle = lv_label_create(configEditor);
+    lv_obj_set_style_text_color(configTitle, white, LV_PART_MAIN);
+    lv_obj_set_style_text_font(configTitle, &lv_font_montserrat_16, LV_PART_MAIN);
+    lv_obj_set_pos(configTitle, 10, 10);
+    lv_label_set_text(configTitle, "config");
+
+    lv_obj_t* back = configButton(configEditor, "back", configBackEvent, NULL, false);
+    lv_obj_set_width(back, 70);
+    lv_obj_align(back, LV_ALIGN_TOP_RIGHT, -5, 3);
+    lv_obj_t* save = configButton(configEditor, "save", configSaveEvent, NULL, false);
+    lv_obj_set_width(save, 70);
+    lv_obj_align(save, LV_ALIGN_TOP_RIGHT, -80, 3);
+    lv_obj_t* defaults = configButton(configEditor, "defaults", configDefaultsEvent, NULL, false);
+    lv_obj_set_width(defaults, 90);
+    lv_obj_align(defaults, LV_ALIGN_TOP_RIGHT, -155, 3);
+
+    lv_obj_t* rows = lv_obj_create(configEditor);
+    lv_obj_set_size(rows, 480, 200);
+    lv_obj_set_pos(rows, 0, 40);
+    lv_obj_add_style(rows, &pushback, LV_PART_MAIN);
+    lv_obj_set_style_bg_color(rows, black, LV_PART_MAIN);
+    lv_obj_set_style_outline_width(rows, 0, LV_PART_MAIN);
+    lv_obj_set_flex_flow(rows, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(rows, 4, LV_PART_MAIN);
+
+    for(int i = 0; i < CFG_COUNT; i++) {
+        if(!config_fields[i].name) continue;
+        lv_obj_t* row = lv_obj_create(rows);
+        lv_obj_remove_style_all(row);
+        lv_obj_set_size(row, 460, 30);
+        lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+
+        lv_obj_t* name = lv_label_create(row);
+        lv_obj_set_style_text_color(name, white, LV_PART_MAIN);
+        lv_label_set_text(name, config_fields[i].name);
+        lv_obj_align(name, LV_ALIGN_LEFT_MID, 5, 0);
+
+        lv_obj_t* down = configButton(row, "-", configDownEvent, (void*)(intptr_t)i, true);
+        lv_obj_set_width(down, 50);
+        lv_obj_align(down, LV_ALIGN_RIGHT_MID, -160, 0);
+        configValues[i] = lv_label_create(row);
+        lv_obj_set_style_text_color(configValues[i], white, LV_PART_MAIN);
+        lv_obj_set_width(configValues[i], 100);
+        lv_obj_set_style_text_align(configValues[i], LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+        lv_obj_align(configValues[i], LV_ALIGN_RIGHT_MID, -55, 0);
+        lv_obj_t* up = configButton(row, "+", configUpEvent, (void*)(intptr_t)i, true);
+        lv_obj_set_width(up, 50);
+        lv_obj_align(up, LV_ALIGN_RIGHT_MID, 0, 0);
+        configValueShow((ConfigKeys)i);
+    }
+}
+
+// Long press on the logo
+static void configEditorEvent(lv_event_t* e) {
+    if(!configEditor) configEditorBuild();
+    for(int i = 0; i < CFG_COUNT; i++) configValueShow((ConfigKeys)i);
+    lv_label_set_text(configTitle, "config");
+    lv_scr_load(configEditor);
+}
+
 void autoSelectorInit() {
     // logoImg setup
     lv_obj_set_size(logoImg, 51, 51);
@@ -418,7 +661,8 @@ void autoSelectorInit() {
     lv_obj_add_flag(logoImg, LV_OBJ_FLAG_CLICKABLE);
     lv_img_set_src(logoImg, &logo);
     lv_img_set_angle(logoImg, 0);
-    lv_obj_add_event_cb(logoImg, toggleConsoleEvent, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(logoImg, toggleConsoleEvent, LV_EVENT_SHORT_CLICKED, NULL);  // CLICKED still fires after a long press
+    lv_obj_add_event_cb(logoImg, configEditorEvent, LV_EVENT_LONG_PRESSED, NULL);
 
     // autonTable setup
     lv_obj_set_size(autonTable, 160, 216);
@@ -468,9 +712,16 @@ void autoSelectorInit() {
     lv_obj_add_event_cb(autonField, AngleCheckEvent, LV_EVENT_SHORT_CLICKED, NULL);
     lv_obj_add_event_cb(autonField, PauseEvent, LV_EVENT_CLICKED, NULL);
     lv_obj_add_event_cb(autonField, PauseEvent, LV_EVENT_PRESSING, NULL);
+    // autonTrail setup, drawn once per selection under the robot
+    lv_obj_remove_style_all(autonTrail);
+    lv_obj_set_size(autonTrail, 216, 216);
+    lv_obj_set_pos(autonTrail, 0, 0);
+    lv_obj_clear_flag(autonTrail, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_clear_flag(autonTrail, LV_OBJ_FLAG_SCROLLABLE);
     // autonRobot setup
     lv_obj_add_style(autonRobot, &pushback, LV_PART_MAIN);
-    lv_img_set_src(autonRobot, &pfp2145);
+    lv_img_set_src(autonRobot, &robotAtlas);
+    lv_obj_set_size(autonRobot, robotAtlas.header.w, robotAtlas.header.w);
     lv_obj_set_style_bg_opa(autonRobot, 0, LV_PART_MAIN);
     lv_obj_set_style_outline_width(autonRobot, 0, LV_PART_MAIN);
     lv_obj_add_flag(autonRobot, LV_OBJ_FLAG_HIDDEN);
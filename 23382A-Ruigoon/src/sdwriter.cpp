@@ -0,0 +1,133 @@
+#include "sdwriter.hpp"
+#include <cstdarg>
+#include <deque>
+#include "main.h"  // IWYU pragma: keep
+#include "pros/misc.hpp"
+#include "pros/rtos.hpp"
+#include "screen.hpp"
+
+/**
+ * @file sdwriter.cpp
+ * @brief This file contains the write-behind queue for the SD card.
+ * @details Callers only queue a copy of what they want written. The writer task takes requests one
+ * at a time and is the only thing that opens a file for writing, so the card's latency lands on
+ * a task nobody waits for.
+ */
+
+class SdRequest {
+    public:
+        std::string path;
+        std::string data;
+        std::string header;
+        SdWriteModes mode = SD_REPLACE;
+};
+
+static pros::Mutex sd_mutex;
+static std::deque<SdRequest> sd_queue;
+static size_t sd_queued_bytes = 0;
+
+static bool sd_enqueue(const std::string& path, const std::string& data, const std::string& header, SdWriteModes mode) {
+    sd_mutex.take();
+    // Only the newest request for a file can be merged into, anything else would reorder writes
+    for (auto it = sd_queue.rbegin(); it != sd_queue.rend(); it++) {
+        if (it->path != path) continue;
+        if (it->mode != mode) break;
+        size_t bytes = mode == SD_REPLACE ? sd_queued_bytes - it->data.size() + data.size() : sd_queued_bytes + data.size();
+        if (bytes > SD_QUEUE_BYTES) break;
+        if (mode == SD_REPLACE) it->data = data;
+        else it->data += data;
+        sd_queued_bytes = bytes;
+        sd_mutex.give();
+        return true;
+    }
+    bool fits = (int)sd_queue.size() < SD_QUEUE_CAPACITY && sd_queued_bytes + data.size() + header.size() <= SD_QUEUE_BYTES;
+    if (fits) {
+        sd_queue.push_back({path, data, header, mode});
+        sd_queued_bytes += data.size() + header.size();
+    }
+    sd_mutex.give();
+    return fits;
+}
+
+bool sd_write(const std::string& path, const std::string& data) { return sd_enqueue(path, data, "", SD_REPLACE); }
+
+bool sd_append(const std::string& path, const std::string& data, const std::string& header) { return sd_enqueue(path, data, header, SD_APPEND); }
+
+FILE* sd_open(const char* path, const char* mode) {
+    FILE* file = fopen(path, mode);
+    if (file) return file;
+    return fopen((std::string(path) + SD_TEMP_SUFFIX).c_str(), mode);
+}
+
+std::string sd_format(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < (int)sizeof(buffer)) return std::string(buffer, length < 0 ? 0 : length);
+
+    std::string out(length, '\0');
+    va_start(args, format);
+    vsnprintf(out.data(), length + 1, format, args);
+    va_end(args);
+    return out;
+}
+
+size_t sd_pending() {
+    sd_mutex.take();
+    size_t bytes = sd_queued_bytes;
+    sd_mutex.give();
+    return bytes;
+}
+
+//
+// Writer
+//
+
+static bool sd_replace(const SdRequest& request) {
+    std::string temp = request.path + SD_TEMP_SUFFIX;
+    FILE* file = fopen(temp.c_str(), "wb");
+    if (!file) return false;
+    bool written = fwrite(request.data.data(), 1, request.data.size(), file) == request.data.size();
+    written = fclose(file) == 0 && written;
+    if (!written) {
+        remove(temp.c_str());
+        return false;
+    }
+    // FAT won't rename onto an existing file. The new one is complete before the old one goes
+    remove(request.path.c_str());
+    return rename(temp.c_str(), request.path.c_str()) == 0;
+}
+
+static bool sd_append_file(const SdRequest& request) {
+    FILE* existing = fopen(request.path.c_str(), "r");
+    if (existing) fclose(existing);
+    FILE* file = fopen(request.path.c_str(), "a");
+    if (!file) return false;
+    if (!existing) fputs(request.header.c_str(), file);
+    bool written = fwrite(request.data.data(), 1, request.data.size(), file) == request.data.size();
+    return fclose(file) == 0 && written;
+}
+
+void sd_writer_task() {
+    while (true) {
+        sd_mutex.take();
+        bool waiting = !sd_queue.empty();
+        SdRequest request;
+        if (waiting) {
+            request = std::move(sd_queue.front());
+            sd_queue.pop_front();
+            sd_queued_bytes -= request.data.size() + request.header.size();
+        }
+        sd_mutex.give();
+
+        if (!waiting) {
+            pros::delay(SD_WRITER_PERIOD);
+            continue;
+        }
+        if (!pros::usd::is_installed()) continue;
+        bool written = request.mode == SD_REPLACE ? sd_replace(request) : sd_append_file(request);
+        if (!written) print("SD write failed: " + request.path);
+    }
+}
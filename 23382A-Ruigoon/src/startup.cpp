@@ -0,0 +1,62 @@
+#include "startup.hpp"
+#include <string>
+#include "main.h"  // IWYU pragma: keep
+#include "pros/rtos.hpp"
+#include "screen.hpp"
+
+/**
+ * @file startup.cpp
+ * @brief This file contains the staged startup runner used by initialize().
+ * @details Each stage gets a task once everything it depends on has finished. Stages that only
+ * touch their own hardware run side by side, anything that touches LVGL is chained behind
+ * STARTUP_UI so only one task ever builds the screen.
+ */
+
+static const int STARTUP_POLL = 5;  // ms between checks for stages that can start
+static uint32_t startup_begin = 0;
+static uint32_t startup_total = 0;
+
+void startup_add(StartupStages stage, const char* name, std::function<void()> run, std::initializer_list<StartupStages> after) {
+    StartupStage& entry = startup_stages[stage];
+    entry.name = name;
+    entry.run = run;
+    entry.after = 0;
+    for (StartupStages dependency : after) entry.after |= 1u << dependency;
+}
+
+void startup_run() {
+    startup_begin = pros::millis();
+    while (true) {
+        uint32_t done = 0;
+        bool pending = false;
+        for (int i = 0; i < STARTUP_STAGES; i++) {
+            // Stages never added count as done so nothing waits on them
+            if (!startup_stages[i].run || startup_stages[i].finished) done |= 1u << i;
+            else pending = true;
+        }
+        if (!pending) break;
+
+        for (int i = 0; i < STARTUP_STAGES; i++) {
+            StartupStage& stage = startup_stages[i];
+            if (!stage.run || stage.started || (stage.after & done) != stage.after) continue;
+            stage.started = true;
+            stage.start = pros::millis() - startup_begin;
+            pros::Task([&stage] {
+                stage.run();
+                stage.end = pros::millis() - startup_begin;
+                stage.finished = true;
+            }, stage.name);
+        }
+        pros::delay(STARTUP_POLL);
+    }
+    startup_total = pros::millis() - startup_begin;
+}
+
+void startup_report() {
+    for (const StartupStage& stage : startup_stages) {
+        if (!stage.run) continue;
+        print(std::string(stage.name) + ": " + std::to_string(stage.end - stage.start) + " ms (" +
+              std::to_string(stage.start) + "-" + std::to_string(stage.end) + ")");
+    }
+    print("startup: " + std::to_string(startup_total) + " ms");
+}
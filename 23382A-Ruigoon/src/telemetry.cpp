@@ -0,0 +1,196 @@
+#include "telemetry.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <unistd.h>
+#include "config.hpp"
+#include "ekf.hpp"
+#include "main.h"  // IWYU pragma: keep
+#include "pros/apix.h"
+#include "pros/misc.hpp"
+#include "pros/rtos.hpp"
+#include "subsystems.hpp"
+
+/**
+ * @file telemetry.cpp
+ * @brief This file contains the framed binary telemetry stream.
+ * @details PROS normally wraps stdout in its own COBS stream for the terminal. That's turned off
+ * while telemetry is on so the frames go out raw, and anything else printed lands between two 0
+ * bytes where the decoder shows it as text. Turning telemetry off hands the link back to the PROS
+ * terminal. Writes don't block while streaming, a full serial buffer drops frames and the sequence
+ * numbers show the gap.
+ */
+
+static const size_t FRAME_HEADER = 7;
+static const size_t FRAME_MAX = 64;
+
+static pros::Mutex telemetry_mutex;
+static std::deque<std::string> telemetry_events;
+static std::vector<Coordinate> telemetry_path_points;
+static size_t telemetry_path_next = 0;
+static uint16_t telemetry_sequence = 0;
+
+void telemetry_event(const std::string& text) {
+    telemetry_mutex.take();
+    if ((int)telemetry_events.size() < TELEMETRY_EVENTS) telemetry_events.push_back(text.substr(0, FRAME_MAX - FRAME_HEADER - 2));
+    telemetry_mutex.give();
+}
+
+void telemetry_path(const std::vector<Coordinate>& path) {
+    telemetry_mutex.take();
+    telemetry_path_points = path;
+    telemetry_path_next = 0;
+    telemetry_mutex.give();
+}
+
+//
+// Framing
+//
+
+static uint16_t crc16(const uint8_t* data, size_t length) {
+    uint16_t crc = 0xffff;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i] << 8;
+        for (int bit = 0; bit < 8; bit++) crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+// Appends the COBS encoding of data and the 0 that ends the frame
+static void cobs_encode(const uint8_t* data, size_t length, std::string& out) {
+    size_t code_at = out.size();
+    out.push_back(0);
+    uint8_t code = 1;
+    for (size_t i = 0; i < length; i++) {
+        if (data[i] != 0) {
+            out.push_back(data[i]);
+            code++;
+        }
+        if (data[i] == 0 || code == 0xff) {
+            out[code_at] = code;
+            code_at = out.size();
+            out.push_back(0);
+            code = 1;
+        }
+    }
+    out[code_at] = code;
+    out.push_back(0);
+}
+
+class FrameBuilder {
+    public:
+        FrameBuilder(TelemetryChannels channel) {
+            uint32_t time = pros::millis();
+            data[0] = channel;
+            memcpy(data + 1, &telemetry_sequence, 2);
+            memcpy(data + 3, &time, 4);
+            telemetry_sequence++;
+        }
+
+        template <typename T>
+        FrameBuilder& put(T value) {
+            if (length + sizeof(T) + 2 > FRAME_MAX) return *this;
+            memcpy(data + length, &value, sizeof(T));
+            length += sizeof(T);
+            return *this;
+        }
+
+        FrameBuilder& put(const std::string& text) {
+            size_t count = std::min(text.size(), FRAME_MAX - 2 - length);
+            memcpy(data + length, text.data(), count);
+            length += count;
+            return *this;
+        }
+
+        void finish(std::string& out) {
+            uint16_t crc = crc16(data, length);
+            memcpy(data + length, &crc, 2);
+            cobs_encode(data, length + 2, out);
+        }
+
+    private:
+        uint8_t data[FRAME_MAX];
+        size_t length = FRAME_HEADER;
+};
+
+//
+// Sampling
+//
+
+static const ez::PID& active_pid(ez::e_mode mode) {
+    switch (mode) {
+        case ez::SWING:
+            return chassis.swingPID;
+        case ez::TURN:
+        case ez::TURN_TO_POINT:
+            return chassis.turnPID;
+        case ez::POINT_TO_POINT:
+        case ez::PURE_PURSUIT:
+            return chassis.xyPID;
+        default:
+            return chassis.leftPID;
+    }
+}
+
+static void telemetry_sample(std::string& out) {
+    PoseSample pose = pose_latest();
+    FrameBuilder(TEL_POSE).put<float>(pose.x).put<float>(pose.y).put<float>(pose.t).finish(out);
+
+    // Next to odom, so slip shows up as the two drifting apart
+    EkfEstimate ekf = ekf_estimate_get();
+    FrameBuilder(TEL_EKF)
+        .put<float>(ekf.pose.x).put<float>(ekf.pose.y).put<float>(ekf.pose.theta).put<float>(ekf.velocity)
+        .put<float>(ekf.variance[0]).put<float>(ekf.variance[1]).put<float>(ekf.variance[2])
+        .put<uint16_t>(std::min<uint32_t>(ekf_iterate_us, UINT16_MAX))
+        .finish(out);
+
+    FrameBuilder(TEL_MOTORS)
+        .put<float>(motorgroup_L.get_voltage())
+        .put<float>(motorgroup_R.get_voltage())
+        .put<float>(motorgroup_L.get_actual_velocity())
+        .put<float>(motorgroup_R.get_actual_velocity())
+        .finish(out);
+
+    ez::e_mode mode = chassis.drive_mode_get();
+    const ez::PID& pid = active_pid(mode);
+    FrameBuilder(TEL_PID).put<uint8_t>(mode).put<float>(pid.error).put<float>(pid.output).finish(out);
+
+    telemetry_mutex.take();
+    for (const std::string& text : telemetry_events) FrameBuilder(TEL_EVENT).put(text).finish(out);
+    telemetry_events.clear();
+    uint16_t count = telemetry_path_points.size();
+    for (int i = 0; i < TELEMETRY_PATH_POINTS && telemetry_path_next < count; i++, telemetry_path_next++) {
+        const Coordinate& point = telemetry_path_points[telemetry_path_next];
+        FrameBuilder(TEL_PATH).put<uint16_t>(telemetry_path_next).put<uint16_t>(count)
+            .put<float>(point.x).put<float>(point.y).put<float>(point.t).finish(out);
+    }
+    telemetry_mutex.give();
+}
+
+// The serial link is either raw telemetry or the PROS terminal, never both
+static void streaming_set(bool streaming) {
+    pros::c::serctl(streaming ? SERCTL_DISABLE_COBS : SERCTL_ENABLE_COBS, NULL);
+    pros::c::fdctl(STDOUT_FILENO, streaming ? SERCTL_NOBLKWRITE : SERCTL_BLKWRITE, NULL);
+}
+
+void telemetry_task() {
+    std::string out;
+    bool streaming = false;
+    uint32_t now = pros::millis();
+    while (true) {
+        bool wanted = config_get(CFG_TELEMETRY) != 0 && !pros::competition::is_connected();
+        if (wanted != streaming) {
+            streaming = wanted;
+            streaming_set(streaming);
+        }
+        if (streaming) {
+            // Starts with a 0 too, so text printed since the last batch is its own chunk
+            out.assign(1, '\0');
+            telemetry_sample(out);
+            fwrite(out.data(), 1, out.size(), stdout);
+            fflush(stdout);
+        }
+        pros::Task::delay_until(&now, TELEMETRY_PERIOD);
+    }
+}
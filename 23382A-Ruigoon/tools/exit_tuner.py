@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""Recommends exit conditions and chain constants from the robot's motion log.
+
+Copy /usd/motions.csv off the SD card after a few auton runs and run
+
+    python3 tools/exit_tuner.py motions.csv --turn-tol 2 --drive-tol 0.75
+
+Tolerances are the accuracy each motion type has to finish within. For every motion type the
+tool looks at how long motions sat inside small_error before EZ let them go, how far they
+overshot and how close they really finished, and prints the config fields to set in the
+brain's config editor (long press the logo) and save. The names are the editor's, from
+include/config.hpp.
+"""
+
+import argparse
+import csv
+import math
+from collections import defaultdict
+
+TICK = 10  # ms, ez::util::DELAY_TIME
+STEP = 0.25  # deg or in, how the editor steps errors and chain constants
+
+# Motion modes grouped by the setter that owns their exit conditions
+GROUPS = {
+    "turn": ("turn", "turn_to_point"),
+    "swing": ("swing",),
+    "drive": ("drive",),
+    "odom_drive": ("point_to_point", "pure_pursuit"),
+}
+UNITS = {"turn": "deg", "swing": "deg", "drive": "in", "odom_drive": "in"}
+FIELDS = {"turn": "turn", "swing": "swing", "drive": "drive", "odom_drive": "odom drive"}  # config field prefixes
+HAS_CHAIN = ("turn", "swing", "drive")
+
+
+def field(name, value, current=None):
+    changed = current is not None and not math.isclose(value, current)
+    print(f"   {name:<24} {value:g}" + (f"  (was {current:g})" if changed else ""))
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    index = (len(values) - 1) * p / 100
+    low = math.floor(index)
+    high = math.ceil(index)
+    return values[low] + (values[high] - values[low]) * (index - low)
+
+
+def round_tick(ms):
+    return int(math.ceil(ms / TICK) * TICK)
+
+
+def load(path, run):
+    groups = defaultdict(list)
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            if run and row["run"] != run:
+                continue
+            for group, modes in GROUPS.items():
+                if row["mode"] in modes:
+                    for key in ("duration", "time_to_small", "small_exit_time", "big_exit_time", "velocity_exit_time", "mA_timeout"):
+                        row[key] = int(row[key])
+                    for key in ("start_error", "final_error", "overshoot", "small_error", "big_error"):
+                        row[key] = float(row[key])
+                    groups[group].append(row)
+    return groups
+
+
+def recommend(group, rows, tolerance):
+    current = rows[-1]
+    waited = [r for r in rows if r["reason"] != "chain"]
+    settled = [r for r in waited if r["time_to_small"] >= 0]
+    reasons = defaultdict(int)
+    for r in rows:
+        reasons[r["reason"]] += 1
+
+    print(f"== {group}: {len(rows)} motions, " + ", ".join(f"{n} {k}" for k, n in sorted(reasons.items())))
+    if not waited:
+        print("   only chained motions, nothing to recommend\n")
+        return
+
+    final = [abs(r["final_error"]) for r in waited]
+    overshoot = [r["overshoot"] for r in waited]
+    print(f"   final error p50 {percentile(final, 50):.2f} p95 {percentile(final, 95):.2f} {UNITS[group]},"
+          f" overshoot p50 {percentile(overshoot, 50):.2f} p95 {percentile(overshoot, 95):.2f} {UNITS[group]}")
+
+    # Small error tightens to the tolerance, and only opens up to it if motions really do finish inside it
+    small_error = current["small_error"]
+    if tolerance < small_error or percentile(final, 95) <= tolerance:
+        small_error = tolerance
+
+    # Time past the small exit dwell is spent bouncing back out of the band. Motions that stay put once
+    # they're in only need a few ticks to prove it
+    extra = [max(0, r["duration"] - r["time_to_small"] - r["small_exit_time"]) for r in settled]
+    small_exit_time = min(current["small_exit_time"], max(3 * TICK, round_tick(percentile(extra, 90) + 3 * TICK)))
+
+    # Big exit is the fallback for motions that stall just outside small_error
+    big = [r for r in waited if r["reason"] == "big"]
+    big_error = current["big_error"]
+    if any(abs(r["final_error"]) > tolerance for r in big):
+        big_error = max(small_error, min(big_error, tolerance * 1.5))
+    big_exit_time = max(small_exit_time * 2, min(current["big_exit_time"], round_tick(percentile([r["duration"] - r["time_to_small"] for r in settled], 75))))
+
+    for r in rows:
+        if r["reason"] in ("velocity", "mA"):
+            print(f"   {r['run']} #{r['index']} ended on {r['reason']} after {r['duration']} ms, final error {r['final_error']:.2f}")
+
+    saved = sum(max(0, r["small_exit_time"] - small_exit_time) for r in waited if r["reason"] == "small")
+    print(f"   saves about {saved} ms over these {len(waited)} waited motions")
+    # Onto the editor's steps, small error rounding down so it stays inside the tolerance
+    small_error = max(STEP, math.floor(small_error / STEP) * STEP)
+    big_error = max(small_error, round(big_error / STEP) * STEP)
+    prefix, unit = FIELDS[group], UNITS[group]
+    field(f"{prefix} small ms", small_exit_time, current["small_exit_time"])
+    field(f"{prefix} small {unit}", small_error, current["small_error"])
+    field(f"{prefix} big ms", big_exit_time, current["big_exit_time"])
+    field(f"{prefix} big {unit}", big_error, current["big_error"])
+
+    # A chained motion lets go at the chain constant and coasts about as far as a full motion overshoots.
+    # The log doesn't keep the chain constant, so there's nothing to compare it to
+    if group in HAS_CHAIN:
+        chain = min(max(small_error, percentile(overshoot, 75) + small_error), tolerance * 3)
+        field(f"{prefix} chain {unit}", max(STEP, round(chain / STEP) * STEP))
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log", help="motions.csv from the SD card")
+    parser.add_argument("--run", help="only use motions from this auton")
+    parser.add_argument("--turn-tol", type=float, default=3, help="degrees")
+    parser.add_argument("--swing-tol", type=float, default=3, help="degrees")
+    parser.add_argument("--drive-tol", type=float, default=1, help="inches")
+    args = parser.parse_args()
+
+    tolerances = {"turn": args.turn_tol, "swing": args.swing_tol, "drive": args.drive_tol, "odom_drive": args.drive_tol}
+    groups = load(args.log, args.run)
+    if not groups:
+        print("no motions in log")
+    for group in GROUPS:
+        if group in groups:
+            recommend(group, groups[group], tolerances[group])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""Packs images into the compressed format decoded by src/imgcache.cpp.
+
+Takes either an LVGL image converter .c file (the LV_COLOR_DEPTH == 32 block is used) or a PNG
+(needs Pillow) and writes a .c file with the same symbol, small enough to upload quickly:
+
+    python3 tools/img_pack.py src/pics/matchField.c
+    python3 tools/img_pack.py field.png --name matchField -o src/pics/matchField.c
+
+Images with 256 colours or fewer are stored as palette indices, anything else as RGBA pixels.
+Both are run length encoded, so the large flat areas of the field images cost almost nothing.
+The packing is lossless.
+
+Layout, little endian:
+    "RIMG"  u8 version  u8 flags (1 = palette)  u16 palette count  u16 width  u16 height
+    palette: count x RGBA
+    runs: control byte c, c < 128 is a literal of c + 1 units, otherwise a run of c - 125
+          copies of the next unit. A unit is one index, or four RGBA bytes without a palette
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+MAGIC = b"RIMG"
+VERSION = 1
+FLAG_PALETTE = 1
+MIN_RUN = 3
+MAX_RUN = 130
+MAX_LITERAL = 128
+
+
+def read_lvgl_c(path):
+    """Returns (name, width, height, RGBA bytes) from an LVGL converter file."""
+    text = open(path).read()
+    block = re.search(r"#if LV_COLOR_DEPTH == 32(.*?)#endif", text, re.S)
+    if not block:
+        sys.exit(f"{path}: no LV_COLOR_DEPTH == 32 block, was it packed already?")
+    name = re.search(r"const lv_img_dsc_t (\w+)", text).group(1)
+    width = int(re.search(r"\.header\.w = (\d+)", text).group(1))
+    height = int(re.search(r"\.header\.h = (\d+)", text).group(1))
+    data = bytes(int(b, 16) for b in re.findall(r"0x([0-9a-fA-F]{2})", block.group(1)))
+    # Some headers were cropped by hand, only the rows that get drawn are kept
+    data = data[: width * height * 4]
+    if len(data) != width * height * 4:
+        sys.exit(f"{path}: {len(data)} bytes of pixels for a {width}x{height} image")
+    rgba = bytearray(len(data))
+    rgba[0::4], rgba[1::4], rgba[2::4], rgba[3::4] = data[2::4], data[1::4], data[0::4], data[3::4]
+    return name, width, height, bytes(rgba)
+
+
+def read_packed_c(path):
+    """Returns (name, width, height, RGBA bytes) from a file this tool wrote."""
+    text = open(path).read()
+    name = re.search(r"const lv_img_dsc_t (\w+)", text).group(1)
+    data = bytes(int(b, 16) for b in re.findall(r"0x([0-9a-fA-F]{2})", text))
+    magic, version, flags, colours, width, height = struct.unpack_from("<4sBBHHH", data)
+    if magic != MAGIC or version != VERSION:
+        sys.exit(f"{path}: not a packed image")
+    unit = 1 if flags & FLAG_PALETTE else 4
+    i = 12 + colours * 4
+    palette = [data[12 + c * 4 : 16 + c * 4] for c in range(colours)]
+    units = []
+    while i < len(data):
+        control = data[i]
+        i += 1
+        if control < 128:
+            units += [data[i + k * unit : i + (k + 1) * unit] for k in range(control + 1)]
+            i += (control + 1) * unit
+        else:
+            units += [data[i : i + unit]] * (control - 125)
+            i += unit
+    if unit == 1:
+        units = [palette[u[0]] for u in units]
+    return name, width, height, b"".join(units)
+
+
+def read_image(path):
+    """Any of an LVGL converter file, a packed file or a PNG, as (name, width, height, RGBA bytes)."""
+    if not path.endswith(".c"):
+        width, height, rgba = read_png(path)
+        return None, width, height, rgba
+    if "#if LV_COLOR_DEPTH == 32" in open(path).read():
+        return read_lvgl_c(path)
+    return read_packed_c(path)
+
+
+def read_png(path):
+    from PIL import Image
+
+    image = Image.open(path).convert("RGBA")
+    return image.width, image.height, image.tobytes()
+
+
+def rle(units):
+    """PackBits style runs over a list of equal sized byte strings."""
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            for unit in chunk:
+                out.extend(unit)
+
+    i = 0
+    while i < len(units):
+        run = 1
+        while i + run < len(units) and run < MAX_RUN and units[i + run] == units[i]:
+            run += 1
+        if run >= MIN_RUN:
+            flush()
+            out.append(run + 125)
+            out += units[i]
+        else:
+            literal.extend(units[i : i + run])
+        i += run
+    flush()
+    return bytes(out)
+
+
+def pack(width, height, rgba):
+    pixels = [rgba[i : i + 4] for i in range(0, len(rgba), 4)]
+    colours = sorted(set(pixels))
+    if len(colours) <= 256:
+        index = {c: bytes([i]) for i, c in enumerate(colours)}
+        header = struct.pack("<4sBBHHH", MAGIC, VERSION, FLAG_PALETTE, len(colours), width, height)
+        return header + b"".join(colours) + rle([index[p] for p in pixels]), len(colours)
+    header = struct.pack("<4sBBHHH", MAGIC, VERSION, 0, 0, width, height)
+    return header + rle(pixels), len(colours)
+
+
+def write_c(path, name, width, height, packed, colours):
+    attribute = "LV_ATTRIBUTE_IMG_" + name.upper()
+    rows = [", ".join(f"0x{b:02x}" for b in packed[i : i + 32]) for i in range(0, len(packed), 32)]
+    palette = f"{colours} colours, palette" if colours <= 256 else f"{colours} colours, RGBA"
+    with open(path, "w") as out:
+        out.write(f"""#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "liblvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef {attribute}
+#define {attribute}
+#endif
+
+/* Packed by tools/img_pack.py: {width}x{height}, {palette}, {width * height * 4} bytes unpacked.
+ * Decoded on demand by imgcache.cpp */
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST {attribute} uint8_t {name}_map[] = {{
+""")
+        for row in rows:
+            out.write(f"  {row},\n")
+        out.write(f"""}};
+
+const lv_img_dsc_t {name} = {{
+  .header.cf = LV_IMG_CF_RAW_ALPHA,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = {width},
+  .header.h = {height},
+  .data_size = {len(packed)},
+  .data = {name}_map,
+}};
+""")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="LVGL converter .c file or PNG")
+    parser.add_argument("--name", help="symbol name, required for PNGs")
+    parser.add_argument("-o", "--output", help="defaults to overwriting the input .c file")
+    args = parser.parse_args()
+
+    if args.input.endswith(".c"):
+        name, width, height, rgba = read_lvgl_c(args.input)
+    else:
+        if not args.name:
+            sys.exit("--name is required for PNGs")
+        width, height, rgba = read_png(args.input)
+    name = args.name or name
+    output = args.output or (args.input if args.input.endswith(".c") else f"{name}.c")
+
+    packed, colours = pack(width, height, rgba)
+    write_c(output, name, width, height, packed, colours)
+    print(f"{name}: {width}x{height}, {colours} colours, {width * height * 4} -> {len(packed)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""Pre-renders the robot sprite at fixed heading steps for the path viewer.
+
+The Makefile runs this whenever the sprite changes:
+
+    python3 tools/sprite_atlas.py src/pics/pfp2145.c -o src/pics/robotAtlas.c
+
+Every frame is a square big enough to hold the sprite at any angle, with the sprite's centre in
+the middle, rotated clockwise by frame * 360 / frames degrees to match the robot's heading. The
+frames are stacked top to bottom in one packed image, so the viewer picks the nearest one with an
+image offset and LVGL draws it as a plain copy instead of a rotated blit.
+"""
+
+import argparse
+import math
+
+import img_pack
+
+
+def sample(rgba, width, height, x, y):
+    """Bilinear sample at pixel coordinates (x, y), premultiplied so edges don't pick up fringes."""
+    x -= 0.5
+    y -= 0.5
+    x0, y0 = math.floor(x), math.floor(y)
+    fx, fy = x - x0, y - y0
+    total = [0.0, 0.0, 0.0, 0.0]
+    for dx, dy, weight in ((0, 0, (1 - fx) * (1 - fy)), (1, 0, fx * (1 - fy)), (0, 1, (1 - fx) * fy), (1, 1, fx * fy)):
+        px, py = x0 + dx, y0 + dy
+        if weight == 0 or not (0 <= px < width and 0 <= py < height):
+            continue
+        i = (py * width + px) * 4
+        alpha = rgba[i + 3] / 255 * weight
+        for c in range(3):
+            total[c] += rgba[i + c] * alpha
+        total[3] += alpha
+    if total[3] <= 0:
+        return b"\x00\x00\x00\x00"
+    return bytes([round(total[c] / total[3]) for c in range(3)] + [round(total[3] * 255)])
+
+
+def render(rgba, width, height, size, degrees):
+    """One size x size frame with the sprite rotated clockwise about its centre."""
+    angle = math.radians(degrees)
+    cos, sin = math.cos(angle), math.sin(angle)
+    frame = bytearray()
+    for v in range(size):
+        for u in range(size):
+            # Screen y points down, so this is the inverse of a clockwise rotation
+            dx, dy = u + 0.5 - size / 2, v + 0.5 - size / 2
+            x = dx * cos + dy * sin + width / 2
+            y = -dx * sin + dy * cos + height / 2
+            frame += sample(rgba, width, height, x, y)
+    return bytes(frame)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("sprite", help="robot sprite, any image img_pack.py reads")
+    parser.add_argument("-o", "--output", default="src/pics/robotAtlas.c")
+    parser.add_argument("--name", default="robotAtlas")
+    parser.add_argument("--frames", type=int, default=24, help="heading steps, 24 is every 15 degrees")
+    args = parser.parse_args()
+
+    _, width, height, rgba = img_pack.read_image(args.sprite)
+    size = math.ceil(math.hypot(width, height))
+    size += size % 2  # even, so the centre lands on a whole pixel when it's positioned
+    frames = [render(rgba, width, height, size, i * 360 / args.frames) for i in range(args.frames)]
+
+    packed, colours = img_pack.pack(size, size * args.frames, b"".join(frames))
+    img_pack.write_c(args.output, args.name, size, size * args.frames, packed, colours)
+    print(f"{args.name}: {args.frames} frames of {size}x{size}, {len(packed)} bytes packed")
+
+
+if __name__ == "__main__":
+    main()
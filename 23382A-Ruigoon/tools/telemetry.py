@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+"""Decodes and records the robot's binary telemetry stream (src/telemetry.cpp).
+
+The robot only streams with "telemetry on" set to 1 in the brain's config editor, and never on a
+competition switch; the rest of the time the link is the normal PROS terminal. Plug the brain in
+over USB and point the tool at its user port:
+
+    python3 tools/telemetry.py /dev/ttyACM1
+    python3 tools/telemetry.py /dev/ttyACM1 --record run.jsonl --quiet
+    python3 tools/telemetry.py run.bin          # a raw capture, decoded offline
+
+Frames are printed one per line, or written one JSON object per line with --record. Anything the
+robot printed as text is shown as-is. Dropped and corrupt frames are counted from the sequence
+numbers and CRCs, and summarised on exit.
+
+    python3 tools/telemetry.py --loopback
+
+runs the decoder against frames written into a local pseudo-terminal, to check the tool without
+a robot.
+
+Frame, little endian, COBS encoded and ended by a 0 byte:
+    u8 channel  u16 sequence  u32 time ms  body  u16 CRC-16/CCITT (0xffff start) of the rest
+"""
+
+import argparse
+import json
+import os
+import struct
+import sys
+import termios
+import threading
+import tty
+
+HEADER = struct.Struct("<BHI")
+CHANNELS = {
+    1: ("pose", "<fff", ("x", "y", "theta")),
+    2: ("motors", "<ffff", ("left_mv", "right_mv", "left_rpm", "right_rpm")),
+    3: ("pid", "<Bff", ("mode", "error", "output")),
+    4: ("event", None, ("text",)),
+    5: ("path", "<HHfff", ("index", "count", "x", "y", "theta")),
+    6: ("ekf", "<fffffffH", ("x", "y", "theta", "velocity", "var_x", "var_y", "var_theta", "tick_us")),
+}
+# ez::e_mode
+MODES = ["disable", "swing", "turn", "turn_to_point", "drive", "point_to_point", "pure_pursuit"]
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code_at, code = 0, 1
+    for byte in data:
+        if byte:
+            out.append(byte)
+            code += 1
+        if not byte or code == 0xFF:
+            out[code_at] = code
+            code_at, code = len(out), 1
+            out.append(0)
+    out[code_at] = code
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data) + (0 if code == 1 else 0):
+            return None
+        block = data[i + 1:i + code]
+        if len(block) != code - 1 or 0 in block:
+            return None
+        out += block
+        i += code
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def encode_frame(channel, sequence, time, body):
+    data = HEADER.pack(channel, sequence, time) + body
+    return cobs_encode(data + struct.pack("<H", crc16(data))) + b"\0"
+
+
+def decode_frame(chunk):
+    """Returns the frame as a dict, or None if chunk isn't a valid frame."""
+    data = cobs_decode(chunk)
+    if data is None or len(data) < HEADER.size + 2:
+        return None
+    if crc16(data[:-2]) != struct.unpack_from("<H", data, len(data) - 2)[0]:
+        return None
+    channel, sequence, time = HEADER.unpack_from(data)
+    if channel not in CHANNELS:
+        return None
+    name, layout, fields = CHANNELS[channel]
+    body = data[HEADER.size:-2]
+    frame = {"channel": name, "seq": sequence, "time": time}
+    if layout is None:
+        frame["text"] = body.decode("utf-8", "replace")
+    else:
+        if len(body) != struct.calcsize(layout):
+            return None
+        frame.update(zip(fields, struct.unpack(layout, body)))
+    if name == "pid" and frame["mode"] < len(MODES):
+        frame["mode"] = MODES[frame["mode"]]
+    return frame
+
+
+class Decoder:
+    """Splits a byte stream on 0 bytes and keeps count of what it found."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.last_seq = None
+        self.frames = self.dropped = self.corrupt = 0
+
+    def feed(self, data):
+        """Yields frames as dicts and stray text as str."""
+        self.buffer += data
+        while True:
+            end = self.buffer.find(0)
+            if end < 0:
+                return
+            chunk = bytes(self.buffer[:end])
+            del self.buffer[:end + 1]
+            if not chunk:
+                continue
+            frame = decode_frame(chunk)
+            if frame is None:
+                text = chunk.decode("ascii", "replace")
+                if all(c.isprintable() or c in "\r\n\t" for c in text):
+                    yield text
+                else:
+                    self.corrupt += 1
+                continue
+            if self.last_seq is not None:
+                self.dropped += (frame["seq"] - self.last_seq - 1) & 0xFFFF
+            self.last_seq = frame["seq"]
+            self.frames += 1
+            yield frame
+
+    def summary(self):
+        return f"{self.frames} frames, {self.dropped} dropped, {self.corrupt} corrupt"
+
+
+def format_frame(frame):
+    values = " ".join(f"{k}={v:.2f}" if isinstance(v, float) else f"{k}={v}"
+                      for k, v in frame.items() if k not in ("channel", "seq", "time"))
+    return f"{frame['time']:>8} {frame['seq']:>5} {frame['channel']:<6} {values}"
+
+
+def open_port(path):
+    fd = os.open(path, os.O_RDONLY | os.O_NOCTTY)
+    if os.isatty(fd):
+        tty.setraw(fd)
+        attrs = termios.tcgetattr(fd)
+        attrs[4] = attrs[5] = termios.B115200
+        termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    return fd
+
+
+def run(fd, decoder, record=None, quiet=False, limit=None):
+    count = 0
+    while limit is None or count < limit:
+        data = os.read(fd, 4096)
+        if not data:
+            break
+        for item in decoder.feed(data):
+            if isinstance(item, str):
+                if not quiet:
+                    print(item.rstrip("\r\n"))
+                continue
+            count += 1
+            if record:
+                record.write(json.dumps(item) + "\n")
+            if not quiet:
+                print(format_frame(item))
+
+
+def loopback():
+    """Writes known frames, a text line and a corrupt frame into a pty and decodes them back."""
+    main_fd, peer_fd = os.openpty()
+    tty.setraw(peer_fd)
+    frames = [
+        encode_frame(1, 0, 20, struct.pack("<fff", 12.5, -3.0, 90.0)),
+        encode_frame(2, 1, 20, struct.pack("<ffff", 6000, 5800, 210, 205)),
+        encode_frame(3, 2, 20, struct.pack("<Bff", 4, 1.5, 42.0)),
+        b"hello from the brain\n\0",  # text between batches, the next batch starts with a 0
+        encode_frame(4, 3, 40, b"auton start skills"),
+        encode_frame(1, 5, 60, struct.pack("<fff", 0, 0, 0)),  # sequence 4 lost
+    ]
+    corrupt = bytearray(encode_frame(1, 6, 80, struct.pack("<fff", 1, 2, 3)))
+    corrupt[3] ^= 0x40
+    frames += [bytes(corrupt), encode_frame(5, 7, 80, struct.pack("<HHfff", 0, 1, 24, 48, 180)),
+               encode_frame(6, 8, 80, struct.pack("<fffffffH", 12.0, -3.5, 90.0, 20.0, 0.5, 0.5, 0.01, 180))]
+    # Written byte by byte so frames straddle reads
+    writer = threading.Thread(target=lambda: [os.write(main_fd, bytes([b])) for b in b"".join(frames)])
+    writer.start()
+
+    decoder = Decoder()
+    got, text = [], []
+    while len(got) < 7:
+        for item in decoder.feed(os.read(peer_fd, 64)):
+            (text if isinstance(item, str) else got).append(item)
+    writer.join()
+    os.close(main_fd)
+    os.close(peer_fd)
+
+    expected = ["pose", "motors", "pid", "event", "pose", "path", "ekf"]
+    checks = [
+        ([f["channel"] for f in got] == expected, "channels in order"),
+        (got[0]["x"] == 12.5 and got[0]["theta"] == 90.0, "pose values"),
+        (got[2]["mode"] == "drive", "PID mode name"),
+        (got[3]["text"] == "auton start skills", "event text"),
+        (got[6]["velocity"] == 20.0 and got[6]["tick_us"] == 180, "EKF values"),
+        (text == ["hello from the brain\n"], "text passed through"),
+        (decoder.dropped == 2 and decoder.corrupt == 1, "dropped and corrupt counts"),
+    ]
+    for ok, name in checks:
+        print(("ok    " if ok else "FAIL  ") + name)
+    print(decoder.summary())
+    return all(ok for ok, _ in checks)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("port", nargs="?", help="serial port, pty or raw capture file")
+    parser.add_argument("--record", help="write every frame to this file as JSON lines")
+    parser.add_argument("--quiet", action="store_true", help="don't print frames")
+    parser.add_argument("--loopback", action="store_true", help="check the decoder against a local pty")
+    args = parser.parse_args()
+
+    if args.loopback:
+        sys.exit(0 if loopback() else 1)
+    if not args.port:
+        parser.error("a port is needed unless --loopback is given")
+
+    decoder = Decoder()
+    record = open(args.record, "w") if args.record else None
+    fd = open_port(args.port)
+    try:
+        run(fd, decoder, record, args.quiet)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        os.close(fd)
+        if record:
+            record.close()
+        print(decoder.summary(), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()